@@ -0,0 +1,140 @@
+#include "AssetFile.h"
+#include "Common/Checksum.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SupergodCore { namespace Assets
+{
+	AssetFile::AssetFile()
+		: data(nullptr), size(0), mapping(nullptr)
+	{
+	}
+
+	AssetFile::~AssetFile()
+	{
+		Close();
+	}
+
+	bool AssetFile::Open(const char* path)
+	{
+		Close();
+
+		#ifdef _WIN32
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		// Empty files can't be mapped, and are too small anyway. The mapping keeps the file open, so its handle can be closed right away.
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= (long long)sizeof(FileHeader) && (unsigned long long)fileSize.QuadPart <= (size_t)-1)
+		{
+			mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping != nullptr)
+			{
+				data = static_cast<const byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+				size = (size_t)fileSize.QuadPart;
+			}
+		}
+		CloseHandle(file);
+		#else
+		int file = open(path, O_RDONLY);
+		if (file < 0)
+			return false;
+
+		struct stat status;
+		if (fstat(file, &status) == 0 && status.st_size >= (off_t)sizeof(FileHeader))
+		{
+			void* view = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+			if (view != MAP_FAILED)
+			{
+				data = static_cast<const byte*>(view);
+				size = (size_t)status.st_size;
+			}
+		}
+		close(file);
+		#endif
+
+		if (data != nullptr && IsValid())
+			return true;
+
+		Close();
+		return false;
+	}
+
+	void AssetFile::Close()
+	{
+		#ifdef _WIN32
+		if (data != nullptr)
+			UnmapViewOfFile(data);
+		if (mapping != nullptr)
+			CloseHandle(mapping);
+		#else
+		if (data != nullptr)
+			munmap(const_cast<byte*>(data), size);
+		#endif
+
+		data = nullptr;
+		size = 0;
+		mapping = nullptr;
+	}
+
+	const ChunkEntry* AssetFile::FindChunk(uint id) const
+	{
+		const ChunkEntry* chunks = Chunks();
+		for (uint i = 0; i < ChunkCount(); i++)
+		{
+			if (chunks[i].id == id)
+				return &chunks[i];
+		}
+		return nullptr;
+	}
+
+	bool AssetFile::VerifyChunk(const ChunkEntry& chunk) const
+	{
+		return Checksum::Crc32C(ChunkData(chunk), (size_t)(chunk.count * chunk.elementSize)) == chunk.checksum;
+	}
+
+	bool AssetFile::Verify() const
+	{
+		const ChunkEntry* chunks = Chunks();
+		for (uint i = 0; i < ChunkCount(); i++)
+		{
+			if (!VerifyChunk(chunks[i]))
+				return false;
+		}
+		return true;
+	}
+
+	bool AssetFile::IsValid() const
+	{
+		const FileHeader& header = Header();
+		if (header.magic != AssetFormat::MAGIC || header.byteOrderMark != AssetFormat::BYTE_ORDER_MARK ||
+			header.version == 0 || header.version > AssetFormat::VERSION || header.fileSize != size)
+			return false;
+
+		// The sizes are checked by dividing, so huge values from a corrupt file can't overflow into looking valid.
+		unsigned long long tableSize = (unsigned long long)header.chunkCount * sizeof(ChunkEntry);
+		if (header.tableOffset % AssetFormat::ALIGNMENT != 0 || header.tableOffset < sizeof(FileHeader) || header.tableOffset > size || tableSize > size - header.tableOffset ||
+			Checksum::Crc32C(data + header.tableOffset, (size_t)tableSize) != header.tableChecksum)
+			return false;
+
+		const ChunkEntry* chunks = Chunks();
+		for (uint i = 0; i < header.chunkCount; i++)
+		{
+			const ChunkEntry& chunk = chunks[i];
+			if (chunk.offset % AssetFormat::ALIGNMENT != 0 || chunk.offset < sizeof(FileHeader) || chunk.offset > header.tableOffset || chunk.elementSize == 0 ||
+				chunk.count > (header.tableOffset - chunk.offset) / chunk.elementSize)
+				return false;
+		}
+		return true;
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include "Common/CommonDefines.h"
+#include "AssetFormat.h"
+
+namespace SupergodCore { namespace Assets
+{
+	/// <summary>
+	/// A read only view of count elements somewhere else, like in a mapped file. Empty views have no data.
+	/// </summary>
+	template<class T>
+	struct ArrayView final
+	{
+		const T* data;
+		size_t count;
+
+		constexpr ArrayView()
+			: data(nullptr), count(0)
+		{
+		}
+
+		constexpr ArrayView(const T* data, size_t count)
+			: data(data), count(count)
+		{
+		}
+
+		inline constexpr bool IsEmpty() const { return count == 0; }
+		inline constexpr const T& operator[](size_t index) const { return data[index]; }
+		inline constexpr const T* begin() const { return data; }
+		inline constexpr const T* end() const { return data + count; }
+	};
+
+	/// <summary>
+	/// An asset file (see AssetFormat) mapped into memory and used in place: opening it only reads the header and the table of the chunks, and the pages of the data are read by the OS when they are first used.<para/>
+	/// The views point into the mapping, so they are valid until the file is closed.
+	/// </summary>
+	class SUPERGOD_API_CLASS AssetFile final
+	{
+	public:
+		AssetFile();
+		AssetFile(const AssetFile&) = delete;
+		AssetFile& operator=(const AssetFile&) = delete;
+
+		/// <summary>
+		/// Closes the file if it is open.
+		/// </summary>
+		~AssetFile();
+
+		/// <summary>
+		/// Maps the file at path, and returns false if it can't be mapped or isn't a valid asset file: of a newer version or byte order, with a corrupt table, or with chunks out of the file or not aligned.<para/>
+		/// The data of the chunks isn't checked, since that would read all of it. Call Verify for that.
+		/// </summary>
+		bool Open(const char* path);
+
+		/// <summary>
+		/// Unmaps the file. Views of it are invalid after this.
+		/// </summary>
+		void Close();
+
+		inline bool IsOpen() const { return data != nullptr; }
+		inline const FileHeader& Header() const { return *reinterpret_cast<const FileHeader*>(data); }
+		inline const ChunkEntry* Chunks() const { return reinterpret_cast<const ChunkEntry*>(data + Header().tableOffset); }
+		inline uint ChunkCount() const { return Header().chunkCount; }
+
+		/// <summary>
+		/// Gets the first chunk with id, or null if there is none.
+		/// </summary>
+		const ChunkEntry* FindChunk(uint id) const;
+
+		/// <summary>
+		/// Gets the data of chunk, which must be in this file.
+		/// </summary>
+		inline const void* ChunkData(const ChunkEntry& chunk) const { return data + chunk.offset; }
+
+		/// <summary>
+		/// Checks the data of chunk against its checksum.
+		/// </summary>
+		bool VerifyChunk(const ChunkEntry& chunk) const;
+
+		/// <summary>
+		/// Checks the data of every chunk against its checksum, which reads the whole file.
+		/// </summary>
+		bool Verify() const;
+
+		/// <summary>
+		/// Gets the elements of the first chunk with id in place, or an empty view if there is no such chunk or its elements aren't of type T.
+		/// </summary>
+		template<class T>
+		ArrayView<T> View(uint id) const
+		{
+			const ChunkEntry* chunk = FindChunk(id);
+			if (chunk == nullptr || chunk->type != ElementTypeOf<T>::VALUE || chunk->elementSize != sizeof(T))
+				return ArrayView<T>();
+
+			return ArrayView<T>(static_cast<const T*>(ChunkData(*chunk)), (size_t)chunk->count);
+		}
+
+	private:
+		/// <summary>
+		/// Checks the header and the table of the chunks after mapping.
+		/// </summary>
+		bool IsValid() const;
+
+		const byte* data;
+		size_t size;
+
+		/// <summary>
+		/// The file mapping object on Windows, which is closed with the view.
+		/// </summary>
+		void* mapping;
+	};
+} }
\ No newline at end of file
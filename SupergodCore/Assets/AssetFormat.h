@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vectors.h"
+#include "Math/Matrices/Matrices.h"
+#include "Math/Colors/FColor.h"
+#include "Math/Quaternion.h"
+
+namespace SupergodCore { namespace Assets
+{
+	/// <summary>
+	/// The type of the elements of a chunk, so views of the wrong type can be refused.
+	/// </summary>
+	enum class ElementType : uint
+	{
+		/// <summary>
+		/// Raw bytes, for anything without a type of its own.
+		/// </summary>
+		Byte = 1,
+		Float,
+		Int,
+		Uint,
+		Vector2D,
+		Vector3D,
+		Vector4D,
+		Quaternion,
+		Matrix2x2,
+		Matrix3x3,
+		FColor
+	};
+
+	/// <summary>
+	/// The ElementType of the C++ type T, in VALUE. Only types that are copied as they are (and so can be used in place from a mapped file) have one.
+	/// </summary>
+	template<class T>
+	struct ElementTypeOf;
+
+	#define SUPERGOD_ASSET_ELEMENT_TYPE(type, elementType) \
+		template<> \
+		struct ElementTypeOf<type> \
+		{ \
+			static_assert(std::is_trivially_copyable<type>::value, #type " must be trivially copyable to be used from a mapped file."); \
+			static constexpr ElementType VALUE = ElementType::elementType; \
+		};
+
+	SUPERGOD_ASSET_ELEMENT_TYPE(byte, Byte)
+	SUPERGOD_ASSET_ELEMENT_TYPE(float, Float)
+	SUPERGOD_ASSET_ELEMENT_TYPE(int, Int)
+	SUPERGOD_ASSET_ELEMENT_TYPE(uint, Uint)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::Vector2D, Vector2D)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::Vector3D, Vector3D)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::Vector4D, Vector4D)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::Quaternion, Quaternion)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::Matrix2x2, Matrix2x2)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::Matrix3x3, Matrix3x3)
+	SUPERGOD_ASSET_ELEMENT_TYPE(Math::FColor, FColor)
+	#undef SUPERGOD_ASSET_ELEMENT_TYPE
+
+	/// <summary>
+	/// Makes the id of a chunk from a name of four characters, like ChunkId("POSI").
+	/// </summary>
+	inline constexpr uint ChunkId(const char(&name)[5])
+	{
+		return (uint)(byte)name[0] | (uint)(byte)name[1] << 8 | (uint)(byte)name[2] << 16 | (uint)(byte)name[3] << 24;
+	}
+
+	/// <summary>
+	/// The layout of asset files, which AssetWriter writes and AssetFile reads in place:<para/>
+	/// The FileHeader, then the data of every chunk starting at a multiple of ALIGNMENT, then the table of the chunks (a ChunkEntry for every chunk) at the end, so the writer can stream the data before it knows all the chunks.<para/>
+	/// Everything is little-endian, which all the platforms the engine runs on are. BYTE_ORDER_MARK reads differently on big-endian machines, so they refuse the files instead of misreading them.
+	/// </summary>
+	namespace AssetFormat
+	{
+		/// <summary>
+		/// The first four bytes of every asset file, "SGAF".
+		/// </summary>
+		static constexpr uint MAGIC = ChunkId("SGAF");
+
+		/// <summary>
+		/// The version files are written with. Readers open files of this version and older.
+		/// </summary>
+		static constexpr ushort VERSION = 1;
+
+		static constexpr ushort BYTE_ORDER_MARK = 0xfeff;
+
+		/// <summary>
+		/// The alignment of the data of every chunk in the file. Mapped files start at a page, so the data is aligned the same in memory, enough for SSE loads.
+		/// </summary>
+		static constexpr uint ALIGNMENT = 16;
+	}
+
+	/// <summary>
+	/// The start of every asset file.
+	/// </summary>
+	struct FileHeader
+	{
+		uint magic;
+		ushort version;
+		ushort byteOrderMark;
+		uint chunkCount;
+
+		/// <summary>
+		/// The Crc32C of the table of the chunks, which has the checksums of the chunks themselves.
+		/// </summary>
+		uint tableChecksum;
+		unsigned long long tableOffset;
+		unsigned long long fileSize;
+	};
+
+	/// <summary>
+	/// Where a chunk is in an asset file and what is in it.
+	/// </summary>
+	struct ChunkEntry
+	{
+		uint id;
+		ElementType type;
+		uint elementSize;
+
+		/// <summary>
+		/// The Crc32C of the data of the chunk.
+		/// </summary>
+		uint checksum;
+		unsigned long long offset;
+		unsigned long long count;
+	};
+
+	static_assert(sizeof(FileHeader) == 32 && sizeof(ChunkEntry) == 32, "The file layout must not depend on padding.");
+} }
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "AssetWriter.h"
+#include "Common/Checksum.h"
+
+namespace SupergodCore { namespace Assets
+{
+	AssetWriter::AssetWriter()
+		: position(0), inChunk(false), failed(true)
+	{
+	}
+
+	AssetWriter::~AssetWriter()
+	{
+		if (file.is_open())
+			Close();
+	}
+
+	bool AssetWriter::Open(const char* path)
+	{
+		if (file.is_open())
+			return false;
+
+		file.open(path, std::ios::binary | std::ios::trunc);
+		chunks.clear();
+		position = 0;
+		inChunk = false;
+		failed = !file.is_open();
+
+		FileHeader header = {};
+		return WriteBytes(&header, sizeof(header));
+	}
+
+	bool AssetWriter::BeginChunk(uint id, ElementType type, uint elementSize)
+	{
+		if (inChunk || elementSize == 0)
+			failed = true;
+		if (!Pad())
+			return false;
+
+		ChunkEntry chunk = {};
+		chunk.id = id;
+		chunk.type = type;
+		chunk.elementSize = elementSize;
+		chunk.offset = position;
+		chunks.push_back(chunk);
+		inChunk = true;
+		return true;
+	}
+
+	bool AssetWriter::WriteElements(const void* elements, size_t count, ElementType type, uint elementSize)
+	{
+		if (!inChunk || chunks.back().type != type || chunks.back().elementSize != elementSize)
+			failed = true;
+		if (!WriteBytes(elements, count * elementSize))
+			return false;
+
+		chunks.back().count += count;
+		return true;
+	}
+
+	bool AssetWriter::EndChunk()
+	{
+		if (!inChunk)
+			failed = true;
+
+		inChunk = false;
+		return !failed;
+	}
+
+	bool AssetWriter::Close()
+	{
+		if (!file.is_open())
+			return false;
+		if (inChunk)
+			failed = true;
+		inChunk = false;
+
+		FileHeader header;
+		header.magic = AssetFormat::MAGIC;
+		header.version = AssetFormat::VERSION;
+		header.byteOrderMark = AssetFormat::BYTE_ORDER_MARK;
+		header.chunkCount = (uint)chunks.size();
+
+		// The table is aligned like the chunks so readers can use it in place too.
+		Pad();
+		header.tableOffset = position;
+		header.tableChecksum = Checksum::Crc32C(chunks.data(), chunks.size() * sizeof(ChunkEntry));
+		WriteBytes(chunks.data(), chunks.size() * sizeof(ChunkEntry));
+		header.fileSize = position;
+
+		if (!failed)
+		{
+			file.seekp(0);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.flush();
+			failed = !file;
+		}
+		file.close();
+		return !failed;
+	}
+
+	bool AssetWriter::Pad()
+	{
+		static const byte zeros[AssetFormat::ALIGNMENT] = {};
+		return WriteBytes(zeros, (size_t)(0 - position) & (AssetFormat::ALIGNMENT - 1));
+	}
+
+	bool AssetWriter::WriteBytes(const void* data, size_t size)
+	{
+		if (failed)
+			return false;
+
+		if (inChunk)
+			chunks.back().checksum = Checksum::Crc32C(data, size, chunks.back().checksum);
+		file.write(static_cast<const char*>(data), (std::streamsize)size);
+		position += size;
+		failed = !file;
+		return !failed;
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <fstream>
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "AssetFormat.h"
+
+namespace SupergodCore { namespace Assets
+{
+	/// <summary>
+	/// Writes asset files (see AssetFormat) chunk by chunk, straight to the file, so assets bigger than memory can be written in parts.<para/>
+	/// A chunk is written between BeginChunk and EndChunk with any number of calls to Write, and the file is only valid after Close.
+	/// Every function returns false once anything fails (or was called out of order), and the file should be thrown away.
+	/// </summary>
+	class AssetWriter final
+	{
+	public:
+		SUPERGOD_API_FUNC AssetWriter();
+		AssetWriter(const AssetWriter&) = delete;
+		AssetWriter& operator=(const AssetWriter&) = delete;
+
+		/// <summary>
+		/// Closes the file if it is still open.
+		/// </summary>
+		SUPERGOD_API_FUNC ~AssetWriter();
+
+		/// <summary>
+		/// Creates (or overwrites) the file at path and writes a header that Close fills in.
+		/// </summary>
+		SUPERGOD_API_FUNC bool Open(const char* path);
+
+		/// <summary>
+		/// Starts a chunk of elements of type, padding the file so its data starts at a multiple of AssetFormat::ALIGNMENT. Ids should be unique, otherwise readers find the first chunk with the id.
+		/// </summary>
+		SUPERGOD_API_FUNC bool BeginChunk(uint id, ElementType type, uint elementSize);
+
+		/// <summary>
+		/// Starts a chunk of elements of type T. See BeginChunk(uint, ElementType, uint).
+		/// </summary>
+		template<class T>
+		inline bool BeginChunk(uint id)
+		{
+			return BeginChunk(id, ElementTypeOf<T>::VALUE, sizeof(T));
+		}
+
+		/// <summary>
+		/// Adds count elements to the chunk that was started, which must be of type T.
+		/// </summary>
+		template<class T>
+		inline bool Write(const T* elements, size_t count)
+		{
+			return WriteElements(elements, count, ElementTypeOf<T>::VALUE, sizeof(T));
+		}
+
+		/// <summary>
+		/// Ends the chunk that was started.
+		/// </summary>
+		SUPERGOD_API_FUNC bool EndChunk();
+
+		/// <summary>
+		/// Writes a whole chunk of count elements.
+		/// </summary>
+		template<class T>
+		inline bool WriteChunk(uint id, const T* elements, size_t count)
+		{
+			return BeginChunk<T>(id) && Write(elements, count) && EndChunk();
+		}
+
+		/// <summary>
+		/// Writes the table of the chunks, fills in the header and closes the file. Returns whether everything was written.
+		/// </summary>
+		SUPERGOD_API_FUNC bool Close();
+
+	private:
+		/// <summary>
+		/// Adds count elements to the chunk that was started. Write calls it from the code that uses the writer, so it is exported even though it's private.
+		/// </summary>
+		SUPERGOD_API_FUNC bool WriteElements(const void* elements, size_t count, ElementType type, uint elementSize);
+
+		/// <summary>
+		/// Writes zeros up to the next multiple of AssetFormat::ALIGNMENT.
+		/// </summary>
+		bool Pad();
+
+		/// <summary>
+		/// Writes size bytes at the end of the file, and adds them to the checksum of the current chunk if there is one.
+		/// </summary>
+		bool WriteBytes(const void* data, size_t size);
+
+		std::ofstream file;
+		std::vector<ChunkEntry> chunks;
+		unsigned long long position;
+		bool inChunk;
+		bool failed;
+	};
+} }
\ No newline at end of file
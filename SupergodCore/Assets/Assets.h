@@ -0,0 +1,5 @@
+#pragma once
+
+#include "AssetFormat.h"
+#include "AssetWriter.h"
+#include "AssetFile.h"
\ No newline at end of file
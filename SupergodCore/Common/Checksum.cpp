@@ -0,0 +1,65 @@
+#include "Checksum.h"
+#include "CpuFeatures.h"
+#include <cstring>
+#include <immintrin.h>
+
+namespace SupergodCore
+{
+	/// <summary>
+	/// The CRC-32C polynomial, with its bits reversed.
+	/// </summary>
+	static constexpr uint CRC32C_POLYNOMIAL = 0x82f63b78;
+
+	/// <summary>
+	/// The CRC of every byte, for CPUs without SSE4.2.
+	/// </summary>
+	struct Crc32CTable
+	{
+		uint values[256];
+
+		Crc32CTable()
+		{
+			for (uint i = 0; i < 256; i++)
+			{
+				uint crc = i;
+				for (int bit = 0; bit < 8; bit++)
+					crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLYNOMIAL : 0);
+				values[i] = crc;
+			}
+		}
+	};
+
+	uint Checksum::Crc32C(const void* data, size_t size, uint previous)
+	{
+		const byte* bytes = static_cast<const byte*>(data);
+		uint crc = ~previous;
+		size_t i = 0;
+		if (CpuFeatures::HasSSE42())
+		{
+			// 32-bit builds don't have the 64-bit instruction.
+			#if defined(_M_X64) || defined(__x86_64__)
+			for (; i + 8 <= size; i += 8)
+			{
+				unsigned long long value;
+				std::memcpy(&value, bytes + i, sizeof(value));
+				crc = (uint)_mm_crc32_u64(crc, value);
+			}
+			#endif
+
+			for (; i + 4 <= size; i += 4)
+			{
+				uint value;
+				std::memcpy(&value, bytes + i, sizeof(value));
+				crc = _mm_crc32_u32(crc, value);
+			}
+			for (; i < size; i++)
+				crc = _mm_crc32_u8(crc, bytes[i]);
+			return ~crc;
+		}
+
+		static const Crc32CTable table;
+		for (; i < size; i++)
+			crc = (crc >> 8) ^ table.values[(crc ^ bytes[i]) & 0xff];
+		return ~crc;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include "CommonDefines.h"
+
+namespace SupergodCore
+{
+	/// <summary>
+	/// Checksums for finding corrupt or truncated data.
+	/// </summary>
+	namespace Checksum
+	{
+		/// <summary>
+		/// Computes the CRC-32C (Castagnoli) of size bytes, with the SSE4.2 instructions when the CPU has them (about 8 bytes a cycle).<para/>
+		/// To checksum data that comes in parts, pass the result of every part as previous to the next one. The first part starts with 0.
+		/// </summary>
+		SUPERGOD_API_FUNC uint Crc32C(const void* data, size_t size, uint previous = 0);
+	}
+}
\ No newline at end of file
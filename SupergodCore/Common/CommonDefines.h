@@ -1,6 +1,11 @@
 #pragma once
 
 #define SUPERGOD_API_FUNC __declspec(dllexport)
+
+/// <summary>
+/// Exports a whole class. Classes with standard library members (like std::vector) don't use it, because their members can't be exported with them (C4251),
+/// so they export their member functions with SUPERGOD_API_FUNC instead.
+/// </summary>
 #define SUPERGOD_API_CLASS __declspec(dllexport, empty_bases)
 #define ARRAY_ELEMENTS_COUNT(array) sizeof(array) / sizeof(*array)
 
@@ -12,13 +17,13 @@
 #define interface struct
 
 /// <summary>
-/// Defines a preset value for a struct (because you can't use const with those). This is being undefined in SupergodEngine.h.
+/// Defines a preset value for a struct (because you can't use const with those). This is being undefined in SupergodEngine.h.<para/>
+/// The preset is constexpr, so it can be used in constant expressions and doesn't need a static with an initialization guard.
 /// </summary>
 #define DEFINE_STRUCT_VALUE_PRESET(type, name, value) \
-			inline static const type& name() \
+			inline static constexpr type name() \
 			{ \
-				static const type val value; \
-				return val; \
+				return type value; \
 			}
 
 /// <summary>
@@ -0,0 +1,78 @@
+#include "CpuFeatures.h"
+#include <intrin.h>
+
+namespace SupergodCore
+{
+	/// <summary>
+	/// The feature bits that are needed from cpuid, read once.
+	/// </summary>
+	struct CpuInfo
+	{
+		bool sse41 = false;
+		bool sse42 = false;
+		bool avx = false;
+		bool avx2 = false;
+		bool fma = false;
+		bool f16c = false;
+
+		CpuInfo()
+		{
+			int info[4];
+			__cpuid(info, 0);
+			int highestLeaf = info[0];
+
+			__cpuid(info, 1);
+			sse41 = (info[2] & (1 << 19)) != 0;
+			sse42 = (info[2] & (1 << 20)) != 0;
+
+			// AVX needs the OS to save the YMM registers, which is what OSXSAVE and XCR0 tell.
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool avxSupported = (info[2] & (1 << 28)) != 0;
+			avx = osxsave && avxSupported && (_xgetbv(0) & 6) == 6;
+			fma = avx && (info[2] & (1 << 12)) != 0;
+			f16c = avx && (info[2] & (1 << 29)) != 0;
+
+			if (highestLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = avx && (info[1] & (1 << 5)) != 0;
+			}
+		}
+	};
+
+	static const CpuInfo& GetCpuInfo()
+	{
+		static const CpuInfo info;
+		return info;
+	}
+
+	bool CpuFeatures::HasSSE41()
+	{
+		return GetCpuInfo().sse41;
+	}
+
+	bool CpuFeatures::HasSSE42()
+	{
+		return GetCpuInfo().sse42;
+	}
+
+	bool CpuFeatures::HasAVX()
+	{
+		return GetCpuInfo().avx;
+	}
+
+	bool CpuFeatures::HasAVX2()
+	{
+		return GetCpuInfo().avx2;
+	}
+
+	bool CpuFeatures::HasFMA()
+	{
+		return GetCpuInfo().fma;
+	}
+
+	bool CpuFeatures::HasF16C()
+	{
+		return GetCpuInfo().f16c;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CommonDefines.h"
+
+namespace SupergodCore
+{
+	/// <summary>
+	/// Runtime detection of the instruction set extensions the SIMD kernels can use.<para/>
+	/// Every function checks the CPU once and caches the result, so they are cheap to call before every batch.
+	/// </summary>
+	namespace CpuFeatures
+	{
+		/// <summary>
+		/// Does the CPU support SSE4.1?
+		/// </summary>
+		SUPERGOD_API_FUNC bool HasSSE41();
+
+		/// <summary>
+		/// Does the CPU support SSE4.2 (which has the CRC32C instructions)?
+		/// </summary>
+		SUPERGOD_API_FUNC bool HasSSE42();
+
+		/// <summary>
+		/// Does the CPU (and the OS) support AVX?
+		/// </summary>
+		SUPERGOD_API_FUNC bool HasAVX();
+
+		/// <summary>
+		/// Does the CPU (and the OS) support AVX2?
+		/// </summary>
+		SUPERGOD_API_FUNC bool HasAVX2();
+
+		/// <summary>
+		/// Does the CPU (and the OS) support FMA3?
+		/// </summary>
+		SUPERGOD_API_FUNC bool HasFMA();
+
+		/// <summary>
+		/// Does the CPU (and the OS) support F16C (half precision float conversions)?
+		/// </summary>
+		SUPERGOD_API_FUNC bool HasF16C();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "Parallel.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SupergodCore
+{
+	/// <summary>
+	/// Is the current thread running chunks of a parallel loop? Loops started from inside one run on the calling thread, so they never wait for themselves.
+	/// </summary>
+	static thread_local bool insideLoop = false;
+
+	/// <summary>
+	/// The worker threads and the loop they are working on. Only one loop runs at a time.
+	/// </summary>
+	class ThreadPool
+	{
+	public:
+		ThreadPool()
+			: function(nullptr), context(nullptr), count(0), chunkSize(0), chunkCount(0), nextChunk(0), finishedChunks(0), activeWorkers(0), generation(0)
+		{
+			uint threads = std::thread::hardware_concurrency();
+			for (uint i = 1; i < threads; i++)
+				workers.emplace_back([this]() { WorkerLoop(); });
+
+			// The workers are never joined: the pool lives as long as the process, and joining threads while a DLL unloads can deadlock.
+			for (std::thread& worker : workers)
+				worker.detach();
+		}
+
+		inline uint ThreadCount() const
+		{
+			return (uint)workers.size() + 1;
+		}
+
+		void Run(size_t newCount, size_t newChunkSize, Parallel::RangeFunction newFunction, void* newContext)
+		{
+			std::lock_guard<std::mutex> loopLock(loopMutex);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				function = newFunction;
+				context = newContext;
+				count = newCount;
+				chunkSize = newChunkSize;
+				chunkCount = (newCount + newChunkSize - 1) / newChunkSize;
+				nextChunk = 0;
+				finishedChunks = 0;
+				generation++;
+			}
+			wake.notify_all();
+
+			RunChunks(function, context, count, chunkSize, chunkCount);
+
+			// Waiting for the workers to leave too makes sure none of them touches this loop after it returns.
+			std::unique_lock<std::mutex> lock(mutex);
+			done.wait(lock, [this]() { return finishedChunks == chunkCount && activeWorkers == 0; });
+		}
+
+	private:
+		/// <summary>
+		/// Takes chunks of the current loop and runs them until there are none left.
+		/// </summary>
+		void RunChunks(Parallel::RangeFunction loopFunction, void* loopContext, size_t loopCount, size_t loopChunkSize, size_t loopChunkCount)
+		{
+			insideLoop = true;
+			size_t finished = 0;
+			for (size_t chunk = nextChunk++; chunk < loopChunkCount; chunk = nextChunk++)
+			{
+				size_t begin = chunk * loopChunkSize;
+				size_t end = begin + loopChunkSize < loopCount ? begin + loopChunkSize : loopCount;
+				loopFunction(loopContext, begin, end);
+				finished++;
+			}
+			insideLoop = false;
+
+			if (finished != 0)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				finishedChunks += finished;
+			}
+		}
+
+		void WorkerLoop()
+		{
+			unsigned long long seenGeneration = 0;
+			std::unique_lock<std::mutex> lock(mutex);
+			while (true)
+			{
+				wake.wait(lock, [&]() { return generation != seenGeneration; });
+				seenGeneration = generation;
+				if (finishedChunks == chunkCount)
+					continue;
+
+				Parallel::RangeFunction loopFunction = function;
+				void* loopContext = context;
+				size_t loopCount = count, loopChunkSize = chunkSize, loopChunkCount = chunkCount;
+				activeWorkers++;
+				lock.unlock();
+
+				RunChunks(loopFunction, loopContext, loopCount, loopChunkSize, loopChunkCount);
+
+				lock.lock();
+				activeWorkers--;
+				if (activeWorkers == 0 && finishedChunks == chunkCount)
+					done.notify_all();
+			}
+		}
+
+		std::vector<std::thread> workers;
+		std::mutex loopMutex;
+		std::mutex mutex;
+		std::condition_variable wake;
+		std::condition_variable done;
+
+		Parallel::RangeFunction function;
+		void* context;
+		size_t count;
+		size_t chunkSize;
+		size_t chunkCount;
+		std::atomic<size_t> nextChunk;
+		size_t finishedChunks;
+		uint activeWorkers;
+		unsigned long long generation;
+	};
+
+	static ThreadPool& GetThreadPool()
+	{
+		// Never deleted, see the constructor.
+		static ThreadPool* pool = new ThreadPool();
+		return *pool;
+	}
+
+	uint Parallel::ThreadCount()
+	{
+		return GetThreadPool().ThreadCount();
+	}
+
+	void Parallel::For(size_t count, size_t chunkSize, RangeFunction function, void* context)
+	{
+		if (count == 0)
+			return;
+
+		if (chunkSize == 0)
+			chunkSize = 1;
+
+		if (count <= chunkSize || insideLoop || GetThreadPool().ThreadCount() == 1)
+		{
+			for (size_t begin = 0; begin < count; begin += chunkSize)
+				function(context, begin, begin + chunkSize < count ? begin + chunkSize : count);
+			return;
+		}
+
+		GetThreadPool().Run(count, chunkSize, function, context);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include "CommonDefines.h"
+
+namespace SupergodCore
+{
+	/// <summary>
+	/// Splits loops over many items between the cores of the CPU.<para/>
+	/// The worker threads are created once, on the first parallel loop, and sleep between loops. The thread that starts a loop works on it too.
+	/// </summary>
+	namespace Parallel
+	{
+		/// <summary>
+		/// The function a parallel loop calls for every chunk of items, from begin up to (not including) end.
+		/// </summary>
+		typedef void(*RangeFunction)(void* context, size_t begin, size_t end);
+
+		/// <summary>
+		/// Gets the number of threads that work on a parallel loop (including the one that starts it).
+		/// </summary>
+		SUPERGOD_API_FUNC uint ThreadCount();
+
+		/// <summary>
+		/// Calls function for chunks of chunkSize items (the last one can be smaller) until all count items are covered, and returns when all of them are done.<para/>
+		/// The chunks can run at the same time and in any order. Loops with a single chunk, and loops started from inside another loop, run on the calling thread.
+		/// </summary>
+		/// <param name="context">Passed to function as is.</param>
+		SUPERGOD_API_FUNC void For(size_t count, size_t chunkSize, RangeFunction function, void* context);
+
+		/// <summary>
+		/// Calls function(begin, end) for chunks of chunkSize items until all count items are covered, and returns when all of them are done. See For(size_t, size_t, RangeFunction, void*).
+		/// </summary>
+		template<class TFunction>
+		inline void For(size_t count, size_t chunkSize, const TFunction& function)
+		{
+			For(count, chunkSize, [](void* context, size_t begin, size_t end)
+			{
+				(*static_cast<const TFunction*>(context))(begin, end);
+			}, const_cast<TFunction*>(&function));
+		}
+	}
+}
\ No newline at end of file
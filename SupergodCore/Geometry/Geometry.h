@@ -0,0 +1,8 @@
+#pragma once
+
+#include "Mesh.h"
+#include "MeshPrimitives.h"
+#include "MeshOptimizer.h"
+#include "TangentSpace.h"
+#include "Quadric.h"
+#include "MeshSimplifier.h"
\ No newline at end of file
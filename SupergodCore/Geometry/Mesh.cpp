@@ -0,0 +1,63 @@
+#include "Mesh.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	using namespace Math;
+
+	/// <summary>
+	/// Moves every value i of stream to remap[i], keeping vertexCount values.
+	/// </summary>
+	template<class T>
+	static void RemapStream(std::vector<T>& stream, const uint* remap, size_t vertexCount)
+	{
+		if (stream.empty())
+			return;
+
+		std::vector<T> remapped(vertexCount);
+		for (size_t i = 0; i < stream.size(); i++)
+		{
+			if (remap[i] != ~0u)
+				remapped[remap[i]] = stream[i];
+		}
+		stream.swap(remapped);
+	}
+
+	uint Mesh::AddVertex(const Vector3D& position)
+	{
+		positions.push_back(position);
+		return (uint)positions.size() - 1;
+	}
+
+	uint Mesh::AddVertex(const Vector3D& position, const Vector3D& normal, const Vector2D& uv)
+	{
+		normals.push_back(normal);
+		uvs.push_back(uv);
+		return AddVertex(position);
+	}
+
+	void Mesh::AddTriangle(uint a, uint b, uint c)
+	{
+		indices.push_back(a);
+		indices.push_back(b);
+		indices.push_back(c);
+	}
+
+	void Mesh::RemapVertices(const uint* remap, size_t vertexCount)
+	{
+		RemapStream(positions, remap, vertexCount);
+		RemapStream(normals, remap, vertexCount);
+		RemapStream(uvs, remap, vertexCount);
+		RemapStream(tangents, remap, vertexCount);
+		for (uint& index : indices)
+			index = remap[index];
+	}
+
+	void Mesh::Clear()
+	{
+		positions.clear();
+		normals.clear();
+		uvs.clear();
+		tangents.clear();
+		indices.clear();
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector2D.h"
+#include "Math/Vectors/Vector3D.h"
+#include "Math/Vectors/Vector4D.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	/// <summary>
+	/// A triangle mesh: a separate array (stream) for every vertex attribute, and three indices into them for every triangle.<para/>
+	/// Positions are always there. The other streams are either empty (the mesh doesn't have the attribute) or have a value for every vertex.
+	/// </summary>
+	class Mesh final
+	{
+	public:
+		std::vector<Math::Vector3D> positions;
+		std::vector<Math::Vector3D> normals;
+		std::vector<Math::Vector2D> uvs;
+
+		/// <summary>
+		/// The direction the u texture coordinate grows in, perpendicular to the normal, with the handedness of the texture space in w (1 or -1): the bitangent is normal.Cross(tangent) * w.
+		/// </summary>
+		std::vector<Math::Vector4D> tangents;
+
+		/// <summary>
+		/// The vertex indices of the triangles, three for every triangle.
+		/// </summary>
+		std::vector<uint> indices;
+
+		/// <summary>
+		/// Creates a new mesh without vertices and triangles.
+		/// </summary>
+		Mesh() = default;
+
+		/// <summary>
+		/// Gets the number of vertices.
+		/// </summary>
+		inline size_t VertexCount() const { return positions.size(); }
+
+		/// <summary>
+		/// Gets the number of triangles.
+		/// </summary>
+		inline size_t TriangleCount() const { return indices.size() / 3; }
+
+		/// <summary>
+		/// Does every vertex have a normal?
+		/// </summary>
+		inline bool HasNormals() const { return !normals.empty(); }
+
+		/// <summary>
+		/// Does every vertex have texture coordinates?
+		/// </summary>
+		inline bool HasUvs() const { return !uvs.empty(); }
+
+		/// <summary>
+		/// Does every vertex have a tangent?
+		/// </summary>
+		inline bool HasTangents() const { return !tangents.empty(); }
+
+		/// <summary>
+		/// Adds a vertex with only a position and returns its index. Don't use on meshes with other streams.
+		/// </summary>
+		SUPERGOD_API_FUNC uint AddVertex(const Math::Vector3D& position);
+
+		/// <summary>
+		/// Adds a vertex with a position, normal and texture coordinates and returns its index. Don't use on meshes with only some of the streams.
+		/// </summary>
+		SUPERGOD_API_FUNC uint AddVertex(const Math::Vector3D& position, const Math::Vector3D& normal, const Math::Vector2D& uv);
+
+		/// <summary>
+		/// Adds the triangle abc.
+		/// </summary>
+		SUPERGOD_API_FUNC void AddTriangle(uint a, uint b, uint c);
+
+		/// <summary>
+		/// Moves every vertex i to remap[i] in all of the streams and the indices, and keeps vertexCount vertices.<para/>
+		/// Vertices that remap to the same index must be the same, and ~0 removes vertices (which no triangle may use).
+		/// </summary>
+		SUPERGOD_API_FUNC void RemapVertices(const uint* remap, size_t vertexCount);
+
+		/// <summary>
+		/// Removes all the vertices and triangles.
+		/// </summary>
+		SUPERGOD_API_FUNC void Clear();
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,440 @@
+#include "MeshOptimizer.h"
+#include "Math/SMath.h"
+#include <algorithm>
+#include <cstring>
+
+namespace SupergodCore { namespace Geometry
+{
+	using namespace Math;
+
+	#pragma region Deduplication.
+	/// <summary>
+	/// Mixes the bits of value into hash (the 32-bit MurmurHash3 step).
+	/// </summary>
+	static inline uint HashBits(uint hash, float value)
+	{
+		uint bits;
+		memcpy(&bits, &value, sizeof(bits));
+		bits *= 0xcc9e2d51;
+		bits = (bits << 15) | (bits >> 17);
+		hash ^= bits * 0x1b873593;
+		hash = (hash << 13) | (hash >> 19);
+		return hash * 5 + 0xe6546b64;
+	}
+
+	/// <summary>
+	/// Hashes all the streams of a vertex of mesh.
+	/// </summary>
+	static uint HashVertex(const Mesh& mesh, size_t vertex)
+	{
+		const Vector3D& position = mesh.positions[vertex];
+		uint hash = HashBits(HashBits(HashBits(0, position.x), position.y), position.z);
+		if (mesh.HasNormals())
+		{
+			const Vector3D& normal = mesh.normals[vertex];
+			hash = HashBits(HashBits(HashBits(hash, normal.x), normal.y), normal.z);
+		}
+		if (mesh.HasUvs())
+			hash = HashBits(HashBits(hash, mesh.uvs[vertex].x), mesh.uvs[vertex].y);
+		if (mesh.HasTangents())
+		{
+			const Vector4D& tangent = mesh.tangents[vertex];
+			hash = HashBits(HashBits(HashBits(HashBits(hash, tangent.x), tangent.y), tangent.z), tangent.w);
+		}
+		return hash ^ (hash >> 16);
+	}
+
+	/// <summary>
+	/// Are all the streams of the vertices a and b of mesh bitwise the same?
+	/// </summary>
+	static bool SameVertex(const Mesh& mesh, size_t a, size_t b)
+	{
+		return memcmp(&mesh.positions[a], &mesh.positions[b], sizeof(Vector3D)) == 0 &&
+			(!mesh.HasNormals() || memcmp(&mesh.normals[a], &mesh.normals[b], sizeof(Vector3D)) == 0) &&
+			(!mesh.HasUvs() || memcmp(&mesh.uvs[a], &mesh.uvs[b], sizeof(Vector2D)) == 0) &&
+			(!mesh.HasTangents() || memcmp(&mesh.tangents[a], &mesh.tangents[b], sizeof(Vector4D)) == 0);
+	}
+
+	size_t MeshOptimizer::Deduplicate(Mesh& mesh)
+	{
+		// An open addressing table of the first vertex with every value, at most half full.
+		size_t vertexCount = mesh.VertexCount();
+		size_t tableSize = 16;
+		while (tableSize < vertexCount * 2)
+			tableSize *= 2;
+
+		std::vector<uint> table(tableSize, ~0u);
+		std::vector<uint> remap(vertexCount);
+		uint uniqueCount = 0;
+		for (size_t vertex = 0; vertex < vertexCount; vertex++)
+		{
+			size_t slot = HashVertex(mesh, vertex) & (tableSize - 1);
+			while (table[slot] != ~0u && !SameVertex(mesh, table[slot], vertex))
+				slot = (slot + 1) & (tableSize - 1);
+
+			if (table[slot] == ~0u)
+			{
+				table[slot] = (uint)vertex;
+				remap[vertex] = uniqueCount++;
+			}
+			else
+				remap[vertex] = remap[table[slot]];
+		}
+
+		if (uniqueCount != vertexCount)
+			mesh.RemapVertices(remap.data(), uniqueCount);
+		return uniqueCount;
+	}
+	#pragma endregion
+
+	#pragma region Vertex cache.
+	/// <summary>
+	/// Vertices used by more triangles than this get the same valence score.
+	/// </summary>
+	static constexpr uint MAX_SCORED_VALENCE = 32;
+
+	/// <summary>
+	/// The cache the optimization simulates, with room for the vertices the newest triangle pushes out.
+	/// </summary>
+	static constexpr uint VERTEX_CACHE_SIZE_WITH_NEW_TRIANGLE = MeshOptimizer::VERTEX_CACHE_SIZE + 3;
+
+	/// <summary>
+	/// The scores of Forsyth's optimization, for every position in the cache and for every number of triangles that still use a vertex.
+	/// </summary>
+	struct ForsythScores
+	{
+		float cache[VERTEX_CACHE_SIZE_WITH_NEW_TRIANGLE];
+		float valence[MAX_SCORED_VALENCE + 1];
+
+		ForsythScores()
+		{
+			// The vertices of the last triangle score the same no matter their order, so it isn't favored to use two of them again.
+			for (uint position = 0; position < VERTEX_CACHE_SIZE_WITH_NEW_TRIANGLE; position++)
+			{
+				if (position < 3)
+					cache[position] = .75f;
+				else if (position < MeshOptimizer::VERTEX_CACHE_SIZE)
+					cache[position] = SMath::Pow(1 - (position - 3) / (float)(MeshOptimizer::VERTEX_CACHE_SIZE - 3), 1.5f);
+				else
+					cache[position] = 0;
+			}
+
+			// Vertices that only a few triangles still use are finished first, so they don't leave lone triangles to come back to later.
+			valence[0] = 0;
+			for (uint count = 1; count <= MAX_SCORED_VALENCE; count++)
+				valence[count] = 2 / SMath::Sqrt((float)count);
+		}
+
+		inline float Score(int cachePosition, uint liveTriangles) const
+		{
+			if (liveTriangles == 0)
+				return -1;
+			return (cachePosition >= 0 ? cache[cachePosition] : 0) + valence[std::min(liveTriangles, MAX_SCORED_VALENCE)];
+		}
+	};
+
+	void MeshOptimizer::OptimizeVertexCache(Mesh& mesh)
+	{
+		static const ForsythScores scores;
+		size_t triangleCount = mesh.TriangleCount();
+		size_t vertexCount = mesh.VertexCount();
+		if (triangleCount == 0)
+			return;
+
+		// The triangles of every vertex, the first liveTriangles of them not added yet.
+		std::vector<uint> liveTriangles(vertexCount, 0);
+		for (uint index : mesh.indices)
+			liveTriangles[index]++;
+
+		std::vector<uint> firstTriangle(vertexCount + 1, 0);
+		for (size_t vertex = 0; vertex < vertexCount; vertex++)
+			firstTriangle[vertex + 1] = firstTriangle[vertex] + liveTriangles[vertex];
+
+		std::vector<uint> vertexTriangles(mesh.indices.size());
+		std::vector<uint> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+		for (size_t i = 0; i < mesh.indices.size(); i++)
+			vertexTriangles[filled[mesh.indices[i]]++] = (uint)(i / 3);
+
+		std::vector<int> cachePosition(vertexCount, -1);
+		std::vector<float> vertexScores(vertexCount);
+		for (size_t vertex = 0; vertex < vertexCount; vertex++)
+			vertexScores[vertex] = scores.Score(-1, liveTriangles[vertex]);
+
+		std::vector<float> triangleScores(triangleCount);
+		std::vector<bool> added(triangleCount, false);
+		uint bestTriangle = 0;
+		for (size_t triangle = 0; triangle < triangleCount; triangle++)
+		{
+			const uint* corners = &mesh.indices[triangle * 3];
+			triangleScores[triangle] = vertexScores[corners[0]] + vertexScores[corners[1]] + vertexScores[corners[2]];
+			if (triangleScores[triangle] > triangleScores[bestTriangle])
+				bestTriangle = (uint)triangle;
+		}
+
+		// The vertices pushed out of the cache by the newest triangle are kept for a step, so their scores drop.
+		uint cache[VERTEX_CACHE_SIZE_WITH_NEW_TRIANGLE], newCache[VERTEX_CACHE_SIZE_WITH_NEW_TRIANGLE];
+		uint cacheCount = 0;
+		size_t nextUnadded = 0;
+		std::vector<uint> ordered;
+		ordered.reserve(mesh.indices.size());
+		for (size_t step = 0; step < triangleCount; step++)
+		{
+			// When no triangle uses a cached vertex, start again from the next one that isn't added.
+			if (bestTriangle == ~0u)
+			{
+				while (added[nextUnadded])
+					nextUnadded++;
+				bestTriangle = (uint)nextUnadded;
+			}
+
+			added[bestTriangle] = true;
+			const uint* corners = &mesh.indices[bestTriangle * 3];
+			ordered.insert(ordered.end(), corners, corners + 3);
+
+			// Remove the triangle from the live triangles of its vertices, and put them first in the cache.
+			uint newCount = 0;
+			for (int corner = 0; corner < 3; corner++)
+			{
+				uint vertex = corners[corner];
+				if (corner > 0 && (vertex == corners[0] || vertex == corners[corner - 1]))
+					continue;
+
+				// Degenerate triangles are in the list of a vertex more than once.
+				uint* triangles = &vertexTriangles[firstTriangle[vertex]];
+				for (uint* found; (found = std::find(triangles, triangles + liveTriangles[vertex], bestTriangle)) != triangles + liveTriangles[vertex];)
+					std::swap(*found, triangles[--liveTriangles[vertex]]);
+				newCache[newCount++] = vertex;
+			}
+			for (uint i = 0; i < cacheCount; i++)
+			{
+				uint vertex = cache[i];
+				if (vertex != corners[0] && vertex != corners[1] && vertex != corners[2])
+					newCache[newCount++] = vertex;
+			}
+			if (newCount > VERTEX_CACHE_SIZE)
+			{
+				for (uint i = VERTEX_CACHE_SIZE; i < newCount; i++)
+					cachePosition[newCache[i]] = -1;
+			}
+
+			// Update the scores of the vertices whose position changed, and of their triangles.
+			for (uint i = 0; i < newCount; i++)
+			{
+				uint vertex = newCache[i];
+				if (i < VERTEX_CACHE_SIZE)
+					cachePosition[vertex] = i;
+
+				float score = scores.Score(cachePosition[vertex], liveTriangles[vertex]);
+				float change = score - vertexScores[vertex];
+				vertexScores[vertex] = score;
+				for (uint j = firstTriangle[vertex]; j < firstTriangle[vertex] + liveTriangles[vertex]; j++)
+					triangleScores[vertexTriangles[j]] += change;
+			}
+
+			// The next triangle is the best one that uses a cached vertex.
+			bestTriangle = ~0u;
+			float bestScore = -1;
+			cacheCount = std::min(newCount, VERTEX_CACHE_SIZE);
+			for (uint i = 0; i < cacheCount; i++)
+			{
+				uint vertex = newCache[i];
+				cache[i] = vertex;
+				for (uint j = firstTriangle[vertex]; j < firstTriangle[vertex] + liveTriangles[vertex]; j++)
+				{
+					uint triangle = vertexTriangles[j];
+					if (triangleScores[triangle] > bestScore)
+					{
+						bestScore = triangleScores[triangle];
+						bestTriangle = triangle;
+					}
+				}
+			}
+		}
+
+		mesh.indices.swap(ordered);
+	}
+
+	float MeshOptimizer::AverageCacheMissRatio(const uint* indices, size_t indexCount, uint cacheSize)
+	{
+		if (indexCount < 3)
+			return 0;
+
+		// With a FIFO cache, a vertex is still cached if fewer than cacheSize misses happened since it was added.
+		uint vertexCount = *std::max_element(indices, indices + indexCount) + 1;
+		std::vector<size_t> addedAt(vertexCount, 0);
+		size_t misses = 0;
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			size_t& time = addedAt[indices[i]];
+			if (time == 0 || misses - time >= cacheSize)
+				time = ++misses;
+		}
+		return (float)misses / (indexCount / 3);
+	}
+	#pragma endregion
+
+	#pragma region Overdraw.
+	/// <summary>
+	/// The size of the FIFO cache the clusters are measured with.
+	/// </summary>
+	static constexpr uint OVERDRAW_CACHE_SIZE = 16;
+
+	/// <summary>
+	/// A FIFO vertex cache that counts the vertices a range of triangles transforms.
+	/// </summary>
+	class CacheSimulation final
+	{
+	public:
+		CacheSimulation(size_t vertexCount)
+			: addedAt(vertexCount, 0), time(OVERDRAW_CACHE_SIZE + 1)
+		{
+		}
+
+		/// <summary>
+		/// Draws the triangle and returns how many of its vertices weren't cached.
+		/// </summary>
+		inline uint Draw(const uint* corners)
+		{
+			uint misses = 0;
+			for (int corner = 0; corner < 3; corner++)
+			{
+				if (time - addedAt[corners[corner]] > OVERDRAW_CACHE_SIZE)
+				{
+					addedAt[corners[corner]] = time++;
+					misses++;
+				}
+			}
+			return misses;
+		}
+
+		/// <summary>
+		/// Empties the cache.
+		/// </summary>
+		inline void Flush()
+		{
+			time += OVERDRAW_CACHE_SIZE + 1;
+		}
+
+	private:
+		std::vector<size_t> addedAt;
+		size_t time;
+	};
+
+	void MeshOptimizer::OptimizeOverdraw(Mesh& mesh, float threshold)
+	{
+		size_t triangleCount = mesh.TriangleCount();
+		if (triangleCount == 0)
+			return;
+
+		// The cache order already starts over wherever a triangle misses all of its vertices, so cutting there costs nothing.
+		// The first triangle always starts a range, even a degenerate one that can't miss 3 vertices.
+		std::vector<size_t> hardCuts;
+		CacheSimulation cache(mesh.VertexCount());
+		for (size_t triangle = 0; triangle < triangleCount; triangle++)
+		{
+			if (cache.Draw(&mesh.indices[triangle * 3]) == 3 || triangle == 0)
+				hardCuts.push_back(triangle);
+		}
+		hardCuts.push_back(triangleCount);
+
+		// Inside those, cut wherever the triangles since the last cut reuse vertices almost as well as the whole range does.
+		std::vector<size_t> cuts;
+		for (size_t range = 0; range + 1 < hardCuts.size(); range++)
+		{
+			size_t begin = hardCuts[range], end = hardCuts[range + 1];
+			size_t misses = 0;
+			cache.Flush();
+			for (size_t triangle = begin; triangle < end; triangle++)
+				misses += cache.Draw(&mesh.indices[triangle * 3]);
+			float limit = (float)misses / (end - begin) * threshold;
+
+			cuts.push_back(begin);
+			cache.Flush();
+			misses = 0;
+			size_t clusterBegin = begin;
+			for (size_t triangle = begin; triangle + 1 < end; triangle++)
+			{
+				misses += cache.Draw(&mesh.indices[triangle * 3]);
+				if (misses <= limit * (triangle + 1 - clusterBegin))
+				{
+					clusterBegin = triangle + 1;
+					cuts.push_back(clusterBegin);
+					cache.Flush();
+					misses = 0;
+				}
+			}
+		}
+		cuts.push_back(triangleCount);
+
+		// The center and area weighted normal of every cluster.
+		size_t clusterCount = cuts.size() - 1;
+		std::vector<Vector3D> centers(clusterCount), clusterNormals(clusterCount);
+		Vector3D meshCenter;
+		float meshArea = 0;
+		for (size_t cluster = 0; cluster < clusterCount; cluster++)
+		{
+			Vector3D center, normal;
+			float area = 0;
+			for (size_t triangle = cuts[cluster]; triangle < cuts[cluster + 1]; triangle++)
+			{
+				const Vector3D& a = mesh.positions[mesh.indices[triangle * 3]];
+				const Vector3D& b = mesh.positions[mesh.indices[triangle * 3 + 1]];
+				const Vector3D& c = mesh.positions[mesh.indices[triangle * 3 + 2]];
+				Vector3D triangleNormal = (b - a).Cross(c - a);
+				float triangleArea = triangleNormal.Magnitude();
+				center = center + (a + b + c) * (triangleArea / 3);
+				normal = normal + triangleNormal;
+				area += triangleArea;
+			}
+
+			meshCenter = meshCenter + center;
+			meshArea += area;
+			centers[cluster] = area > 0 ? center / area : mesh.positions[mesh.indices[cuts[cluster] * 3]];
+			clusterNormals[cluster] = normal;
+		}
+		if (meshArea > 0)
+			meshCenter = meshCenter / meshArea;
+
+		// Clusters that are far out along their normal are likely to be in front of the others.
+		std::vector<float> keys(clusterCount);
+		std::vector<uint> order(clusterCount);
+		for (size_t cluster = 0; cluster < clusterCount; cluster++)
+		{
+			float normalLength = clusterNormals[cluster].Magnitude();
+			keys[cluster] = normalLength > 0 ? (centers[cluster] - meshCenter).Dot(clusterNormals[cluster]) / normalLength : 0;
+			order[cluster] = (uint)cluster;
+		}
+		std::stable_sort(order.begin(), order.end(), [&](uint a, uint b) { return keys[a] > keys[b]; });
+
+		std::vector<uint> ordered;
+		ordered.reserve(mesh.indices.size());
+		for (uint cluster : order)
+			ordered.insert(ordered.end(), mesh.indices.begin() + cuts[cluster] * 3, mesh.indices.begin() + cuts[cluster + 1] * 3);
+		mesh.indices.swap(ordered);
+	}
+	#pragma endregion
+
+	#pragma region Vertex fetch.
+	size_t MeshOptimizer::OptimizeVertexFetch(Mesh& mesh)
+	{
+		std::vector<uint> remap(mesh.VertexCount(), ~0u);
+		uint usedCount = 0;
+		for (uint index : mesh.indices)
+		{
+			if (remap[index] == ~0u)
+				remap[index] = usedCount++;
+		}
+
+		mesh.RemapVertices(remap.data(), usedCount);
+		return usedCount;
+	}
+	#pragma endregion
+
+	void MeshOptimizer::Optimize(Mesh& mesh)
+	{
+		Deduplicate(mesh);
+		OptimizeVertexCache(mesh);
+		OptimizeOverdraw(mesh);
+		OptimizeVertexFetch(mesh);
+	}
+} }
\ No newline at end of file
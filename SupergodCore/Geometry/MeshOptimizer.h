@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include "Common/CommonDefines.h"
+#include "Mesh.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	/// <summary>
+	/// Reorders the triangles and vertices of meshes so the GPU draws them faster, without changing what is drawn.<para/>
+	/// Optimize runs all of the steps in the order they should run in: removing duplicate vertices, ordering the triangles for the vertex cache and then against overdraw, and finally ordering the vertices for fetching.
+	/// </summary>
+	namespace MeshOptimizer
+	{
+		/// <summary>
+		/// The size of the LRU cache the vertex cache optimization aims at. It works well for smaller and FIFO caches too.
+		/// </summary>
+		static constexpr uint VERTEX_CACHE_SIZE = 32;
+
+		/// <summary>
+		/// Merges vertices that are bitwise the same in all of their streams, found by hashing, and returns the new number of vertices. The vertices keep their order.
+		/// </summary>
+		SUPERGOD_API_FUNC size_t Deduplicate(Mesh& mesh);
+
+		/// <summary>
+		/// Orders the triangles so vertices are reused while they're still in the post-transform cache, with Tom Forsyth's linear-speed vertex cache optimization:
+		/// it greedily adds the triangle with the best score, where vertices score higher the more recently they were used and the fewer triangles still need them.
+		/// </summary>
+		SUPERGOD_API_FUNC void OptimizeVertexCache(Mesh& mesh);
+
+		/// <summary>
+		/// Orders clusters of triangles so those that face outwards are drawn first and hide those behind them, which run fewer pixel shaders.
+		/// Run this after OptimizeVertexCache: the clusters are cut only where that doesn't raise the average cache miss ratio by more than threshold times.
+		/// </summary>
+		SUPERGOD_API_FUNC void OptimizeOverdraw(Mesh& mesh, float threshold = 1.05f);
+
+		/// <summary>
+		/// Orders the vertices by when the triangles first use them so they're read from memory in order, removes the vertices no triangle uses, and returns the new number of vertices.
+		/// </summary>
+		SUPERGOD_API_FUNC size_t OptimizeVertexFetch(Mesh& mesh);
+
+		/// <summary>
+		/// Runs Deduplicate, OptimizeVertexCache, OptimizeOverdraw and OptimizeVertexFetch.
+		/// </summary>
+		SUPERGOD_API_FUNC void Optimize(Mesh& mesh);
+
+		/// <summary>
+		/// Gets the average number of vertices every triangle transforms with a FIFO post-transform cache of cacheSize vertices (the ACMR), from 3 (no reuse at all) down to about 0.5 for big regular grids.
+		/// </summary>
+		SUPERGOD_API_FUNC float AverageCacheMissRatio(const uint* indices, size_t indexCount, uint cacheSize = 16);
+	}
+} }
\ No newline at end of file
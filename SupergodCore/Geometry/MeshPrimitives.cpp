@@ -0,0 +1,68 @@
+#include "MeshPrimitives.h"
+#include "Math/SMath.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	using namespace Math;
+
+	Mesh MeshPrimitives::Grid(int size, float uScale)
+	{
+		Mesh mesh;
+		for (int z = 0; z <= size; z++)
+		{
+			for (int x = 0; x <= size; x++)
+			{
+				mesh.AddVertex(Vector3D((float)x, 0, (float)z));
+				mesh.uvs.push_back(Vector2D(x * uScale, (float)z));
+			}
+		}
+		for (int z = 0; z < size; z++)
+		{
+			for (int x = 0; x < size; x++)
+			{
+				uint corner = z * (size + 1) + x;
+				mesh.AddTriangle(corner, corner + size + 1, corner + 1);
+				mesh.AddTriangle(corner + 1, corner + size + 1, corner + size + 2);
+			}
+		}
+		return mesh;
+	}
+
+	Mesh MeshPrimitives::Sphere(int rings, int segments, bool uvs)
+	{
+		Mesh mesh;
+		for (int ring = 0; ring <= rings; ring++)
+		{
+			int ringVertices = uvs ? segments + 1 : ring == 0 || ring == rings ? 1 : segments;
+			for (int segment = 0; segment < ringVertices; segment++)
+			{
+				float polar = Constants::PI * ring / rings, azimuth = 2 * Constants::PI * segment / segments;
+				mesh.AddVertex(Vector3D(SMath::Sin(polar) * SMath::Cos(azimuth), SMath::Cos(polar), SMath::Sin(polar) * SMath::Sin(azimuth)));
+				if (uvs)
+					mesh.uvs.push_back(Vector2D((float)segment / segments, (float)ring / rings));
+			}
+		}
+
+		auto vertex = [=](int ring, int segment)
+		{
+			if (uvs)
+				return (uint)(ring * (segments + 1) + segment);
+			if (ring == 0)
+				return 0u;
+			return ring == rings ? (uint)(1 + (rings - 1) * segments) : (uint)(1 + (ring - 1) * segments + segment % segments);
+		};
+
+		// Without uvs, the triangles that would have two corners on the same pole vertex are left out.
+		for (int ring = 0; ring < rings; ring++)
+		{
+			for (int segment = 0; segment < segments; segment++)
+			{
+				if (uvs || ring != 0)
+					mesh.AddTriangle(vertex(ring, segment), vertex(ring, segment + 1), vertex(ring + 1, segment));
+				if (uvs || ring != rings - 1)
+					mesh.AddTriangle(vertex(ring, segment + 1), vertex(ring + 1, segment + 1), vertex(ring + 1, segment));
+			}
+		}
+		return mesh;
+	}
+} }
\ No newline at end of file
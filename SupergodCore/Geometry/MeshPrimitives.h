@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Mesh.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	/// <summary>
+	/// Builds simple meshes, with shared vertices and without normals.
+	/// </summary>
+	namespace MeshPrimitives
+	{
+		/// <summary>
+		/// Creates a flat grid of size by size quads facing up, with texture coordinates (x * uScale, z).
+		/// </summary>
+		SUPERGOD_API_FUNC Mesh Grid(int size, float uScale = 1);
+
+		/// <summary>
+		/// Creates a sphere of radius 1 facing out. The vertices go ring by ring from the top.<para/>
+		/// Without uvs, it is closed: there is a single vertex at every pole and no seams.
+		/// With uvs, it has texture coordinates (segment / segments, ring / rings), so its vertices are split at the seam of the texture and for every segment at the poles.
+		/// </summary>
+		SUPERGOD_API_FUNC Mesh Sphere(int rings, int segments, bool uvs = false);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,381 @@
+#include "MeshSimplifier.h"
+#include "Quadric.h"
+#include "Common/Parallel.h"
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+namespace SupergodCore { namespace Geometry
+{
+	using namespace Math;
+
+	/// <summary>
+	/// Collapses whose triangles turn by more than this (a cosine) are rejected, so the surface doesn't fold over itself.
+	/// </summary>
+	static constexpr float MIN_NORMAL_COSINE = .2f;
+
+	/// <summary>
+	/// Collapsing the vertex from into the vertex to, with the error it had when it was queued.
+	/// </summary>
+	struct Collapse
+	{
+		float error;
+		uint from, to;
+
+		/// <summary>
+		/// The versions of from and to when this was queued. Collapses that changed either of them make this stale.
+		/// </summary>
+		uint fromVersion, toVersion;
+
+		inline bool operator>(const Collapse& other) const
+		{
+			return error > other.error || (error == other.error && (from > other.from || (from == other.from && to > other.to)));
+		}
+	};
+
+	/// <summary>
+	/// The state of simplifying one mesh.
+	/// </summary>
+	class Simplification final
+	{
+	public:
+		Simplification(const Mesh& mesh, const std::vector<uint>& sourceIndices)
+			: positions(mesh.positions), indices(sourceIndices), vertexCount(mesh.VertexCount()),
+			group(vertexCount), locked(vertexCount, false), removed(vertexCount, false), quadrics(vertexCount), version(vertexCount, 0), next(vertexCount),
+			firstTriangle(vertexCount + 1, 0), alive(indices.size() / 3, true), mark(vertexCount, 0), markStamp(0)
+		{
+			FindPositionGroups();
+			LockBordersAndSeams();
+			AddPlaneQuadrics();
+
+			// The triangles of every vertex. Vertices collapsed into another join its ring in next, and the triangles of all of them are its triangles.
+			for (uint index : indices)
+				firstTriangle[index + 1]++;
+			for (size_t vertex = 0; vertex < vertexCount; vertex++)
+			{
+				firstTriangle[vertex + 1] += firstTriangle[vertex];
+				next[vertex] = (uint)vertex;
+			}
+			vertexTriangles.resize(indices.size());
+			std::vector<uint> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+			for (size_t i = 0; i < indices.size(); i++)
+				vertexTriangles[filled[indices[i]]++] = (uint)(i / 3);
+
+			// Every edge inside the mesh is in two triangles, once in every direction, and the vertices of the other edges are locked.
+			queue.reserve(indices.size());
+			for (size_t i = 0; i < indices.size(); i++)
+				QueueCollapse(indices[i], indices[i - i % 3 + (i % 3 + 1) % 3], false);
+			std::make_heap(queue.begin(), queue.end(), std::greater<Collapse>());
+		}
+
+		MeshLod Run(size_t targetTriangleCount, float maxError)
+		{
+			size_t triangleCount = indices.size() / 3;
+			float error = 0;
+			while (triangleCount > targetTriangleCount && !queue.empty())
+			{
+				std::pop_heap(queue.begin(), queue.end(), std::greater<Collapse>());
+				Collapse collapse = queue.back();
+				queue.pop_back();
+				if (removed[collapse.from] || removed[collapse.to] ||
+					version[collapse.from] != collapse.fromVersion || version[group[collapse.to]] != collapse.toVersion)
+					continue;
+
+				if (collapse.error > maxError)
+					break;
+
+				if (!CanCollapse(collapse.from, collapse.to))
+					continue;
+
+				triangleCount -= Apply(collapse.from, collapse.to);
+				error = std::max(error, collapse.error);
+			}
+
+			MeshLod lod;
+			lod.error = error;
+			lod.indices.reserve(triangleCount * 3);
+			for (size_t triangle = 0; triangle < alive.size(); triangle++)
+			{
+				if (alive[triangle])
+					lod.indices.insert(lod.indices.end(), indices.begin() + triangle * 3, indices.begin() + triangle * 3 + 3);
+			}
+			return lod;
+		}
+
+	private:
+		#pragma region Setup.
+		/// <summary>
+		/// Sets the group of every vertex to the first vertex with the same position.
+		/// </summary>
+		void FindPositionGroups()
+		{
+			std::vector<uint> sorted(vertexCount);
+			for (size_t vertex = 0; vertex < vertexCount; vertex++)
+				sorted[vertex] = (uint)vertex;
+
+			auto less = [this](uint a, uint b)
+			{
+				const Vector3D& p = positions[a];
+				const Vector3D& q = positions[b];
+				return std::tie(p.x, p.y, p.z, a) < std::tie(q.x, q.y, q.z, b);
+			};
+			std::sort(sorted.begin(), sorted.end(), less);
+
+			for (size_t i = 0; i < vertexCount; i++)
+			{
+				bool samePosition = i > 0 && positions[sorted[i]] == positions[sorted[i - 1]];
+				group[sorted[i]] = samePosition ? group[sorted[i - 1]] : sorted[i];
+				if (samePosition)
+					locked[sorted[i]] = locked[sorted[i - 1]] = true;
+			}
+		}
+
+		/// <summary>
+		/// Locks the vertices of edges that don't have exactly two triangles: open borders and edges shared by more than two triangles.
+		/// </summary>
+		void LockBordersAndSeams()
+		{
+			std::vector<unsigned long long> edges;
+			edges.reserve(indices.size());
+			for (size_t i = 0; i < indices.size(); i++)
+			{
+				uint a = group[indices[i]], b = group[indices[i - i % 3 + (i % 3 + 1) % 3]];
+				edges.push_back((unsigned long long)std::min(a, b) << 32 | std::max(a, b));
+			}
+			std::sort(edges.begin(), edges.end());
+
+			for (size_t begin = 0, end; begin < edges.size(); begin = end)
+			{
+				for (end = begin + 1; end < edges.size() && edges[end] == edges[begin]; end++);
+				if (end - begin != 2)
+				{
+					locked[(uint)(edges[begin] >> 32)] = true;
+					locked[(uint)edges[begin]] = true;
+				}
+			}
+
+			// A group is locked if any of its vertices is.
+			for (size_t vertex = 0; vertex < vertexCount; vertex++)
+			{
+				if (locked[vertex])
+					locked[group[vertex]] = true;
+			}
+			for (size_t vertex = 0; vertex < vertexCount; vertex++)
+				locked[vertex] = locked[group[vertex]];
+		}
+
+		/// <summary>
+		/// Adds the plane of every triangle to the quadrics of its corners, weighted by its area.
+		/// </summary>
+		void AddPlaneQuadrics()
+		{
+			for (size_t triangle = 0; triangle < indices.size() / 3; triangle++)
+			{
+				const uint* corners = &indices[triangle * 3];
+				Vector3D normal = (positions[corners[1]] - positions[corners[0]]).Cross(positions[corners[2]] - positions[corners[0]]);
+				float length = normal.Magnitude();
+				if (length == 0)
+					continue;
+
+				// The plane goes through every corner, which is the origin of its quadric.
+				Quadric plane = Quadric::FromPlane(normal / length, 0, length * .5f);
+				for (int corner = 0; corner < 3; corner++)
+					quadrics[group[corners[corner]]] = quadrics[group[corners[corner]]].Add(plane);
+			}
+		}
+		#pragma endregion
+
+		#pragma region Collapses.
+		/// <summary>
+		/// Queues collapsing from into to, if from can be removed. The queue is only a heap if pushing.
+		/// </summary>
+		void QueueCollapse(uint from, uint to, bool push = true)
+		{
+			if (locked[from] || from == to)
+				return;
+
+			float error = quadrics[from].Translated(positions[to] - positions[from]).Add(quadrics[group[to]]).Error(Vector3D());
+			queue.push_back(Collapse{ error, from, to, version[from], version[group[to]] });
+			if (push)
+				std::push_heap(queue.begin(), queue.end(), std::greater<Collapse>());
+		}
+
+		/// <summary>
+		/// Calls function(triangle) for every triangle that is alive around vertex.
+		/// </summary>
+		template<class TFunction>
+		void ForTriangles(uint vertex, const TFunction& function)
+		{
+			uint member = vertex;
+			do
+			{
+				for (uint i = firstTriangle[member]; i < firstTriangle[member + 1]; i++)
+				{
+					if (alive[vertexTriangles[i]])
+						function(vertexTriangles[i]);
+				}
+				member = next[member];
+			} while (member != vertex);
+		}
+
+		/// <summary>
+		/// Can from collapse into to without folding triangles over or making the mesh non-manifold?
+		/// </summary>
+		bool CanCollapse(uint from, uint to)
+		{
+			markStamp += 2;
+			uint toNeighbor = markStamp - 1;
+			ForTriangles(to, [&](uint triangle)
+			{
+				for (int corner = 0; corner < 3; corner++)
+					mark[indices[triangle * 3 + corner]] = toNeighbor;
+			});
+
+			// The vertices next to both must be exactly the third vertices of the triangles of the edge (the link condition), or the collapse makes duplicate triangles or pinches the surface.
+			uint sharedTriangles = 0, sharedNeighbors = 0;
+			bool flips = false;
+			ForTriangles(from, [&](uint triangle)
+			{
+				const uint* corners = &indices[triangle * 3];
+				bool shared = corners[0] == to || corners[1] == to || corners[2] == to;
+				sharedTriangles += shared;
+				for (int corner = 0; corner < 3; corner++)
+				{
+					uint neighbor = corners[corner];
+					if (neighbor != from && neighbor != to && mark[neighbor] == toNeighbor)
+					{
+						mark[neighbor] = markStamp;
+						sharedNeighbors++;
+					}
+				}
+				if (shared)
+					return;
+
+				// The triangle with from moved to to must face about the same way.
+				Vector3D moved[3];
+				for (int corner = 0; corner < 3; corner++)
+					moved[corner] = positions[corners[corner] == from ? to : corners[corner]];
+				Vector3D oldNormal = (positions[corners[1]] - positions[corners[0]]).Cross(positions[corners[2]] - positions[corners[0]]);
+				Vector3D newNormal = (moved[1] - moved[0]).Cross(moved[2] - moved[0]);
+				float newLength = newNormal.SqrMagnitude();
+				if (newLength == 0 || oldNormal.Dot(newNormal) < MIN_NORMAL_COSINE * SMath::Sqrt(oldNormal.SqrMagnitude() * newLength))
+					flips = true;
+			});
+			return sharedTriangles > 0 && sharedNeighbors == sharedTriangles && !flips;
+		}
+
+		/// <summary>
+		/// Collapses from into to, and returns the number of triangles removed.
+		/// </summary>
+		uint Apply(uint from, uint to)
+		{
+			uint removedTriangles = 0;
+			ForTriangles(from, [&](uint triangle)
+			{
+				uint* corners = &indices[triangle * 3];
+				if (corners[0] == to || corners[1] == to || corners[2] == to)
+				{
+					alive[triangle] = false;
+					removedTriangles++;
+				}
+				else
+				{
+					for (int corner = 0; corner < 3; corner++)
+					{
+						if (corners[corner] == from)
+							corners[corner] = to;
+					}
+				}
+			});
+
+			// Splicing the rings of the two vertices makes one ring of both, so the triangles of from are now found from to.
+			std::swap(next[from], next[to]);
+			removed[from] = true;
+			uint toGroup = group[to];
+			quadrics[toGroup] = quadrics[toGroup].Add(quadrics[from].Translated(positions[to] - positions[from]));
+			version[toGroup]++;
+
+			// The errors of collapsing into and out of to changed, and the old ones are stale by the version.
+			markStamp++;
+			mark[to] = markStamp;
+			ForTriangles(to, [&](uint triangle)
+			{
+				for (int corner = 0; corner < 3; corner++)
+				{
+					uint vertex = indices[triangle * 3 + corner];
+					if (mark[vertex] != markStamp)
+					{
+						mark[vertex] = markStamp;
+						QueueCollapse(to, vertex);
+						QueueCollapse(vertex, to);
+					}
+				}
+			});
+			return removedTriangles;
+		}
+		#pragma endregion
+
+		const std::vector<Vector3D>& positions;
+		std::vector<uint> indices;
+		size_t vertexCount;
+
+		/// <summary>
+		/// The first vertex with the same position as every vertex.
+		/// </summary>
+		std::vector<uint> group;
+		std::vector<bool> locked, removed;
+
+		/// <summary>
+		/// The quadrics and the versions of the groups, kept on their first vertices. Every quadric is around the position of its group, so errors much smaller than the mesh aren't lost.
+		/// </summary>
+		std::vector<Quadric> quadrics;
+		std::vector<uint> version;
+
+		/// <summary>
+		/// The next vertex in the ring of vertices collapsed together.
+		/// </summary>
+		std::vector<uint> next;
+		std::vector<uint> firstTriangle, vertexTriangles;
+		std::vector<bool> alive;
+
+		/// <summary>
+		/// Marks of neighbors for CanCollapse and Apply, where new stamps clear all of them.
+		/// </summary>
+		std::vector<uint> mark;
+		uint markStamp;
+
+		/// <summary>
+		/// A heap of the collapses with the smallest error on top, including stale ones.
+		/// </summary>
+		std::vector<Collapse> queue;
+	};
+
+	MeshLod MeshSimplifier::Simplify(const Mesh& mesh, size_t targetTriangleCount, float maxError)
+	{
+		return Simplification(mesh, mesh.indices).Run(targetTriangleCount, maxError);
+	}
+
+	std::vector<MeshLod> MeshSimplifier::GenerateLods(const Mesh& mesh, const float* ratios, size_t lodCount)
+	{
+		std::vector<MeshLod> lods;
+		const std::vector<uint>* source = &mesh.indices;
+		float error = 0;
+		for (size_t lod = 0; lod < lodCount; lod++)
+		{
+			// The errors of simplifying every level from the previous one add up to at most their sum.
+			lods.push_back(Simplification(mesh, *source).Run((size_t)(mesh.TriangleCount() * ratios[lod]), std::numeric_limits<float>::max()));
+			error = lods.back().error = error + lods.back().error;
+			source = &lods.back().indices;
+		}
+		return lods;
+	}
+
+	void MeshSimplifier::GenerateLods(const Mesh* meshes, size_t meshCount, const float* ratios, size_t lodCount, std::vector<MeshLod>* lods, bool multithreaded)
+	{
+		Parallel::For(meshCount, multithreaded ? 1 : meshCount, [=](size_t begin, size_t end)
+		{
+			for (size_t mesh = begin; mesh < end; mesh++)
+				lods[mesh] = GenerateLods(meshes[mesh], ratios, lodCount);
+		});
+	}
+} }
\ No newline at end of file
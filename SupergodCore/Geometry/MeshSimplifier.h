@@ -0,0 +1,50 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "Mesh.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	/// <summary>
+	/// A simplified version of a mesh: new triangles over the same vertices.
+	/// </summary>
+	struct MeshLod final
+	{
+		/// <summary>
+		/// The vertex indices of the triangles, three for every triangle.
+		/// </summary>
+		std::vector<uint> indices;
+
+		/// <summary>
+		/// About how far the simplified surface is from the original one, in the units of the positions.
+		/// </summary>
+		float error;
+	};
+
+	/// <summary>
+	/// Simplifies meshes for levels of detail by collapsing edges with quadric error metrics (Garland and Heckbert):
+	/// every vertex keeps the quadric of the planes of the triangles around it, and the edge whose collapse moves the surface the least from them is collapsed first, from a priority queue.<para/>
+	/// Vertices are only removed by collapsing them into a neighbor, never moved, so the levels share the vertex streams of the mesh and keep its normals and texture coordinates as they are.
+	/// Vertices on open borders, and vertices that share their position with others (seams of the normals or texture coordinates), are never removed, so the outline and the seams stay in place.
+	/// Run MeshOptimizer::Deduplicate first, otherwise duplicate vertices are taken for seams.
+	/// </summary>
+	namespace MeshSimplifier
+	{
+		/// <summary>
+		/// Collapses edges of mesh until it has at most targetTriangleCount triangles, or until the next collapse would have an error above maxError.
+		/// </summary>
+		SUPERGOD_API_FUNC MeshLod Simplify(const Mesh& mesh, size_t targetTriangleCount, float maxError = std::numeric_limits<float>::max());
+
+		/// <summary>
+		/// Simplifies mesh to lodCount levels, where level i has about ratios[i] times the triangles of mesh. Every level is simplified from the one before it, so ratios must get smaller.
+		/// </summary>
+		SUPERGOD_API_FUNC std::vector<MeshLod> GenerateLods(const Mesh& mesh, const float* ratios, size_t lodCount);
+
+		/// <summary>
+		/// Generates the levels of meshCount meshes into lods (one vector for every mesh), with every mesh simplified on its own thread. See GenerateLods(const Mesh&, const float*, size_t).
+		/// </summary>
+		SUPERGOD_API_FUNC void GenerateLods(const Mesh* meshes, size_t meshCount, const float* ratios, size_t lodCount, std::vector<MeshLod>* lods, bool multithreaded = true);
+	}
+} }
\ No newline at end of file
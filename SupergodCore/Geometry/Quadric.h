@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/SMath.h"
+#include "Math/Vectors/Vector3D.h"
+#include "Math/Matrices/Matrix3x3.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	/// <summary>
+	/// A quadric error metric: the sum of the weighted squared distances of a point from a set of planes.<para/>
+	/// It is the symmetric 4x4 matrix [a b; b c] applied to (point, 1), kept as its 3x3 part a, the column b and the corner c.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Quadric final
+	{
+		Math::Matrix3x3 a;
+		Math::Vector3D b;
+		float c;
+
+		/// <summary>
+		/// The sum of the weights of the planes, which Error divides by.
+		/// </summary>
+		float weight;
+
+		/// <summary>
+		/// Creates a quadric without planes, which is 0 everywhere.
+		/// </summary>
+		constexpr Quadric()
+			: a(), b(), c(0), weight(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a quadric from its parts. See Quadric.
+		/// </summary>
+		constexpr Quadric(const Math::Matrix3x3& a, const Math::Vector3D& b, float c, float weight)
+			: a(a), b(b), c(c), weight(weight)
+		{
+		}
+
+		/// <summary>
+		/// Creates the quadric of the plane of points p where normal.Dot(p) + distance = 0, multiplied by weight. normal must be a unit vector.
+		/// </summary>
+		static constexpr Quadric FromPlane(const Math::Vector3D& normal, float distance, float weight)
+		{
+			return Quadric(
+				Math::Matrix3x3(
+					normal.x * normal.x, normal.x * normal.y, normal.x * normal.z,
+					normal.y * normal.x, normal.y * normal.y, normal.y * normal.z,
+					normal.z * normal.x, normal.z * normal.y, normal.z * normal.z).Multiply(weight),
+				normal * (distance * weight), distance * distance * weight, weight);
+		}
+
+		/// <summary>
+		/// Gets the quadric of the planes of both this and other.
+		/// </summary>
+		constexpr Quadric Add(const Quadric& other) const
+		{
+			return Quadric(a.Add(other.a), b + other.b, c + other.c, weight + other.weight);
+		}
+
+		/// <summary>
+		/// Gets the quadric of the same planes around a new origin, at offset from the current one: Translated(offset).Evaluate(point) = Evaluate(point + offset).<para/>
+		/// Points are best kept close to the origin, since the parts of the quadric grow with the distance and the small errors get lost between them.
+		/// </summary>
+		constexpr Quadric Translated(const Math::Vector3D& offset) const
+		{
+			return Quadric(a, b + a.Multiply(offset), Evaluate(offset), weight);
+		}
+
+		/// <summary>
+		/// Gets the sum of the weighted squared distances of point from the planes.
+		/// </summary>
+		constexpr float Evaluate(const Math::Vector3D& point) const
+		{
+			return a.Multiply(point).Dot(point) + 2 * b.Dot(point) + c;
+		}
+
+		/// <summary>
+		/// Gets the root mean square distance of point from the planes, by their weights.
+		/// </summary>
+		inline float Error(const Math::Vector3D& point) const
+		{
+			return weight > 0 ? Math::SMath::Sqrt(Math::SMath::Max(Evaluate(point), 0.f) / weight) : 0;
+		}
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "TangentSpace.h"
+#include "Common/Parallel.h"
+#include "Math/SMath.h"
+#include <algorithm>
+
+namespace SupergodCore { namespace Geometry
+{
+	using namespace Math;
+
+	/// <summary>
+	/// Splits the vertices of mesh into a range for every thread, and calls function(first, count) for each of them.<para/>
+	/// Every range goes over all the triangles in order and adds only to its own vertices, so nothing is shared between threads and every vertex sums its triangles in the same order as a single thread does.
+	/// </summary>
+	template<class TFunction>
+	static void ForVertexRanges(const Mesh& mesh, bool multithreaded, const TFunction& function)
+	{
+		size_t rangeCount = multithreaded ? Parallel::ThreadCount() : 1;
+		size_t rangeSize = (mesh.VertexCount() + rangeCount - 1) / rangeCount;
+		Parallel::For(rangeCount, 1, [&](size_t begin, size_t end)
+		{
+			for (size_t range = begin; range < end; range++)
+			{
+				size_t first = range * rangeSize;
+				if (first < mesh.VertexCount())
+					function((uint)first, (uint)std::min(rangeSize, mesh.VertexCount() - first));
+			}
+		});
+	}
+
+	/// <summary>
+	/// Is vertex in the range of count vertices from first? Vertices before first wrap around to big numbers, so one comparison covers both ends.
+	/// </summary>
+	static inline bool InRange(uint vertex, uint first, uint count)
+	{
+		return vertex - first < count;
+	}
+
+	/// <summary>
+	/// Gets the angle between two directions that don't have to be normalized, or 0 if one of them is zero.
+	/// </summary>
+	static inline float AngleBetween(const Vector3D& a, const Vector3D& b)
+	{
+		float lengths = SMath::Sqrt(a.SqrMagnitude() * b.SqrMagnitude());
+		return lengths > 0 ? SMath::Acos(SMath::Clamp(a.Dot(b) / lengths, -1.f, 1.f)) : 0;
+	}
+
+	/// <summary>
+	/// Gets vector without its part along the unit vector normal.
+	/// </summary>
+	static inline Vector3D Perpendicular(const Vector3D& vector, const Vector3D& normal)
+	{
+		return vector - normal * normal.Dot(vector);
+	}
+
+	/// <summary>
+	/// Gets vector normalized, or zero if it's too short to normalize.
+	/// </summary>
+	static inline Vector3D NormalizedOrZero(const Vector3D& vector)
+	{
+		float length = vector.Magnitude();
+		return length > 1e-20f ? vector / length : Vector3D();
+	}
+
+	void TangentSpace::ComputeNormals(Mesh& mesh, NormalWeighting weighting, bool multithreaded)
+	{
+		const std::vector<Vector3D>& positions = mesh.positions;
+		const std::vector<uint>& indices = mesh.indices;
+		mesh.normals.assign(mesh.VertexCount(), Vector3D());
+		ForVertexRanges(mesh, multithreaded, [&](uint first, uint count)
+		{
+			for (size_t triangle = 0; triangle < mesh.TriangleCount(); triangle++)
+			{
+				const uint* corners = &indices[triangle * 3];
+				if (!InRange(corners[0], first, count) && !InRange(corners[1], first, count) && !InRange(corners[2], first, count))
+					continue;
+
+				// The length of the cross product is twice the area.
+				const Vector3D* trianglePositions[3] = { &positions[corners[0]], &positions[corners[1]], &positions[corners[2]] };
+				Vector3D normal = (*trianglePositions[1] - *trianglePositions[0]).Cross(*trianglePositions[2] - *trianglePositions[0]);
+				if (weighting != NormalWeighting::Area)
+					normal = NormalizedOrZero(normal);
+
+				for (int corner = 0; corner < 3; corner++)
+				{
+					if (!InRange(corners[corner], first, count))
+						continue;
+
+					Vector3D& vertexNormal = mesh.normals[corners[corner]];
+					if (weighting == NormalWeighting::Angle)
+					{
+						const Vector3D& position = *trianglePositions[corner];
+						vertexNormal = vertexNormal + normal * AngleBetween(*trianglePositions[(corner + 1) % 3] - position, *trianglePositions[(corner + 2) % 3] - position);
+					}
+					else
+						vertexNormal = vertexNormal + normal;
+				}
+			}
+
+			for (uint vertex = first; vertex < first + count; vertex++)
+			{
+				Vector3D normal = NormalizedOrZero(mesh.normals[vertex]);
+				mesh.normals[vertex] = normal == Vector3D() ? Vector3D::UnitY() : normal;
+			}
+		});
+	}
+
+	bool TangentSpace::ComputeTangents(Mesh& mesh, bool multithreaded)
+	{
+		if (!mesh.HasNormals() || !mesh.HasUvs())
+			return false;
+
+		const std::vector<Vector3D>& positions = mesh.positions;
+		const std::vector<Vector3D>& normals = mesh.normals;
+		const std::vector<Vector2D>& uvs = mesh.uvs;
+		const std::vector<uint>& indices = mesh.indices;
+
+		// The tangents are summed in xyz, and the handedness of the triangles weighted the same way in w.
+		mesh.tangents.assign(mesh.VertexCount(), Vector4D());
+		ForVertexRanges(mesh, multithreaded, [&](uint first, uint count)
+		{
+			for (size_t triangle = 0; triangle < mesh.TriangleCount(); triangle++)
+			{
+				const uint* corners = &indices[triangle * 3];
+				if (!InRange(corners[0], first, count) && !InRange(corners[1], first, count) && !InRange(corners[2], first, count))
+					continue;
+
+				// Triangles whose texture coordinates have no area have no direction to add.
+				Vector2D uvEdge1 = uvs[corners[1]] - uvs[corners[0]];
+				Vector2D uvEdge2 = uvs[corners[2]] - uvs[corners[0]];
+				float signedUvArea = uvEdge1.x * uvEdge2.y - uvEdge1.y * uvEdge2.x;
+				if (signedUvArea == 0)
+					continue;
+
+				// The direction u grows in, flipped where the texture is mirrored like MikkTSpace does.
+				const Vector3D* trianglePositions[3] = { &positions[corners[0]], &positions[corners[1]], &positions[corners[2]] };
+				float handedness = signedUvArea > 0 ? 1.f : -1.f;
+				Vector3D faceTangent = NormalizedOrZero((*trianglePositions[1] - *trianglePositions[0]) * uvEdge2.y - (*trianglePositions[2] - *trianglePositions[0]) * uvEdge1.y) * handedness;
+				for (int corner = 0; corner < 3; corner++)
+				{
+					uint vertex = corners[corner];
+					if (!InRange(vertex, first, count))
+						continue;
+
+					// The angle of the corner, seen along the normal of the vertex.
+					const Vector3D& normal = normals[vertex];
+					const Vector3D& position = *trianglePositions[corner];
+					float angle = AngleBetween(Perpendicular(*trianglePositions[(corner + 1) % 3] - position, normal),
+						Perpendicular(*trianglePositions[(corner + 2) % 3] - position, normal));
+					mesh.tangents[vertex] = mesh.tangents[vertex] + Vector4D(NormalizedOrZero(Perpendicular(faceTangent, normal)) * angle, handedness * angle);
+				}
+			}
+
+			for (uint vertex = first; vertex < first + count; vertex++)
+			{
+				// Vertices without a direction still get a tangent perpendicular to their normal.
+				const Vector4D& sum = mesh.tangents[vertex];
+				Vector3D tangent = NormalizedOrZero(Vector3D(sum.x, sum.y, sum.z));
+				if (tangent == Vector3D())
+				{
+					const Vector3D& normal = normals[vertex];
+					tangent = NormalizedOrZero(Perpendicular(SMath::Abs(normal.x) < .9f ? Vector3D::UnitX() : Vector3D::UnitY(), normal));
+				}
+				mesh.tangents[vertex] = Vector4D(tangent, sum.w < 0 ? -1.f : 1.f);
+			}
+		});
+		return true;
+	}
+} }
\ No newline at end of file
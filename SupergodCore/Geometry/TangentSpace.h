@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Mesh.h"
+
+namespace SupergodCore { namespace Geometry
+{
+	/// <summary>
+	/// How much every triangle adds to the normals of its vertices.
+	/// </summary>
+	enum class NormalWeighting
+	{
+		/// <summary>
+		/// All triangles add the same, so vertices lean towards the sides with more (smaller) triangles.
+		/// </summary>
+		Uniform = 1,
+
+		/// <summary>
+		/// Bigger triangles add more. This is the cheapest and works well for most meshes.
+		/// </summary>
+		Area,
+
+		/// <summary>
+		/// Triangles add by the angle of their corner at the vertex, so the normals don't depend on how the faces are split into triangles.
+		/// </summary>
+		Angle
+	};
+
+	/// <summary>
+	/// Computes smooth normals and tangents of whole meshes at once, split between the threads of Parallel without any memory besides the streams they write.<para/>
+	/// Every thread owns a range of vertices and sums the triangles around them in the order of the indices, so the results are the same to the bit with any number of threads.
+	/// </summary>
+	namespace TangentSpace
+	{
+		/// <summary>
+		/// Sets the normals of mesh to the weighted average of the normals of the triangles around every vertex. Vertices that no triangle uses get the normal (0, 1, 0).
+		/// </summary>
+		SUPERGOD_API_FUNC void ComputeNormals(Mesh& mesh, NormalWeighting weighting = NormalWeighting::Area, bool multithreaded = true);
+
+		/// <summary>
+		/// Sets the tangents of mesh the same way MikkTSpace does, so normal maps baked with it look right: the tangents of every triangle corner are made perpendicular to the vertex normal and averaged by the angle of the corner.<para/>
+		/// MikkTSpace also splits vertices whose triangles have mirrored texture coordinates, and this can't add vertices, so those get the handedness of most of their corners. Vertices split at UV seams (like the output of MeshOptimizer::Deduplicate) don't have this problem.<para/>
+		/// Returns false and does nothing if the mesh has no normals or no texture coordinates.
+		/// </summary>
+		SUPERGOD_API_FUNC bool ComputeTangents(Mesh& mesh, bool multithreaded = true);
+	}
+} }
\ No newline at end of file
@@ -1,82 +1,161 @@
 #include "Angle.h"
+#include "LerpOps.h"
+#include <emmintrin.h>
 
 namespace SupergodCore { namespace Math
 {
-	Angle::Angle()
-	{
-		SetRadians(0);
-	}
+	static_assert(sizeof(Angle) == sizeof(float), "The batched functions treat Angle arrays as arrays of radians.");
 
-	Angle::Angle(float angle, const Measurement& measurement)
+	/// <summary>
+	/// Wraps 4 values in radians like WrapRadians and stores them in destination.<para/>
+	/// Values within a turn of the range take one step like WrapRadians does. The rare values further out fall back to WrapRadians itself, so the results are always the same.
+	/// </summary>
+	static inline void WrapFour(__m128 radians, float* destination)
 	{
-		switch (measurement)
-		{
-		case Measurement::Degrees:
-			SetDegrees(angle);
-			break;
+		__m128 zero = _mm_setzero_ps();
+		__m128 tau = _mm_set1_ps(Constants::TAU);
 
-		case Measurement::Radians:
-			SetRadians(angle);
-			break;
+		__m128 tooBig = _mm_cmpgt_ps(radians, tau);
+		__m128 tooSmall = _mm_cmplt_ps(radians, zero);
+		__m128 wrapped = _mm_add_ps(radians, _mm_or_ps(_mm_and_ps(tooSmall, tau), _mm_and_ps(tooBig, _mm_sub_ps(zero, tau))));
+		_mm_storeu_ps(destination, wrapped);
 
-		case Measurement::Revolutions:
-			SetRevolutions(angle);
-			break;
+		int stillOut = _mm_movemask_ps(_mm_or_ps(_mm_cmpgt_ps(wrapped, tau), _mm_cmplt_ps(wrapped, zero)));
+		if (stillOut != 0)
+		{
+			float original[4];
+			_mm_storeu_ps(original, radians);
+			for (int i = 0; i < 4; i++)
+			{
+				if ((stillOut >> i) & 1)
+					destination[i] = Angle::WrapRadians(original[i]);
+			}
 		}
 	}
 
-	bool Angle::Equals(Angle other) const
+	void Angle::Wrap(const float* radians, Angle* destination, size_t count)
 	{
-		return GetRadians() == other.GetRadians();
-	}
+		float* result = (float*)destination;
 
-	bool Angle::CloseEnough(Angle other, float threshold) const
-	{
-		return SMath::CloseEnough(GetRadians(), other.GetRadians(), threshold);
-	}
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			WrapFour(_mm_loadu_ps(radians + i), result + i);
 
-	bool Angle::BiggerThan(Angle other) const
-	{
-		return GetRadians() > other.GetRadians();
+		for (; i < count; i++)
+			destination[i] = Angle(radians[i]);
 	}
 
-	bool Angle::SmallerThan(Angle other) const
+	void Angle::Add(const Angle* angles, const float* radians, Angle* destination, size_t count)
 	{
-		return GetRadians() < other.GetRadians();
-	}
+		const float* sources = (const float*)angles;
+		float* result = (float*)destination;
 
-	Angle Angle::Multiply(float scalar) const
-	{
-		return GetRadians() * scalar;
-	}
-	
-	Angle Angle::Divide(float scalar) const
-	{
-		return GetRadians() / scalar;
-	}
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			WrapFour(_mm_add_ps(_mm_loadu_ps(sources + i), _mm_loadu_ps(radians + i)), result + i);
 
-	Angle Angle::Add(Angle other) const
-	{
-		return GetRadians() + other.GetRadians();
+		for (; i < count; i++)
+			destination[i] = Angle(angles[i].GetRadians() + radians[i]);
 	}
 
-	Angle Angle::Subtract(Angle other) const
+	void Angle::LerpShortest(const Angle* sources, const Angle* targets, const float* alphas, Angle* destination, size_t count, bool clampAlpha)
 	{
-		return GetRadians() - other.GetRadians();
-	}
+		const float* from = (const float*)sources;
+		const float* to = (const float*)targets;
+		float* result = (float*)destination;
 
-	Angle Angle::Flipped() const
-	{
-		return GetRadians() - Constants::PI;
+		__m128 zero = _mm_setzero_ps();
+		__m128 pi = _mm_set1_ps(Constants::PI);
+		__m128 minusPi = _mm_set1_ps(-Constants::PI);
+		__m128 tau = _mm_set1_ps(Constants::TAU);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 alpha = _mm_loadu_ps(alphas + i);
+			if (clampAlpha)
+				alpha = LerpOps::ClampAlpha(alpha);
+
+			// DeltaTo: bring the difference between -pi and pi.
+			__m128 source = _mm_loadu_ps(from + i);
+			__m128 delta = _mm_sub_ps(_mm_loadu_ps(to + i), source);
+			__m128 tooBig = _mm_cmpgt_ps(delta, pi);
+			__m128 tooSmall = _mm_cmple_ps(delta, minusPi);
+			delta = _mm_add_ps(delta, _mm_or_ps(_mm_and_ps(tooSmall, tau), _mm_and_ps(tooBig, _mm_sub_ps(zero, tau))));
+
+			WrapFour(_mm_add_ps(source, _mm_mul_ps(delta, alpha)), result + i);
+		}
+
+		for (; i < count; i++)
+			destination[i] = sources[i].LerpShortest(targets[i], alphas[i], clampAlpha);
 	}
 
-	Angle Angle::Reflection() const
+	/// <summary>
+	/// Computes the sines and cosines of 4 angles between 0 and 2pi.<para/>
+	/// The angle is reduced to a quarter turn around 0 and the sine and cosine of the remainder are evaluated with the minimax polynomials from Cephes.
+	/// </summary>
+	static inline void SinCosFour(__m128 radians, __m128& sines, __m128& cosines)
 	{
-		return Constants::TAU - GetRadians();
+		// quadrant = round(radians / (pi / 2)), remainder = radians - quadrant * pi / 2, with pi / 2 split in 3 parts so the subtraction stays exact.
+		__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(radians, _mm_set1_ps(2 / Constants::PI)));
+		__m128 quadrantFloat = _mm_cvtepi32_ps(quadrant);
+		__m128 x = _mm_sub_ps(radians, _mm_mul_ps(quadrantFloat, _mm_set1_ps(1.5703125f)));
+		x = _mm_sub_ps(x, _mm_mul_ps(quadrantFloat, _mm_set1_ps(4.837512969970703125e-4f)));
+		x = _mm_sub_ps(x, _mm_mul_ps(quadrantFloat, _mm_set1_ps(7.54978995489188216e-8f)));
+
+		__m128 x2 = _mm_mul_ps(x, x);
+
+		__m128 sine = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), x2), _mm_set1_ps(8.3321608736e-3f));
+		sine = _mm_add_ps(_mm_mul_ps(sine, x2), _mm_set1_ps(-1.6666654611e-1f));
+		sine = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sine, x2), x), x);
+
+		__m128 cosine = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), x2), _mm_set1_ps(-1.388731625493765e-3f));
+		cosine = _mm_add_ps(_mm_mul_ps(cosine, x2), _mm_set1_ps(4.166664568298827e-2f));
+		cosine = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(cosine, x2), x2), _mm_sub_ps(_mm_set1_ps(1), _mm_mul_ps(x2, _mm_set1_ps(.5f))));
+
+		// Odd quadrants swap sine and cosine, and the sign bits come from the quadrant:
+		// sin is negative in quadrants 2 and 3, cos is negative in quadrants 1 and 2.
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+		__m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+		sines = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, cosine), _mm_andnot_ps(swap, sine)), sineSign);
+		cosines = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, sine), _mm_andnot_ps(swap, cosine)), cosineSign);
 	}
 
-	Angle Angle::Clamp(Angle min, Angle max) const
+	void Angle::SinCos(const Angle* angles, float* sines, float* cosines, size_t count)
 	{
-		return SMath::Clamp(GetRadians(), min, max);
+		const float* radians = (const float*)angles;
+
+		__m128 sine, cosine;
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			SinCosFour(_mm_loadu_ps(radians + i), sine, cosine);
+			if (sines != nullptr)
+				_mm_storeu_ps(sines + i, sine);
+
+			if (cosines != nullptr)
+				_mm_storeu_ps(cosines + i, cosine);
+		}
+
+		if (i < count)
+		{
+			float rest[4] = {}, restSines[4], restCosines[4];
+			for (size_t j = i; j < count; j++)
+				rest[j - i] = radians[j];
+
+			SinCosFour(_mm_loadu_ps(rest), sine, cosine);
+			_mm_storeu_ps(restSines, sine);
+			_mm_storeu_ps(restCosines, cosine);
+			for (size_t j = i; j < count; j++)
+			{
+				if (sines != nullptr)
+					sines[j] = restSines[j - i];
+
+				if (cosines != nullptr)
+					cosines[j] = restCosines[j - i];
+			}
+		}
 	}
 } }
\ No newline at end of file
@@ -59,7 +59,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
         /// Wraps value between 0 to 2pi using SMath::Wrap.
         /// </summary>
-        static float WrapRadians(float value)
+        static constexpr float WrapRadians(float value)
         {
             return SMath::Wrap(value, Constants::TAU);
         }
@@ -67,7 +67,7 @@ namespace SupergodCore { namespace Math
         /// <summary>
         /// Wraps value between 0 to 2pi using SMath::Wrap.
         /// </summary>
-        static float WrapDegrees(float value)
+        static constexpr float WrapDegrees(float value)
         {
             return SMath::Wrap(value, 360);
         }
@@ -75,7 +75,7 @@ namespace SupergodCore { namespace Math
         /// <summary>
         /// Wraps value between 0 to 2pi using SMath::Wrap.
         /// </summary>
-        static float WrapRevolutions(float value)
+        static constexpr float WrapRevolutions(float value)
         {
             return SMath::Wrap(value, 1);
         }
@@ -85,62 +85,62 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Sets the angle as radians from 0 to 2pi.
 		/// </summary>
-		inline float GetRadians() const { return _radians; }
+		inline constexpr float GetRadians() const { return _radians; }
 
 		/// <summary>
 		/// Sets the angle as radians from 0 to 2pi.
 		/// </summary>
-		inline float SetRadians(float value) { return _radians = WrapRadians(value); }
+		inline constexpr float SetRadians(float value) { return _radians = WrapRadians(value); }
 
 		/// <summary>
 		/// Gets the angle as radians from -pi to pi.
 		/// </summary>
-		inline float GetNegativeRadians() const { return GetRadians() - Constants::PI; }
+		inline constexpr float GetNegativeRadians() const { return GetRadians() - Constants::PI; }
 
 		/// <summary>
 		/// Sets the angle as radians from -pi to pi.
 		/// </summary>
-		inline float SetNegativeRadians(float value) { return SetRadians(value + Constants::PI); }
+		inline constexpr float SetNegativeRadians(float value) { return SetRadians(value + Constants::PI); }
 
 		/// <summary>
 		/// Gets the angle as degrees from 0 to 360.
 		/// </summary>
-		inline float GetDegrees() const { return GetRadians() * RAD_TO_DEG; }
+		inline constexpr float GetDegrees() const { return GetRadians() * RAD_TO_DEG; }
 
 		/// <summary>
 		/// Sets the angle as degrees from 0 to 360.
 		/// </summary>
-		inline float SetDegrees(float value) { return SetRadians(value * DEG_TO_RAD); }
+		inline constexpr float SetDegrees(float value) { return SetRadians(value * DEG_TO_RAD); }
 
 		/// <summary>
 		/// Gets the angle as degrees from -180 to 180.
 		/// </summary>
-		inline float GetNegativeDegrees() const { return GetDegrees() - 180; }
+		inline constexpr float GetNegativeDegrees() const { return GetDegrees() - 180; }
 
 		/// <summary>
 		/// Sets the angle as degrees from -180 to 180.
 		/// </summary>
-		inline float SetNegativeDegrees(float value) { return SetDegrees(value + 180); }
+		inline constexpr float SetNegativeDegrees(float value) { return SetDegrees(value + 180); }
 
 		/// <summary>
 		/// Gets the angle as revolutions from 0 to 1.
 		/// </summary>
-		inline float GetRevolutions() const { return GetRadians() * RAD_TO_REV; }
+		inline constexpr float GetRevolutions() const { return GetRadians() * RAD_TO_REV; }
 
 		/// <summary>
 		/// Sets the angle as revolutions from 0 to 1.
 		/// </summary>
-		inline float SetRevolutions(float value) { return SetRadians(value * REV_TO_RAD); }
+		inline constexpr float SetRevolutions(float value) { return SetRadians(value * REV_TO_RAD); }
 
 		/// <summary>
 		/// Gets the angle as revolutions from -0.5 to 0.5.
 		/// </summary>
-		inline float GetNegativeRevolutions() const { return GetRevolutions() - .5f; }
+		inline constexpr float GetNegativeRevolutions() const { return GetRevolutions() - .5f; }
 
 		/// <summary>
 		/// Sets the angle as revolutions from -0.5 to 0.5.
 		/// </summary>
-		inline float SetNegativeRevolutions(float value) { return SetRevolutions(value + .5f); }
+		inline constexpr float SetNegativeRevolutions(float value) { return SetRevolutions(value + .5f); }
 		#pragma endregion
 
 		/// <summary>
@@ -167,19 +167,28 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new angle and sets it to 0.
 		/// </summary>
-		Angle();
+		constexpr Angle()
+			: _radians(0)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new angle with a value and wraps it to a valid range for angles.
 		/// </summary>
 		/// <param name="angle">The value of the angle.</param>
 		/// <param name="measurement">The type of measurement to measure the angles with.</param>
-		Angle(float angle, const Measurement& measurement = Measurement::Radians);
+		constexpr Angle(float angle, const Measurement& measurement = Measurement::Radians)
+			: _radians(WrapRadians(
+				measurement == Measurement::Degrees ? angle * DEG_TO_RAD :
+				measurement == Measurement::Revolutions ? angle * REV_TO_RAD :
+				angle))
+		{
+		}
 
 		/// <summary>
 		/// Gets the angle as radians.
 		/// </summary>
-		inline operator float() const
+		inline constexpr operator float() const
 		{
 			return GetRadians();
 		}
@@ -188,34 +197,49 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Are the radians of this the same as the radians of other?
 		/// </summary>
-		bool Equals(Angle other) const;
+		constexpr bool Equals(Angle other) const
+		{
+			return GetRadians() == other.GetRadians();
+		}
 
 		/// <summary>
 		/// Is the distance between the radians of this and the radians of other smaller or equal to threshold?
 		/// </summary>
-		bool CloseEnough(Angle other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(Angle other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(GetRadians(), other.GetRadians(), threshold);
+		}
 		
 		/// <summary>
 		/// Are the radians of this bigger than the radians of other?
 		/// </summary>
-		bool BiggerThan(Angle other) const;
+		constexpr bool BiggerThan(Angle other) const
+		{
+			return GetRadians() > other.GetRadians();
+		}
 
 		/// <summary>
 		/// Are the radians of this smaller than the radians of other?
 		/// </summary>
-		bool SmallerThan(Angle other) const;
+		constexpr bool SmallerThan(Angle other) const
+		{
+			return GetRadians() < other.GetRadians();
+		}
 		#pragma endregion
 		
 		#pragma region Scaling (scalar multiplication and division).
 		/// <summary>
 		/// Multiplies the radians of this by scalar.
 		/// </summary>
-		Angle Multiply(float scalar) const;
+		constexpr Angle Multiply(float scalar) const
+		{
+			return GetRadians() * scalar;
+		}
 
 		/// <summary>
 		/// Multiplies scalar by the radians of angle.
 		/// </summary>
-		friend Angle operator*(float scalar, Angle angle)
+		friend constexpr Angle operator*(float scalar, Angle angle)
 		{
 			return angle.Multiply(scalar);
 		}
@@ -223,28 +247,40 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Divides the radians of this by scalar.
 		/// </summary>
-		Angle Divide(float scalar) const;
+		constexpr Angle Divide(float scalar) const
+		{
+			return GetRadians() / scalar;
+		}
 		#pragma endregion
 
 		#pragma region Addition and subtraction.
 		/// <summary>
 		/// Adds the radians of this and the radians of other.
 		/// </summary>
-		Angle Add(Angle other) const;
+		constexpr Angle Add(Angle other) const
+		{
+			return GetRadians() + other.GetRadians();
+		}
 
 		/// <summary>
 		/// Subtracts the radians of other from the radians of this.
 		/// </summary>
-		Angle Subtract(Angle other) const;
+		constexpr Angle Subtract(Angle other) const
+		{
+			return GetRadians() - other.GetRadians();
+		}
 		#pragma endregion
 
 		#pragma region Flipping and reflecting.
 		/// <summary>
 		/// Flips this angle, so it's pointing to the opposite angle (subtracts 90 degrees from the angle).
 		/// </summary>
-		Angle Flipped() const;
+		constexpr Angle Flipped() const
+		{
+			return GetRadians() - Constants::PI;
+		}
 
-		static inline Angle Flip(Angle angle)
+		static inline constexpr Angle Flip(Angle angle)
 		{
 			return angle.Flipped();
 		}
@@ -252,12 +288,15 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Takes this rotation and puts it on the other side of the circle (subtract it from 360 degrees).
 		/// </summary>
-		Angle Reflection() const;
+		constexpr Angle Reflection() const
+		{
+			return Constants::TAU - GetRadians();
+		}
 
 		/// <summary>
 		/// Takes the rotation of angle and puts it on the other side of the circle (subtract it from 360 degrees).
 		/// </summary>
-		static inline Angle Reflect(Angle angle)
+		static inline constexpr Angle Reflect(Angle angle)
 		{
 			return angle.Reflection();
 		}
@@ -265,7 +304,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Takes this rotation and puts it on the other side of the circle (subtract it from 360 degrees).
 		/// </summary>
-		inline Angle operator-() const
+		inline constexpr Angle operator-() const
 		{
 			return Reflection();
 		}
@@ -275,7 +314,68 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Clamps this so it's never smaller than min and never bigger than max.
 		/// </summary>
-		Angle Clamp(Angle min, Angle max) const;
+		constexpr Angle Clamp(Angle min, Angle max) const
+		{
+			return SMath::Clamp(GetRadians(), min, max);
+		}
+		#pragma endregion
+
+		#pragma region Shortest path.
+		/// <summary>
+		/// Gets the smallest rotation (in radians, between -pi and pi) that turns this into target. Positive values rotate towards bigger angles.<para/>
+		/// For example, the delta from 350 degrees to 10 degrees is 20 degrees, not -340.
+		/// </summary>
+		constexpr float DeltaTo(Angle target) const
+		{
+			float delta = target.GetRadians() - GetRadians();
+			if (delta > Constants::PI)
+				return delta - Constants::TAU;
+
+			if (delta <= -Constants::PI)
+				return delta + Constants::TAU;
+
+			return delta;
+		}
+
+		/// <summary>
+		/// Interpolates between this and target by alpha, going the short way around the circle (unlike Lerp, which interpolates the radians).
+		/// </summary>
+		/// <param name="target">The angle to interpolate to.</param>
+		/// <param name="alpha">The interpolation factor.</param>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr Angle LerpShortest(Angle target, float alpha, bool clampAlpha = true) const
+		{
+			if (clampAlpha)
+				alpha = SMath::Clamp(alpha, 0, 1);
+
+			return GetRadians() + DeltaTo(target) * alpha;
+		}
+		#pragma endregion
+
+		#pragma region Batched (SSE2).
+		// Every batched function gives exactly the same results as its single angle version, except SinCos which has no single angle version.
+		// destination may be the same array as the sources, but must not partially overlap them.
+
+		/// <summary>
+		/// Wraps count values in radians to angles, like the Angle constructor.
+		/// </summary>
+		static void Wrap(const float* radians, Angle* destination, size_t count);
+
+		/// <summary>
+		/// Adds count rotations in radians to count angles and wraps the results (for example, headings += turn speeds * delta time).
+		/// </summary>
+		static void Add(const Angle* angles, const float* radians, Angle* destination, size_t count);
+
+		/// <summary>
+		/// Interpolates count angles from sources to targets by alphas like LerpShortest.
+		/// </summary>
+		static void LerpShortest(const Angle* sources, const Angle* targets, const float* alphas, Angle* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Gets the sines and the cosines of count angles, with a polynomial approximation that is accurate to about 1e-7.<para/>
+		/// sines or cosines may be null if only one of them is needed.
+		/// </summary>
+		static void SinCos(const Angle* angles, float* sines, float* cosines, size_t count);
 		#pragma endregion
 
 	private:
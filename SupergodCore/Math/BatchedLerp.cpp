@@ -0,0 +1,203 @@
+#include "BatchedLerp.h"
+#include "LerpOps.h"
+#include "Common/CpuFeatures.h"
+#include <utility>
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	static_assert(sizeof(Vector2D) == sizeof(float) * 2, "The batched lerps expect Vector2D arrays to be tightly packed.");
+	static_assert(sizeof(Vector3D) == sizeof(float) * 3, "The batched lerps expect Vector3D arrays to be tightly packed.");
+	static_assert(sizeof(Vector4D) == sizeof(float) * 4, "The batched lerps expect Vector4D arrays to be tightly packed.");
+	static_assert(sizeof(FColor) == sizeof(float) * 4, "The batched lerps expect FColor arrays to be tightly packed.");
+	static_assert(sizeof(Angle) == sizeof(float), "The batched lerps expect Angle arrays to be tightly packed.");
+	static_assert(sizeof(Matrix2x2) == sizeof(float) * 4, "The batched lerps expect Matrix2x2 arrays to be tightly packed.");
+	static_assert(sizeof(Matrix3x3) == sizeof(float) * 9, "The batched lerps expect Matrix3x3 arrays to be tightly packed.");
+
+	/// <summary>
+	/// source * (1 - alpha) + target * alpha, the same operations ILerpable::Lerp does.
+	/// </summary>
+	struct Sse2Lerp
+	{
+		static inline __m128 Lerp(__m128 source, __m128 target, __m128 alpha)
+		{
+			return _mm_add_ps(_mm_mul_ps(source, _mm_sub_ps(_mm_set1_ps(1), alpha)), _mm_mul_ps(target, alpha));
+		}
+	};
+
+	/// <summary>
+	/// (source - alpha * source) + alpha * target with two fused multiply-adds. Both steps are exact for alphas of 0 and 1.
+	/// </summary>
+	struct FmaLerp
+	{
+		static inline __m128 Lerp(__m128 source, __m128 target, __m128 alpha)
+		{
+			return _mm_fmadd_ps(alpha, target, _mm_fnmadd_ps(alpha, source, source));
+		}
+	};
+
+	/// <summary>
+	/// Gets the alphas for the vector'th group of 4 components out of the 4 alphas of 4 values with the given number of components.<para/>
+	/// Lane l covers component 4 * vector + l, which belongs to value (4 * vector + l) / components.
+	/// </summary>
+	template<size_t components, size_t vector>
+	static inline __m128 SpreadAlphas(__m128 alphas)
+	{
+		return _mm_shuffle_ps(alphas, alphas, _MM_SHUFFLE((4 * vector + 3) / components, (4 * vector + 2) / components, (4 * vector + 1) / components, 4 * vector / components));
+	}
+
+	/// <summary>
+	/// Interpolates 4 values (4 * components floats, which is exactly components vectors of 4 floats).
+	/// </summary>
+	template<class TLerp, size_t components, size_t... vectors>
+	static inline void LerpFourValues(const float* sources, const float* targets, __m128 alphas, float* destination, std::index_sequence<vectors...>)
+	{
+		// Expands to one lerp per vector.
+		int expansion[] = { (_mm_storeu_ps(destination + 4 * vectors, TLerp::Lerp(
+			_mm_loadu_ps(sources + 4 * vectors), _mm_loadu_ps(targets + 4 * vectors), SpreadAlphas<components, vectors>(alphas))), 0)... };
+		(void)expansion;
+	}
+
+	/// <summary>
+	/// Interpolates count values made of the given number of floats. alphaStride is 1 for an alpha per value, or 0 for one alpha for every value.
+	/// </summary>
+	template<class TLerp, size_t components>
+	static void LerpValues(const float* sources, const float* targets, const float* alphas, size_t alphaStride, float* destination, size_t count, bool clampAlpha)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 alpha = alphaStride != 0 ? _mm_loadu_ps(alphas + i) : _mm_set1_ps(*alphas);
+			if (clampAlpha)
+				alpha = LerpOps::ClampAlpha(alpha);
+
+			size_t offset = i * components;
+			LerpFourValues<TLerp, components>(sources + offset, targets + offset, alpha, destination + offset, std::make_index_sequence<components>());
+		}
+
+		// The rest goes through the same operation one float at a time, so it rounds the same way.
+		for (; i < count; i++)
+		{
+			__m128 alpha = _mm_set_ss(alphas[i * alphaStride]);
+			if (clampAlpha)
+				alpha = LerpOps::ClampAlpha(alpha);
+
+			for (size_t component = i * components; component < (i + 1) * components; component++)
+				destination[component] = _mm_cvtss_f32(TLerp::Lerp(_mm_set_ss(sources[component]), _mm_set_ss(targets[component]), alpha));
+		}
+	}
+
+	template<size_t components>
+	static void LerpValues(const float* sources, const float* targets, const float* alphas, size_t alphaStride, float* destination, size_t count, bool clampAlpha)
+	{
+		if (CpuFeatures::HasFMA())
+			LerpValues<FmaLerp, components>(sources, targets, alphas, alphaStride, destination, count, clampAlpha);
+		else
+			LerpValues<Sse2Lerp, components>(sources, targets, alphas, alphaStride, destination, count, clampAlpha);
+	}
+
+	template<class T, size_t components = sizeof(T) / sizeof(float)>
+	static inline void LerpArrays(const T* sources, const T* targets, const float* alphas, size_t alphaStride, T* destination, size_t count, bool clampAlpha)
+	{
+		LerpValues<components>((const float*)sources, (const float*)targets, alphas, alphaStride, (float*)destination, count, clampAlpha);
+	}
+
+	/// <summary>
+	/// Interpolates the radians of the angles and wraps the ones that ended up out of range, like the Angle constructor does.
+	/// </summary>
+	static void LerpAngles(const Angle* sources, const Angle* targets, const float* alphas, size_t alphaStride, Angle* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, alphaStride, destination, count, clampAlpha);
+
+		float* radians = (float*)destination;
+		for (size_t i = 0; i < count; i++)
+		{
+			if (radians[i] < 0 || radians[i] >= Constants::TAU)
+				destination[i] = Angle(radians[i]);
+		}
+	}
+
+	#pragma region Per value alphas.
+	void Lerper::LerpN(const float* sources, const float* targets, const float* alphas, float* destination, size_t count, bool clampAlpha)
+	{
+		LerpValues<1>(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Vector2D* sources, const Vector2D* targets, const float* alphas, Vector2D* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Vector3D* sources, const Vector3D* targets, const float* alphas, Vector3D* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Vector4D* sources, const Vector4D* targets, const float* alphas, Vector4D* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const FColor* sources, const FColor* targets, const float* alphas, FColor* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Angle* sources, const Angle* targets, const float* alphas, Angle* destination, size_t count, bool clampAlpha)
+	{
+		LerpAngles(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Matrix2x2* sources, const Matrix2x2* targets, const float* alphas, Matrix2x2* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Matrix3x3* sources, const Matrix3x3* targets, const float* alphas, Matrix3x3* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, alphas, 1, destination, count, clampAlpha);
+	}
+	#pragma endregion
+
+	#pragma region One alpha for every value.
+	void Lerper::LerpN(const float* sources, const float* targets, float alpha, float* destination, size_t count, bool clampAlpha)
+	{
+		LerpValues<1>(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Vector2D* sources, const Vector2D* targets, float alpha, Vector2D* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Vector3D* sources, const Vector3D* targets, float alpha, Vector3D* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Vector4D* sources, const Vector4D* targets, float alpha, Vector4D* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const FColor* sources, const FColor* targets, float alpha, FColor* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Angle* sources, const Angle* targets, float alpha, Angle* destination, size_t count, bool clampAlpha)
+	{
+		LerpAngles(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Matrix2x2* sources, const Matrix2x2* targets, float alpha, Matrix2x2* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+
+	void Lerper::LerpN(const Matrix3x3* sources, const Matrix3x3* targets, float alpha, Matrix3x3* destination, size_t count, bool clampAlpha)
+	{
+		LerpArrays(sources, targets, &alpha, 0, destination, count, clampAlpha);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Angle.h"
+#include "Vectors/Vectors.h"
+#include "Colors/FColor.h"
+#include "Matrices/Matrix2x2.h"
+#include "Matrices/Matrix3x3.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Batched versions of Lerper::Lerp, for blending whole arrays of values at once (like animation poses with many bones).<para/>
+	/// Every function interpolates destination[i] between sources[i] and targets[i] by alphas[i] (or by one alpha for every value).<para/>
+	/// The components are blended 4 at a time with SSE2, using fused multiply-adds when the CPU supports FMA3.
+	/// Without FMA the results are exactly the same as calling Lerp on every value; with FMA they can differ from it in the last bit, and alphas of 0 and 1 still give exactly sources and targets.<para/>
+	/// destination may be the same array as sources or targets, but must not partially overlap them.
+	/// </summary>
+	namespace Lerper
+	{
+		#pragma region Per value alphas.
+		/// <summary>
+		/// Linearly interpolates count floats from sources to targets by alphas.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const float* sources, const float* targets, const float* alphas, float* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count vectors from sources to targets by alphas.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Vector2D* sources, const Vector2D* targets, const float* alphas, Vector2D* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count vectors from sources to targets by alphas.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Vector3D* sources, const Vector3D* targets, const float* alphas, Vector3D* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count vectors from sources to targets by alphas.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Vector4D* sources, const Vector4D* targets, const float* alphas, Vector4D* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count colors from sources to targets by alphas.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const FColor* sources, const FColor* targets, const float* alphas, FColor* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count angles from sources to targets by alphas, like Angle::Lerp (so it doesn't take the shortest way around the circle).
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Angle* sources, const Angle* targets, const float* alphas, Angle* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count matrices from sources to targets by alphas, element by element.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Matrix2x2* sources, const Matrix2x2* targets, const float* alphas, Matrix2x2* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count matrices from sources to targets by alphas, element by element.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Matrix3x3* sources, const Matrix3x3* targets, const float* alphas, Matrix3x3* destination, size_t count, bool clampAlpha = true);
+		#pragma endregion
+
+		#pragma region One alpha for every value.
+		/// <summary>
+		/// Linearly interpolates count floats from sources to targets by alpha.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const float* sources, const float* targets, float alpha, float* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count vectors from sources to targets by alpha.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Vector2D* sources, const Vector2D* targets, float alpha, Vector2D* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count vectors from sources to targets by alpha.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Vector3D* sources, const Vector3D* targets, float alpha, Vector3D* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count vectors from sources to targets by alpha.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Vector4D* sources, const Vector4D* targets, float alpha, Vector4D* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count colors from sources to targets by alpha.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const FColor* sources, const FColor* targets, float alpha, FColor* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count angles from sources to targets by alpha, like Angle::Lerp (so it doesn't take the shortest way around the circle).
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Angle* sources, const Angle* targets, float alpha, Angle* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count matrices from sources to targets by alpha, element by element.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Matrix2x2* sources, const Matrix2x2* targets, float alpha, Matrix2x2* destination, size_t count, bool clampAlpha = true);
+
+		/// <summary>
+		/// Linearly interpolates count matrices from sources to targets by alpha, element by element.
+		/// </summary>
+		SUPERGOD_API_FUNC void LerpN(const Matrix3x3* sources, const Matrix3x3* targets, float alpha, Matrix3x3* destination, size_t count, bool clampAlpha = true);
+		#pragma endregion
+	}
+} }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Common/CommonDefines.h"
 #include "../MathConstants.h"
+#include "../SMath.h"
 #include "../Interfaces/ISupergodEquatable.h"
 
 namespace SupergodCore { namespace Math
@@ -83,17 +84,26 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new color with all of its components set to 0.
 		/// </summary>
-		BColor();
+		constexpr BColor()
+			: red(0), green(0), blue(0), alpha(0)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new color as a 4-byte unsigned integer.
 		/// </summary>
-		BColor(uint value);
+		constexpr BColor(uint value)
+			: value(value)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new color with specified red, green, blue and alpha values.
 		/// </summary>
-		BColor(byte red, byte green, byte blue, byte alpha);
+		constexpr BColor(byte red, byte green, byte blue, byte alpha)
+			: red(red), green(green), blue(blue), alpha(alpha)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new color made of 4 floats that is the same color as this.
@@ -130,19 +140,59 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Are all of the components of this equal to other?
 		/// </summary>
-		bool Equals(const BColor& other) const;
+		constexpr bool Equals(const BColor& other) const
+		{
+			return red == other.red && green == other.green && blue == other.blue && alpha == other.alpha;
+		}
 
 		/// <summary>
 		/// Is the distance between each component of this and its corresponding component in other smaller or equal to threshold?
 		/// </summary>
-		bool CloseEnough(const BColor& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const BColor& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(red, other.red, threshold) && SMath::CloseEnough(green, other.green, threshold) && SMath::CloseEnough(blue, other.blue, threshold) && SMath::CloseEnough(alpha, other.alpha, threshold);
+		}
 		#pragma endregion
 
 		#pragma region Inversion
 		/// <summary>
 		/// Invertes (subtracts every component OTHER THAN ALPGA from 255) this color. The alpha won't change.
 		/// </summary>
-		BColor Inverted() const;
+		constexpr BColor Inverted() const
+		{
+			return BColor(255 - red, 255 - blue, 255 - green, alpha);
+		}
+		#pragma endregion
+
+		#pragma region Premultiplied alpha and channel order.
+		/// <summary>
+		/// Multiplies a and b as if they were values from 0 to 1 (where 255 is 1), rounded to the nearest byte.
+		/// </summary>
+		inline static constexpr byte MultiplyNormalized(byte a, byte b)
+		{
+			return (byte)(((a * b + 128) + ((a * b + 128) >> 8)) >> 8);
+		}
+
+		/// <summary>
+		/// Gets this color with red, green and blue multiplied by alpha. The alpha won't change.
+		/// </summary>
+		constexpr BColor Premultiplied() const
+		{
+			return BColor(MultiplyNormalized(red, alpha), MultiplyNormalized(green, alpha), MultiplyNormalized(blue, alpha), alpha);
+		}
+
+		/// <summary>
+		/// Gets this color with red, green and blue divided by alpha (clamped to 255). The alpha won't change, and a color with an alpha of 0 becomes clear.
+		/// </summary>
+		BColor Unpremultiplied() const;
+
+		/// <summary>
+		/// Gets this color with red and blue swapped. This converts between RGBA and BGRA.
+		/// </summary>
+		constexpr BColor SwappedRedBlue() const
+		{
+			return BColor(blue, green, red, alpha);
+		}
 		#pragma endregion
 	};
 } }
\ No newline at end of file
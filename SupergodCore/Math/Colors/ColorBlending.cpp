@@ -0,0 +1,238 @@
+#include "ColorBlending.h"
+#include "Common/CpuFeatures.h"
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	// Every blend mode is written once, as a template over a set of operations on 16-bit components (0 to 255, with room for sums up to 510).
+	// The same template runs on single components, SSE2 vectors and AVX2 vectors, so all of them give exactly the same results.
+
+	#pragma region Operations.
+	/// <summary>
+	/// Operations on a single component. Masks are 0 or -1, like in the vector versions.
+	/// </summary>
+	struct ScalarOps
+	{
+		typedef int V;
+
+		static inline V Set(int value) { return value; }
+		static inline V Add(V a, V b) { return a + b; }
+		static inline V Subtract(V a, V b) { return a - b; }
+		static inline V Multiply(V a, V b) { return a * b; }
+		static inline V Select(V mask, V a, V b) { return (mask & a) | (~mask & b); }
+
+		/// <summary>
+		/// Divides value (up to 65025) by 255, rounded to the nearest integer.
+		/// </summary>
+		static inline V Divide255(V value) { return ((value + 127) * 0x8081) >> 23; }
+	};
+
+	/// <summary>
+	/// Operations on 8 components (2 colors) with SSE2.
+	/// </summary>
+	struct Sse2Ops
+	{
+		typedef __m128i V;
+
+		static inline V Set(int value) { return _mm_set1_epi16((short)value); }
+		static inline V Add(V a, V b) { return _mm_add_epi16(a, b); }
+		static inline V Subtract(V a, V b) { return _mm_sub_epi16(a, b); }
+		static inline V Multiply(V a, V b) { return _mm_mullo_epi16(a, b); }
+		static inline V Select(V mask, V a, V b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+
+		/// <summary>
+		/// x / 255 is (x * 0x8081) >> 23 for every 16-bit x, and adding 127 first makes it round (255 is odd, so there are no ties).
+		/// </summary>
+		static inline V Divide255(V value) { return _mm_srli_epi16(_mm_mulhi_epu16(_mm_add_epi16(value, Set(127)), Set(0x8081)), 7); }
+
+		static inline V BroadcastAlpha(V colors) { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(colors, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)); }
+		static inline V AlphaMask() { return _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0); }
+
+		static const size_t COLORS = 4;
+		static inline V Load(const BColor* colors) { return _mm_loadu_si128((const __m128i*)colors); }
+		static inline V Low(V bytes) { return _mm_unpacklo_epi8(bytes, _mm_setzero_si128()); }
+		static inline V High(V bytes) { return _mm_unpackhi_epi8(bytes, _mm_setzero_si128()); }
+		static inline void Store(BColor* colors, V low, V high) { _mm_storeu_si128((__m128i*)colors, _mm_packus_epi16(low, high)); }
+	};
+
+	/// <summary>
+	/// Operations on 16 components (4 colors) with AVX2. Unpacking and packing work inside 128-bit lanes, so they cancel each other out.
+	/// </summary>
+	struct Avx2Ops
+	{
+		typedef __m256i V;
+
+		static inline V Set(int value) { return _mm256_set1_epi16((short)value); }
+		static inline V Add(V a, V b) { return _mm256_add_epi16(a, b); }
+		static inline V Subtract(V a, V b) { return _mm256_sub_epi16(a, b); }
+		static inline V Multiply(V a, V b) { return _mm256_mullo_epi16(a, b); }
+		static inline V Select(V mask, V a, V b) { return _mm256_blendv_epi8(b, a, mask); }
+		static inline V Divide255(V value) { return _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_add_epi16(value, Set(127)), Set(0x8081)), 7); }
+
+		static inline V BroadcastAlpha(V colors) { return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(colors, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)); }
+		static inline V AlphaMask() { return _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0); }
+
+		static const size_t COLORS = 8;
+		static inline V Load(const BColor* colors) { return _mm256_loadu_si256((const __m256i*)colors); }
+		static inline V Low(V bytes) { return _mm256_unpacklo_epi8(bytes, _mm256_setzero_si256()); }
+		static inline V High(V bytes) { return _mm256_unpackhi_epi8(bytes, _mm256_setzero_si256()); }
+		static inline void Store(BColor* colors, V low, V high) { _mm256_storeu_si256((__m256i*)colors, _mm256_packus_epi16(low, high)); }
+	};
+	#pragma endregion
+
+	#pragma region Blend modes.
+	// Every mode gets the source and destination components, the alpha of the source and a mask that is set for alpha components.
+	// The premultiplied modes treat alpha like the other components, so they leave the parameters they don't need unnamed.
+	// The results may go above 255, they are saturated when they are stored.
+
+	/// <summary>
+	/// The alpha of a blend that isn't premultiplied: sa + da * (1 - sa).
+	/// </summary>
+	template<class Ops>
+	static inline typename Ops::V OverAlpha(typename Ops::V destination, typename Ops::V sourceAlpha)
+	{
+		return Ops::Add(sourceAlpha, Ops::Divide255(Ops::Multiply(destination, Ops::Subtract(Ops::Set(255), sourceAlpha))));
+	}
+
+	/// <summary>
+	/// Blends from to to with the alpha of the source: from * (1 - sa) + to * sa.
+	/// </summary>
+	template<class Ops>
+	static inline typename Ops::V Fade(typename Ops::V from, typename Ops::V to, typename Ops::V sourceAlpha)
+	{
+		return Ops::Divide255(Ops::Add(Ops::Multiply(to, sourceAlpha), Ops::Multiply(from, Ops::Subtract(Ops::Set(255), sourceAlpha))));
+	}
+
+	struct OverMode
+	{
+		template<class Ops>
+		static inline typename Ops::V Apply(typename Ops::V source, typename Ops::V destination, typename Ops::V sourceAlpha, typename Ops::V alphaMask)
+		{
+			return Ops::Select(alphaMask, OverAlpha<Ops>(destination, sourceAlpha), Fade<Ops>(destination, source, sourceAlpha));
+		}
+	};
+
+	struct PremultipliedOverMode
+	{
+		template<class Ops>
+		static inline typename Ops::V Apply(typename Ops::V source, typename Ops::V destination, typename Ops::V sourceAlpha, typename Ops::V /*alphaMask*/)
+		{
+			return Ops::Add(source, Ops::Divide255(Ops::Multiply(destination, Ops::Subtract(Ops::Set(255), sourceAlpha))));
+		}
+	};
+
+	struct AdditiveMode
+	{
+		template<class Ops>
+		static inline typename Ops::V Apply(typename Ops::V source, typename Ops::V destination, typename Ops::V sourceAlpha, typename Ops::V alphaMask)
+		{
+			return Ops::Select(alphaMask, OverAlpha<Ops>(destination, sourceAlpha), Ops::Add(destination, Ops::Divide255(Ops::Multiply(source, sourceAlpha))));
+		}
+	};
+
+	struct PremultipliedAdditiveMode
+	{
+		template<class Ops>
+		static inline typename Ops::V Apply(typename Ops::V source, typename Ops::V destination, typename Ops::V /*sourceAlpha*/, typename Ops::V /*alphaMask*/)
+		{
+			return Ops::Add(source, destination);
+		}
+	};
+
+	struct MultiplyMode
+	{
+		template<class Ops>
+		static inline typename Ops::V Apply(typename Ops::V source, typename Ops::V destination, typename Ops::V sourceAlpha, typename Ops::V alphaMask)
+		{
+			typename Ops::V product = Ops::Divide255(Ops::Multiply(source, destination));
+			return Ops::Select(alphaMask, OverAlpha<Ops>(destination, sourceAlpha), Fade<Ops>(destination, product, sourceAlpha));
+		}
+	};
+
+	struct ScreenMode
+	{
+		template<class Ops>
+		static inline typename Ops::V Apply(typename Ops::V source, typename Ops::V destination, typename Ops::V sourceAlpha, typename Ops::V alphaMask)
+		{
+			typename Ops::V screen = Ops::Subtract(Ops::Add(source, destination), Ops::Divide255(Ops::Multiply(source, destination)));
+			return Ops::Select(alphaMask, OverAlpha<Ops>(destination, sourceAlpha), Fade<Ops>(destination, screen, sourceAlpha));
+		}
+	};
+	#pragma endregion
+
+	#pragma region Kernels.
+	template<class TMode>
+	static inline BColor BlendColor(const BColor& source, const BColor& destination)
+	{
+		BColor result;
+		for (int i = 0; i < 4; i++)
+		{
+			int blended = TMode::template Apply<ScalarOps>(source.components[i], destination.components[i], source.alpha, i == 3 ? -1 : 0);
+			result.components[i] = (byte)(blended > 255 ? 255 : blended);
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Blends as many colors as fit in whole vectors and returns how many were blended.
+	/// </summary>
+	template<class TMode, class Ops>
+	static inline size_t BlendVectors(const BColor* source, BColor* destination, size_t count)
+	{
+		typename Ops::V alphaMask = Ops::AlphaMask();
+
+		size_t i = 0;
+		for (; i + Ops::COLORS <= count; i += Ops::COLORS)
+		{
+			typename Ops::V sourceBytes = Ops::Load(source + i);
+			typename Ops::V destinationBytes = Ops::Load(destination + i);
+			typename Ops::V sourceLow = Ops::Low(sourceBytes), sourceHigh = Ops::High(sourceBytes);
+
+			typename Ops::V low = TMode::template Apply<Ops>(sourceLow, Ops::Low(destinationBytes), Ops::BroadcastAlpha(sourceLow), alphaMask);
+			typename Ops::V high = TMode::template Apply<Ops>(sourceHigh, Ops::High(destinationBytes), Ops::BroadcastAlpha(sourceHigh), alphaMask);
+			Ops::Store(destination + i, low, high);
+		}
+
+		return i;
+	}
+
+	template<class TMode>
+	static void BlendSpan(const BColor* source, BColor* destination, size_t count)
+	{
+		size_t i = CpuFeatures::HasAVX2() ? BlendVectors<TMode, Avx2Ops>(source, destination, count) : 0;
+		i += BlendVectors<TMode, Sse2Ops>(source + i, destination + i, count - i);
+
+		for (; i < count; i++)
+			destination[i] = BlendColor<TMode>(source[i], destination[i]);
+	}
+	#pragma endregion
+
+	BColor ColorBlending::Blend(BlendMode mode, const BColor& source, const BColor& destination)
+	{
+		switch (mode)
+		{
+		case BlendMode::Over: return BlendColor<OverMode>(source, destination);
+		case BlendMode::PremultipliedOver: return BlendColor<PremultipliedOverMode>(source, destination);
+		case BlendMode::Additive: return BlendColor<AdditiveMode>(source, destination);
+		case BlendMode::PremultipliedAdditive: return BlendColor<PremultipliedAdditiveMode>(source, destination);
+		case BlendMode::Multiply: return BlendColor<MultiplyMode>(source, destination);
+		case BlendMode::Screen: return BlendColor<ScreenMode>(source, destination);
+		}
+
+		return destination;
+	}
+
+	void ColorBlending::Blend(BlendMode mode, const BColor* source, BColor* destination, size_t count)
+	{
+		switch (mode)
+		{
+		case BlendMode::Over: BlendSpan<OverMode>(source, destination, count); break;
+		case BlendMode::PremultipliedOver: BlendSpan<PremultipliedOverMode>(source, destination, count); break;
+		case BlendMode::Additive: BlendSpan<AdditiveMode>(source, destination, count); break;
+		case BlendMode::PremultipliedAdditive: BlendSpan<PremultipliedAdditiveMode>(source, destination, count); break;
+		case BlendMode::Multiply: BlendSpan<MultiplyMode>(source, destination, count); break;
+		case BlendMode::Screen: BlendSpan<ScreenMode>(source, destination, count); break;
+		}
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "BColor.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Software blending of byte colors, for compositing things like UI and debug text into images on the CPU.<para/>
+	/// All the math is done with integers and every division by 255 is rounded to the nearest integer, so the results are exact and the same on every CPU.
+	/// The bulk functions use SSE2 (or AVX2 when the CPU supports it), and give the same results as the single color functions.
+	/// </summary>
+	namespace ColorBlending
+	{
+		/// <summary>
+		/// The ways a source color can be blended into a destination color.<para/>
+		/// Unless said otherwise, the colors aren't premultiplied and the alpha of the result is sa + da * (1 - sa).
+		/// </summary>
+		enum class BlendMode
+		{
+			/// <summary>
+			/// Draws the source over the destination: s * sa + d * (1 - sa).
+			/// </summary>
+			Over = 1,
+
+			/// <summary>
+			/// Draws a premultiplied source over a premultiplied destination: s + d * (1 - sa), for every component including alpha.
+			/// </summary>
+			PremultipliedOver = 2,
+
+			/// <summary>
+			/// Adds the source to the destination: d + s * sa.
+			/// </summary>
+			Additive = 3,
+
+			/// <summary>
+			/// Adds a premultiplied source to a premultiplied destination: d + s, for every component including alpha.
+			/// </summary>
+			PremultipliedAdditive = 4,
+
+			/// <summary>
+			/// Multiplies the destination by the source, faded by the alpha of the source: lerp(d, s * d, sa). Darkens the destination.
+			/// </summary>
+			Multiply = 5,
+
+			/// <summary>
+			/// The opposite of multiply, faded by the alpha of the source: lerp(d, s + d - s * d, sa). Brightens the destination.
+			/// </summary>
+			Screen = 6,
+		};
+
+		/// <summary>
+		/// Blends source into destination and returns the result.
+		/// </summary>
+		SUPERGOD_API_FUNC BColor Blend(BlendMode mode, const BColor& source, const BColor& destination);
+
+		/// <summary>
+		/// Blends count source colors into count destination colors, in place.
+		/// </summary>
+		SUPERGOD_API_FUNC void Blend(BlendMode mode, const BColor* source, BColor* destination, size_t count);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "ColorBuffers.h"
+#include "../Packing/NormalizedInt.h"
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	static_assert(sizeof(BColor) == 4, "Byte color buffers are processed as flat arrays of bytes.");
+	static_assert(sizeof(FColor) == sizeof(float) * 4, "Float color buffers are processed as flat arrays of floats.");
+
+	#pragma region Conversions.
+	void ColorBuffers::ToFColors(const BColor* source, FColor* destination, size_t count)
+	{
+		if (count != 0)
+			NormalizedInt::UnpackUnorm8(source->components, destination->components, count * 4);
+	}
+
+	void ColorBuffers::ToBColors(const FColor* source, BColor* destination, size_t count)
+	{
+		if (count != 0)
+			NormalizedInt::PackUnorm8(source->components, destination->components, count * 4);
+	}
+	#pragma endregion
+
+	#pragma region Premultiplied alpha.
+	/// <summary>
+	/// The factors every component is multiplied by to unpremultiply a byte color, indexed by alpha.
+	/// </summary>
+	struct UnpremultiplyFactors
+	{
+		float factors[256];
+
+		UnpremultiplyFactors()
+			: factors()
+		{
+			// Computed the same way as in BColor::Unpremultiplied, so both give the same results.
+			for (int alpha = 1; alpha < 256; alpha++)
+				factors[alpha] = 1.f / alpha;
+		}
+	};
+
+	static const UnpremultiplyFactors unpremultiplyFactors;
+
+	void ColorBuffers::Premultiply(BColor* colors, size_t count)
+	{
+		__m128i zero = _mm_setzero_si128();
+		__m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+		__m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+		__m128i half = _mm_set1_epi16(128);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(colors + i));
+			__m128i halves[2] = { _mm_unpacklo_epi8(pixels, zero), _mm_unpackhi_epi8(pixels, zero) };
+
+			for (__m128i& pixelPair : halves)
+			{
+				// Multiply red, green and blue by alpha and alpha by 255 (which keeps it the same), then divide by 255 with rounding: (x + (x >> 8)) >> 8 where x = c * a + 128.
+				__m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixelPair, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+				__m128i product = _mm_add_epi16(_mm_mullo_epi16(pixelPair, _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaOne)), half);
+				pixelPair = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+			}
+
+			_mm_storeu_si128((__m128i*)(colors + i), _mm_packus_epi16(halves[0], halves[1]));
+		}
+
+		for (; i < count; i++)
+			colors[i] = colors[i].Premultiplied();
+	}
+
+	void ColorBuffers::Unpremultiply(BColor* colors, size_t count)
+	{
+		__m128i zero = _mm_setzero_si128();
+		__m128 zeroFloat = _mm_setzero_ps();
+		__m128 one = _mm_set1_ps(1);
+		__m128 scale = _mm_set1_ps(255);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(colors + i));
+			__m128i low = _mm_unpacklo_epi8(pixels, zero);
+			__m128i high = _mm_unpackhi_epi8(pixels, zero);
+			__m128i words[4] = { _mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero), _mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero) };
+
+			// Alpha is scaled to [0, 1] so packing it back gives the same alpha. A factor of 0 for alpha 0 makes the whole color clear.
+			for (int pixel = 0; pixel < 4; pixel++)
+			{
+				float factor = unpremultiplyFactors.factors[colors[i + pixel].alpha];
+				__m128 scaled = _mm_mul_ps(_mm_cvtepi32_ps(words[pixel]), _mm_set_ps(factor != 0 ? 1.f / 255 : 0, factor, factor, factor));
+				words[pixel] = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(scaled, zeroFloat), one), scale));
+			}
+
+			__m128i packed = _mm_packus_epi16(_mm_packs_epi32(words[0], words[1]), _mm_packs_epi32(words[2], words[3]));
+			_mm_storeu_si128((__m128i*)(colors + i), packed);
+		}
+
+		for (; i < count; i++)
+			colors[i] = colors[i].Unpremultiplied();
+	}
+
+	/// <summary>
+	/// Gets a vector with alpha of color in the red, green and blue lanes and 1 in the alpha lane.
+	/// </summary>
+	static inline __m128 AlphaMultiplier(__m128 color, __m128 colorMask, __m128 alphaOne)
+	{
+		return _mm_or_ps(_mm_and_ps(_mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3)), colorMask), alphaOne);
+	}
+
+	void ColorBuffers::Premultiply(FColor* colors, size_t count)
+	{
+		__m128 colorMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		__m128 alphaOne = _mm_set_ps(1, 0, 0, 0);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			__m128 color = _mm_loadu_ps(colors[i].components);
+			_mm_storeu_ps(colors[i].components, _mm_mul_ps(color, AlphaMultiplier(color, colorMask, alphaOne)));
+		}
+	}
+
+	void ColorBuffers::Unpremultiply(FColor* colors, size_t count)
+	{
+		__m128 colorMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		__m128 alphaOne = _mm_set_ps(1, 0, 0, 0);
+		__m128 zero = _mm_setzero_ps();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			__m128 color = _mm_loadu_ps(colors[i].components);
+			__m128 visible = _mm_cmpneq_ps(_mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3)), zero);
+			_mm_storeu_ps(colors[i].components, _mm_and_ps(_mm_div_ps(color, AlphaMultiplier(color, colorMask, alphaOne)), visible));
+		}
+	}
+	#pragma endregion
+
+	#pragma region Channel order.
+	void ColorBuffers::SwapRedBlue(const BColor* source, BColor* destination, size_t count)
+	{
+		__m128i greenAlpha = _mm_set1_epi32((int)0xff00ff00);
+		__m128i lowByte = _mm_set1_epi32(0xff);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			// Colors are little endian, so red is the lowest byte of every 32 bit lane and blue is the third one.
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(source + i));
+			__m128i red = _mm_slli_epi32(_mm_and_si128(pixels, lowByte), 16);
+			__m128i blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), lowByte);
+			_mm_storeu_si128((__m128i*)(destination + i), _mm_or_si128(_mm_and_si128(pixels, greenAlpha), _mm_or_si128(red, blue)));
+		}
+
+		for (; i < count; i++)
+			destination[i] = source[i].SwappedRedBlue();
+	}
+	#pragma endregion
+} }
\ No newline at end of file
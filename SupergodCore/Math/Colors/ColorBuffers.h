@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "FColor.h"
+#include "BColor.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Functions that work on whole buffers of colors (like images), using SSE2.<para/>
+	/// Every function gives exactly the same results as doing the same thing to every color on its own, so the scalar and bulk versions can be mixed freely.<para/>
+	/// Unless said otherwise, source and destination may be the same buffer, but must not partially overlap.
+	/// </summary>
+	namespace ColorBuffers
+	{
+		#pragma region Conversions.
+		/// <summary>
+		/// Converts count byte colors to float colors, like the FColor conversion operator of BColor.
+		/// </summary>
+		SUPERGOD_API_FUNC void ToFColors(const BColor* source, FColor* destination, size_t count);
+
+		/// <summary>
+		/// Converts count float colors to byte colors, like the BColor conversion operator of FColor. Components are clamped between 0 and 1 and rounded to the nearest byte.
+		/// </summary>
+		SUPERGOD_API_FUNC void ToBColors(const FColor* source, BColor* destination, size_t count);
+		#pragma endregion
+
+		#pragma region Premultiplied alpha.
+		/// <summary>
+		/// Multiplies red, green and blue of count colors by their alpha, in place.
+		/// </summary>
+		SUPERGOD_API_FUNC void Premultiply(BColor* colors, size_t count);
+
+		/// <summary>
+		/// Divides red, green and blue of count colors by their alpha, in place. Colors with an alpha of 0 become clear.
+		/// </summary>
+		SUPERGOD_API_FUNC void Unpremultiply(BColor* colors, size_t count);
+
+		/// <summary>
+		/// Multiplies red, green and blue of count colors by their alpha, in place.
+		/// </summary>
+		SUPERGOD_API_FUNC void Premultiply(FColor* colors, size_t count);
+
+		/// <summary>
+		/// Divides red, green and blue of count colors by their alpha, in place. Colors with an alpha of 0 become clear.
+		/// </summary>
+		SUPERGOD_API_FUNC void Unpremultiply(FColor* colors, size_t count);
+		#pragma endregion
+
+		#pragma region Channel order.
+		/// <summary>
+		/// Swaps red and blue of count colors, which converts RGBA to BGRA and back.
+		/// </summary>
+		SUPERGOD_API_FUNC void SwapRedBlue(const BColor* source, BColor* destination, size_t count);
+
+		/// <summary>
+		/// Swaps red and blue of count colors in place, which converts RGBA to BGRA and back.
+		/// </summary>
+		inline void SwapRedBlue(BColor* colors, size_t count)
+		{
+			SwapRedBlue(colors, colors, count);
+		}
+		#pragma endregion
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,326 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include <cstring>
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// The math of the conversions between color models, written once as templates over a set of float operations.
+	/// The same template runs on single colors (ScalarOps) and on 4 colors at a time (Sse2Ops) and gives exactly the same results.<para/>
+	/// Only used by the color model implementations, not part of the public headers.
+	/// </summary>
+	namespace ColorOps
+	{
+		/// <summary>
+		/// Operations on a single component.
+		/// </summary>
+		struct ScalarOps
+		{
+			typedef float V;
+			typedef bool M;
+
+			static inline V Set(float value) { return value; }
+			static inline V Add(V a, V b) { return a + b; }
+			static inline V Subtract(V a, V b) { return a - b; }
+			static inline V Multiply(V a, V b) { return a * b; }
+			static inline V Divide(V a, V b) { return a / b; }
+
+			// Written like minps and maxps, which return b if either value is NaN.
+			static inline V Min(V a, V b) { return a < b ? a : b; }
+			static inline V Max(V a, V b) { return a > b ? a : b; }
+
+			static inline M Equal(V a, V b) { return a == b; }
+			static inline M Greater(V a, V b) { return a > b; }
+			static inline M GreaterOrEqual(V a, V b) { return a >= b; }
+			static inline V Select(M mask, V a, V b) { return mask ? a : b; }
+
+			static inline V Floor(V value)
+			{
+				V truncated = (float)(int)value;
+				return truncated > value ? truncated - 1 : truncated;
+			}
+
+			static inline V Cbrt(V value)
+			{
+				uint bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				uint sign = bits & 0x80000000;
+				bits = (uint)(int)((float)(int)(bits & 0x7fffffff) * (1.f / 3)) + 0x2a508935;
+
+				V absolute = value < 0 ? -value : value;
+				V guess;
+				std::memcpy(&guess, &bits, sizeof(guess));
+				guess = HalleyStep(guess, absolute);
+				guess = HalleyStep(guess, absolute);
+
+				std::memcpy(&bits, &guess, sizeof(bits));
+				bits |= sign;
+				std::memcpy(&guess, &bits, sizeof(guess));
+				return value == 0 ? 0 : guess;
+			}
+
+			/// <summary>
+			/// One step of Halley's method for the cube root of value, which triples the correct digits of guess.
+			/// </summary>
+			static inline V HalleyStep(V guess, V value)
+			{
+				V cube = guess * guess * guess;
+				return guess * (cube + value + value) / (cube + cube + value);
+			}
+		};
+
+		/// <summary>
+		/// Operations on 4 components with SSE2.
+		/// </summary>
+		struct Sse2Ops
+		{
+			typedef __m128 V;
+			typedef __m128 M;
+
+			static inline V Set(float value) { return _mm_set1_ps(value); }
+			static inline V Add(V a, V b) { return _mm_add_ps(a, b); }
+			static inline V Subtract(V a, V b) { return _mm_sub_ps(a, b); }
+			static inline V Multiply(V a, V b) { return _mm_mul_ps(a, b); }
+			static inline V Divide(V a, V b) { return _mm_div_ps(a, b); }
+			static inline V Min(V a, V b) { return _mm_min_ps(a, b); }
+			static inline V Max(V a, V b) { return _mm_max_ps(a, b); }
+
+			static inline M Equal(V a, V b) { return _mm_cmpeq_ps(a, b); }
+			static inline M Greater(V a, V b) { return _mm_cmpgt_ps(a, b); }
+			static inline M GreaterOrEqual(V a, V b) { return _mm_cmpge_ps(a, b); }
+			static inline V Select(M mask, V a, V b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+			static inline V Floor(V value)
+			{
+				V truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+				return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, value), Set(1)));
+			}
+
+			static inline V Cbrt(V value)
+			{
+				__m128 signMask = _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000));
+				__m128 absolute = _mm_andnot_ps(signMask, value);
+				__m128i bits = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(absolute)), Set(1.f / 3)));
+
+				V guess = _mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x2a508935)));
+				guess = HalleyStep(guess, absolute);
+				guess = HalleyStep(guess, absolute);
+
+				guess = _mm_or_ps(guess, _mm_and_ps(value, signMask));
+				return _mm_andnot_ps(_mm_cmpeq_ps(value, _mm_setzero_ps()), guess);
+			}
+
+			static inline V HalleyStep(V guess, V value)
+			{
+				V cube = _mm_mul_ps(_mm_mul_ps(guess, guess), guess);
+				return _mm_div_ps(_mm_mul_ps(guess, _mm_add_ps(_mm_add_ps(cube, value), value)), _mm_add_ps(_mm_add_ps(cube, cube), value));
+			}
+		};
+
+		/// <summary>
+		/// Converts count colors with TKernel::Apply, which gets the first 3 components of the colors and changes them in place (the 4th component, alpha, is copied).<para/>
+		/// TSource and TDestination must be made of 4 floats, accessible through components.
+		/// </summary>
+		template<class TKernel, class TSource, class TDestination>
+		inline void Convert(const TSource* source, TDestination* destination, size_t count)
+		{
+			static_assert(sizeof(TSource) == sizeof(float) * 4 && sizeof(TDestination) == sizeof(float) * 4, "Colors are converted as 4 floats.");
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 first = _mm_loadu_ps(source[i].components);
+				__m128 second = _mm_loadu_ps(source[i + 1].components);
+				__m128 third = _mm_loadu_ps(source[i + 2].components);
+				__m128 fourth = _mm_loadu_ps(source[i + 3].components);
+				_MM_TRANSPOSE4_PS(first, second, third, fourth);
+
+				TKernel::template Apply<Sse2Ops>(first, second, third);
+
+				_MM_TRANSPOSE4_PS(first, second, third, fourth);
+				_mm_storeu_ps(destination[i].components, first);
+				_mm_storeu_ps(destination[i + 1].components, second);
+				_mm_storeu_ps(destination[i + 2].components, third);
+				_mm_storeu_ps(destination[i + 3].components, fourth);
+			}
+
+			for (; i < count; i++)
+			{
+				float first = source[i].components[0], second = source[i].components[1], third = source[i].components[2];
+				TKernel::template Apply<ScalarOps>(first, second, third);
+				destination[i].components[0] = first;
+				destination[i].components[1] = second;
+				destination[i].components[2] = third;
+				destination[i].components[3] = source[i].components[3];
+			}
+		}
+
+		/// <summary>
+		/// Converts a single color with TKernel::Apply.
+		/// </summary>
+		template<class TKernel, class TSource, class TDestination>
+		inline TDestination Convert(const TSource& source)
+		{
+			TDestination destination;
+			Convert<TKernel>(&source, &destination, 1);
+			return destination;
+		}
+
+		#pragma region Kernels.
+		/// <summary>
+		/// Gets the hue (from 0 to 1) of an RGB color, given its biggest component and the difference between its biggest and smallest components.
+		/// </summary>
+		template<class Ops>
+		inline typename Ops::V Hue(typename Ops::V red, typename Ops::V green, typename Ops::V blue, typename Ops::V max, typename Ops::V delta)
+		{
+			// The biggest component picks the sector of the hue hexagon.
+			typename Ops::V redHue = Ops::Divide(Ops::Subtract(green, blue), delta);
+			redHue = Ops::Select(Ops::Greater(Ops::Set(0), redHue), Ops::Add(redHue, Ops::Set(6)), redHue);
+			typename Ops::V greenHue = Ops::Add(Ops::Divide(Ops::Subtract(blue, red), delta), Ops::Set(2));
+			typename Ops::V blueHue = Ops::Add(Ops::Divide(Ops::Subtract(red, green), delta), Ops::Set(4));
+
+			typename Ops::V hue = Ops::Select(Ops::Equal(max, red), redHue, Ops::Select(Ops::Equal(max, green), greenHue, blueHue));
+			return Ops::Select(Ops::Greater(delta, Ops::Set(0)), Ops::Multiply(hue, Ops::Set(1.f / 6)), Ops::Set(0));
+		}
+
+		/// <summary>
+		/// Gets (n + scaledHue) mod sectors, where scaledHue is between 0 and sectors.
+		/// </summary>
+		template<class Ops>
+		inline typename Ops::V HueSector(typename Ops::V scaledHue, float n, float sectors)
+		{
+			typename Ops::V k = Ops::Add(Ops::Set(n), scaledHue);
+			return Ops::Select(Ops::GreaterOrEqual(k, Ops::Set(sectors)), Ops::Subtract(k, Ops::Set(sectors)), k);
+		}
+
+		struct RgbToHsv
+		{
+			template<class Ops>
+			static inline void Apply(typename Ops::V& red, typename Ops::V& green, typename Ops::V& blue)
+			{
+				typename Ops::V max = Ops::Max(Ops::Max(red, green), blue);
+				typename Ops::V delta = Ops::Subtract(max, Ops::Min(Ops::Min(red, green), blue));
+
+				typename Ops::V hue = Hue<Ops>(red, green, blue, max, delta);
+				green = Ops::Select(Ops::Greater(max, Ops::Set(0)), Ops::Divide(delta, max), Ops::Set(0));
+				red = hue;
+				blue = max;
+			}
+		};
+
+		struct HsvToRgb
+		{
+			template<class Ops>
+			static inline typename Ops::V Channel(typename Ops::V scaledHue, typename Ops::V chroma, typename Ops::V value, float n)
+			{
+				typename Ops::V k = HueSector<Ops>(scaledHue, n, 6);
+				typename Ops::V factor = Ops::Max(Ops::Set(0), Ops::Min(Ops::Min(k, Ops::Subtract(Ops::Set(4), k)), Ops::Set(1)));
+				return Ops::Subtract(value, Ops::Multiply(chroma, factor));
+			}
+
+			template<class Ops>
+			static inline void Apply(typename Ops::V& hue, typename Ops::V& saturation, typename Ops::V& value)
+			{
+				typename Ops::V scaledHue = Ops::Multiply(Ops::Subtract(hue, Ops::Floor(hue)), Ops::Set(6));
+				typename Ops::V chroma = Ops::Multiply(value, saturation);
+
+				typename Ops::V red = Channel<Ops>(scaledHue, chroma, value, 5);
+				typename Ops::V green = Channel<Ops>(scaledHue, chroma, value, 3);
+				value = Channel<Ops>(scaledHue, chroma, value, 1);
+				hue = red;
+				saturation = green;
+			}
+		};
+
+		struct RgbToHsl
+		{
+			template<class Ops>
+			static inline void Apply(typename Ops::V& red, typename Ops::V& green, typename Ops::V& blue)
+			{
+				typename Ops::V max = Ops::Max(Ops::Max(red, green), blue);
+				typename Ops::V min = Ops::Min(Ops::Min(red, green), blue);
+				typename Ops::V delta = Ops::Subtract(max, min);
+
+				typename Ops::V lightness = Ops::Multiply(Ops::Add(max, min), Ops::Set(.5f));
+				typename Ops::V distanceFromEdge = Ops::Min(lightness, Ops::Subtract(Ops::Set(1), lightness));
+
+				typename Ops::V hue = Hue<Ops>(red, green, blue, max, delta);
+				green = Ops::Select(Ops::Greater(distanceFromEdge, Ops::Set(0)), Ops::Divide(Ops::Subtract(max, lightness), distanceFromEdge), Ops::Set(0));
+				red = hue;
+				blue = lightness;
+			}
+		};
+
+		struct HslToRgb
+		{
+			template<class Ops>
+			static inline typename Ops::V Channel(typename Ops::V scaledHue, typename Ops::V chroma, typename Ops::V lightness, float n)
+			{
+				typename Ops::V k = HueSector<Ops>(scaledHue, n, 12);
+				typename Ops::V factor = Ops::Max(Ops::Set(-1), Ops::Min(Ops::Min(Ops::Subtract(k, Ops::Set(3)), Ops::Subtract(Ops::Set(9), k)), Ops::Set(1)));
+				return Ops::Subtract(lightness, Ops::Multiply(chroma, factor));
+			}
+
+			template<class Ops>
+			static inline void Apply(typename Ops::V& hue, typename Ops::V& saturation, typename Ops::V& lightness)
+			{
+				typename Ops::V scaledHue = Ops::Multiply(Ops::Subtract(hue, Ops::Floor(hue)), Ops::Set(12));
+				typename Ops::V chroma = Ops::Multiply(saturation, Ops::Min(lightness, Ops::Subtract(Ops::Set(1), lightness)));
+
+				typename Ops::V red = Channel<Ops>(scaledHue, chroma, lightness, 0);
+				typename Ops::V green = Channel<Ops>(scaledHue, chroma, lightness, 8);
+				lightness = Channel<Ops>(scaledHue, chroma, lightness, 4);
+				hue = red;
+				saturation = green;
+			}
+		};
+
+		/// <summary>
+		/// Gets x * a + y * b + z * c.
+		/// </summary>
+		template<class Ops>
+		inline typename Ops::V Dot(typename Ops::V x, typename Ops::V y, typename Ops::V z, float a, float b, float c)
+		{
+			return Ops::Add(Ops::Add(Ops::Multiply(x, Ops::Set(a)), Ops::Multiply(y, Ops::Set(b))), Ops::Multiply(z, Ops::Set(c)));
+		}
+
+		struct RgbToOklab
+		{
+			template<class Ops>
+			static inline void Apply(typename Ops::V& red, typename Ops::V& green, typename Ops::V& blue)
+			{
+				typename Ops::V l = Ops::Cbrt(Dot<Ops>(red, green, blue, .4122214708f, .5363325363f, .0514459929f));
+				typename Ops::V m = Ops::Cbrt(Dot<Ops>(red, green, blue, .2119034982f, .6806995451f, .1073969566f));
+				typename Ops::V s = Ops::Cbrt(Dot<Ops>(red, green, blue, .0883024619f, .2817188376f, .6299787005f));
+
+				red = Dot<Ops>(l, m, s, .2104542553f, .7936177850f, -.0040720468f);
+				green = Dot<Ops>(l, m, s, 1.9779984951f, -2.4285922050f, .4505937099f);
+				blue = Dot<Ops>(l, m, s, .0259040371f, .7827717662f, -.8086757660f);
+			}
+		};
+
+		struct OklabToRgb
+		{
+			template<class Ops>
+			static inline typename Ops::V Cube(typename Ops::V value)
+			{
+				return Ops::Multiply(Ops::Multiply(value, value), value);
+			}
+
+			template<class Ops>
+			static inline void Apply(typename Ops::V& lightness, typename Ops::V& a, typename Ops::V& b)
+			{
+				typename Ops::V l = Cube<Ops>(Dot<Ops>(lightness, a, b, 1, .3963377774f, .2158037573f));
+				typename Ops::V m = Cube<Ops>(Dot<Ops>(lightness, a, b, 1, -.1055613458f, -.0638541728f));
+				typename Ops::V s = Cube<Ops>(Dot<Ops>(lightness, a, b, 1, -.0894841775f, -1.2914855480f));
+
+				lightness = Dot<Ops>(l, m, s, 4.0767416621f, -3.3077115913f, .2309699292f);
+				a = Dot<Ops>(l, m, s, -1.2684380046f, 2.6097574011f, -.3413193965f);
+				b = Dot<Ops>(l, m, s, -.0041960863f, -.7034186147f, 1.7076147010f);
+			}
+		};
+		#pragma endregion
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "ColorSpace.h"
+#include "../SMath.h"
+#include "../Packing/NormalizedInt.h"
+#include "Common/CpuFeatures.h"
+#include <cmath>
+#include <cstring>
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	#pragma region Exact.
+	float ColorSpace::SrgbToLinear(float value)
+	{
+		return value <= .04045f ? value / 12.92f : SMath::Pow((value + .055f) / 1.055f, 2.4f);
+	}
+
+	float ColorSpace::LinearToSrgb(float value)
+	{
+		return value <= .0031308f ? value * 12.92f : 1.055f * SMath::Pow(value, 1 / 2.4f) - .055f;
+	}
+
+	FColor ColorSpace::SrgbToLinear(const FColor& color)
+	{
+		return FColor(SrgbToLinear(color.red), SrgbToLinear(color.green), SrgbToLinear(color.blue), color.alpha);
+	}
+
+	FColor ColorSpace::LinearToSrgb(const FColor& color)
+	{
+		return FColor(LinearToSrgb(color.red), LinearToSrgb(color.green), LinearToSrgb(color.blue), color.alpha);
+	}
+	#pragma endregion
+
+	#pragma region Tables.
+	// The encoder splits [2^-13, 1) into buckets by the exponent and the top 3 mantissa bits of the value, and approximates the curve
+	// with a line in each bucket. Everything below 2^-13 encodes to 0 anyway.
+	static const uint ENCODE_MIN_BITS = 0x39000000;
+	static const uint ENCODE_MAX_BITS = 0x3f7fffff;
+	static const int ENCODE_BUCKETS = 13 * 8;
+
+	/// <summary>
+	/// The lookup tables of the sRGB conversions.
+	/// </summary>
+	struct SrgbTables
+	{
+		/// <summary>
+		/// The first 256 entries are the linear values of sRGB bytes, and the other 256 are the values of alpha bytes.
+		/// Keeping them together lets the bulk decoder look up all 4 components with a single gather.
+		/// </summary>
+		float decode[512];
+		float encodeOffsets[ENCODE_BUCKETS];
+		float encodeSlopes[ENCODE_BUCKETS];
+
+		SrgbTables()
+		{
+			for (int i = 0; i < 256; i++)
+			{
+				decode[i] = ColorSpace::SrgbToLinear(i / 255.f);
+				decode[i + 256] = NormalizedInt::UnpackUnorm8((byte)i);
+			}
+
+			for (int bucket = 0; bucket < ENCODE_BUCKETS; bucket++)
+			{
+				double start = std::ldexp(1 + (bucket % 8) / 8., bucket / 8 - 13);
+				double width = std::ldexp(1 / 8., bucket / 8 - 13);
+				double first = ExactEncode(start);
+				double slope = ExactEncode(start + width) - first;
+
+				// Move the line between the chord and the curve, so the error is split evenly between both sides.
+				double minError = 0, maxError = 0;
+				for (int sample = 1; sample < 64; sample++)
+				{
+					double t = sample / 64.;
+					double error = ExactEncode(start + t * width) - (first + slope * t);
+					minError = error < minError ? error : minError;
+					maxError = error > maxError ? error : maxError;
+				}
+
+				encodeOffsets[bucket] = (float)(first + (minError + maxError) / 2);
+				encodeSlopes[bucket] = (float)slope;
+			}
+		}
+
+		/// <summary>
+		/// Encodes a linear value to sRGB in [0, 255] in double precision.
+		/// </summary>
+		static double ExactEncode(double value)
+		{
+			return 255 * (value <= .0031308 ? value * 12.92 : 1.055 * std::pow(value, 1 / 2.4) - .055);
+		}
+	};
+
+	static const SrgbTables tables;
+
+	/// <summary>
+	/// Rounds value to the nearest integer (ties to even), with the same instruction as the bulk functions.
+	/// </summary>
+	static inline int RoundToInt(float value)
+	{
+		return _mm_cvtss_si32(_mm_set_ss(value));
+	}
+
+	float ColorSpace::DecodeSrgb(byte value)
+	{
+		return tables.decode[value];
+	}
+
+	byte ColorSpace::EncodeSrgb(float value)
+	{
+		// Written so NaN ends up at the minimum, like with maxps in the bulk version.
+		float minimum, maximum;
+		std::memcpy(&minimum, &ENCODE_MIN_BITS, sizeof(minimum));
+		std::memcpy(&maximum, &ENCODE_MAX_BITS, sizeof(maximum));
+		value = value > minimum ? value : minimum;
+		value = value < maximum ? value : maximum;
+
+		uint bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		uint bucket = (bits - ENCODE_MIN_BITS) >> 20;
+		float t = (bits & 0xfffff) * (1.f / (1 << 20));
+		int encoded = RoundToInt(tables.encodeOffsets[bucket] + tables.encodeSlopes[bucket] * t);
+		return (byte)(encoded < 0 ? 0 : encoded > 255 ? 255 : encoded);
+	}
+
+	FColor ColorSpace::DecodeSrgb(const BColor& color)
+	{
+		return FColor(tables.decode[color.red], tables.decode[color.green], tables.decode[color.blue], tables.decode[color.alpha + 256]);
+	}
+
+	BColor ColorSpace::EncodeSrgb(const FColor& color)
+	{
+		return BColor(EncodeSrgb(color.red), EncodeSrgb(color.green), EncodeSrgb(color.blue), NormalizedInt::PackUnorm8(color.alpha));
+	}
+
+	void ColorSpace::DecodeSrgb(const BColor* source, FColor* destination, size_t count)
+	{
+		size_t i = 0;
+		if (CpuFeatures::HasAVX2())
+		{
+			// Two colors per gather, with the alpha lanes moved to the alpha half of the table.
+			__m256i alphaOffset = _mm256_set_epi32(256, 0, 0, 0, 256, 0, 0, 0);
+			for (; i + 2 <= count; i += 2)
+			{
+				__m256i indices = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(source + i))), alphaOffset);
+				_mm256_storeu_ps(destination[i].components, _mm256_i32gather_ps(tables.decode, indices, 4));
+			}
+		}
+
+		for (; i < count; i++)
+			destination[i] = DecodeSrgb(source[i]);
+	}
+
+	/// <summary>
+	/// Encodes 2 colors (8 floats) to ints, the same way as the single value functions.
+	/// </summary>
+	static inline __m256i EncodeTwoColors(const float* source)
+	{
+		__m256 values = _mm256_loadu_ps(source);
+
+		__m256 minimum = _mm256_castsi256_ps(_mm256_set1_epi32(ENCODE_MIN_BITS));
+		__m256 maximum = _mm256_castsi256_ps(_mm256_set1_epi32(ENCODE_MAX_BITS));
+		__m256i bits = _mm256_castps_si256(_mm256_min_ps(_mm256_max_ps(values, minimum), maximum));
+		__m256i buckets = _mm256_srli_epi32(_mm256_sub_epi32(bits, _mm256_castps_si256(minimum)), 20);
+		__m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(bits, _mm256_set1_epi32(0xfffff))), _mm256_set1_ps(1.f / (1 << 20)));
+		__m256 encoded = _mm256_add_ps(_mm256_i32gather_ps(tables.encodeOffsets, buckets, 4), _mm256_mul_ps(_mm256_i32gather_ps(tables.encodeSlopes, buckets, 4), t));
+
+		// Alpha isn't gamma encoded, it's packed like NormalizedInt::PackUnorm8 does.
+		__m256 alpha = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(values, _mm256_setzero_ps()), _mm256_set1_ps(1)), _mm256_set1_ps(255));
+		return _mm256_cvtps_epi32(_mm256_blend_ps(encoded, alpha, 0x88));
+	}
+
+	void ColorSpace::EncodeSrgb(const FColor* source, BColor* destination, size_t count)
+	{
+		size_t i = 0;
+		if (CpuFeatures::HasAVX2())
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256i first = EncodeTwoColors(source[i].components);
+				__m256i second = EncodeTwoColors(source[i + 2].components);
+				__m128i firstWords = _mm_packs_epi32(_mm256_castsi256_si128(first), _mm256_extracti128_si256(first, 1));
+				__m128i secondWords = _mm_packs_epi32(_mm256_castsi256_si128(second), _mm256_extracti128_si256(second, 1));
+				_mm_storeu_si128((__m128i*)(destination + i), _mm_packus_epi16(firstWords, secondWords));
+			}
+		}
+
+		for (; i < count; i++)
+			destination[i] = EncodeSrgb(source[i]);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "FColor.h"
+#include "BColor.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Conversions between the sRGB color space (what images and screens use) and linear colors (what lighting and blending math expects).<para/>
+	/// Only red, green and blue are converted, alpha is always linear.<para/>
+	/// The exact functions use pow. The byte functions use tables: decoding a byte is a single lookup, and encoding uses a piecewise linear approximation
+	/// that is never more than 0.6 away from the exact value (so it's off by 1 from the exact rounding only in rare cases, and every byte survives a round trip).
+	/// </summary>
+	namespace ColorSpace
+	{
+		#pragma region Exact.
+		/// <summary>
+		/// Converts value from [0, 1] in sRGB to linear.
+		/// </summary>
+		SUPERGOD_API_FUNC float SrgbToLinear(float value);
+
+		/// <summary>
+		/// Converts value from [0, 1] in linear to sRGB.
+		/// </summary>
+		SUPERGOD_API_FUNC float LinearToSrgb(float value);
+
+		/// <summary>
+		/// Converts the red, green and blue of color from sRGB to linear.
+		/// </summary>
+		SUPERGOD_API_FUNC FColor SrgbToLinear(const FColor& color);
+
+		/// <summary>
+		/// Converts the red, green and blue of color from linear to sRGB.
+		/// </summary>
+		SUPERGOD_API_FUNC FColor LinearToSrgb(const FColor& color);
+		#pragma endregion
+
+		#pragma region Tables.
+		/// <summary>
+		/// Decodes an sRGB byte to a linear value from 0 to 1 with a lookup table.
+		/// </summary>
+		SUPERGOD_API_FUNC float DecodeSrgb(byte value);
+
+		/// <summary>
+		/// Encodes a linear value to an sRGB byte with a table. value is clamped between 0 and 1.
+		/// </summary>
+		SUPERGOD_API_FUNC byte EncodeSrgb(float value);
+
+		/// <summary>
+		/// Decodes an sRGB byte color to a linear float color.
+		/// </summary>
+		SUPERGOD_API_FUNC FColor DecodeSrgb(const BColor& color);
+
+		/// <summary>
+		/// Encodes a linear float color to an sRGB byte color. Components are clamped between 0 and 1.
+		/// </summary>
+		SUPERGOD_API_FUNC BColor EncodeSrgb(const FColor& color);
+
+		/// <summary>
+		/// Decodes count sRGB byte colors to linear float colors. Uses AVX2 gathers when the CPU supports it, and gives the same results as the single color version.
+		/// </summary>
+		SUPERGOD_API_FUNC void DecodeSrgb(const BColor* source, FColor* destination, size_t count);
+
+		/// <summary>
+		/// Encodes count linear float colors to sRGB byte colors. Uses AVX2 gathers when the CPU supports it, and gives the same results as the single color version.
+		/// </summary>
+		SUPERGOD_API_FUNC void EncodeSrgb(const FColor* source, BColor* destination, size_t count);
+		#pragma endregion
+	}
+} }
\ No newline at end of file
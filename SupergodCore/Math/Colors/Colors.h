@@ -1,4 +1,10 @@
 #pragma once
 
 #include "FColor.h"
-#include "BColor.h"
\ No newline at end of file
+#include "BColor.h"
+#include "HSVColor.h"
+#include "HSLColor.h"
+#include "OklabColor.h"
+#include "ColorBuffers.h"
+#include "ColorSpace.h"
+#include "ColorBlending.h"
\ No newline at end of file
@@ -84,12 +84,18 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new color with all of its components set to 0.
 		/// </summary>
-		FColor();
+		constexpr FColor()
+			: red(0), green(0), blue(0), alpha(0)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new color with specified red, green, blue and alpha values.
 		/// </summary>
-		FColor(float red, float green, float blue, float alpha);
+		constexpr FColor(float red, float green, float blue, float alpha)
+			: red(red), green(green), blue(blue), alpha(alpha)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new Vector4D with its x y z w components set to red green blue alpha (in that order).
@@ -105,51 +111,75 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Are all of the components of this equal to other?
 		/// </summary>
-		bool Equals(const FColor& other) const;
+		constexpr bool Equals(const FColor& other) const
+		{
+			return red == other.red && green == other.green && blue == other.blue && alpha == other.alpha;
+		}
 
 		/// <summary>
 		/// Is the distance between each component of this and its corresponding component in other smaller or equal to threshold?
 		/// </summary>
-		bool CloseEnough(const FColor& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const FColor& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(red, other.red, threshold) && SMath::CloseEnough(green, other.green, threshold) && SMath::CloseEnough(blue, other.blue, threshold) && SMath::CloseEnough(alpha, other.alpha, threshold);
+		}
 		#pragma endregion
 
 		#pragma region Addition and subtraction.
 		/// <summary>
 		/// Adds every component of this to its corresponding component in other.
 		/// </summary>
-		FColor Add(const FColor& other) const;
+		constexpr FColor Add(const FColor& other) const
+		{
+			return FColor(red + other.red, green + other.green, blue + other.blue, alpha + other.alpha);
+		}
 
 		/// <summary>
 		/// Subtracts every component of other from its corresponding component in this.
 		/// </summary>
-		FColor Subtract(const FColor& other) const;
+		constexpr FColor Subtract(const FColor& other) const
+		{
+			return FColor(red - other.red, green - other.green, blue - other.blue, alpha - other.alpha);
+		}
 		#pragma endregion
 
 		#pragma region Multiplication and division.
 		/// <summary>
 		/// Multiplies every component of this by its corresponding component in other.
 		/// </summary>
-		FColor Multiply(const FColor& other) const;
+		constexpr FColor Multiply(const FColor& other) const
+		{
+			return FColor(red * other.red, green * other.green, blue * other.blue, alpha * other.alpha);
+		}
 
 		/// <summary>
 		/// Multiplies every component of this by scalar.
 		/// </summary>
-		FColor Multiply(float scalar) const;
+		constexpr FColor Multiply(float scalar) const
+		{
+			return FColor(red * scalar, green * scalar, blue * scalar, alpha * scalar);
+		}
 
 		/// <summary>
 		/// Divides every component of this by its corresponding component in other.
 		/// </summary>
-		FColor Divide(const FColor& other) const;
+		constexpr FColor Divide(const FColor& other) const
+		{
+			return FColor(red / other.red, green / other.green, blue / other.blue, alpha / other.alpha);
+		}
 
 		/// <summary>
 		/// Divides every component of this by scalar.
 		/// </summary>
-		FColor Divide(float scalar) const;
+		constexpr FColor Divide(float scalar) const
+		{
+			return FColor(red / scalar, green / scalar, blue / scalar, alpha / scalar);
+		}
 
 		/// <summary>
 		/// Multiplies every component of color by scalar.
 		/// </summary>
-		friend FColor operator*(float scalar, const FColor& color)
+		friend constexpr FColor operator*(float scalar, const FColor& color)
 		{
 			return color.Multiply(scalar);
 		}
@@ -159,19 +189,43 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Invertes (subtracts every component OTHER THAN ALPGA from 1) this color. The alpha won't change.
 		/// </summary>
-		FColor Inverted() const;
+		constexpr FColor Inverted() const
+		{
+			return FColor(1 - red, 1 - blue, 1 - green, alpha);
+		}
+		#pragma endregion
+
+		#pragma region Premultiplied alpha.
+		/// <summary>
+		/// Gets this color with red, green and blue multiplied by alpha. The alpha won't change.
+		/// </summary>
+		constexpr FColor Premultiplied() const
+		{
+			return FColor(red * alpha, green * alpha, blue * alpha, alpha);
+		}
+
+		/// <summary>
+		/// Gets this color with red, green and blue divided by alpha. The alpha won't change, and a color with an alpha of 0 becomes clear.
+		/// </summary>
+		constexpr FColor Unpremultiplied() const
+		{
+			return alpha == 0 ? FColor(0, 0, 0, 0) : FColor(red / alpha, green / alpha, blue / alpha, alpha);
+		}
 		#pragma endregion
 
 		#pragma region Clamping and normalizing.
 		/// <summary>
 		/// Clamps every component of this between its corresponding component in min and its corresponding component in max.
 		/// </summary>
-		FColor Clamp(const FColor& min, const FColor& max) const;
+		constexpr FColor Clamp(const FColor& min, const FColor& max) const
+		{
+			return FColor(SMath::Clamp(red, min.red, max.red), SMath::Clamp(green, min.green, max.green), SMath::Clamp(blue, min.blue, max.blue), SMath::Clamp(alpha, min.alpha, max.alpha));
+		}
 
 		/// <summary>
 		/// Gets a version of this with all of its components clamped between 0 and 1. The returned value will always be a valid color.
 		/// </summary>
-		inline FColor Normalized() const
+		inline constexpr FColor Normalized() const
 		{
 			return Clamp(Black(), White());
 		}
@@ -179,7 +233,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Gets a version of color with all of its components clamped between 0 and 1. The returned value will always be a valid color.
 		/// </summary>
-		static inline FColor Normalize(const FColor& color)
+		static inline constexpr FColor Normalize(const FColor& color)
 		{
 			return color.Normalized();
 		}
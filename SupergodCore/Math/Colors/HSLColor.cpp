@@ -0,0 +1,26 @@
+#include "HSLColor.h"
+#include "FColor.h"
+#include "ColorOps.h"
+
+namespace SupergodCore { namespace Math
+{
+	HSLColor::HSLColor(const FColor& color)
+		: HSLColor(ColorOps::Convert<ColorOps::RgbToHsl, FColor, HSLColor>(color))
+	{
+	}
+
+	HSLColor::operator FColor() const
+	{
+		return ColorOps::Convert<ColorOps::HslToRgb, HSLColor, FColor>(*this);
+	}
+
+	void HSLColor::FromFColors(const FColor* source, HSLColor* destination, size_t count)
+	{
+		ColorOps::Convert<ColorOps::RgbToHsl>(source, destination, count);
+	}
+
+	void HSLColor::ToFColors(const HSLColor* source, FColor* destination, size_t count)
+	{
+		ColorOps::Convert<ColorOps::HslToRgb>(source, destination, count);
+	}
+} }
\ No newline at end of file
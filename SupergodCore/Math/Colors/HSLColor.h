@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../Interfaces/ISupergodEquatable.h"
+#include "../SMath.h"
+
+namespace SupergodCore { namespace Math
+{
+	struct FColor;
+
+	/// <summary>
+	/// Represents a color as hue, saturation and lightness (HSL), plus alpha. Every component is a float from 0 to 1, including the hue (which wraps around, 1 is red again).
+	/// </summary>
+	struct SUPERGOD_API_CLASS HSLColor final : public ISupergodEquatable<HSLColor>
+	{
+		union
+		{
+			struct { float hue, saturation, lightness, alpha; };
+			float components[4];
+		};
+
+		/// <summary>
+		/// Creates a new color with all of its components set to 0.
+		/// </summary>
+		constexpr HSLColor()
+			: hue(0), saturation(0), lightness(0), alpha(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new color with the specified hue, saturation, lightness and alpha.
+		/// </summary>
+		constexpr HSLColor(float hue, float saturation, float lightness, float alpha)
+			: hue(hue), saturation(saturation), lightness(lightness), alpha(alpha)
+		{
+		}
+
+		/// <summary>
+		/// Converts an RGB color to HSL. Gray colors get a hue of 0, and black gets a saturation of 0.
+		/// </summary>
+		explicit HSLColor(const FColor& color);
+
+		/// <summary>
+		/// Converts this to an RGB color.
+		/// </summary>
+		explicit operator FColor() const;
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Are all of the components of this equal to other?
+		/// </summary>
+		constexpr bool Equals(const HSLColor& other) const
+		{
+			return hue == other.hue && saturation == other.saturation && lightness == other.lightness && alpha == other.alpha;
+		}
+
+		/// <summary>
+		/// Is the distance between each component of this and its corresponding component in other smaller or equal to threshold?
+		/// </summary>
+		constexpr bool CloseEnough(const HSLColor& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(hue, other.hue, threshold) && SMath::CloseEnough(saturation, other.saturation, threshold) && SMath::CloseEnough(lightness, other.lightness, threshold) && SMath::CloseEnough(alpha, other.alpha, threshold);
+		}
+		#pragma endregion
+
+		#pragma region Bulk conversions.
+		/// <summary>
+		/// Converts count RGB colors to HSL, 4 at a time with SSE2. Gives the same results as converting every color on its own.
+		/// </summary>
+		static void FromFColors(const FColor* source, HSLColor* destination, size_t count);
+
+		/// <summary>
+		/// Converts count HSL colors to RGB, 4 at a time with SSE2. Gives the same results as converting every color on its own.
+		/// </summary>
+		static void ToFColors(const HSLColor* source, FColor* destination, size_t count);
+		#pragma endregion
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "HSVColor.h"
+#include "FColor.h"
+#include "ColorOps.h"
+
+namespace SupergodCore { namespace Math
+{
+	HSVColor::HSVColor(const FColor& color)
+		: HSVColor(ColorOps::Convert<ColorOps::RgbToHsv, FColor, HSVColor>(color))
+	{
+	}
+
+	HSVColor::operator FColor() const
+	{
+		return ColorOps::Convert<ColorOps::HsvToRgb, HSVColor, FColor>(*this);
+	}
+
+	void HSVColor::FromFColors(const FColor* source, HSVColor* destination, size_t count)
+	{
+		ColorOps::Convert<ColorOps::RgbToHsv>(source, destination, count);
+	}
+
+	void HSVColor::ToFColors(const HSVColor* source, FColor* destination, size_t count)
+	{
+		ColorOps::Convert<ColorOps::HsvToRgb>(source, destination, count);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "OklabColor.h"
+#include "FColor.h"
+#include "ColorOps.h"
+
+namespace SupergodCore { namespace Math
+{
+	OklabColor::OklabColor(const FColor& color)
+		: OklabColor(ColorOps::Convert<ColorOps::RgbToOklab, FColor, OklabColor>(color))
+	{
+	}
+
+	OklabColor::operator FColor() const
+	{
+		return ColorOps::Convert<ColorOps::OklabToRgb, OklabColor, FColor>(*this);
+	}
+
+	FColor OklabColor::PerceptualLerp(const FColor& source, const FColor& target, float alpha, bool clampAlpha)
+	{
+		return (FColor)OklabColor(source).Lerp(OklabColor(target), alpha, clampAlpha);
+	}
+
+	void OklabColor::PerceptualLerp(const FColor& source, const FColor& target, const float* alphas, FColor* destination, size_t count, bool clampAlpha)
+	{
+		OklabColor from(source), to(target);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			// The same math as ILerpable::Lerp, on 4 factors at a time.
+			__m128 factors = _mm_loadu_ps(alphas + i);
+			if (clampAlpha)
+				factors = _mm_min_ps(_mm_max_ps(factors, _mm_setzero_ps()), _mm_set1_ps(1));
+
+			__m128 inverse = _mm_sub_ps(_mm_set1_ps(1), factors);
+			__m128 components[4];
+			for (int component = 0; component < 4; component++)
+				components[component] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(from.components[component]), inverse), _mm_mul_ps(_mm_set1_ps(to.components[component]), factors));
+
+			ColorOps::OklabToRgb::Apply<ColorOps::Sse2Ops>(components[0], components[1], components[2]);
+
+			_MM_TRANSPOSE4_PS(components[0], components[1], components[2], components[3]);
+			for (int color = 0; color < 4; color++)
+				_mm_storeu_ps(destination[i + color].components, components[color]);
+		}
+
+		for (; i < count; i++)
+			destination[i] = (FColor)from.Lerp(to, alphas[i], clampAlpha);
+	}
+
+	void OklabColor::FromFColors(const FColor* source, OklabColor* destination, size_t count)
+	{
+		ColorOps::Convert<ColorOps::RgbToOklab>(source, destination, count);
+	}
+
+	void OklabColor::ToFColors(const OklabColor* source, FColor* destination, size_t count)
+	{
+		ColorOps::Convert<ColorOps::OklabToRgb>(source, destination, count);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../Interfaces/ILerpable.h"
+#include "../Interfaces/ISupergodEquatable.h"
+#include "../SMath.h"
+
+namespace SupergodCore { namespace Math
+{
+	struct FColor;
+
+	/// <summary>
+	/// Represents a color in the Oklab perceptual color space, plus alpha.<para/>
+	/// lightness goes from 0 (black) to 1 (white), a goes from green (negative) to red (positive) and b goes from blue (negative) to yellow (positive).
+	/// Distances and interpolations in Oklab match how different colors look, so gradients made in it don't get muddy or change brightness.<para/>
+	/// Conversions treat FColor as linear RGB (use ColorSpace to convert sRGB colors first).
+	/// </summary>
+	struct SUPERGOD_API_CLASS OklabColor final : public ISupergodEquatable<OklabColor>, public ILerpable<OklabColor>
+	{
+		union
+		{
+			struct { float lightness, a, b, alpha; };
+			float components[4];
+		};
+
+		/// <summary>
+		/// Creates a new color with all of its components set to 0.
+		/// </summary>
+		constexpr OklabColor()
+			: lightness(0), a(0), b(0), alpha(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new color with the specified lightness, a, b and alpha.
+		/// </summary>
+		constexpr OklabColor(float lightness, float a, float b, float alpha)
+			: lightness(lightness), a(a), b(b), alpha(alpha)
+		{
+		}
+
+		/// <summary>
+		/// Converts a linear RGB color to Oklab.
+		/// </summary>
+		explicit OklabColor(const FColor& color);
+
+		/// <summary>
+		/// Converts this to a linear RGB color. Colors outside of the RGB gamut get components outside of [0, 1].
+		/// </summary>
+		explicit operator FColor() const;
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Are all of the components of this equal to other?
+		/// </summary>
+		constexpr bool Equals(const OklabColor& other) const
+		{
+			return lightness == other.lightness && a == other.a && b == other.b && alpha == other.alpha;
+		}
+
+		/// <summary>
+		/// Is the distance between each component of this and its corresponding component in other smaller or equal to threshold?
+		/// </summary>
+		constexpr bool CloseEnough(const OklabColor& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(lightness, other.lightness, threshold) && SMath::CloseEnough(a, other.a, threshold) && SMath::CloseEnough(b, other.b, threshold) && SMath::CloseEnough(alpha, other.alpha, threshold);
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Adds every component of this to its corresponding component in other.
+		/// </summary>
+		constexpr OklabColor Add(const OklabColor& other) const
+		{
+			return OklabColor(lightness + other.lightness, a + other.a, b + other.b, alpha + other.alpha);
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		constexpr OklabColor Multiply(float scalar) const
+		{
+			return OklabColor(lightness * scalar, a * scalar, b * scalar, alpha * scalar);
+		}
+		#pragma endregion
+
+		#pragma region Perceptual interpolation.
+		/// <summary>
+		/// Interpolates between two linear RGB colors in Oklab, so the colors in between look like an even blend.
+		/// </summary>
+		/// <param name="source">The initial color.</param>
+		/// <param name="target">The color to interpolate to.</param>
+		/// <param name="alpha">The interpolation factor.</param>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		static FColor PerceptualLerp(const FColor& source, const FColor& target, float alpha, bool clampAlpha = true);
+
+		/// <summary>
+		/// Interpolates between two linear RGB colors in Oklab by count factors (for example the ages of particles), 4 at a time with SSE2.<para/>
+		/// Gives the same results as interpolating by every factor on its own.
+		/// </summary>
+		static void PerceptualLerp(const FColor& source, const FColor& target, const float* alphas, FColor* destination, size_t count, bool clampAlpha = true);
+		#pragma endregion
+
+		#pragma region Bulk conversions.
+		/// <summary>
+		/// Converts count linear RGB colors to Oklab, 4 at a time with SSE2. Gives the same results as converting every color on its own.
+		/// </summary>
+		static void FromFColors(const FColor* source, OklabColor* destination, size_t count);
+
+		/// <summary>
+		/// Converts count Oklab colors to linear RGB, 4 at a time with SSE2. Gives the same results as converting every color on its own.
+		/// </summary>
+		static void ToFColors(const OklabColor* source, FColor* destination, size_t count);
+		#pragma endregion
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "AnimationCurve.h"
+#include "../SMath.h"
+#include <algorithm>
+
+namespace SupergodCore { namespace Math
+{
+	AnimationCurve::AnimationCurve()
+		: keys(), table(), tableLayout()
+	{
+	}
+
+	AnimationCurve::AnimationCurve(const CurveKey* keys, size_t count)
+		: keys(keys, keys + count), table(), tableLayout()
+	{
+		std::stable_sort(this->keys.begin(), this->keys.end(), [](const CurveKey& a, const CurveKey& b) { return a.time < b.time; });
+	}
+
+	AnimationCurve AnimationCurve::Linear(float startTime, float startValue, float endTime, float endValue)
+	{
+		CurveKey keys[] = { CurveKey(startTime, startValue), CurveKey(endTime, endValue) };
+		return AnimationCurve(keys, 2);
+	}
+
+	#pragma region Keys.
+	void AnimationCurve::AddKey(const CurveKey& key)
+	{
+		auto position = std::upper_bound(keys.begin(), keys.end(), key.time, [](float time, const CurveKey& other) { return time < other.time; });
+		keys.insert(position, key);
+
+		if (IsBaked())
+			Bake(table.size());
+	}
+
+	void AnimationCurve::RemoveKey(size_t index)
+	{
+		keys.erase(keys.begin() + index);
+
+		if (IsBaked())
+			Bake(table.size());
+	}
+	#pragma endregion
+
+	#pragma region Baking.
+	void AnimationCurve::Bake(size_t samples)
+	{
+		samples = samples < 2 ? 2 : samples;
+		float start = keys.empty() ? 0 : keys.front().time;
+		float end = keys.empty() ? 0 : keys.back().time;
+
+		table.resize(samples);
+		for (size_t i = 0; i < samples; i++)
+			table[i] = EvaluateKeys(start + (end - start) * i / (samples - 1));
+
+		tableLayout = CurveTable::CreateLayout(start, end, samples);
+	}
+
+	void AnimationCurve::Unbake()
+	{
+		table.clear();
+		table.shrink_to_fit();
+	}
+	#pragma endregion
+
+	#pragma region Evaluation.
+	/// <summary>
+	/// Evaluates a cubic Bezier curve with the control points a, b, c and d at t.
+	/// </summary>
+	static inline float CubicBezier(float a, float b, float c, float d, float t)
+	{
+		float inverse = 1 - t;
+		return inverse * inverse * inverse * a + 3 * inverse * inverse * t * b + 3 * inverse * t * t * c + t * t * t * d;
+	}
+
+	/// <summary>
+	/// Evaluates the segment of a Bezier key, where the curve is a Bezier curve in both time and value.
+	/// Finds the curve parameter at time with Newton's method (falling back to bisection), then gets the value at it.
+	/// </summary>
+	static float EvaluateBezier(const CurveKey& previous, const CurveKey& next, float time)
+	{
+		float duration = next.time - previous.time;
+		float outReach = SMath::Clamp(previous.outWeight, 0, 1) * duration;
+		float inReach = SMath::Clamp(next.inWeight, 0, 1) * duration;
+
+		// With weights between 0 and 1 the time control points are in order, so time grows with the parameter and there is a single solution.
+		float time0 = previous.time, time1 = previous.time + outReach, time2 = next.time - inReach, time3 = next.time;
+		float parameter = (time - previous.time) / duration;
+		float low = 0, high = 1;
+		for (int iteration = 0; iteration < 16; iteration++)
+		{
+			float error = CubicBezier(time0, time1, time2, time3, parameter) - time;
+			if (SMath::Abs(error) <= duration * 1e-6f)
+				break;
+
+			if (error > 0)
+				high = parameter;
+			else
+				low = parameter;
+
+			float inverse = 1 - parameter;
+			float derivative = 3 * inverse * inverse * (time1 - time0) + 6 * inverse * parameter * (time2 - time1) + 3 * parameter * parameter * (time3 - time2);
+			float newtonStep = derivative != 0 ? parameter - error / derivative : -1;
+			parameter = newtonStep > low && newtonStep < high ? newtonStep : (low + high) / 2;
+		}
+
+		return CubicBezier(previous.value, previous.value + previous.outTangent * outReach, next.value - next.inTangent * inReach, next.value, parameter);
+	}
+
+	float AnimationCurve::EvaluateKeys(float time) const
+	{
+		if (keys.empty())
+			return 0;
+
+		if (time <= keys.front().time)
+			return keys.front().value;
+
+		if (time >= keys.back().time)
+			return keys.back().value;
+
+		auto nextKey = std::upper_bound(keys.begin(), keys.end(), time, [](float time, const CurveKey& other) { return time < other.time; });
+		const CurveKey& next = *nextKey;
+		const CurveKey& previous = *(nextKey - 1);
+		float duration = next.time - previous.time;
+		float t = (time - previous.time) / duration;
+
+		switch (previous.interpolation)
+		{
+		case CurveInterpolation::Constant:
+			return previous.value;
+		case CurveInterpolation::Hermite:
+		{
+			float t2 = t * t, t3 = t2 * t;
+			return (2 * t3 - 3 * t2 + 1) * previous.value + (t3 - 2 * t2 + t) * previous.outTangent * duration
+				+ (-2 * t3 + 3 * t2) * next.value + (t3 - t2) * next.inTangent * duration;
+		}
+		case CurveInterpolation::Bezier:
+			return EvaluateBezier(previous, next, time);
+		default:
+			return previous.value + (next.value - previous.value) * t;
+		}
+	}
+
+	float AnimationCurve::Evaluate(float time) const
+	{
+		if (!IsBaked())
+			return EvaluateKeys(time);
+
+		float fraction;
+		int index = CurveTable::Locate(tableLayout, time, fraction);
+		return table[index] * (1 - fraction) + table[index + 1] * fraction;
+	}
+
+	void AnimationCurve::Evaluate(const float* times, float* destination, size_t count) const
+	{
+		size_t i = 0;
+		if (IsBaked())
+		{
+			__m128 one = _mm_set1_ps(1);
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 fractions;
+				__m128i indices = CurveTable::Locate(tableLayout, _mm_loadu_ps(times + i), fractions);
+
+				alignas(16) int indexLanes[4];
+				_mm_store_si128((__m128i*)indexLanes, indices);
+				__m128 previous = _mm_set_ps(table[indexLanes[3]], table[indexLanes[2]], table[indexLanes[1]], table[indexLanes[0]]);
+				__m128 next = _mm_set_ps(table[indexLanes[3] + 1], table[indexLanes[2] + 1], table[indexLanes[1] + 1], table[indexLanes[0] + 1]);
+				_mm_storeu_ps(destination + i, _mm_add_ps(_mm_mul_ps(previous, _mm_sub_ps(one, fractions)), _mm_mul_ps(next, fractions)));
+			}
+		}
+
+		for (; i < count; i++)
+			destination[i] = Evaluate(times[i]);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "CurveTable.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// The ways the value of an animation curve goes from one key to the next.
+	/// </summary>
+	enum class CurveInterpolation
+	{
+		/// <summary>
+		/// The value stays the value of the key until the next key.
+		/// </summary>
+		Constant = 1,
+
+		/// <summary>
+		/// The value goes to the next key in a straight line.
+		/// </summary>
+		Linear = 2,
+
+		/// <summary>
+		/// The value follows a cubic Hermite spline, leaving the key with its out tangent and arriving at the next key with its in tangent.
+		/// </summary>
+		Hermite = 3,
+
+		/// <summary>
+		/// Like Hermite, but the tangents also have weights (how far their handles reach, as a fraction of the time between the keys),
+		/// which makes the segment a cubic Bezier curve in time and value. Weights of 1/3 give the same curve as Hermite.
+		/// </summary>
+		Bezier = 4,
+	};
+
+	/// <summary>
+	/// A key (a value at a point in time) of an animation curve.
+	/// </summary>
+	struct SUPERGOD_API_CLASS CurveKey final
+	{
+		/// <summary>The time of the key.</summary>
+		float time;
+
+		/// <summary>The value of the curve at time.</summary>
+		float value;
+
+		/// <summary>The slope (value per time) the curve arrives at this key with.</summary>
+		float inTangent;
+
+		/// <summary>The slope (value per time) the curve leaves this key with.</summary>
+		float outTangent;
+
+		/// <summary>How far the in tangent reaches, as a fraction of the time from the previous key. Only used by Bezier segments.</summary>
+		float inWeight;
+
+		/// <summary>How far the out tangent reaches, as a fraction of the time to the next key. Only used by Bezier segments.</summary>
+		float outWeight;
+
+		/// <summary>How the curve goes from this key to the next one.</summary>
+		CurveInterpolation interpolation;
+
+		/// <summary>
+		/// Creates a new key with the value of 0 at time 0, that goes linearly to the next key.
+		/// </summary>
+		constexpr CurveKey()
+			: CurveKey(0, 0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new key with value at time, that goes linearly to the next key.
+		/// </summary>
+		constexpr CurveKey(float time, float value)
+			: time(time), value(value), inTangent(0), outTangent(0), inWeight(1.f / 3), outWeight(1.f / 3), interpolation(CurveInterpolation::Linear)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new key with value at time, that goes to the next key with a Hermite spline.
+		/// </summary>
+		constexpr CurveKey(float time, float value, float inTangent, float outTangent)
+			: time(time), value(value), inTangent(inTangent), outTangent(outTangent), inWeight(1.f / 3), outWeight(1.f / 3), interpolation(CurveInterpolation::Hermite)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new key with value at time, that goes to the next key with a Bezier curve.
+		/// </summary>
+		constexpr CurveKey(float time, float value, float inTangent, float outTangent, float inWeight, float outWeight)
+			: time(time), value(value), inTangent(inTangent), outTangent(outTangent), inWeight(inWeight), outWeight(outWeight), interpolation(CurveInterpolation::Bezier)
+		{
+		}
+	};
+
+	/// <summary>
+	/// A float that changes over time, made of keys (for example the size of a particle over its lifetime).<para/>
+	/// Times before the first key or after the last one get the value of the closest key.<para/>
+	/// Evaluating searches for the keys around the time. For many evaluations, Bake the curve into a table first: baked curves
+	/// are evaluated with two lookups, and the batched Evaluate runs on them with SSE2.
+	/// </summary>
+	class AnimationCurve final
+	{
+	public:
+		/// <summary>
+		/// Creates a new curve without keys, which is 0 everywhere.
+		/// </summary>
+		SUPERGOD_API_FUNC AnimationCurve();
+
+		/// <summary>
+		/// Creates a new curve from keys, which don't have to be sorted.
+		/// </summary>
+		SUPERGOD_API_FUNC AnimationCurve(const CurveKey* keys, size_t count);
+
+		/// <summary>
+		/// Creates a new curve that goes linearly from startValue at startTime to endValue at endTime.
+		/// </summary>
+		static SUPERGOD_API_FUNC AnimationCurve Linear(float startTime, float startValue, float endTime, float endValue);
+
+		#pragma region Keys.
+		/// <summary>
+		/// Gets the number of keys in the curve.
+		/// </summary>
+		inline size_t KeyCount() const { return keys.size(); }
+
+		/// <summary>
+		/// Gets the key at index. Keys are sorted by time.
+		/// </summary>
+		inline const CurveKey& GetKey(size_t index) const { return keys[index]; }
+
+		/// <summary>
+		/// Adds a key, after any key with the same time. Rebakes the curve if it was baked.
+		/// </summary>
+		SUPERGOD_API_FUNC void AddKey(const CurveKey& key);
+
+		/// <summary>
+		/// Removes the key at index. Rebakes the curve if it was baked.
+		/// </summary>
+		SUPERGOD_API_FUNC void RemoveKey(size_t index);
+		#pragma endregion
+
+		#pragma region Baking.
+		/// <summary>
+		/// Samples the curve at samples (at least 2) evenly spaced times between the first and last key, and evaluates from the samples from now on.<para/>
+		/// Use enough samples for the sharpest change in the curve. Constant segments become steep ramps between samples.
+		/// </summary>
+		SUPERGOD_API_FUNC void Bake(size_t samples = 256);
+
+		/// <summary>
+		/// Throws the baked table away and evaluates from the keys again.
+		/// </summary>
+		SUPERGOD_API_FUNC void Unbake();
+
+		/// <summary>
+		/// Is the curve evaluated from a baked table?
+		/// </summary>
+		inline bool IsBaked() const { return !table.empty(); }
+		#pragma endregion
+
+		#pragma region Evaluation.
+		/// <summary>
+		/// Gets the value of the curve at time.
+		/// </summary>
+		SUPERGOD_API_FUNC float Evaluate(float time) const;
+
+		/// <summary>
+		/// Gets the values of the curve at count times. Gives the same results as evaluating every time on its own.
+		/// </summary>
+		SUPERGOD_API_FUNC void Evaluate(const float* times, float* destination, size_t count) const;
+		#pragma endregion
+
+	private:
+		/// <summary>
+		/// Evaluates from the keys, ignoring the table.
+		/// </summary>
+		float EvaluateKeys(float time) const;
+
+		std::vector<CurveKey> keys;
+		std::vector<float> table;
+		CurveTable::Layout tableLayout;
+	};
+} }
\ No newline at end of file
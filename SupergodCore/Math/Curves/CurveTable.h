@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Helpers for sampling baked curve tables: evenly spaced samples of a curve between a start time and an end time, linearly interpolated.<para/>
+	/// The scalar and SSE2 versions do the same operations, so single and batched evaluations give the same results.
+	/// Only used by the curve implementations, not part of the public headers.
+	/// </summary>
+	namespace CurveTable
+	{
+		/// <summary>
+		/// Where a time falls in a baked table: scale is (samples - 1) / (end - start) and lastSegment is samples - 2.
+		/// </summary>
+		struct Layout
+		{
+			float start;
+			float scale;
+			float lastSegment;
+		};
+
+		/// <summary>
+		/// Finds the sample before time and how far time is between it and the next sample (from 0 to 1). Times outside the table are clamped.
+		/// </summary>
+		inline int Locate(const Layout& layout, float time, float& fraction)
+		{
+			// Written like maxps and minps, so NaN ends up at the start like in the batched version.
+			float position = (time - layout.start) * layout.scale;
+			position = position > 0 ? position : 0;
+			position = position < layout.lastSegment + 1 ? position : layout.lastSegment + 1;
+
+			float segment = (float)(int)position;
+			segment = segment < layout.lastSegment ? segment : layout.lastSegment;
+			fraction = position - segment;
+			return (int)segment;
+		}
+
+		/// <summary>
+		/// Locate for 4 times at a time.
+		/// </summary>
+		inline __m128i Locate(const Layout& layout, __m128 times, __m128& fractions)
+		{
+			__m128 lastSegment = _mm_set1_ps(layout.lastSegment);
+			__m128 position = _mm_mul_ps(_mm_sub_ps(times, _mm_set1_ps(layout.start)), _mm_set1_ps(layout.scale));
+			position = _mm_min_ps(_mm_max_ps(position, _mm_setzero_ps()), _mm_add_ps(lastSegment, _mm_set1_ps(1)));
+
+			__m128 segment = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(position)), lastSegment);
+			fractions = _mm_sub_ps(position, segment);
+			return _mm_cvttps_epi32(segment);
+		}
+
+		/// <summary>
+		/// Creates the layout of a table with samples samples (at least 2) between start and end.
+		/// </summary>
+		inline Layout CreateLayout(float start, float end, size_t samples)
+		{
+			Layout layout;
+			layout.start = start;
+			layout.scale = end > start ? (samples - 1) / (end - start) : 0;
+			layout.lastSegment = (float)(samples - 2);
+			return layout;
+		}
+	}
+} }
\ No newline at end of file
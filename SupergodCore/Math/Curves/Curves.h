@@ -0,0 +1,5 @@
+#pragma once
+
+#include "Gradient.h"
+#include "AnimationCurve.h"
+#include "Spline.h"
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "Gradient.h"
+#include <algorithm>
+
+namespace SupergodCore { namespace Math
+{
+	Gradient::Gradient()
+		: stops(), table(), tableLayout()
+	{
+	}
+
+	Gradient::Gradient(const GradientStop* stops, size_t count)
+		: stops(stops, stops + count), table(), tableLayout()
+	{
+		std::stable_sort(this->stops.begin(), this->stops.end(), [](const GradientStop& a, const GradientStop& b) { return a.time < b.time; });
+	}
+
+	Gradient::Gradient(const FColor& start, const FColor& end)
+		: stops({ GradientStop(0, start), GradientStop(1, end) }), table(), tableLayout()
+	{
+	}
+
+	#pragma region Stops.
+	void Gradient::AddStop(const GradientStop& stop)
+	{
+		auto position = std::upper_bound(stops.begin(), stops.end(), stop.time, [](float time, const GradientStop& other) { return time < other.time; });
+		stops.insert(position, stop);
+
+		if (IsBaked())
+			Bake(table.size());
+	}
+
+	void Gradient::RemoveStop(size_t index)
+	{
+		stops.erase(stops.begin() + index);
+
+		if (IsBaked())
+			Bake(table.size());
+	}
+	#pragma endregion
+
+	#pragma region Baking.
+	void Gradient::Bake(size_t samples)
+	{
+		samples = samples < 2 ? 2 : samples;
+		float start = stops.empty() ? 0 : stops.front().time;
+		float end = stops.empty() ? 0 : stops.back().time;
+
+		table.resize(samples);
+		for (size_t i = 0; i < samples; i++)
+			table[i] = EvaluateStops(start + (end - start) * i / (samples - 1));
+
+		tableLayout = CurveTable::CreateLayout(start, end, samples);
+	}
+
+	void Gradient::Unbake()
+	{
+		table.clear();
+		table.shrink_to_fit();
+	}
+	#pragma endregion
+
+	#pragma region Evaluation.
+	FColor Gradient::EvaluateStops(float time) const
+	{
+		if (stops.empty())
+			return FColor::Clear();
+
+		if (time <= stops.front().time)
+			return stops.front().color;
+
+		if (time >= stops.back().time)
+			return stops.back().color;
+
+		auto next = std::upper_bound(stops.begin(), stops.end(), time, [](float time, const GradientStop& other) { return time < other.time; });
+		const GradientStop& previous = *(next - 1);
+		return previous.color.Lerp(next->color, (time - previous.time) / (next->time - previous.time));
+	}
+
+	FColor Gradient::Evaluate(float time) const
+	{
+		if (!IsBaked())
+			return EvaluateStops(time);
+
+		float fraction;
+		int index = CurveTable::Locate(tableLayout, time, fraction);
+		return table[index] * (1 - fraction) + table[index + 1] * fraction;
+	}
+
+	void Gradient::Evaluate(const float* times, FColor* destination, size_t count) const
+	{
+		size_t i = 0;
+		if (IsBaked())
+		{
+			__m128 one = _mm_set1_ps(1);
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 fractions;
+				__m128i indices = CurveTable::Locate(tableLayout, _mm_loadu_ps(times + i), fractions);
+
+				alignas(16) int indexLanes[4];
+				alignas(16) float fractionLanes[4];
+				_mm_store_si128((__m128i*)indexLanes, indices);
+				_mm_store_ps(fractionLanes, fractions);
+
+				for (int lane = 0; lane < 4; lane++)
+				{
+					__m128 fraction = _mm_set1_ps(fractionLanes[lane]);
+					__m128 previous = _mm_loadu_ps(table[indexLanes[lane]].components);
+					__m128 next = _mm_loadu_ps(table[indexLanes[lane] + 1].components);
+					_mm_storeu_ps(destination[i + lane].components, _mm_add_ps(_mm_mul_ps(previous, _mm_sub_ps(one, fraction)), _mm_mul_ps(next, fraction)));
+				}
+			}
+		}
+
+		for (; i < count; i++)
+			destination[i] = Evaluate(times[i]);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "../Colors/FColor.h"
+#include "CurveTable.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A color at a point in time of a gradient.
+	/// </summary>
+	struct SUPERGOD_API_CLASS GradientStop final
+	{
+		/// <summary>
+		/// The time of the stop, usually from 0 to 1.
+		/// </summary>
+		float time;
+
+		/// <summary>
+		/// The color of the gradient at time.
+		/// </summary>
+		FColor color;
+
+		/// <summary>
+		/// Creates a new clear stop at time 0.
+		/// </summary>
+		constexpr GradientStop()
+			: time(0), color()
+		{
+		}
+
+		/// <summary>
+		/// Creates a new stop with color at time.
+		/// </summary>
+		constexpr GradientStop(float time, const FColor& color)
+			: time(time), color(color)
+		{
+		}
+	};
+
+	/// <summary>
+	/// A color that changes over time, made of stops that are linearly interpolated (for example the color of a particle over its lifetime).<para/>
+	/// Times before the first stop or after the last one get the color of the closest stop.<para/>
+	/// Evaluating searches for the stops around the time. For many evaluations, Bake the gradient into a table first: baked gradients
+	/// are evaluated with two lookups, and the batched Evaluate runs on them with SSE2.
+	/// </summary>
+	class Gradient final
+	{
+	public:
+		/// <summary>
+		/// Creates a new gradient without stops, which is clear everywhere.
+		/// </summary>
+		SUPERGOD_API_FUNC Gradient();
+
+		/// <summary>
+		/// Creates a new gradient from stops, which don't have to be sorted.
+		/// </summary>
+		SUPERGOD_API_FUNC Gradient(const GradientStop* stops, size_t count);
+
+		/// <summary>
+		/// Creates a new gradient that goes from start at time 0 to end at time 1.
+		/// </summary>
+		SUPERGOD_API_FUNC Gradient(const FColor& start, const FColor& end);
+
+		#pragma region Stops.
+		/// <summary>
+		/// Gets the number of stops in the gradient.
+		/// </summary>
+		inline size_t StopCount() const { return stops.size(); }
+
+		/// <summary>
+		/// Gets the stop at index. Stops are sorted by time.
+		/// </summary>
+		inline const GradientStop& GetStop(size_t index) const { return stops[index]; }
+
+		/// <summary>
+		/// Adds a stop, after any stop with the same time. Rebakes the gradient if it was baked.
+		/// </summary>
+		SUPERGOD_API_FUNC void AddStop(const GradientStop& stop);
+
+		/// <summary>
+		/// Removes the stop at index. Rebakes the gradient if it was baked.
+		/// </summary>
+		SUPERGOD_API_FUNC void RemoveStop(size_t index);
+		#pragma endregion
+
+		#pragma region Baking.
+		/// <summary>
+		/// Samples the gradient at samples (at least 2) evenly spaced times between the first and last stop, and evaluates from the samples from now on.<para/>
+		/// Use enough samples for the sharpest change in the gradient, 256 is plenty for most.
+		/// </summary>
+		SUPERGOD_API_FUNC void Bake(size_t samples = 256);
+
+		/// <summary>
+		/// Throws the baked table away and evaluates from the stops again.
+		/// </summary>
+		SUPERGOD_API_FUNC void Unbake();
+
+		/// <summary>
+		/// Is the gradient evaluated from a baked table?
+		/// </summary>
+		inline bool IsBaked() const { return !table.empty(); }
+		#pragma endregion
+
+		#pragma region Evaluation.
+		/// <summary>
+		/// Gets the color of the gradient at time.
+		/// </summary>
+		SUPERGOD_API_FUNC FColor Evaluate(float time) const;
+
+		/// <summary>
+		/// Gets the colors of the gradient at count times. Gives the same results as evaluating every time on its own.
+		/// </summary>
+		SUPERGOD_API_FUNC void Evaluate(const float* times, FColor* destination, size_t count) const;
+		#pragma endregion
+
+	private:
+		/// <summary>
+		/// Evaluates from the stops, ignoring the table.
+		/// </summary>
+		FColor EvaluateStops(float time) const;
+
+		std::vector<GradientStop> stops;
+		std::vector<FColor> table;
+		CurveTable::Layout tableLayout;
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <emmintrin.h>
+#include "Common/CommonDefines.h"
+#include "../SMath.h"
+#include "CurveTable.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// The kinds of cubic splines.
+	/// </summary>
+	enum class SplineType
+	{
+		/// <summary>
+		/// Goes through every point, with tangents pointing from the previous point to the next one.
+		/// The missing points before the first point and after the last one are mirrored from their neighbours. Needs at least 2 points.
+		/// </summary>
+		CatmullRom = 1,
+
+		/// <summary>
+		/// Cubic Bezier segments: every segment starts at a point, is pulled by the 2 points after it and ends at the 4th one, which starts the next segment.
+		/// Needs 3 * segments + 1 points.
+		/// </summary>
+		Bezier = 2,
+
+		/// <summary>
+		/// A uniform cubic B-spline: very smooth (its curvature is continuous) but only goes near the points, not through them. Needs at least 4 points.
+		/// </summary>
+		BSpline = 3,
+	};
+
+	/// <summary>
+	/// A cubic spline through points of type T, which can be anything that can be added and scaled, like Vector2D, Vector3D and FColor.<para/>
+	/// The spline is evaluated by a parameter from 0 (the start) to 1 (the end), where every segment gets an equal part of the parameter.
+	/// To move along the spline at a constant speed (camera rails, path following), build an arc length table and evaluate by distance instead.
+	/// Lengths, distances and curvature need T to be a vector.<para/>
+	/// The batched functions compute the basis weights of 4 parameters at a time with SSE2 and give the same results as the single functions.
+	/// </summary>
+	template<class T>
+	class Spline final
+	{
+	public:
+		/// <summary>
+		/// Creates a new Catmull-Rom spline without points.
+		/// </summary>
+		Spline()
+			: type(SplineType::CatmullRom), points(), arcLengthTable(), arcLengthLayout(), arcLengthSamplesPerSegment(0), length(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new spline of type through count points.
+		/// </summary>
+		Spline(SplineType type, const T* points, size_t count)
+			: type(type), points(points, points + count), arcLengthTable(), arcLengthLayout(), arcLengthSamplesPerSegment(0), length(0)
+		{
+		}
+
+		#pragma region Points.
+		/// <summary>
+		/// Gets the kind of the spline.
+		/// </summary>
+		inline SplineType Type() const { return type; }
+
+		/// <summary>
+		/// Gets the number of points of the spline.
+		/// </summary>
+		inline size_t PointCount() const { return points.size(); }
+
+		/// <summary>
+		/// Gets the point at index.
+		/// </summary>
+		inline const T& GetPoint(size_t index) const { return points[index]; }
+
+		/// <summary>
+		/// Moves the point at index to value. Rebuilds the arc length table if the spline has one.
+		/// </summary>
+		void SetPoint(size_t index, const T& value)
+		{
+			points[index] = value;
+			RebuildArcLengthTable();
+		}
+
+		/// <summary>
+		/// Adds a point to the end of the spline. Rebuilds the arc length table if the spline has one.
+		/// </summary>
+		void AddPoint(const T& value)
+		{
+			points.push_back(value);
+			RebuildArcLengthTable();
+		}
+
+		/// <summary>
+		/// Gets the number of cubic segments the spline is made of.
+		/// </summary>
+		size_t SegmentCount() const
+		{
+			size_t count = points.size();
+			switch (type)
+			{
+			case SplineType::CatmullRom: return count < 2 ? 0 : count - 1;
+			case SplineType::Bezier: return count < 4 ? 0 : (count - 1) / 3;
+			default: return count < 4 ? 0 : count - 3;
+			}
+		}
+		#pragma endregion
+
+		#pragma region Evaluation.
+		/// <summary>
+		/// Gets the point on the spline at parameter (clamped between 0 and 1).
+		/// </summary>
+		T Evaluate(float parameter) const
+		{
+			return EvaluateDerivative(parameter, 0);
+		}
+
+		/// <summary>
+		/// Gets the derivative of the spline by the parameter at parameter: its direction, scaled by how fast a point moves along it as the parameter changes.
+		/// </summary>
+		T Tangent(float parameter) const
+		{
+			return EvaluateDerivative(parameter, 1);
+		}
+
+		/// <summary>
+		/// Gets the second derivative of the spline by the parameter at parameter.
+		/// </summary>
+		T SecondDerivative(float parameter) const
+		{
+			return EvaluateDerivative(parameter, 2);
+		}
+
+		/// <summary>
+		/// Gets how sharply the spline turns at parameter: 1 / the radius of the circle that touches the spline there. Straight parts have a curvature of 0.
+		/// </summary>
+		float Curvature(float parameter) const
+		{
+			T velocity = Tangent(parameter);
+			T acceleration = SecondDerivative(parameter);
+
+			float speedSquared = velocity.Dot(velocity);
+			if (speedSquared == 0)
+				return 0;
+
+			// |v x a| / |v|^3, written with dot products so it works in any dimension.
+			float dot = velocity.Dot(acceleration);
+			float crossSquared = speedSquared * acceleration.Dot(acceleration) - dot * dot;
+			return SMath::Sqrt(crossSquared > 0 ? crossSquared : 0) / (speedSquared * SMath::Sqrt(speedSquared));
+		}
+
+		/// <summary>
+		/// Gets the points on the spline at count parameters.
+		/// </summary>
+		void Evaluate(const float* parameters, T* destination, size_t count) const
+		{
+			EvaluateDerivatives(parameters, destination, count, 0);
+		}
+
+		/// <summary>
+		/// Gets the tangents of the spline at count parameters.
+		/// </summary>
+		void Tangent(const float* parameters, T* destination, size_t count) const
+		{
+			EvaluateDerivatives(parameters, destination, count, 1);
+		}
+		#pragma endregion
+
+		#pragma region Arc length.
+		/// <summary>
+		/// Measures the spline by samplesPerSegment straight lines per segment and builds a table that maps distances along the spline to parameters.
+		/// The table is rebuilt whenever a point changes.
+		/// </summary>
+		void BuildArcLengthTable(size_t samplesPerSegment = 32)
+		{
+			samplesPerSegment = samplesPerSegment < 1 ? 1 : samplesPerSegment;
+			arcLengthSamplesPerSegment = samplesPerSegment;
+			size_t samples = SegmentCount() * samplesPerSegment + 1;
+			samples = samples < 2 ? 2 : samples;
+
+			std::vector<float> distances(samples);
+			T previous = Evaluate(0);
+			distances[0] = 0;
+			for (size_t i = 1; i < samples; i++)
+			{
+				T current = Evaluate((float)i / (samples - 1));
+				distances[i] = distances[i - 1] + previous.Distance(current);
+				previous = current;
+			}
+
+			length = distances.back();
+
+			// Invert the measurements into parameters at evenly spaced distances, so looking up a distance is a table lookup instead of a search.
+			arcLengthTable.resize(samples);
+			size_t measurement = 0;
+			for (size_t i = 0; i < samples; i++)
+			{
+				float distance = length * i / (samples - 1);
+				while (measurement + 2 < samples && distances[measurement + 1] < distance)
+					measurement++;
+
+				float span = distances[measurement + 1] - distances[measurement];
+				float fraction = span > 0 ? SMath::Clamp((distance - distances[measurement]) / span, 0, 1) : 0;
+				arcLengthTable[i] = (measurement + fraction) / (samples - 1);
+			}
+
+			arcLengthLayout = CurveTable::CreateLayout(0, length, samples);
+		}
+
+		/// <summary>
+		/// Does the spline have an arc length table?
+		/// </summary>
+		inline bool HasArcLengthTable() const { return !arcLengthTable.empty(); }
+
+		/// <summary>
+		/// Gets the length of the spline, as measured by the arc length table.
+		/// </summary>
+		inline float Length() const { return length; }
+
+		/// <summary>
+		/// Gets the parameter of the point that is distance along the spline (clamped between 0 and the length). Needs an arc length table.
+		/// </summary>
+		float ParameterAtDistance(float distance) const
+		{
+			float fraction;
+			int index = CurveTable::Locate(arcLengthLayout, distance, fraction);
+			return arcLengthTable[index] * (1 - fraction) + arcLengthTable[index + 1] * fraction;
+		}
+
+		/// <summary>
+		/// Gets the point that is distance along the spline. Needs an arc length table.
+		/// </summary>
+		T EvaluateAtDistance(float distance) const
+		{
+			return Evaluate(ParameterAtDistance(distance));
+		}
+
+		/// <summary>
+		/// Gets the points that are count distances along the spline (for example the positions of agents following a path). Needs an arc length table.
+		/// </summary>
+		void EvaluateAtDistance(const float* distances, T* destination, size_t count) const
+		{
+			__m128 one = _mm_set1_ps(1);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 fractions;
+				__m128i indices = CurveTable::Locate(arcLengthLayout, _mm_loadu_ps(distances + i), fractions);
+
+				alignas(16) int indexLanes[4];
+				_mm_store_si128((__m128i*)indexLanes, indices);
+				__m128 previous = _mm_set_ps(arcLengthTable[indexLanes[3]], arcLengthTable[indexLanes[2]], arcLengthTable[indexLanes[1]], arcLengthTable[indexLanes[0]]);
+				__m128 next = _mm_set_ps(arcLengthTable[indexLanes[3] + 1], arcLengthTable[indexLanes[2] + 1], arcLengthTable[indexLanes[1] + 1], arcLengthTable[indexLanes[0] + 1]);
+
+				alignas(16) float parameters[4];
+				_mm_store_ps(parameters, _mm_add_ps(_mm_mul_ps(previous, _mm_sub_ps(one, fractions)), _mm_mul_ps(next, fractions)));
+				EvaluateDerivatives(parameters, destination + i, 4, 0);
+			}
+
+			for (; i < count; i++)
+				destination[i] = EvaluateAtDistance(distances[i]);
+		}
+		#pragma endregion
+
+	private:
+		#pragma region Implementation.
+		/// <summary>
+		/// Gets the point at index, mirroring the points before the first one and after the last one (used by Catmull-Rom ends).
+		/// </summary>
+		T PointOrMirror(ptrdiff_t index) const
+		{
+			ptrdiff_t last = (ptrdiff_t)points.size() - 1;
+			if (index < 0)
+				return points[0] * 2 - points[1];
+			if (index > last)
+				return points[last] * 2 - points[last - 1];
+			return points[index];
+		}
+
+		/// <summary>
+		/// Gets the 4 control points of segment.
+		/// </summary>
+		void SegmentPoints(int segment, T controlPoints[4]) const
+		{
+			ptrdiff_t first = type == SplineType::CatmullRom ? segment - 1 : type == SplineType::Bezier ? segment * 3 : segment;
+			for (int i = 0; i < 4; i++)
+				controlPoints[i] = type == SplineType::CatmullRom ? PointOrMirror(first + i) : points[first + i];
+		}
+
+		/// <summary>
+		/// Gets the basis matrix of the spline: row k has the coefficients of t^k in the weights of the 4 control points.
+		/// </summary>
+		const float* Basis() const
+		{
+			static const float catmullRom[16] = { 0, 1, 0, 0, -.5f, 0, .5f, 0, 1, -2.5f, 2, -.5f, -.5f, 1.5f, -1.5f, .5f };
+			static const float bezier[16] = { 1, 0, 0, 0, -3, 3, 0, 0, 3, -6, 3, 0, -1, 3, -3, 1 };
+			static const float bSpline[16] = { 1 / 6.f, 4 / 6.f, 1 / 6.f, 0, -.5f, 0, .5f, 0, .5f, -1, .5f, 0, -1 / 6.f, .5f, -.5f, 1 / 6.f };
+
+			switch (type)
+			{
+			case SplineType::CatmullRom: return catmullRom;
+			case SplineType::Bezier: return bezier;
+			default: return bSpline;
+			}
+		}
+
+		/// <summary>
+		/// Locates 4 parameters in the segments and gets the weights of the 4 control points of their segments for the derivative of order (0 is the position).
+		/// The single parameter functions call this too, so both give the same results.
+		/// </summary>
+		__m128i SegmentWeights(__m128 parameters, int order, __m128 weights[4]) const
+		{
+			size_t segments = SegmentCount();
+			__m128 t;
+			__m128i indices = CurveTable::Locate(CurveTable::CreateLayout(0, 1, segments + 1), parameters, t);
+
+			// The derivatives of [1, t, t^2, t^3], scaled by the number of segments for every order (the chain rule for the parameter of the whole spline).
+			__m128 zero = _mm_setzero_ps();
+			__m128 scale = _mm_set1_ps(order == 0 ? 1.f : order == 1 ? (float)segments : (float)(segments * segments));
+			__m128 powers[4];
+			if (order == 0)
+			{
+				powers[0] = _mm_set1_ps(1);
+				powers[1] = t;
+				powers[2] = _mm_mul_ps(t, t);
+				powers[3] = _mm_mul_ps(powers[2], t);
+			}
+			else if (order == 1)
+			{
+				powers[0] = zero;
+				powers[1] = scale;
+				powers[2] = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2), t), scale);
+				powers[3] = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(3), _mm_mul_ps(t, t)), scale);
+			}
+			else
+			{
+				powers[0] = zero;
+				powers[1] = zero;
+				powers[2] = _mm_mul_ps(_mm_set1_ps(2), scale);
+				powers[3] = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(6), t), scale);
+			}
+
+			const float* basis = Basis();
+			for (int point = 0; point < 4; point++)
+			{
+				weights[point] = _mm_mul_ps(powers[0], _mm_set1_ps(basis[point]));
+				for (int power = 1; power < 4; power++)
+					weights[point] = _mm_add_ps(weights[point], _mm_mul_ps(powers[power], _mm_set1_ps(basis[power * 4 + point])));
+			}
+
+			return indices;
+		}
+
+		/// <summary>
+		/// Sums the control points of segment multiplied by their weights.
+		/// </summary>
+		T Combine(int segment, const float weights[4]) const
+		{
+			T controlPoints[4];
+			SegmentPoints(segment, controlPoints);
+			return controlPoints[0] * weights[0] + controlPoints[1] * weights[1] + controlPoints[2] * weights[2] + controlPoints[3] * weights[3];
+		}
+
+		T EvaluateDerivative(float parameter, int order) const
+		{
+			T result;
+			EvaluateDerivatives(&parameter, &result, 1, order);
+			return result;
+		}
+
+		void EvaluateDerivatives(const float* parameters, T* destination, size_t count, int order) const
+		{
+			if (SegmentCount() == 0)
+			{
+				for (size_t i = 0; i < count; i++)
+					destination[i] = points.empty() || order != 0 ? T() : points[0];
+				return;
+			}
+
+			for (size_t i = 0; i < count; i += 4)
+			{
+				alignas(16) float laneParameters[4] = { 0, 0, 0, 0 };
+				size_t lanes = count - i < 4 ? count - i : 4;
+				for (size_t lane = 0; lane < lanes; lane++)
+					laneParameters[lane] = parameters[i + lane];
+
+				__m128 weights[4];
+				alignas(16) int segments[4];
+				alignas(16) float laneWeights[4][4];
+				_mm_store_si128((__m128i*)segments, SegmentWeights(_mm_load_ps(laneParameters), order, weights));
+				_MM_TRANSPOSE4_PS(weights[0], weights[1], weights[2], weights[3]);
+				for (int lane = 0; lane < 4; lane++)
+					_mm_store_ps(laneWeights[lane], weights[lane]);
+
+				for (size_t lane = 0; lane < lanes; lane++)
+					destination[i + lane] = Combine(segments[lane], laneWeights[lane]);
+			}
+		}
+
+		/// <summary>
+		/// Builds the arc length table again if the spline has one.
+		/// </summary>
+		void RebuildArcLengthTable()
+		{
+			if (HasArcLengthTable())
+				BuildArcLengthTable(arcLengthSamplesPerSegment);
+		}
+		#pragma endregion
+
+		SplineType type;
+		std::vector<T> points;
+		std::vector<float> arcLengthTable;
+		CurveTable::Layout arcLengthLayout;
+		size_t arcLengthSamplesPerSegment;
+		float length;
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,509 @@
+#include "SMath.h"
+#include <cstring>
+#include <limits>
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	// Everything here is calculated with doubles and rounded to float once at the end.
+	// Floats convert to doubles exactly, and the extra precision keeps the polynomial and reduction errors far below 1 float ulp.
+	// The sin, cos and atan coefficients are the ones used by FreeBSD's msun (fdlibm), which is freely redistributable.
+
+	static const double PI = 3.14159265358979311600e+00;
+	static const double HALF_PI = 1.57079632679489655800e+00;
+	static const double TWO_OVER_PI = 6.36619772367581382433e-01;
+
+	// Pi/2 split into 3 parts with 33 bits each, so multiplying them by a quadrant count under 2^20 is exact.
+	static const double HALF_PI_1 = 1.57079632673412561417e+00;
+	static const double HALF_PI_2 = 6.07710050630396597660e-11;
+	static const double HALF_PI_3 = 2.02226624871116645580e-21;
+
+	static const double INVERSE_LN2 = 1.44269504088896338700e+00;
+
+	// Ln2 split into 2 parts, the first with 32 bits so multiplying it by an exponent is exact.
+	static const double LN2_HIGH = 6.93147180369123816490e-01;
+	static const double LN2_LOW = 1.90821492927058770002e-10;
+
+	// Adding and subtracting this rounds a double to an integer (with the default round to nearest, ties to even).
+	static const double ROUNDING_MAGIC = 6755399441055744.0;
+
+	static inline double RoundToInteger(double value)
+	{
+		return (value + ROUNDING_MAGIC) - ROUNDING_MAGIC;
+	}
+
+	static inline unsigned long long DoubleToBits(double value)
+	{
+		unsigned long long bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	static inline double BitsToDouble(unsigned long long bits)
+	{
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	static inline double DoubleSqrt(double x)
+	{
+		return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(x)));
+	}
+
+	static inline float NotANumber()
+	{
+		return std::numeric_limits<float>::quiet_NaN();
+	}
+
+	#pragma region Trig.
+	/// <summary>
+	/// Gets sin(x) for x between -pi/4 and pi/4.
+	/// </summary>
+	static inline double SinKernel(double x)
+	{
+		const double S1 = -0.166666666416265235595;
+		const double S2 = 0.0083333293858894631756;
+		const double S3 = -0.000198393348360966317347;
+		const double S4 = 0.0000027183114939898219064;
+
+		double z = x * x;
+		return x + x * z * (S1 + z * (S2 + z * (S3 + z * S4)));
+	}
+
+	/// <summary>
+	/// Gets cos(x) for x between -pi/4 and pi/4.
+	/// </summary>
+	static inline double CosKernel(double x)
+	{
+		const double C0 = -0.499999997251031003120;
+		const double C1 = 0.0416666233237390631894;
+		const double C2 = -0.00138867637746099294692;
+		const double C3 = 0.0000243904487962774090654;
+
+		double z = x * x;
+		return 1 + z * (C0 + z * (C1 + z * (C2 + z * C3)));
+	}
+
+	/// <summary>
+	/// Gets the number of quarter turns in k (a whole number) mod 4.
+	/// </summary>
+	static inline int QuarterTurnsMod4(double k)
+	{
+		// Doubles from 2^54 and up are multiples of 4.
+		double quarter = k * .25;
+		if (quarter >= 4503599627370496.0 || quarter <= -4503599627370496.0)
+			return 0;
+
+		double wholeTurns = RoundToInteger(quarter);
+		if (wholeTurns > quarter)
+			wholeTurns -= 1;
+		return (int)((quarter - wholeTurns) * 4);
+	}
+
+	/// <summary>
+	/// Reduces theta to the range [-pi/4, pi/4] and returns it, and sets quadrant to the number of quarter turns that were taken out of it (mod 4).
+	/// </summary>
+	static inline double ReduceQuarterTurns(float theta, int& quadrant)
+	{
+		double x = theta;
+		double turns = x * TWO_OVER_PI;
+
+		// One step is exact for everything under 2^20 quarter turns.
+		if (turns > -1048576 && turns < 1048576)
+		{
+			double k = RoundToInteger(turns);
+			quadrant = (int)k & 3;
+			return ((x - k * HALF_PI_1) - k * HALF_PI_2) - k * HALF_PI_3;
+		}
+
+		// Bigger values can leave a remainder that's still too big, and the following steps bring it down (it isn't accurate anymore, but it's deterministic).
+		quadrant = 0;
+		do
+		{
+			// Huge values are already whole numbers (and too big for the rounding trick).
+			double k = turns > -ROUNDING_MAGIC && turns < ROUNDING_MAGIC ? RoundToInteger(turns) : turns;
+			quadrant = (quadrant + QuarterTurnsMod4(k)) & 3;
+			x = ((x - k * HALF_PI_1) - k * HALF_PI_2) - k * HALF_PI_3;
+			turns = x * TWO_OVER_PI;
+		} while (x > .79 || x < -.79);
+
+		return x;
+	}
+
+	/// <summary>
+	/// Gets the sine of theta.
+	/// </summary>
+	static inline double DoubleSin(float theta)
+	{
+		int quadrant;
+		double x = ReduceQuarterTurns(theta, quadrant);
+		double sin = quadrant & 1 ? CosKernel(x) : SinKernel(x);
+		return quadrant & 2 ? -sin : sin;
+	}
+
+	/// <summary>
+	/// Gets the cosine of theta.
+	/// </summary>
+	static inline double DoubleCos(float theta)
+	{
+		int quadrant;
+		double x = ReduceQuarterTurns(theta, quadrant);
+		double cos = quadrant & 1 ? SinKernel(x) : CosKernel(x);
+		return (quadrant + 1) & 2 ? -cos : cos;
+	}
+
+	float SMath::Deterministic::Sin(float theta)
+	{
+		if (theta != theta || theta - theta != 0)
+			return NotANumber();
+
+		// Keeps the sign of -0.
+		if (theta == 0)
+			return theta;
+
+		return (float)DoubleSin(theta);
+	}
+
+	float SMath::Deterministic::Cos(float theta)
+	{
+		if (theta != theta || theta - theta != 0)
+			return NotANumber();
+
+		return (float)DoubleCos(theta);
+	}
+
+	float SMath::Deterministic::Tan(float theta)
+	{
+		if (theta != theta || theta - theta != 0)
+			return NotANumber();
+
+		// Keeps the sign of -0.
+		if (theta == 0)
+			return theta;
+
+		int quadrant;
+		double x = ReduceQuarterTurns(theta, quadrant);
+		double sin = SinKernel(x), cos = CosKernel(x);
+		return (float)(quadrant & 1 ? -cos / sin : sin / cos);
+	}
+
+	/// <summary>
+	/// Gets atan(x) for any finite x.
+	/// </summary>
+	static double DoubleAtan(double x)
+	{
+		static const double ATAN_HIGH[] = { 4.63647609000806093515e-01, 7.85398163397448278999e-01, 9.82793723247329054082e-01, 1.57079632679489655800e+00 };
+		static const double ATAN_LOW[] = { 2.26987774529616870924e-17, 3.06161699786838301793e-17, 1.39033110312309984516e-17, 6.12323399573676603587e-17 };
+		static const double T[] =
+		{
+			3.33333333333329318027e-01, -1.99999999998764832476e-01, 1.42857142725034663711e-01, -1.11111104054623557880e-01,
+			9.09088713343650656196e-02, -7.69187620504482999495e-02, 6.66107313738753120669e-02, -5.83357013379057348645e-02,
+			4.97687799461593236017e-02, -3.65315727442169155270e-02, 1.62858201153657823623e-02
+		};
+
+		bool negative = x < 0;
+		if (negative)
+			x = -x;
+
+		// Reduce x to [-7/16, 7/16] with atan(x) = atan(c) + atan((x - c) / (1 + x * c)) for c in 0, 1/2, 1, 3/2 and infinity.
+		int id;
+		if (x < .4375)
+			id = -1;
+		else if (x < .6875)
+		{
+			id = 0;
+			x = (2 * x - 1) / (2 + x);
+		}
+		else if (x < 1.1875)
+		{
+			id = 1;
+			x = (x - 1) / (x + 1);
+		}
+		else if (x < 2.4375)
+		{
+			id = 2;
+			x = (x - 1.5) / (1 + 1.5 * x);
+		}
+		else
+		{
+			id = 3;
+			x = -1 / x;
+		}
+
+		double z = x * x;
+		double w = z * z;
+		double odd = z * (T[0] + w * (T[2] + w * (T[4] + w * (T[6] + w * (T[8] + w * T[10])))));
+		double even = w * (T[1] + w * (T[3] + w * (T[5] + w * (T[7] + w * T[9]))));
+
+		double result = id < 0 ? x - x * (odd + even) : ATAN_HIGH[id] - ((x * (odd + even) - ATAN_LOW[id]) - x);
+		return negative ? -result : result;
+	}
+
+	/// <summary>
+	/// Gets atan2(y, x) where x and y aren't NaN.
+	/// </summary>
+	static double DoubleAtan2(double y, double x)
+	{
+		bool yNegative = y < 0 || (y == 0 && 1 / y < 0);
+		bool xNegative = x < 0 || (x == 0 && 1 / x < 0);
+
+		if (y == 0)
+			return xNegative ? (yNegative ? -PI : PI) : y;
+
+		if (x == 0)
+			return yNegative ? -HALF_PI : HALF_PI;
+
+		bool xInfinite = x - x != 0, yInfinite = y - y != 0;
+		if (xInfinite && yInfinite)
+		{
+			double angle = xNegative ? 3 * PI / 4 : PI / 4;
+			return yNegative ? -angle : angle;
+		}
+
+		if (yInfinite)
+			return yNegative ? -HALF_PI : HALF_PI;
+
+		if (xInfinite)
+			return xNegative ? (yNegative ? -PI : PI) : (yNegative ? -0.0 : 0.0);
+
+		double angle = DoubleAtan(y / x);
+		if (xNegative)
+			angle += yNegative ? -PI : PI;
+		return angle;
+	}
+
+	float SMath::Deterministic::Asin(float sin)
+	{
+		if (!(sin >= -1 && sin <= 1))
+			return NotANumber();
+
+		// (1 - sin) and (1 + sin) are exact in doubles, and so is their product, so only the square root rounds.
+		double x = sin;
+		if (x == 1 || x == -1)
+			return (float)(x * HALF_PI);
+
+		return (float)DoubleAtan(x / DoubleSqrt((1 - x) * (1 + x)));
+	}
+
+	float SMath::Deterministic::Acos(float cos)
+	{
+		if (!(cos >= -1 && cos <= 1))
+			return NotANumber();
+
+		double x = cos;
+		if (x == 0)
+			return (float)HALF_PI;
+
+		double angle = DoubleAtan(DoubleSqrt((1 - x) * (1 + x)) / x);
+		return (float)(x < 0 ? angle + PI : angle);
+	}
+
+	float SMath::Deterministic::Atan(float tan)
+	{
+		// NaNs stay NaNs, and 0 keeps its sign.
+		if (tan != tan || tan == 0)
+			return tan;
+
+		if (tan - tan != 0)
+			return (float)(tan > 0 ? HALF_PI : -HALF_PI);
+
+		return (float)DoubleAtan(tan);
+	}
+
+	float SMath::Deterministic::Atan2(float y, float x)
+	{
+		if (x != x || y != y)
+			return NotANumber();
+
+		return (float)DoubleAtan2(y, x);
+	}
+	#pragma endregion
+
+	#pragma region Exponentials and logarithms.
+	/// <summary>
+	/// The number of entries in the exponential and logarithm tables per doubling.
+	/// </summary>
+	static const int TABLE_STEPS = 32;
+
+	/// <summary>
+	/// Gets e^x with its Taylor series, for x between -1 and 1. This is slow, it's only used for building the table.
+	/// </summary>
+	static double ExpSeries(double x)
+	{
+		double term = 1, sum = 1;
+		for (int i = 1; i < 30; i++)
+		{
+			term = term * x / i;
+			sum += term;
+		}
+		return sum;
+	}
+
+	/// <summary>
+	/// Gets ln(x) with the series 2 * atanh((x - 1) / (x + 1)), for x between 1 and 2. This is slow, it's only used for building the table.
+	/// </summary>
+	static double LogSeries(double x)
+	{
+		double s = (x - 1) / (x + 1);
+		double z = s * s;
+		double power = s, sum = 0;
+		for (int i = 1; i < 80; i += 2)
+		{
+			sum += power / i;
+			power *= z;
+		}
+		return 2 * sum;
+	}
+
+	/// <summary>
+	/// The tables for the exponential and the logarithm. They are calculated with basic operations on first use, so they are the same everywhere.
+	/// </summary>
+	struct ExpLogTables
+	{
+		/// <summary>2^(i / TABLE_STEPS).</summary>
+		double powersOfTwo[TABLE_STEPS];
+
+		/// <summary>1 / (1 + i / TABLE_STEPS).</summary>
+		double inverses[TABLE_STEPS + 1];
+
+		/// <summary>ln(1 + i / TABLE_STEPS).</summary>
+		double logarithms[TABLE_STEPS + 1];
+
+		ExpLogTables()
+		{
+			for (int i = 0; i < TABLE_STEPS; i++)
+				powersOfTwo[i] = ExpSeries(i * (LN2_HIGH + LN2_LOW) / TABLE_STEPS);
+
+			for (int i = 0; i <= TABLE_STEPS; i++)
+			{
+				double c = 1 + (double)i / TABLE_STEPS;
+				inverses[i] = 1 / c;
+				logarithms[i] = LogSeries(c);
+			}
+		}
+	};
+
+	static const ExpLogTables& GetExpLogTables()
+	{
+		static const ExpLogTables tables;
+		return tables;
+	}
+
+	/// <summary>
+	/// Gets e^x for x between -750 and 710 (outside of that it's 0 or infinity anyway).
+	/// </summary>
+	static double DoubleExp(double x)
+	{
+		if (x > 709)
+			return std::numeric_limits<double>::infinity();
+		if (x < -745)
+			return 0;
+
+		// e^x = 2^(k / 32) * e^r where r is between -ln2/64 and ln2/64. 2^(k / 32) comes from the table and the exponent bits, and e^r is its Taylor series up to r^5.
+		// k is under 2^16, so multiplying it by the 32 bits of LN2_HIGH / 32 is exact.
+		const ExpLogTables& tables = GetExpLogTables();
+		double k = RoundToInteger(x * (INVERSE_LN2 * TABLE_STEPS));
+		double r = (x - k * (LN2_HIGH / TABLE_STEPS)) - k * (LN2_LOW / TABLE_STEPS);
+		double series = 1 + r * (1 + r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 + r * (1.0 / 120)))));
+
+		int steps = (int)k;
+		int index = steps & (TABLE_STEPS - 1);
+		int exponent = (steps - index) / TABLE_STEPS;
+		double result = tables.powersOfTwo[index] * series;
+
+		// 2^exponent is built directly from its bits. Results under the smallest normal double take two steps.
+		if (exponent < -1000)
+			return result * BitsToDouble((unsigned long long)(exponent + 1000 + 1023) << 52) * BitsToDouble((unsigned long long)(1023 - 1000) << 52);
+		return result * BitsToDouble((unsigned long long)(exponent + 1023) << 52);
+	}
+
+	/// <summary>
+	/// Gets ln(x) for a positive, finite and normal x.
+	/// </summary>
+	static double DoubleLog(double x)
+	{
+		// x = m * 2^e where m is between 1 and 2, and m = c * (1 + r) where c = 1 + i/32 is the closest table entry, so r is at most 1/64.
+		const ExpLogTables& tables = GetExpLogTables();
+		unsigned long long bits = DoubleToBits(x);
+		int exponent = (int)(bits >> 52) - 1023;
+		double m = BitsToDouble((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+		int index = (int)(((bits >> 46) & 0x3f) + 1) >> 1;
+
+		// ln(1 + r) is its Taylor series up to r^8. When m is close to 1, c is exactly 1 and r is exact.
+		double r = index == 0 ? m - 1 : m * tables.inverses[index] - 1;
+		double series = r * (1 - r * (1.0 / 2 - r * (1.0 / 3 - r * (1.0 / 4 - r * (1.0 / 5 - r * (1.0 / 6 - r * (1.0 / 7 - r * (1.0 / 8))))))));
+
+		return (exponent * LN2_HIGH + tables.logarithms[index]) + (exponent * LN2_LOW + series);
+	}
+
+	float SMath::Deterministic::Exp(float x)
+	{
+		if (x != x)
+			return x;
+
+		return (float)DoubleExp(x);
+	}
+
+	float SMath::Deterministic::Log(float x)
+	{
+		if (x != x || x < 0)
+			return NotANumber();
+		if (x == 0)
+			return -std::numeric_limits<float>::infinity();
+		if (x - x != 0)
+			return x;
+
+		return (float)DoubleLog(x);
+	}
+
+	float SMath::Deterministic::Pow(float base, float exponent)
+	{
+		if (exponent == 0 || base == 1)
+			return 1;
+		if (base != base || exponent != exponent)
+			return NotANumber();
+
+		double x = base, y = exponent;
+		bool yInfinite = y - y != 0;
+
+		// The common case: a positive base and finite numbers.
+		if (x > 0 && x - x == 0 && !yInfinite)
+			return (float)DoubleExp(y * DoubleLog(x));
+
+		// A negative base only works with whole exponents, and the result is negative when the exponent is odd.
+		// Floats of 2^24 and above are even whole numbers.
+		bool whole = y >= 16777216 || y <= -16777216 || RoundToInteger(y) == y;
+		bool odd = whole && y < 16777216 && y > -16777216 && RoundToInteger(y * .5) != y * .5;
+
+		bool negativeResult = false;
+		if (x < 0 || (x == 0 && 1 / x < 0))
+		{
+			if (x < 0 && !whole && !yInfinite)
+				return NotANumber();
+
+			negativeResult = odd;
+			x = -x;
+		}
+
+		double result;
+		if (x == 1)
+			result = 1;
+		else if (x == 0)
+			result = y > 0 ? 0 : std::numeric_limits<double>::infinity();
+		else if (x - x != 0)
+			result = y > 0 ? x : 0;
+		else if (yInfinite)
+			result = (x > 1) == (y > 0) ? std::numeric_limits<double>::infinity() : 0;
+		else
+			result = DoubleExp(y * DoubleLog(x));
+
+		return (float)(negativeResult ? -result : result);
+	}
+
+	float SMath::Deterministic::Sqrt(float x)
+	{
+		return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x)));
+	}
+	#pragma endregion
+} }
\ No newline at end of file
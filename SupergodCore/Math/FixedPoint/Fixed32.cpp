@@ -0,0 +1,14 @@
+#include "Fixed32.h"
+#include "FixedTables.h"
+
+namespace SupergodCore { namespace Math
+{
+	Fixed32 Fixed32::Sqrt(Fixed32 value)
+	{
+		if (value.raw <= 0)
+			return Zero();
+
+		// sqrt(raw / 2^16) * 2^16 = sqrt(raw * 2^16).
+		return FromRaw((int)FixedTables::SquareRoot((unsigned long long)value.raw << FRACTION_BITS));
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../SMath.h"
+#include "../Interfaces/ISupergodEquatable.h"
+#include "../Interfaces/ISizeComparable.h"
+#include "../Interfaces/ArithmeticInterfaces.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A Q16.16 fixed-point number: a 32-bit integer that counts 1/65536 units, so it covers about -32768 to 32768 with a constant precision of 1/65536.<para/>
+	/// Everything is done with integer operations, so the results are bit-identical on every compiler and CPU (for lockstep simulations).<para/>
+	/// Addition, subtraction and negation wrap around on overflow, multiplication rounds to nearest (ties up) and division truncates towards 0.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Fixed32 final : public ISupergodEquatable<Fixed32>, public ISizeComparable<Fixed32>,
+		public IAddable<Fixed32>, public ISubtractable<Fixed32>, public IMultipliable<Fixed32>, public IDividable<Fixed32>, public INegatable<Fixed32>
+	{
+		/// <summary>
+		/// The number of bits after the binary point.
+		/// </summary>
+		static constexpr int FRACTION_BITS = 16;
+
+		/// <summary>
+		/// The raw value of 1.
+		/// </summary>
+		static constexpr int ONE_RAW = 1 << FRACTION_BITS;
+
+		#pragma region Presets.
+		/// <summary>Gets 0.</summary>
+		inline static constexpr Fixed32 Zero() { return FromRaw(0); }
+
+		/// <summary>Gets 1.</summary>
+		inline static constexpr Fixed32 One() { return FromRaw(ONE_RAW); }
+
+		/// <summary>Gets 0.5.</summary>
+		inline static constexpr Fixed32 Half() { return FromRaw(ONE_RAW / 2); }
+
+		/// <summary>Gets the smallest positive value, 1/65536.</summary>
+		inline static constexpr Fixed32 Epsilon() { return FromRaw(1); }
+
+		/// <summary>Gets the biggest value, just under 32768.</summary>
+		inline static constexpr Fixed32 Max() { return FromRaw(0x7fffffff); }
+
+		/// <summary>Gets the smallest value, -32768.</summary>
+		inline static constexpr Fixed32 Min() { return FromRaw(-0x7fffffff - 1); }
+
+		/// <summary>Gets pi.</summary>
+		inline static constexpr Fixed32 Pi() { return FromRaw(205887); }
+
+		/// <summary>Gets 2pi.</summary>
+		inline static constexpr Fixed32 Tau() { return FromRaw(411775); }
+		#pragma endregion
+
+		/// <summary>
+		/// The value multiplied by 65536.
+		/// </summary>
+		int raw;
+
+		/// <summary>
+		/// Creates a new fixed-point number and sets it to 0.
+		/// </summary>
+		constexpr Fixed32()
+			: raw(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point number from an integer.
+		/// </summary>
+		explicit constexpr Fixed32(int value)
+			: raw((int)((uint)value << FRACTION_BITS))
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point number from a float, rounded to the nearest 1/65536 (ties away from 0) and clamped to the range.
+		/// </summary>
+		explicit constexpr Fixed32(float value)
+			: Fixed32((double)value)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point number from a double, rounded to the nearest 1/65536 (ties away from 0) and clamped to the range.
+		/// </summary>
+		explicit constexpr Fixed32(double value)
+			: raw(RoundToRaw(value * ONE_RAW))
+		{
+		}
+
+		/// <summary>
+		/// Creates a fixed-point number from its raw value (the value multiplied by 65536).
+		/// </summary>
+		static inline constexpr Fixed32 FromRaw(int raw)
+		{
+			Fixed32 result;
+			result.raw = raw;
+			return result;
+		}
+
+		/// <summary>
+		/// Gets the value as a float (numbers with more than 24 significant bits are rounded).
+		/// </summary>
+		explicit constexpr operator float() const
+		{
+			return raw * (1.f / ONE_RAW);
+		}
+
+		/// <summary>
+		/// Gets the value as a double.
+		/// </summary>
+		explicit constexpr operator double() const
+		{
+			return raw * (1.0 / ONE_RAW);
+		}
+
+		/// <summary>
+		/// Gets the integer part of the value, rounded down.
+		/// </summary>
+		explicit constexpr operator int() const
+		{
+			return raw >> FRACTION_BITS;
+		}
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Are this and other the same value?
+		/// </summary>
+		constexpr bool Equals(Fixed32 other) const
+		{
+			return raw == other.raw;
+		}
+
+		/// <summary>
+		/// Is the distance between this and other smaller or equal to threshold?
+		/// </summary>
+		constexpr bool CloseEnough(Fixed32 other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough((float)*this, (float)other, threshold);
+		}
+
+		/// <summary>
+		/// Is this bigger than other?
+		/// </summary>
+		constexpr bool BiggerThan(Fixed32 other) const
+		{
+			return raw > other.raw;
+		}
+
+		/// <summary>
+		/// Is this smaller than other?
+		/// </summary>
+		constexpr bool SmallerThan(Fixed32 other) const
+		{
+			return raw < other.raw;
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Adds this and other.
+		/// </summary>
+		constexpr Fixed32 Add(Fixed32 other) const
+		{
+			return FromRaw((int)((uint)raw + (uint)other.raw));
+		}
+
+		/// <summary>
+		/// Subtracts other from this.
+		/// </summary>
+		constexpr Fixed32 Subtract(Fixed32 other) const
+		{
+			return FromRaw((int)((uint)raw - (uint)other.raw));
+		}
+
+		/// <summary>
+		/// Negates this.
+		/// </summary>
+		constexpr Fixed32 Negated() const
+		{
+			return FromRaw((int)(0u - (uint)raw));
+		}
+
+		/// <summary>
+		/// Multiplies this by other, rounded to the nearest 1/65536.
+		/// </summary>
+		constexpr Fixed32 Multiply(Fixed32 other) const
+		{
+			return FromRaw((int)(((long long)raw * other.raw + (1 << (FRACTION_BITS - 1))) >> FRACTION_BITS));
+		}
+
+		/// <summary>
+		/// Divides this by other, truncated towards 0. Dividing by 0 gives Max (or Min if this is negative).
+		/// </summary>
+		constexpr Fixed32 Divide(Fixed32 other) const
+		{
+			if (other.raw == 0)
+				return raw < 0 ? Min() : Max();
+
+			return FromRaw((int)((long long)raw * ONE_RAW / other.raw));
+		}
+		#pragma endregion
+
+		#pragma region Rounding, clamping and interpolation.
+		/// <summary>
+		/// Gets the absolute value of this.
+		/// </summary>
+		constexpr Fixed32 Abs() const
+		{
+			return raw < 0 ? Negated() : *this;
+		}
+
+		/// <summary>
+		/// Rounds this down to an integer.
+		/// </summary>
+		constexpr Fixed32 Floor() const
+		{
+			return FromRaw(raw & ~(ONE_RAW - 1));
+		}
+
+		/// <summary>
+		/// Rounds this up to an integer.
+		/// </summary>
+		constexpr Fixed32 Ceil() const
+		{
+			return FromRaw((int)(((uint)raw + (ONE_RAW - 1)) & ~(uint)(ONE_RAW - 1)));
+		}
+
+		/// <summary>
+		/// Clamps this so it's never smaller than min and never bigger than max.
+		/// </summary>
+		constexpr Fixed32 Clamp(Fixed32 min, Fixed32 max) const
+		{
+			return raw < min.raw ? min : raw > max.raw ? max : *this;
+		}
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha.
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr Fixed32 Lerp(Fixed32 target, Fixed32 alpha, bool clampAlpha = true) const
+		{
+			if (clampAlpha)
+				alpha = alpha.Clamp(Zero(), One());
+
+			return Add(target.Subtract(*this).Multiply(alpha));
+		}
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha, which is converted to fixed-point first (so Lerper can be used with fixed-point numbers).
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr Fixed32 Lerp(Fixed32 target, float alpha, bool clampAlpha = true) const
+		{
+			return Lerp(target, Fixed32(alpha), clampAlpha);
+		}
+		#pragma endregion
+
+		/// <summary>
+		/// Gets the square root of value, rounded down to a multiple of 1/65536. The square root of a negative value is 0.
+		/// </summary>
+		static Fixed32 Sqrt(Fixed32 value);
+
+	private:
+		/// <summary>
+		/// Rounds value to the nearest integer (ties away from 0) and clamps it to the range of int.
+		/// </summary>
+		static inline constexpr int RoundToRaw(double value)
+		{
+			return value >= 2147483647.0 ? 0x7fffffff :
+				value <= -2147483648.0 ? -0x7fffffff - 1 :
+				value >= 0 ? (int)(value + .5) : -(int)(-value + .5);
+		}
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "Fixed64.h"
+#include <cmath>
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Multiplies a and b into a 128-bit product split into its high and low 64 bits, using 32-bit halves.
+	/// </summary>
+	static inline void MultiplyUnsigned(unsigned long long a, unsigned long long b, unsigned long long& high, unsigned long long& low)
+	{
+		unsigned long long aLow = a & 0xffffffffULL, aHigh = a >> 32;
+		unsigned long long bLow = b & 0xffffffffULL, bHigh = b >> 32;
+
+		unsigned long long lowLow = aLow * bLow;
+		unsigned long long lowHigh = aLow * bHigh;
+		unsigned long long highLow = aHigh * bLow;
+		unsigned long long highHigh = aHigh * bHigh;
+
+		unsigned long long middle = (lowLow >> 32) + (lowHigh & 0xffffffffULL) + (highLow & 0xffffffffULL);
+		low = (middle << 32) | (lowLow & 0xffffffffULL);
+		high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+	}
+
+	/// <summary>
+	/// Is the 128-bit value (aHigh, aLow) bigger than (bHigh, bLow)?
+	/// </summary>
+	static inline bool Greater(unsigned long long aHigh, unsigned long long aLow, unsigned long long bHigh, unsigned long long bLow)
+	{
+		return aHigh > bHigh || (aHigh == bHigh && aLow > bLow);
+	}
+
+	Fixed64 Fixed64::Multiply(Fixed64 other) const
+	{
+		unsigned long long high, low;
+		MultiplyUnsigned((unsigned long long)raw, (unsigned long long)other.raw, high, low);
+
+		// The unsigned product of the two's complement values only needs its high half corrected to become the signed product.
+		if (raw < 0)
+			high -= (unsigned long long)other.raw;
+
+		if (other.raw < 0)
+			high -= (unsigned long long)raw;
+
+		// Round to nearest, then take the middle 64 bits.
+		unsigned long long roundedLow = low + (1ULL << (FRACTION_BITS - 1));
+		if (roundedLow < low)
+			high++;
+
+		return FromRaw((long long)((high << 32) | (roundedLow >> 32)));
+	}
+
+	Fixed64 Fixed64::Divide(Fixed64 other) const
+	{
+		if (other.raw == 0)
+			return raw < 0 ? Min() : Max();
+
+		bool negative = (raw < 0) != (other.raw < 0);
+		unsigned long long dividend = raw < 0 ? 0ULL - (unsigned long long)raw : (unsigned long long)raw;
+		unsigned long long divisor = other.raw < 0 ? 0ULL - (unsigned long long)other.raw : (unsigned long long)other.raw;
+
+		// (dividend * 2^32) / divisor: the integer part with one division, then the 32 fraction bits with long division.
+		// The remainder is always smaller than the divisor (at most 2^63), so shifting it left never overflows.
+		unsigned long long quotient = dividend / divisor;
+		unsigned long long remainder = dividend % divisor;
+		for (int i = 0; i < FRACTION_BITS; i++)
+		{
+			remainder <<= 1;
+			quotient <<= 1;
+			if (remainder >= divisor)
+			{
+				remainder -= divisor;
+				quotient |= 1;
+			}
+		}
+
+		return FromRaw((long long)(negative ? 0ULL - quotient : quotient));
+	}
+
+	Fixed64 Fixed64::Sqrt(Fixed64 value)
+	{
+		if (value.raw <= 0)
+			return Zero();
+
+		// sqrt(raw / 2^32) * 2^32 = sqrt(raw * 2^32), where raw * 2^32 is a 96-bit number.
+		unsigned long long high = (unsigned long long)value.raw >> 32;
+		unsigned long long low = (unsigned long long)value.raw << 32;
+
+		// The double square root is only a starting guess, the integer steps make the result exact.
+		unsigned long long root = (unsigned long long)std::sqrt((double)value.raw * 4294967296.0);
+		unsigned long long squareHigh, squareLow;
+		for (MultiplyUnsigned(root, root, squareHigh, squareLow); Greater(squareHigh, squareLow, high, low); MultiplyUnsigned(root, root, squareHigh, squareLow))
+			root--;
+
+		for (MultiplyUnsigned(root + 1, root + 1, squareHigh, squareLow); !Greater(squareHigh, squareLow, high, low); MultiplyUnsigned(root + 1, root + 1, squareHigh, squareLow))
+			root++;
+
+		return FromRaw((long long)root);
+	}
+} }
\ No newline at end of file
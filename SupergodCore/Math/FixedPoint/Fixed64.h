@@ -0,0 +1,277 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Fixed32.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A Q32.32 fixed-point number: a 64-bit integer that counts 1/2^32 units, so it covers about -2^31 to 2^31 with a constant precision of 1/2^32.<para/>
+	/// Use it where Fixed32 runs out of range or precision (like world positions or accumulated time). Like Fixed32, the results are bit-identical everywhere.<para/>
+	/// Addition, subtraction and negation wrap around on overflow, multiplication rounds to nearest (ties up) and division truncates towards 0.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Fixed64 final : public ISupergodEquatable<Fixed64>, public ISizeComparable<Fixed64>,
+		public IAddable<Fixed64>, public ISubtractable<Fixed64>, public IMultipliable<Fixed64>, public IDividable<Fixed64>, public INegatable<Fixed64>
+	{
+		/// <summary>
+		/// The number of bits after the binary point.
+		/// </summary>
+		static constexpr int FRACTION_BITS = 32;
+
+		/// <summary>
+		/// The raw value of 1.
+		/// </summary>
+		static constexpr long long ONE_RAW = 1LL << FRACTION_BITS;
+
+		#pragma region Presets.
+		/// <summary>Gets 0.</summary>
+		inline static constexpr Fixed64 Zero() { return FromRaw(0); }
+
+		/// <summary>Gets 1.</summary>
+		inline static constexpr Fixed64 One() { return FromRaw(ONE_RAW); }
+
+		/// <summary>Gets the smallest positive value, 1/2^32.</summary>
+		inline static constexpr Fixed64 Epsilon() { return FromRaw(1); }
+
+		/// <summary>Gets the biggest value, just under 2^31.</summary>
+		inline static constexpr Fixed64 Max() { return FromRaw(0x7fffffffffffffffLL); }
+
+		/// <summary>Gets the smallest value, -2^31.</summary>
+		inline static constexpr Fixed64 Min() { return FromRaw(-0x7fffffffffffffffLL - 1); }
+
+		/// <summary>Gets pi.</summary>
+		inline static constexpr Fixed64 Pi() { return FromRaw(13493037705LL); }
+
+		/// <summary>Gets 2pi.</summary>
+		inline static constexpr Fixed64 Tau() { return FromRaw(26986075409LL); }
+		#pragma endregion
+
+		/// <summary>
+		/// The value multiplied by 2^32.
+		/// </summary>
+		long long raw;
+
+		/// <summary>
+		/// Creates a new fixed-point number and sets it to 0.
+		/// </summary>
+		constexpr Fixed64()
+			: raw(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point number from an integer.
+		/// </summary>
+		explicit constexpr Fixed64(int value)
+			: raw((long long)((unsigned long long)(long long)value << FRACTION_BITS))
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point number from a double, rounded to the nearest 1/2^32 (ties away from 0) and clamped to the range.
+		/// </summary>
+		explicit constexpr Fixed64(double value)
+			: raw(RoundToRaw(value * ONE_RAW))
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point number from a float, rounded to the nearest 1/2^32 (ties away from 0) and clamped to the range.
+		/// </summary>
+		explicit constexpr Fixed64(float value)
+			: Fixed64((double)value)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new Q32.32 number from a Q16.16 number. This is exact.
+		/// </summary>
+		explicit constexpr Fixed64(Fixed32 value)
+			: raw((long long)value.raw * (1 << (FRACTION_BITS - Fixed32::FRACTION_BITS)))
+		{
+		}
+
+		/// <summary>
+		/// Creates a fixed-point number from its raw value (the value multiplied by 2^32).
+		/// </summary>
+		static inline constexpr Fixed64 FromRaw(long long raw)
+		{
+			Fixed64 result;
+			result.raw = raw;
+			return result;
+		}
+
+		/// <summary>
+		/// Gets the value as a double (numbers with more than 53 significant bits are rounded).
+		/// </summary>
+		explicit constexpr operator double() const
+		{
+			return raw * (1.0 / ONE_RAW);
+		}
+
+		/// <summary>
+		/// Gets the value as a float.
+		/// </summary>
+		explicit constexpr operator float() const
+		{
+			return (float)(double)*this;
+		}
+
+		/// <summary>
+		/// Gets the integer part of the value, rounded down.
+		/// </summary>
+		explicit constexpr operator int() const
+		{
+			return (int)(raw >> FRACTION_BITS);
+		}
+
+		/// <summary>
+		/// Gets the value as a Q16.16 number, rounded to the nearest 1/65536 (ties up). Values out of the range of Fixed32 wrap around.
+		/// </summary>
+		explicit constexpr operator Fixed32() const
+		{
+			return Fixed32::FromRaw((int)((raw + (1LL << (FRACTION_BITS - Fixed32::FRACTION_BITS - 1))) >> (FRACTION_BITS - Fixed32::FRACTION_BITS)));
+		}
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Are this and other the same value?
+		/// </summary>
+		constexpr bool Equals(Fixed64 other) const
+		{
+			return raw == other.raw;
+		}
+
+		/// <summary>
+		/// Is the distance between this and other smaller or equal to threshold?
+		/// </summary>
+		constexpr bool CloseEnough(Fixed64 other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return (double)Subtract(other).Abs() <= threshold;
+		}
+
+		/// <summary>
+		/// Is this bigger than other?
+		/// </summary>
+		constexpr bool BiggerThan(Fixed64 other) const
+		{
+			return raw > other.raw;
+		}
+
+		/// <summary>
+		/// Is this smaller than other?
+		/// </summary>
+		constexpr bool SmallerThan(Fixed64 other) const
+		{
+			return raw < other.raw;
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Adds this and other.
+		/// </summary>
+		constexpr Fixed64 Add(Fixed64 other) const
+		{
+			return FromRaw((long long)((unsigned long long)raw + (unsigned long long)other.raw));
+		}
+
+		/// <summary>
+		/// Subtracts other from this.
+		/// </summary>
+		constexpr Fixed64 Subtract(Fixed64 other) const
+		{
+			return FromRaw((long long)((unsigned long long)raw - (unsigned long long)other.raw));
+		}
+
+		/// <summary>
+		/// Negates this.
+		/// </summary>
+		constexpr Fixed64 Negated() const
+		{
+			return FromRaw((long long)(0ull - (unsigned long long)raw));
+		}
+
+		/// <summary>
+		/// Multiplies this by other, rounded to the nearest 1/2^32. The 128-bit product is computed with 64-bit integers.
+		/// </summary>
+		Fixed64 Multiply(Fixed64 other) const;
+
+		/// <summary>
+		/// Divides this by other, truncated towards 0. Dividing by 0 gives Max (or Min if this is negative).
+		/// </summary>
+		Fixed64 Divide(Fixed64 other) const;
+		#pragma endregion
+
+		#pragma region Rounding, clamping and interpolation.
+		/// <summary>
+		/// Gets the absolute value of this.
+		/// </summary>
+		constexpr Fixed64 Abs() const
+		{
+			return raw < 0 ? Negated() : *this;
+		}
+
+		/// <summary>
+		/// Rounds this down to an integer.
+		/// </summary>
+		constexpr Fixed64 Floor() const
+		{
+			return FromRaw(raw & ~(ONE_RAW - 1));
+		}
+
+		/// <summary>
+		/// Rounds this up to an integer.
+		/// </summary>
+		constexpr Fixed64 Ceil() const
+		{
+			return FromRaw((long long)(((unsigned long long)raw + (ONE_RAW - 1)) & ~(unsigned long long)(ONE_RAW - 1)));
+		}
+
+		/// <summary>
+		/// Clamps this so it's never smaller than min and never bigger than max.
+		/// </summary>
+		constexpr Fixed64 Clamp(Fixed64 min, Fixed64 max) const
+		{
+			return raw < min.raw ? min : raw > max.raw ? max : *this;
+		}
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha.
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		Fixed64 Lerp(Fixed64 target, Fixed64 alpha, bool clampAlpha = true) const
+		{
+			if (clampAlpha)
+				alpha = alpha.Clamp(Zero(), One());
+
+			return Add(target.Subtract(*this).Multiply(alpha));
+		}
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha, which is converted to fixed-point first (so Lerper can be used with fixed-point numbers).
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		Fixed64 Lerp(Fixed64 target, float alpha, bool clampAlpha = true) const
+		{
+			return Lerp(target, Fixed64(alpha), clampAlpha);
+		}
+		#pragma endregion
+
+		/// <summary>
+		/// Gets the square root of value, rounded down to a multiple of 1/2^32. The square root of a negative value is 0.
+		/// </summary>
+		static Fixed64 Sqrt(Fixed64 value);
+
+	private:
+		/// <summary>
+		/// Rounds value to the nearest integer (ties away from 0) and clamps it to the range of long long.
+		/// </summary>
+		static inline constexpr long long RoundToRaw(double value)
+		{
+			return value >= 9223372036854775807.0 ? 0x7fffffffffffffffLL :
+				value <= -9223372036854775808.0 ? -0x7fffffffffffffffLL - 1 :
+				value >= 0 ? (long long)(value + .5) : -(long long)(-value + .5);
+		}
+	};
+} }
\ No newline at end of file
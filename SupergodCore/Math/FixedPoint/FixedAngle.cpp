@@ -0,0 +1,73 @@
+#include "FixedAngle.h"
+#include "FixedTables.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Gets the sine of angle in Q2.30, from the quarter sine table mirrored to the other quadrants.
+	/// </summary>
+	static long long Sine(uint angle)
+	{
+		uint quadrant = angle >> 30;
+		uint position = angle & 0x3fffffff;
+		if ((quadrant & 1) != 0)
+			position = 0x40000000 - position;
+
+		long long value = FixedTables::Interpolate(FixedTables::QuarterSine(), position);
+		return (quadrant & 2) != 0 ? -value : value;
+	}
+
+	/// <summary>
+	/// Rounds a Q2.30 value to Q16.16.
+	/// </summary>
+	static inline Fixed32 ToFixed32(long long value)
+	{
+		const int shift = FixedTables::TABLE_BITS - Fixed32::FRACTION_BITS;
+		return Fixed32::FromRaw((int)((value + (1LL << (shift - 1))) >> shift));
+	}
+
+	Fixed32 FixedAngle::Sin() const
+	{
+		return ToFixed32(Sine(raw));
+	}
+
+	Fixed32 FixedAngle::Cos() const
+	{
+		return ToFixed32(Sine(raw + 0x40000000));
+	}
+
+	Fixed32 FixedAngle::Tan() const
+	{
+		long long sine = Sine(raw);
+		long long cosine = Sine(raw + 0x40000000);
+		if (cosine == 0)
+			return sine < 0 ? Fixed32::Min() : Fixed32::Max();
+
+		long long tangent = sine * Fixed32::ONE_RAW / cosine;
+		return tangent > 0x7fffffff ? Fixed32::Max() : tangent < -0x7fffffffLL - 1 ? Fixed32::Min() : Fixed32::FromRaw((int)tangent);
+	}
+
+	FixedAngle FixedAngle::Atan2(Fixed32 y, Fixed32 x)
+	{
+		if (x.raw == 0 && y.raw == 0)
+			return Zero();
+
+		// Reduce to the first octant (a ratio between 0 and 1), then mirror the table's angle back.
+		long long absoluteX = x.raw < 0 ? -(long long)x.raw : x.raw;
+		long long absoluteY = y.raw < 0 ? -(long long)y.raw : y.raw;
+		bool steep = absoluteY > absoluteX;
+		long long ratio = ((steep ? absoluteX : absoluteY) << FixedTables::TABLE_BITS) / (steep ? absoluteY : absoluteX);
+
+		uint angle = (uint)FixedTables::Interpolate(FixedTables::Arctangent(), (uint)ratio);
+		if (steep)
+			angle = Right().raw - angle;
+
+		if (x.raw < 0)
+			angle = Straight().raw - angle;
+
+		if (y.raw < 0)
+			angle = 0u - angle;
+
+		return FromRaw(angle);
+	}
+} }
\ No newline at end of file
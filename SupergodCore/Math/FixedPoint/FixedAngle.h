@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Fixed32.h"
+#include "../Angle.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A deterministic angle stored as a binary angle: a 32-bit unsigned integer where 2^32 is a full turn.<para/>
+	/// Wrapping is free (the integer simply overflows), and sin, cos and atan2 come from lookup tables generated with integer math, so the results are bit-identical everywhere.<para/>
+	/// Conversions from and to radians, degrees and revolutions use Fixed32.
+	/// </summary>
+	struct SUPERGOD_API_CLASS FixedAngle final : public ISupergodEquatable<FixedAngle>, public IAddable<FixedAngle>, public ISubtractable<FixedAngle>
+	{
+		#pragma region Common angle presets.
+		/// <summary>A zero angle.</summary>
+		inline static constexpr FixedAngle Zero() { return FromRaw(0); }
+
+		/// <summary>Half of a right angle. pi / 4 radians, 45 degrees, 0.125 revolution.</summary>
+		inline static constexpr FixedAngle HalfRight() { return FromRaw(0x20000000); }
+
+		/// <summary>A right angle. 90 degrees, pi / 2 radians, 1/4 revolutions.</summary>
+		inline static constexpr FixedAngle Right() { return FromRaw(0x40000000); }
+
+		/// <summary>A straight angle. 180 degrees, pi radians, 1/2 revolutions.</summary>
+		inline static constexpr FixedAngle Straight() { return FromRaw(0x80000000); }
+
+		/// <summary>An angle that is a right angle before a full rotation. 1.5pi radians, 270 degrees, 0.75 revolution.</summary>
+		inline static constexpr FixedAngle StraightAndHalf() { return FromRaw(0xc0000000); }
+		#pragma endregion
+
+		/// <summary>
+		/// The angle in 1/2^32 turns.
+		/// </summary>
+		uint raw;
+
+		/// <summary>
+		/// Creates a new angle and sets it to 0.
+		/// </summary>
+		constexpr FixedAngle()
+			: raw(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new fixed-point angle from a float angle (rounded to the nearest 1/65536 radians on the way).
+		/// </summary>
+		explicit FixedAngle(const Angle& angle)
+			: raw(FromRadians(Fixed32(angle.GetRadians())).raw)
+		{
+		}
+
+		/// <summary>
+		/// Gets this as a float angle.
+		/// </summary>
+		explicit operator Angle() const
+		{
+			return Angle((float)GetRadians());
+		}
+
+		#pragma region Construction and getters.
+		/// <summary>
+		/// Creates an angle from its raw value (1/2^32 turns).
+		/// </summary>
+		static inline constexpr FixedAngle FromRaw(uint raw)
+		{
+			FixedAngle result;
+			result.raw = raw;
+			return result;
+		}
+
+		/// <summary>
+		/// Creates an angle from radians. Any value is wrapped to a valid angle.
+		/// </summary>
+		static inline constexpr FixedAngle FromRadians(Fixed32 radians)
+		{
+			// 683565276 = 2^32 / 2pi, and the product is shifted by 16 because radians are in Q16.16.
+			return FromRaw((uint)(((long long)radians.raw * 683565276LL + (1LL << 15)) >> 16));
+		}
+
+		/// <summary>
+		/// Creates an angle from degrees. Any value is wrapped to a valid angle.
+		/// </summary>
+		static inline constexpr FixedAngle FromDegrees(Fixed32 degrees)
+		{
+			// degrees * 2^32 / 360 = raw * 2^16 / 360, divided exactly (rounded to nearest) so whole degrees like 90 land on exact binary angles.
+			return FromRaw((uint)(((long long)degrees.raw * 65536 + (degrees.raw < 0 ? -180 : 180)) / 360));
+		}
+
+		/// <summary>
+		/// Creates an angle from revolutions. Any value is wrapped to a valid angle.
+		/// </summary>
+		static inline constexpr FixedAngle FromRevolutions(Fixed32 revolutions)
+		{
+			return FromRaw((uint)revolutions.raw << 16);
+		}
+
+		/// <summary>
+		/// Gets the angle as radians from 0 to 2pi.
+		/// </summary>
+		constexpr Fixed32 GetRadians() const
+		{
+			// 1686629713 = 2pi * 2^28.
+			return Fixed32::FromRaw((int)((raw * 1686629713ULL + (1ULL << 43)) >> 44));
+		}
+
+		/// <summary>
+		/// Gets the angle as degrees from 0 to 360.
+		/// </summary>
+		constexpr Fixed32 GetDegrees() const
+		{
+			return Fixed32::FromRaw((int)((raw * 360ULL + (1ULL << 15)) >> 16));
+		}
+
+		/// <summary>
+		/// Gets the angle as revolutions from 0 to 1.
+		/// </summary>
+		constexpr Fixed32 GetRevolutions() const
+		{
+			return Fixed32::FromRaw((int)((raw + (1ULL << 15)) >> 16));
+		}
+		#pragma endregion
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Are this and other the same angle?
+		/// </summary>
+		constexpr bool Equals(FixedAngle other) const
+		{
+			return raw == other.raw;
+		}
+
+		/// <summary>
+		/// Is the shortest distance between this and other (in radians) smaller or equal to threshold?
+		/// </summary>
+		constexpr bool CloseEnough(FixedAngle other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return (float)DeltaTo(other).Abs() <= threshold;
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Adds the rotation of other to this.
+		/// </summary>
+		constexpr FixedAngle Add(FixedAngle other) const
+		{
+			return FromRaw(raw + other.raw);
+		}
+
+		/// <summary>
+		/// Subtracts the rotation of other from this.
+		/// </summary>
+		constexpr FixedAngle Subtract(FixedAngle other) const
+		{
+			return FromRaw(raw - other.raw);
+		}
+
+		/// <summary>
+		/// Takes this rotation and puts it on the other side of the circle (subtract it from 360 degrees).
+		/// </summary>
+		constexpr FixedAngle Reflection() const
+		{
+			return FromRaw(0u - raw);
+		}
+		#pragma endregion
+
+		#pragma region Shortest path.
+		/// <summary>
+		/// Gets the smallest rotation (in radians, between -pi and pi) that turns this into target. Positive values rotate towards bigger angles.
+		/// </summary>
+		constexpr Fixed32 DeltaTo(FixedAngle target) const
+		{
+			return Fixed32::FromRaw((int)(((long long)(int)(target.raw - raw) * 1686629713LL + (1LL << 43)) >> 44));
+		}
+
+		/// <summary>
+		/// Interpolates between this and target by alpha, going the short way around the circle.
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr FixedAngle LerpShortest(FixedAngle target, Fixed32 alpha, bool clampAlpha = true) const
+		{
+			if (clampAlpha)
+				alpha = alpha.Clamp(Fixed32::Zero(), Fixed32::One());
+
+			return FromRaw(raw + (uint)(((long long)(int)(target.raw - raw) * alpha.raw) >> Fixed32::FRACTION_BITS));
+		}
+		#pragma endregion
+
+		#pragma region Trigonometry.
+		/// <summary>
+		/// Gets the sine of this angle (the error is under 1/65536).
+		/// </summary>
+		Fixed32 Sin() const;
+
+		/// <summary>
+		/// Gets the cosine of this angle (the error is under 1/65536).
+		/// </summary>
+		Fixed32 Cos() const;
+
+		/// <summary>
+		/// Gets the tangent of this angle. At right angles the result saturates to Fixed32::Max or Fixed32::Min.
+		/// </summary>
+		Fixed32 Tan() const;
+
+		/// <summary>
+		/// Gets the angle of the point (x, y) from the positive x axis, counterclockwise. The angle of (0, 0) is 0.
+		/// </summary>
+		static FixedAngle Atan2(Fixed32 y, Fixed32 x);
+		#pragma endregion
+	};
+} }
\ No newline at end of file
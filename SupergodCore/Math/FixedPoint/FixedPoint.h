@@ -0,0 +1,7 @@
+#pragma once
+
+#include "Fixed32.h"
+#include "Fixed64.h"
+#include "FixedAngle.h"
+#include "FixedVector2D.h"
+#include "FixedVector3D.h"
\ No newline at end of file
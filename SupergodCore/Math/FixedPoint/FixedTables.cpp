@@ -0,0 +1,108 @@
+#include "FixedTables.h"
+#include <cmath>
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// pi / 2 in Q2.30.
+	/// </summary>
+	static const long long HALF_PI = 1686629713;
+
+	/// <summary>
+	/// 2^32 / 2pi, the number of binary angle units in a radian.
+	/// </summary>
+	static const long long BINARY_ANGLES_PER_RADIAN = 683565276;
+
+	/// <summary>
+	/// Gets sin(x) where x is in Q2.30 between 0 and pi / 2, with its Taylor series.
+	/// </summary>
+	static long long Sine(long long x)
+	{
+		long long squared = (x * x) >> FixedTables::TABLE_BITS;
+		long long term = x;
+		long long sum = x;
+		for (long long k = 1; term != 0; k++)
+		{
+			term = -((term * squared) >> FixedTables::TABLE_BITS) / ((2 * k) * (2 * k + 1));
+			sum += term;
+		}
+
+		return sum;
+	}
+
+	/// <summary>
+	/// Gets atan(t) in Q2.30 where t is in Q2.30 between 0 and 1.<para/>
+	/// t is first reduced with atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))), so the Taylor series converges quickly.
+	/// </summary>
+	static long long Arctangent(long long t)
+	{
+		const long long one = 1LL << FixedTables::TABLE_BITS;
+
+		long long root = (long long)FixedTables::SquareRoot((unsigned long long)(one + ((t * t) >> FixedTables::TABLE_BITS)) << FixedTables::TABLE_BITS);
+		long long u = (t << FixedTables::TABLE_BITS) / (one + root);
+
+		long long squared = (u * u) >> FixedTables::TABLE_BITS;
+		long long power = u;
+		long long sum = u;
+		for (long long k = 1; power != 0; k++)
+		{
+			power = (power * squared) >> FixedTables::TABLE_BITS;
+			sum += (k % 2 == 1 ? -power : power) / (2 * k + 1);
+		}
+
+		return 2 * sum;
+	}
+
+	/// <summary>
+	/// The lookup tables, generated the first time they are used.
+	/// </summary>
+	struct Tables
+	{
+		int quarterSine[FixedTables::SEGMENTS + 1];
+		int arctangent[FixedTables::SEGMENTS + 1];
+
+		Tables()
+		{
+			for (int i = 0; i < FixedTables::SEGMENTS; i++)
+			{
+				quarterSine[i] = (int)Sine((i * HALF_PI + FixedTables::SEGMENTS / 2) / FixedTables::SEGMENTS);
+
+				long long radians = Arctangent((long long)i << (FixedTables::TABLE_BITS - 8));
+				arctangent[i] = (int)((radians * BINARY_ANGLES_PER_RADIAN + (1LL << (FixedTables::TABLE_BITS - 1))) >> FixedTables::TABLE_BITS);
+			}
+
+			// The ends are set exactly, so right angles give exactly 1 and atan2 of a diagonal gives exactly 45 degrees.
+			quarterSine[FixedTables::SEGMENTS] = 1 << FixedTables::TABLE_BITS;
+			arctangent[FixedTables::SEGMENTS] = 1 << 29;
+		}
+	};
+
+	static const Tables& GetTables()
+	{
+		static const Tables tables;
+		return tables;
+	}
+
+	const int* FixedTables::QuarterSine()
+	{
+		return GetTables().quarterSine;
+	}
+
+	const int* FixedTables::Arctangent()
+	{
+		return GetTables().arctangent;
+	}
+
+	unsigned long long FixedTables::SquareRoot(unsigned long long value)
+	{
+		// The double square root is only a starting guess (IEEE square roots are correctly rounded anyway), the integer steps make the result exact.
+		unsigned long long root = (unsigned long long)std::sqrt((double)value);
+		while (root > 0xffffffffULL || root * root > value)
+			root--;
+
+		while (root < 0xffffffffULL && (root + 1) * (root + 1) <= value)
+			root++;
+
+		return root;
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+
+namespace SupergodCore { namespace Math
+{
+	// Internal header: lookup tables and integer helpers shared by the fixed-point types.
+	// The tables are generated with integer arithmetic only, so they are the same on every compiler and CPU.
+
+	namespace FixedTables
+	{
+		/// <summary>
+		/// The number of segments in the lookup tables (each table has one more entry than this).
+		/// </summary>
+		constexpr int SEGMENTS = 256;
+
+		/// <summary>
+		/// The number of fraction bits of the table entries and of the inputs to interpolate them with.
+		/// </summary>
+		constexpr int TABLE_BITS = 30;
+
+		/// <summary>
+		/// Gets sin(i * (pi / 2) / SEGMENTS) for i from 0 to SEGMENTS, in Q2.30.
+		/// </summary>
+		const int* QuarterSine();
+
+		/// <summary>
+		/// Gets atan(i / SEGMENTS) for i from 0 to SEGMENTS, in binary angle units (2^32 per turn).
+		/// </summary>
+		const int* Arctangent();
+
+		/// <summary>
+		/// Linearly interpolates table at position, where position is in Q2.30 between 0 and 1 (1 is the last entry).
+		/// </summary>
+		inline long long Interpolate(const int* table, uint position)
+		{
+			const int fractionBits = TABLE_BITS - 8;
+			static_assert(SEGMENTS == 1 << 8, "The table index is the top 8 bits of the position.");
+
+			uint index = position >> fractionBits;
+			if (index >= (uint)SEGMENTS)
+				return table[SEGMENTS];
+
+			long long fraction = position & ((1u << fractionBits) - 1);
+			return table[index] + (((table[index + 1] - (long long)table[index]) * fraction) >> fractionBits);
+		}
+
+		/// <summary>
+		/// Gets the square root of value rounded down.
+		/// </summary>
+		unsigned long long SquareRoot(unsigned long long value);
+	}
+} }
\ No newline at end of file
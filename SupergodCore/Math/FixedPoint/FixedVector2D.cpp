@@ -0,0 +1,35 @@
+#include "FixedVector2D.h"
+#include "FixedTables.h"
+
+namespace SupergodCore { namespace Math
+{
+	FixedVector2D FixedVector2D::FromAngle(FixedAngle angle)
+	{
+		return FixedVector2D(angle.Cos(), angle.Sin());
+	}
+
+	Fixed32 FixedVector2D::Magnitude() const
+	{
+		// The squares are in Q32.32, so their square root is already in Q16.16.
+		unsigned long long squares = (unsigned long long)((long long)x.raw * x.raw) + (unsigned long long)((long long)y.raw * y.raw);
+		return Fixed32::FromRaw((int)FixedTables::SquareRoot(squares));
+	}
+
+	FixedVector2D FixedVector2D::Normalized() const
+	{
+		Fixed32 magnitude = Magnitude();
+		if (magnitude.raw == 0)
+			return Zero();
+
+		return Divide(magnitude);
+	}
+
+	FixedVector2D FixedVector2D::Rotated(FixedAngle angle) const
+	{
+		Fixed32 cosine = angle.Cos();
+		Fixed32 sine = angle.Sin();
+		return FixedVector2D(
+			Fixed32::FromRaw((int)(((long long)x.raw * cosine.raw - (long long)y.raw * sine.raw + (1 << 15)) >> 16)),
+			Fixed32::FromRaw((int)(((long long)x.raw * sine.raw + (long long)y.raw * cosine.raw + (1 << 15)) >> 16)));
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Fixed32.h"
+#include "FixedAngle.h"
+#include "../Vectors/Vector2D.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A deterministic 2-component vector of Q16.16 fixed-point numbers. See Fixed32.<para/>
+	/// Dot products, magnitudes and rotations accumulate in 64 bits and round once at the end.
+	/// </summary>
+	struct SUPERGOD_API_CLASS FixedVector2D final : public ISupergodEquatable<FixedVector2D>,
+		public IAddable<FixedVector2D>, public ISubtractable<FixedVector2D>, public INegatable<FixedVector2D>
+	{
+		#pragma region Presets for common vectors.
+		/// <summary>
+		/// Gets a 2D vector with all of its components set to 0.
+		/// </summary>
+		inline static constexpr FixedVector2D Zero() { return FixedVector2D(); }
+
+		/// <summary>
+		/// Gets the 2D vector (1, 0).
+		/// </summary>
+		inline static constexpr FixedVector2D UnitX() { return FixedVector2D(Fixed32::One(), Fixed32::Zero()); }
+
+		/// <summary>
+		/// Gets the 2D vector (0, 1).
+		/// </summary>
+		inline static constexpr FixedVector2D UnitY() { return FixedVector2D(Fixed32::Zero(), Fixed32::One()); }
+		#pragma endregion
+
+		Fixed32 x, y;
+
+		/// <summary>Creates a new 2D vector and initializes both of its components to 0.</summary>
+		constexpr FixedVector2D()
+			: x(), y()
+		{
+		}
+
+		/// <summary>Creates a new 2D vector and initializes its components to x and y.</summary>
+		constexpr FixedVector2D(Fixed32 x, Fixed32 y)
+			: x(x), y(y)
+		{
+		}
+
+		/// <summary>Creates a new 2D vector from a float vector, rounding every component to the nearest 1/65536.</summary>
+		explicit constexpr FixedVector2D(const Vector2D& vector)
+			: x(vector.x), y(vector.y)
+		{
+		}
+
+		/// <summary>
+		/// Gets this as a float vector.
+		/// </summary>
+		explicit constexpr operator Vector2D() const
+		{
+			return Vector2D((float)x, (float)y);
+		}
+
+		/// <summary>
+		/// Gets the unit vector pointing at angle (cos, sin).
+		/// </summary>
+		static FixedVector2D FromAngle(FixedAngle angle);
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Is every component of this same as its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const FixedVector2D& other) const
+		{
+			return x == other.x && y == other.y;
+		}
+
+		/// <summary>
+		/// Is every component of this close enough to its corresponding component in other with the threshold of threshold?
+		/// </summary>
+		constexpr bool CloseEnough(const FixedVector2D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return x.CloseEnough(other.x, threshold) && y.CloseEnough(other.y, threshold);
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Adds every component of this with its corresponding component in other.
+		/// </summary>
+		constexpr FixedVector2D Add(const FixedVector2D& other) const
+		{
+			return FixedVector2D(x.Add(other.x), y.Add(other.y));
+		}
+
+		/// <summary>
+		/// Subtracts every component of other from its corresponding component in this.
+		/// </summary>
+		constexpr FixedVector2D Subtract(const FixedVector2D& other) const
+		{
+			return FixedVector2D(x.Subtract(other.x), y.Subtract(other.y));
+		}
+
+		/// <summary>
+		/// Negates every component of this.
+		/// </summary>
+		constexpr FixedVector2D Negated() const
+		{
+			return FixedVector2D(x.Negated(), y.Negated());
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		constexpr FixedVector2D Multiply(Fixed32 scalar) const
+		{
+			return FixedVector2D(x.Multiply(scalar), y.Multiply(scalar));
+		}
+
+		/// <summary>
+		/// Divides every component of this by scalar.
+		/// </summary>
+		constexpr FixedVector2D Divide(Fixed32 scalar) const
+		{
+			return FixedVector2D(x.Divide(scalar), y.Divide(scalar));
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		inline constexpr FixedVector2D operator*(Fixed32 scalar) const
+		{
+			return Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Multiplies every component of vector by scalar.
+		/// </summary>
+		friend constexpr FixedVector2D operator*(Fixed32 scalar, const FixedVector2D& vector)
+		{
+			return vector.Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Divides every component of this by scalar.
+		/// </summary>
+		inline constexpr FixedVector2D operator/(Fixed32 scalar) const
+		{
+			return Divide(scalar);
+		}
+		#pragma endregion
+
+		#pragma region Products, magnitude and direction.
+		/// <summary>
+		/// Gets the dot product of this and other.
+		/// </summary>
+		constexpr Fixed32 Dot(const FixedVector2D& other) const
+		{
+			return Fixed32::FromRaw((int)(((long long)x.raw * other.x.raw + (long long)y.raw * other.y.raw + (1 << 15)) >> 16));
+		}
+
+		/// <summary>
+		/// Gets the z component of the cross product of this and other (x * other.y - y * other.x).
+		/// </summary>
+		constexpr Fixed32 Cross(const FixedVector2D& other) const
+		{
+			return Fixed32::FromRaw((int)(((long long)x.raw * other.y.raw - (long long)y.raw * other.x.raw + (1 << 15)) >> 16));
+		}
+
+		/// <summary>
+		/// Gets the squared magnitude (length) of this vector. This overflows for vectors longer than about 181, use Magnitude for those.
+		/// </summary>
+		constexpr Fixed32 SqrMagnitude() const
+		{
+			return Dot(*this);
+		}
+
+		/// <summary>
+		/// Gets the magnitude (length) of this vector, rounded down. Unlike SqrMagnitude, this works as long as the magnitude itself fits in a Fixed32.
+		/// </summary>
+		Fixed32 Magnitude() const;
+
+		/// <summary>
+		/// Gets a unit vector pointing to the same direction as this. The zero vector stays zero.
+		/// </summary>
+		FixedVector2D Normalized() const;
+
+		/// <summary>
+		/// Gets the angle of this vector from the positive x axis, counterclockwise.
+		/// </summary>
+		FixedAngle Direction() const
+		{
+			return FixedAngle::Atan2(y, x);
+		}
+
+		/// <summary>
+		/// Rotates this counterclockwise by angle.
+		/// </summary>
+		FixedVector2D Rotated(FixedAngle angle) const;
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha.
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr FixedVector2D Lerp(const FixedVector2D& target, Fixed32 alpha, bool clampAlpha = true) const
+		{
+			return FixedVector2D(x.Lerp(target.x, alpha, clampAlpha), y.Lerp(target.y, alpha, clampAlpha));
+		}
+		#pragma endregion
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "FixedVector3D.h"
+#include "FixedTables.h"
+
+namespace SupergodCore { namespace Math
+{
+	Fixed32 FixedVector3D::Magnitude() const
+	{
+		// The squares are in Q32.32, so their square root is already in Q16.16. Three squares of 32-bit values fit in 64 unsigned bits.
+		unsigned long long squares = (unsigned long long)((long long)x.raw * x.raw) + (unsigned long long)((long long)y.raw * y.raw) + (unsigned long long)((long long)z.raw * z.raw);
+		return Fixed32::FromRaw((int)FixedTables::SquareRoot(squares));
+	}
+
+	FixedVector3D FixedVector3D::Normalized() const
+	{
+		Fixed32 magnitude = Magnitude();
+		if (magnitude.raw == 0)
+			return Zero();
+
+		return Divide(magnitude);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Fixed32.h"
+#include "../Vectors/Vector3D.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A deterministic 3-component vector of Q16.16 fixed-point numbers. See Fixed32.<para/>
+	/// Dot products, cross products and magnitudes accumulate in 64 bits and round once at the end.
+	/// </summary>
+	struct SUPERGOD_API_CLASS FixedVector3D final : public ISupergodEquatable<FixedVector3D>,
+		public IAddable<FixedVector3D>, public ISubtractable<FixedVector3D>, public INegatable<FixedVector3D>
+	{
+		#pragma region Presets for common vectors.
+		/// <summary>
+		/// Gets a 3D vector with all of its components set to 0.
+		/// </summary>
+		inline static constexpr FixedVector3D Zero() { return FixedVector3D(); }
+
+		/// <summary>
+		/// Gets the 3D vector (1, 0, 0).
+		/// </summary>
+		inline static constexpr FixedVector3D UnitX() { return FixedVector3D(Fixed32::One(), Fixed32::Zero(), Fixed32::Zero()); }
+
+		/// <summary>
+		/// Gets the 3D vector (0, 1, 0).
+		/// </summary>
+		inline static constexpr FixedVector3D UnitY() { return FixedVector3D(Fixed32::Zero(), Fixed32::One(), Fixed32::Zero()); }
+
+		/// <summary>
+		/// Gets the 3D vector (0, 0, 1).
+		/// </summary>
+		inline static constexpr FixedVector3D UnitZ() { return FixedVector3D(Fixed32::Zero(), Fixed32::Zero(), Fixed32::One()); }
+		#pragma endregion
+
+		Fixed32 x, y, z;
+
+		/// <summary>Creates a new 3D vector and initializes all of its components to 0.</summary>
+		constexpr FixedVector3D()
+			: x(), y(), z()
+		{
+		}
+
+		/// <summary>Creates a new 3D vector and initializes its components to x, y and z.</summary>
+		constexpr FixedVector3D(Fixed32 x, Fixed32 y, Fixed32 z)
+			: x(x), y(y), z(z)
+		{
+		}
+
+		/// <summary>Creates a new 3D vector from a float vector, rounding every component to the nearest 1/65536.</summary>
+		explicit constexpr FixedVector3D(const Vector3D& vector)
+			: x(vector.x), y(vector.y), z(vector.z)
+		{
+		}
+
+		/// <summary>
+		/// Gets this as a float vector.
+		/// </summary>
+		explicit constexpr operator Vector3D() const
+		{
+			return Vector3D((float)x, (float)y, (float)z);
+		}
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Is every component of this same as its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const FixedVector3D& other) const
+		{
+			return x == other.x && y == other.y && z == other.z;
+		}
+
+		/// <summary>
+		/// Is every component of this close enough to its corresponding component in other with the threshold of threshold?
+		/// </summary>
+		constexpr bool CloseEnough(const FixedVector3D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return x.CloseEnough(other.x, threshold) && y.CloseEnough(other.y, threshold) && z.CloseEnough(other.z, threshold);
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Adds every component of this with its corresponding component in other.
+		/// </summary>
+		constexpr FixedVector3D Add(const FixedVector3D& other) const
+		{
+			return FixedVector3D(x.Add(other.x), y.Add(other.y), z.Add(other.z));
+		}
+
+		/// <summary>
+		/// Subtracts every component of other from its corresponding component in this.
+		/// </summary>
+		constexpr FixedVector3D Subtract(const FixedVector3D& other) const
+		{
+			return FixedVector3D(x.Subtract(other.x), y.Subtract(other.y), z.Subtract(other.z));
+		}
+
+		/// <summary>
+		/// Negates every component of this.
+		/// </summary>
+		constexpr FixedVector3D Negated() const
+		{
+			return FixedVector3D(x.Negated(), y.Negated(), z.Negated());
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		constexpr FixedVector3D Multiply(Fixed32 scalar) const
+		{
+			return FixedVector3D(x.Multiply(scalar), y.Multiply(scalar), z.Multiply(scalar));
+		}
+
+		/// <summary>
+		/// Divides every component of this by scalar.
+		/// </summary>
+		constexpr FixedVector3D Divide(Fixed32 scalar) const
+		{
+			return FixedVector3D(x.Divide(scalar), y.Divide(scalar), z.Divide(scalar));
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		inline constexpr FixedVector3D operator*(Fixed32 scalar) const
+		{
+			return Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Multiplies every component of vector by scalar.
+		/// </summary>
+		friend constexpr FixedVector3D operator*(Fixed32 scalar, const FixedVector3D& vector)
+		{
+			return vector.Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Divides every component of this by scalar.
+		/// </summary>
+		inline constexpr FixedVector3D operator/(Fixed32 scalar) const
+		{
+			return Divide(scalar);
+		}
+		#pragma endregion
+
+		#pragma region Products and magnitude.
+		/// <summary>
+		/// Gets the dot product of this and other.
+		/// </summary>
+		constexpr Fixed32 Dot(const FixedVector3D& other) const
+		{
+			return Fixed32::FromRaw((int)(((long long)x.raw * other.x.raw + (long long)y.raw * other.y.raw + (long long)z.raw * other.z.raw + (1 << 15)) >> 16));
+		}
+
+		/// <summary>
+		/// Gets the cross product of this and other.
+		/// </summary>
+		constexpr FixedVector3D Cross(const FixedVector3D& other) const
+		{
+			return FixedVector3D(
+				Fixed32::FromRaw((int)(((long long)y.raw * other.z.raw - (long long)z.raw * other.y.raw + (1 << 15)) >> 16)),
+				Fixed32::FromRaw((int)(((long long)z.raw * other.x.raw - (long long)x.raw * other.z.raw + (1 << 15)) >> 16)),
+				Fixed32::FromRaw((int)(((long long)x.raw * other.y.raw - (long long)y.raw * other.x.raw + (1 << 15)) >> 16)));
+		}
+
+		/// <summary>
+		/// Gets the squared magnitude (length) of this vector. This overflows for vectors longer than about 181, use Magnitude for those.
+		/// </summary>
+		constexpr Fixed32 SqrMagnitude() const
+		{
+			return Dot(*this);
+		}
+
+		/// <summary>
+		/// Gets the magnitude (length) of this vector, rounded down. Unlike SqrMagnitude, this works as long as the magnitude itself fits in a Fixed32.
+		/// </summary>
+		Fixed32 Magnitude() const;
+
+		/// <summary>
+		/// Gets a unit vector pointing to the same direction as this. The zero vector stays zero.
+		/// </summary>
+		FixedVector3D Normalized() const;
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha.
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr FixedVector3D Lerp(const FixedVector3D& target, Fixed32 alpha, bool clampAlpha = true) const
+		{
+			return FixedVector3D(x.Lerp(target.x, alpha, clampAlpha), y.Lerp(target.y, alpha, clampAlpha), z.Lerp(target.z, alpha, clampAlpha));
+		}
+		#pragma endregion
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "FloatingOrigin.h"
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	static_assert(sizeof(Vector3D) == sizeof(float) * 3, "The batch conversions expect Vector3D arrays to be tightly packed.");
+	static_assert(sizeof(Vector3DDouble) == sizeof(double) * 3, "The batch conversions expect Vector3DDouble arrays to be tightly packed.");
+
+	// The batch conversions treat the vector arrays as flat streams of components, so the origin repeats every 3 components.
+	// They use pairs of doubles, so the origin is loaded as the pairs (x, y), (z, x) and (y, z), which covers 2 vectors (6 components).
+
+	/// <summary>
+	/// Adds shift (as doubles) to 4 floats and rounds them back to float. lowShift is added to the first two floats and highShift to the last two.
+	/// </summary>
+	static inline void ShiftFourComponents(float* components, __m128d lowShift, __m128d highShift)
+	{
+		__m128 values = _mm_loadu_ps(components);
+		__m128d low = _mm_add_pd(_mm_cvtps_pd(values), lowShift);
+		__m128d high = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(values, values)), highShift);
+		_mm_storeu_ps(components, _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(high)));
+	}
+
+	void FloatingOrigin::ToLocal(const Vector3DDouble* world, Vector3D* local, size_t count) const
+	{
+		__m128d originXY = _mm_setr_pd(origin.x, origin.y);
+		__m128d originZX = _mm_setr_pd(origin.z, origin.x);
+		__m128d originYZ = _mm_setr_pd(origin.y, origin.z);
+
+		size_t i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			const double* source = world[i].components;
+			float* destination = local[i].components;
+
+			__m128 first = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(source), originXY));
+			__m128 second = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(source + 2), originZX));
+			__m128 third = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(source + 4), originYZ));
+
+			_mm_storeu_ps(destination, _mm_movelh_ps(first, second));
+			_mm_storel_pi((__m64*)(destination + 4), third);
+		}
+
+		for (; i < count; i++)
+			local[i] = ToLocal(world[i]);
+	}
+
+	void FloatingOrigin::ToWorld(const Vector3D* local, Vector3DDouble* world, size_t count) const
+	{
+		__m128d originXY = _mm_setr_pd(origin.x, origin.y);
+		__m128d originZX = _mm_setr_pd(origin.z, origin.x);
+		__m128d originYZ = _mm_setr_pd(origin.y, origin.z);
+
+		size_t i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			const float* source = local[i].components;
+			double* destination = world[i].components;
+
+			__m128 firstFour = _mm_loadu_ps(source);
+			__m128 lastTwo = _mm_castpd_ps(_mm_load_sd((const double*)(source + 4)));
+
+			_mm_storeu_pd(destination, _mm_add_pd(_mm_cvtps_pd(firstFour), originXY));
+			_mm_storeu_pd(destination + 2, _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(firstFour, firstFour)), originZX));
+			_mm_storeu_pd(destination + 4, _mm_add_pd(_mm_cvtps_pd(lastTwo), originYZ));
+		}
+
+		for (; i < count; i++)
+			world[i] = ToWorld(local[i]);
+	}
+
+	void FloatingOrigin::Rebase(const Vector3DDouble& newOrigin, Vector3D* positions, size_t count)
+	{
+		Rebase(positions, count, origin, newOrigin);
+		origin = newOrigin;
+	}
+
+	void FloatingOrigin::Rebase(Vector3D* positions, size_t count, const Vector3DDouble& oldOrigin, const Vector3DDouble& newOrigin)
+	{
+		if (count == 0)
+			return;
+
+		Vector3DDouble shift = oldOrigin - newOrigin;
+		__m128d shiftXY = _mm_setr_pd(shift.x, shift.y);
+		__m128d shiftZX = _mm_setr_pd(shift.z, shift.x);
+		__m128d shiftYZ = _mm_setr_pd(shift.y, shift.z);
+
+		// 4 vectors (12 components) per iteration, which is when the component pattern repeats in groups of 4.
+		float* components = positions->components;
+		size_t componentsCount = count * 3;
+		size_t i = 0;
+		for (; i + 12 <= componentsCount; i += 12)
+		{
+			ShiftFourComponents(components + i, shiftXY, shiftZX);
+			ShiftFourComponents(components + i + 4, shiftYZ, shiftXY);
+			ShiftFourComponents(components + i + 8, shiftZX, shiftYZ);
+		}
+
+		for (; i < componentsCount; i += 3)
+		{
+			components[i] = (float)(components[i] + shift.x);
+			components[i + 1] = (float)(components[i + 1] + shift.y);
+			components[i + 2] = (float)(components[i + 2] + shift.z);
+		}
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Vectors/Vector3D.h"
+#include "Vectors/Vector3DDouble.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A double precision origin that float positions are relative to. Used for camera-relative rendering in large worlds:<para/>
+	/// world positions are kept as Vector3DDouble, and everything that is sent to the GPU or simulated in float is a Vector3D relative to the origin.<para/>
+	/// When the camera gets too far from the origin, call Rebase to move the origin and shift the float positions so they stay small.
+	/// </summary>
+	struct SUPERGOD_API_CLASS FloatingOrigin final
+	{
+		/// <summary>
+		/// The world position that local positions are relative to.
+		/// </summary>
+		Vector3DDouble origin;
+
+		/// <summary>
+		/// Creates a new floating origin at the world origin.
+		/// </summary>
+		constexpr FloatingOrigin()
+			: origin()
+		{
+		}
+
+		/// <summary>
+		/// Creates a new floating origin at origin.
+		/// </summary>
+		explicit constexpr FloatingOrigin(const Vector3DDouble& origin)
+			: origin(origin)
+		{
+		}
+
+		#pragma region Single position conversions.
+		/// <summary>
+		/// Gets the position of world relative to the origin. The subtraction happens in double precision, so only the result is rounded to float.
+		/// </summary>
+		constexpr Vector3D ToLocal(const Vector3DDouble& world) const
+		{
+			return (Vector3D)world.Subtract(origin);
+		}
+
+		/// <summary>
+		/// Gets the world position of local, where local is relative to the origin.
+		/// </summary>
+		constexpr Vector3DDouble ToWorld(const Vector3D& local) const
+		{
+			return origin.Add(Vector3DDouble(local));
+		}
+
+		/// <summary>
+		/// Is focus (usually the camera) further than maxDistance from the origin on any axis?
+		/// </summary>
+		constexpr bool ShouldRebase(const Vector3DDouble& focus, double maxDistance) const
+		{
+			return !focus.CloseEnough(origin, maxDistance);
+		}
+		#pragma endregion
+
+		#pragma region Batch conversions.
+		/// <summary>
+		/// Converts count world positions to positions relative to the origin.
+		/// </summary>
+		/// <param name="world">The world positions to convert.</param>
+		/// <param name="local">The array that receives the local positions. Must be able to hold count vectors.</param>
+		void ToLocal(const Vector3DDouble* world, Vector3D* local, size_t count) const;
+
+		/// <summary>
+		/// Converts count positions that are relative to the origin to world positions.
+		/// </summary>
+		/// <param name="local">The local positions to convert.</param>
+		/// <param name="world">The array that receives the world positions. Must be able to hold count vectors.</param>
+		void ToWorld(const Vector3D* local, Vector3DDouble* world, size_t count) const;
+
+		/// <summary>
+		/// Moves the origin to newOrigin and shifts count positions that were relative to the old origin so they are relative to newOrigin.
+		/// </summary>
+		/// <param name="newOrigin">The new origin (usually the camera position).</param>
+		/// <param name="positions">The float positions that are relative to the origin.</param>
+		void Rebase(const Vector3DDouble& newOrigin, Vector3D* positions, size_t count);
+
+		/// <summary>
+		/// Shifts count positions that are relative to oldOrigin so they are relative to newOrigin.<para/>
+		/// Every position is shifted in double precision and rounded to float once, so a rebase adds at most half a float ulp of the new local position (the position relative to newOrigin).
+		/// Rebasing many times still adds one such rounding per rebase.
+		/// </summary>
+		static void Rebase(Vector3D* positions, size_t count, const Vector3DDouble& oldOrigin, const Vector3DDouble& newOrigin);
+		#pragma endregion
+	};
+} }
\ No newline at end of file
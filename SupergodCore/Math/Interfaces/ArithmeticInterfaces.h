@@ -9,11 +9,11 @@ namespace SupergodCore { namespace Math
 		struct SUPERGOD_API_CLASS interfaceName \
 		{ \
 			/*virtual T functionName(secondType secondName) const = 0;*/ \
-			inline T operator sign(secondType secondName) const \
+			inline constexpr T operator sign(secondType secondName) const \
 			{ \
 				return TEMPLATED_INTERFACE_THIS.functionName(secondName); \
 			} \
-			inline T operator sign=(secondType secondName) \
+			inline constexpr T operator sign=(secondType secondName) \
 			{ \
 				T& t = static_cast<T&>(*this); \
 				t = TEMPLATED_INTERFACE_THIS.functionName(secondName); \
@@ -63,7 +63,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Negates this.
 		/// </summary>
-		inline T operator-() const
+		inline constexpr T operator-() const
 		{
 			return TEMPLATED_INTERFACE_THIS.Negated();
 		}
@@ -78,7 +78,7 @@ namespace SupergodCore { namespace Math
 		/// Adds a and b (implementation is class-specific).
 		/// </summary>
 		template<class T>
-		inline T Add(const T& a, const T& b)
+		inline constexpr T Add(const T& a, const T& b)
 		{
 			return a.Add(b);
 		}
@@ -87,7 +87,7 @@ namespace SupergodCore { namespace Math
 		/// Subtracts b from a.
 		/// </summary>
 		template<class T>
-		inline T Subtract(const T& a, const T& b)
+		inline constexpr T Subtract(const T& a, const T& b)
 		{
 			return a.Subtract(b);
 		}
@@ -96,7 +96,7 @@ namespace SupergodCore { namespace Math
 		/// Subtracts b from a.
 		/// </summary>
 		template<class T>
-		inline T Divide(const T& a, const T& b)
+		inline constexpr T Divide(const T& a, const T& b)
 		{
 			return a.Divide(b);
 		}
@@ -105,7 +105,7 @@ namespace SupergodCore { namespace Math
 		/// Divides target by scalar.
 		/// </summary>
 		template<class T>
-		inline T Divide(const T& target, float scalar)
+		inline constexpr T Divide(const T& target, float scalar)
 		{
 			return target.Divide(scalar);
 		}
@@ -114,7 +114,7 @@ namespace SupergodCore { namespace Math
 		/// Multiplies target by scalar.
 		/// </summary>
 		template<class T>
-		inline T Multiply(const T& target, float scalar)
+		inline constexpr T Multiply(const T& target, float scalar)
 		{
 			return target.Multiply(scalar);
 		}
@@ -123,7 +123,7 @@ namespace SupergodCore { namespace Math
 		/// Subtracts b from a.
 		/// </summary>
 		template<class T>
-		inline T Multiply(const T& a, const T& b)
+		inline constexpr T Multiply(const T& a, const T& b)
 		{
 			return a.Multiply(b);
 		}
@@ -132,7 +132,7 @@ namespace SupergodCore { namespace Math
 		/// Negates target.
 		/// </summary>
 		template<class T>
-		inline T Negate(const T& target)
+		inline constexpr T Negate(const T& target)
 		{
 			return target.Negated();
 		}
@@ -141,7 +141,7 @@ namespace SupergodCore { namespace Math
 		/// Inverts target.
 		/// </summary>
 		template<class T>
-		inline T Invert(const T& target)
+		inline constexpr T Invert(const T& target)
 		{
 			return target.Inverted();
 		}
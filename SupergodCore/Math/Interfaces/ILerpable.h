@@ -14,7 +14,7 @@ namespace SupergodCore { namespace Math
 		/// <param name="target">The value to interpolate to.</param>
 		/// <param name="alpha">The interpolation factor.</param>
 		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
-		inline T Lerp(const T& target, float alpha, bool clampAlpha = true) const
+		inline constexpr T Lerp(const T& target, float alpha, bool clampAlpha = true) const
 		{
 			if (clampAlpha)
 				alpha = SMath::Clamp(alpha, 0, 1);
@@ -36,7 +36,7 @@ namespace SupergodCore { namespace Math
 		/// <param name="alpha">The interpolation factor.</param>
 		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
 		template<class T>
-		inline T Lerp(const T& source, const T& target, float alpha, bool clampAlpha = true)
+		inline constexpr T Lerp(const T& source, const T& target, float alpha, bool clampAlpha = true)
 		{
 			return source.Lerp(target, alpha, clampAlpha);
 		}
@@ -48,7 +48,7 @@ namespace SupergodCore { namespace Math
 		/// <param name="target">The value to interpolate to.</param>
 		/// <param name="alpha">The interpolation factor.</param>
 		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
-		inline float Lerp(float source, float target, float alpha, bool clampAlpha = true)
+		inline constexpr float Lerp(float source, float target, float alpha, bool clampAlpha = true)
 		{
 			if (clampAlpha)
 				alpha = SMath::Clamp(alpha, 0, 1);
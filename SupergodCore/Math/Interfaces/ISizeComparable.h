@@ -12,7 +12,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Is this bigger than other?
 		/// </summary>
-		inline bool operator>(const T& other) const
+		inline constexpr bool operator>(const T& other) const
 		{
 			return TEMPLATED_INTERFACE_THIS.BiggerThan(other);
 		}
@@ -20,7 +20,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Is this smaller than other?
 		/// </summary>
-		inline bool operator<(const T& other) const
+		inline constexpr bool operator<(const T& other) const
 		{
 			return TEMPLATED_INTERFACE_THIS.SmallerThan(other);
 		}
@@ -35,7 +35,7 @@ namespace SupergodCore { namespace Math
 		/// Is bigger actually bigger than smaller?
 		/// </summary>
 		template<class T>
-		inline bool BiggerThan(const T& bigger, const T& smaller)
+		inline constexpr bool BiggerThan(const T& bigger, const T& smaller)
 		{
 			return bigger.BiggerThan(smaller);
 		}
@@ -44,7 +44,7 @@ namespace SupergodCore { namespace Math
 		/// Is smaller actually smaller than bigger?
 		/// </summary>
 		template<class T>
-		inline bool SmallerThan(const T& smaller, const T& bigger)
+		inline constexpr bool SmallerThan(const T& smaller, const T& bigger)
 		{
 			return smaller.SmallerThan(bigger);
 		}
@@ -15,7 +15,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Checks if this equals to other.
 		/// </summary>
-		inline bool operator==(const T& other) const
+		inline constexpr bool operator==(const T& other) const
 		{
 			return TEMPLATED_INTERFACE_THIS.Equals(other);
 		}
@@ -23,7 +23,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Checks if this equals to other.
 		/// </summary>
-		inline bool operator!=(const T& other) const
+		inline constexpr bool operator!=(const T& other) const
 		{
 			return !(*this == other);
 		}
@@ -38,7 +38,7 @@ namespace SupergodCore { namespace Math
 		/// Is first equal to second?
 		/// </summary>
 		template<class T>
-		inline bool Equals(const T& first, const T& second)
+		inline constexpr bool Equals(const T& first, const T& second)
 		{
 			return first.Equals(second);
 		}
@@ -47,7 +47,7 @@ namespace SupergodCore { namespace Math
 		/// Is first close enough to second with the threshold of threshold?
 		/// </summary>
 		template<class T>
-		inline bool CloseEnough(const T& first, const T& second, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD)
+		inline constexpr bool CloseEnough(const T& first, const T& second, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD)
 		{
 			return first.CloseEnough(second, threshold);
 		}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// SSE2 helpers shared by the batched lerps of BatchedLerp and Angle.<para/>
+	/// Only used by their implementations, not part of the public headers.
+	/// </summary>
+	namespace LerpOps
+	{
+		/// <summary>
+		/// Clamps every lane of alpha between 0 and 1 the way SMath::Clamp does, so NaN stays NaN like it does in Lerp (min and max would turn it into 0).
+		/// </summary>
+		inline __m128 ClampAlpha(__m128 alpha)
+		{
+			__m128 zero = _mm_setzero_ps();
+			__m128 one = _mm_set1_ps(1);
+			alpha = _mm_or_ps(_mm_and_ps(_mm_cmplt_ps(alpha, zero), zero), _mm_andnot_ps(_mm_cmplt_ps(alpha, zero), alpha));
+			return _mm_or_ps(_mm_and_ps(_mm_cmpgt_ps(alpha, one), one), _mm_andnot_ps(_mm_cmpgt_ps(alpha, one), alpha));
+		}
+	}
+} }
\ No newline at end of file
@@ -6,4 +6,11 @@
 
 #include "Vectors/Vectors.h"
 #include "Colors/Colors.h"
-#include "Matrices/Matrices.h"
\ No newline at end of file
+#include "Matrices/Matrices.h"
+#include "Quaternion.h"
+#include "BatchedLerp.h"
+#include "FloatingOrigin.h"
+#include "Packing/Packing.h"
+#include "Curves/Curves.h"
+#include "FixedPoint/FixedPoint.h"
+#include "Text/Text.h"
\ No newline at end of file
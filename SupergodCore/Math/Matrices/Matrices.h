@@ -3,4 +3,5 @@
 #include "MatrixCommon.h"
 #include "Matrix2x2.h"
 #include "Matrix3x3.h"
-#include "Matrix4x4.h"
\ No newline at end of file
+#include "Matrix4x4.h"
+#include "Matrix3x3Double.h"
\ No newline at end of file
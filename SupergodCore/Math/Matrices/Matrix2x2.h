@@ -3,11 +3,11 @@
 #include "Common/CommonDefines.h"
 #include "MatrixCommon.h"
 #include "../Vectors/Vector2D.h"
+#include "../Angle.h"
 
 namespace SupergodCore { namespace Math
 {
 	struct Matrix3x3;
-	struct Angle;
 
 	/// <summary>
 	/// Represents a 2 by 2 mathematical matrix. This is useful for simple linear transformations in 2D.<para/>
@@ -64,20 +64,29 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new 2 by 2 matrix and initializes all of its elements to 0.
 		/// </summary>
-		Matrix2x2();
+		constexpr Matrix2x2()
+			: r0c0(0), r0c1(0), r1c0(0), r1c1(0)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new 2 by 2 matrix with specified values for its elements.
 		/// </summary>
-		Matrix2x2(
+		constexpr Matrix2x2(
 			float r0c0, float r0c1,
-			float r1c0, float r1c1);
+			float r1c0, float r1c1)
+			: r0c0(r0c0), r0c1(r0c1), r1c0(r1c0), r1c1(r1c1)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new 2 by 2 matrix and initializes all elements to 0 and the diagonal elements to diagonal.
 		/// </summary>
 		/// <param name="diagonal">The value for the diagonal elements.</param>
-		Matrix2x2(float diagonal);
+		constexpr Matrix2x2(float diagonal)
+			: r0c0(diagonal), r0c1(0), r1c0(0), r1c1(diagonal)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new 3 by 3 matrix where the top left corner is this, the bottom right elemnt is 1 and the rest of the elements are 0.
@@ -88,16 +97,26 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new matrix with vectors for the rows.
 		/// </summary>
-		static Matrix2x2 FromRows(
+		static constexpr Matrix2x2 FromRows(
 			const Vector2D& firstRow,
-			const Vector2D& secondRow);
+			const Vector2D& secondRow)
+		{
+			return Matrix2x2(
+				firstRow.x, firstRow.y,
+				secondRow.x, secondRow.y);
+		}
 
 		/// <summary>
 		/// Creates a new matrix with vectors for the columns.
 		/// </summary>
-		static Matrix2x2 FromColumns(
+		static constexpr Matrix2x2 FromColumns(
 			const Vector2D& firstColumn,
-			const Vector2D& secondColumn);
+			const Vector2D& secondColumn)
+		{
+			return Matrix2x2(
+				firstColumn.x, secondColumn.x,
+				firstColumn.y, secondColumn.y);
+		}
 		#pragma endregion
 
 		#pragma region Transformation construction methods.
@@ -106,32 +125,56 @@ namespace SupergodCore { namespace Math
 		/// </summary>
 		/// <param name="x">The scale along the x axis.</param>
 		/// <param name="y">The scale along the y axis.</param>
-		static Matrix2x2 Scale(float x, float y);
+		static constexpr Matrix2x2 Scale(float x, float y)
+		{
+			return Matrix2x2(
+				x, 0,
+				0, y);
+		}
 		
 		/// <summary>
 		/// Creates a scale matrix.
 		/// </summary>
 		/// <param name="scale">The scale along the x and y axes.</param>
-		static Matrix2x2 Scale(const Vector2D& scale);
+		static constexpr Matrix2x2 Scale(const Vector2D& scale)
+		{
+			return Scale(scale.x, scale.y);
+		}
 
 		/// <summary>
 		/// Creates a rotation matrix.
 		/// </summary>
 		/// <param name="rotation">The angle of rotation.</param>
-		static Matrix2x2 Rotate(Angle rotation);
+		static constexpr Matrix2x2 Rotate(Angle rotation)
+		{
+			float sin = SMath::Constexpr::Sin(rotation);
+			float cos = SMath::Constexpr::Cos(rotation);
+
+			return Matrix2x2(
+				cos, -sin,
+				sin, cos);
+		}
 
 		/// <summary>
 		/// Creates a shear matrix.
 		/// </summary>
 		/// <param name="x">The amount of shear along the x axis.</param>
 		/// <param name="y">The amount of shear along the y axis.</param>
-		static Matrix2x2 Shear(float x, float y);
+		static constexpr Matrix2x2 Shear(float x, float y)
+		{
+			return Matrix2x2(
+				1, x,
+				y, 1);
+		}
 
 		/// <summary>
 		/// Creates a shear matrix.
 		/// </summary>
 		/// <param name="shear">The amount of shear along the x and y axes.</param>
-		static Matrix2x2 Shear(const Vector2D& shear);
+		static constexpr Matrix2x2 Shear(const Vector2D& shear)
+		{
+			return Shear(shear.x, shear.y);
+		}
 		#pragma endregion
 
 		#pragma region Indexers.
@@ -146,7 +189,7 @@ namespace SupergodCore { namespace Math
 		Vector2D& GetRow(int index);
 
 		/// <summary>
-		/// Gets the value of the column at the index of index. (Will construct a new vector.)
+		/// Gets the value of the column at the index of index. (Will construct a new vector, GetColumnView reads it in place.)
 		/// </summary>
 		/// <param name="index">The index of the column.</param>
 		Vector2D GetColumn(int index) const;
@@ -183,96 +226,203 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Is the distance between each element in this and its corresponding elemtn in other smaller or equal to threshold?
 		/// </summary>
-		bool CloseEnough(const Matrix2x2& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const Matrix2x2& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return
+				SMath::CloseEnough(r0c0, other.r0c0, threshold) && SMath::CloseEnough(r0c1, other.r0c1, threshold) &&
+				SMath::CloseEnough(r1c0, other.r1c0, threshold) && SMath::CloseEnough(r1c1, other.r1c1, threshold);
+		}
 		
 		/// <summary>
 		/// Is every element of this the same as its corresponding component in other?
 		/// </summary>
-		bool Equals(const Matrix2x2& other) const;
+		constexpr bool Equals(const Matrix2x2& other) const
+		{
+			return
+				r0c0 == other.r0c0 && r0c1 == other.r0c1 &&
+				r1c0 == other.r1c0 && r1c1 == other.r1c1;
+		}
 		#pragma endregion
 
 		#pragma region Multiplication and division.
 		/// <summary>
 		/// Multiplies every component of this by its corresponding component in other.
 		/// </summary>
-		Matrix2x2 MultiplyComponentWise(const Matrix2x2& other) const;
+		constexpr Matrix2x2 MultiplyComponentWise(const Matrix2x2& other) const
+		{
+			return Matrix2x2(
+				r0c0 * other.r0c0, r0c1 * other.r0c1,
+				r1c0 * other.r1c0, r1c1 * other.r1c1);
+		}
 
 		/// <summary>
 		/// Multiplies this matrix by other.
 		/// </summary>
-		Matrix2x2 Multiply(const Matrix2x2& other) const;
+		constexpr Matrix2x2 Multiply(const Matrix2x2& other) const
+		{
+			// Every row of the product is the row of this multiplied by other from the left.
+			return FromRows(
+				other.LeftMultiply(Vector2D(r0c0, r0c1)),
+				other.LeftMultiply(Vector2D(r1c0, r1c1)));
+		}
 		
 		/// <summary>
 		/// Multiplies this by vector (where vector is a column vector). This will transform vector.
 		/// </summary>
-		Vector2D Multiply(const Vector2D& vector) const;
+		constexpr Vector2D Multiply(const Vector2D& vector) const
+		{
+			return Vector2D(
+				r0c0 * vector.x + r0c1 * vector.y,
+				r1c0 * vector.x + r1c1 * vector.y);
+		}
+
+		/// <summary>
+		/// Multiplies vector (where vector is a row vector) by this, without transposing this. This will NOT transform vector.
+		/// </summary>
+		constexpr Vector2D LeftMultiply(const Vector2D& vector) const
+		{
+			return Vector2D(
+				vector.x * r0c0 + vector.y * r1c0,
+				vector.x * r0c1 + vector.y * r1c1);
+		}
 
 		/// <summary>
 		/// Multiplies every component of this by scalar.
 		/// </summary>
-		Matrix2x2 Multiply(float scalar) const;
+		constexpr Matrix2x2 Multiply(float scalar) const
+		{
+			return Matrix2x2(
+				r0c0 * scalar, r0c1 * scalar,
+				r1c0 * scalar, r1c1 * scalar);
+		}
 
 		/// <summary>
 		/// Divides every elemnt of this by scalar.
 		/// </summary>
-		Matrix2x2 Divide(float scalar) const;
+		constexpr Matrix2x2 Divide(float scalar) const
+		{
+			return Matrix2x2(
+				r0c0 / scalar, r0c1 / scalar,
+				r1c0 / scalar, r1c1 / scalar);
+		}
 		#pragma endregion
 
 		#pragma region Addition and subtraction.
 		/// <summary>Adds every element of this to the corresponding element in other.</summary>
-		Matrix2x2 Add(const Matrix2x2& other) const;
+		constexpr Matrix2x2 Add(const Matrix2x2& other) const
+		{
+			return Matrix2x2(
+				r0c0 + other.r0c0, r0c1 + other.r0c1,
+				r1c0 + other.r1c0, r1c1 + other.r1c1);
+		}
 		
 		/// <summary>Subtracts every element of this by the corresponding element in other.</summary>
-		Matrix2x2 Subtract(const Matrix2x2& other) const;
+		constexpr Matrix2x2 Subtract(const Matrix2x2& other) const
+		{
+			return Matrix2x2(
+				r0c0 - other.r0c0, r0c1 - other.r0c1,
+				r1c0 - other.r1c0, r1c1 - other.r1c1);
+		}
 		#pragma endregion
 
 		#pragma region Negating, transposing, minor, cofactor and absolute value.
 		/// <summary>
 		/// The matrix with all of its elements negated (multiplied by -1).
 		/// </summary>
-		Matrix2x2 Negated() const;
+		constexpr Matrix2x2 Negated() const
+		{
+			return Matrix2x2(
+				-r0c0, -r0c1,
+				-r1c0, -r1c1);
+		}
 
 		/// <summary>
 		/// Gets the transpose (replaced rows with columns and columns with rows) of this matrix.
 		/// </summary>
-		Matrix2x2 Transposed() const;
+		constexpr Matrix2x2 Transposed() const
+		{
+			return Matrix2x2(
+				r0c0, r1c0,
+				r0c1, r1c1);
+		}
 
 		/// <summary>
 		/// Gets the minor matrix of this.
 		/// </summary>
-		Matrix2x2 Minor() const;
+		constexpr Matrix2x2 Minor() const
+		{
+			return Matrix2x2(
+				r1c1, r1c0,
+				r0c1, r0c0);
+		}
 
 		/// <summary>
 		/// Gets the cofactor matrix of this.
 		/// </summary>
-		Matrix2x2 Cofactor() const;
+		constexpr Matrix2x2 Cofactor() const
+		{
+			return Minor().MultiplyComponentWise(Matrix2x2(
+				+1, -1,
+				-1, +1));
+		}
 
 		/// <summary>
 		/// Gets a new matrix where each element has the absolute value of the corresponding element in this.
 		/// </summary>
-		Matrix2x2 Abs() const;
+		constexpr Matrix2x2 Abs() const
+		{
+			return Matrix2x2(
+				SMath::Abs(r0c0), SMath::Abs(r0c1),
+				SMath::Abs(r1c0), SMath::Abs(r1c1));
+		}
 		#pragma endregion
 
 		#pragma region Determinant and trace.
 		/// <summary>The determinant (how much the area of a 1x1 square will be multiplied by after it's transformed with this matrix) of this matrix.</summary>
-		float Determinant() const;
+		constexpr float Determinant() const
+		{
+			return r0c0 * r1c1 - r0c1 * r1c0;
+		}
 
 		/// <summary>Gest the trace (sum of diagonal elements) of this matrix.</summary>
-		float Trace() const;
+		constexpr float Trace() const
+		{
+			return r0c0 + r1c1;
+		}
 		#pragma endregion
 
 		#pragma region Clamp methods (Clamp, ClampElements, ClampRows. ClampColumns).
 		/// <summary>Clamps each element of this so it's never smaller than the corresponding element in min and never bigger than the corresponding element in max.</summary>
-		Matrix2x2 Clamp(const Matrix2x2& min, const Matrix2x2& max) const;
+		constexpr Matrix2x2 Clamp(const Matrix2x2& min, const Matrix2x2& max) const
+		{
+			return Matrix2x2(
+				SMath::Clamp(r0c0, min.r0c0, max.r0c0), SMath::Clamp(r0c1, min.r0c1, max.r0c1),
+				SMath::Clamp(r1c0, min.r1c0, max.r1c0), SMath::Clamp(r1c1, min.r1c1, max.r1c1));
+		}
 
 		/// <summary>Clamps each element of this so it's never smaller than min and never bigger than max.</summary>
-		Matrix2x2 ClampElements(float min, float max) const;
+		constexpr Matrix2x2 ClampElements(float min, float max) const
+		{
+			return Matrix2x2(
+				SMath::Clamp(r0c0, min, max), SMath::Clamp(r0c1, min, max),
+				SMath::Clamp(r1c0, min, max), SMath::Clamp(r1c1, min, max));
+		}
 
 		/// <summary>Clamps each element of each row in this so that it's never smaller than the corresponding element in min and never bigger than the corresponding element in max.</summary>
-		Matrix2x2 ClampRows(const Vector2D& min, const Vector2D& max) const;
+		constexpr Matrix2x2 ClampRows(const Vector2D& min, const Vector2D& max) const
+		{
+			return FromRows(
+				Vector2D(r0c0, r0c1).Clamp(min, max),
+				Vector2D(r1c0, r1c1).Clamp(min, max));
+		}
 
 		/// <summary>Clamps each element of each column in this so that it's never smaller than the corresponding element in min and never bigger than the corresponding element in max.</summary>
-		Matrix2x2 ClampColumns(const Vector2D& min, const Vector2D& max) const;
+		constexpr Matrix2x2 ClampColumns(const Vector2D& min, const Vector2D& max) const
+		{
+			return FromColumns(
+				Vector2D(r0c0, r1c0).Clamp(min, max),
+				Vector2D(r0c1, r1c1).Clamp(min, max));
+		}
 		#pragma endregion
 	};
 } }
\ No newline at end of file
@@ -4,15 +4,13 @@
 #include "../Interfaces/ITransformer.h"
 #include "../Interfaces/IRotator.h"
 #include "../Vectors/Vector3D.h"
+#include "../Angle.h"
+#include "Matrix2x2.h"
 
 namespace SupergodCore { namespace Math
 {
 	// Inheriting from IRotator2D caused a few problems, so I removed it. The interface will probably be gone later, so it doesn't matter.
 
-	struct Angle;
-	struct Vector2D;
-	struct Matrix2x2;
-
 	/// <summary>
 	/// Represents a 3 by 3 mathematical matrix. Useful for affine transformations in 2D.
 	/// </summary>
@@ -35,7 +33,7 @@ namespace SupergodCore { namespace Math
 		/// [0 0 0 0]<para/>
 		/// [0 0 0 0]
 		/// </summary>
-		DEFINE_STRUCT_VALUE_PRESET(Matrix3x3, Zero, )
+		DEFINE_STRUCT_VALUE_PRESET(Matrix3x3, Zero, (0))
 
 		/// <summary>
 		/// The component-wise multiplicative identity:<para/>
@@ -82,43 +80,71 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a 2 by 2 matrix and initializes all of its elements to 0.
 		/// </summary>
-		Matrix3x3();
+		constexpr Matrix3x3()
+			: Matrix3x3(0)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new 3 by 3 matrix with a specified value for every element.
 		/// </summary>
-		Matrix3x3(
+		constexpr Matrix3x3(
 			float r0c0, float r0c1, float r0c2,
 			float r1c0, float r1c1, float r1c2,
-			float r2c0, float r2c1, float r2c2);
+			float r2c0, float r2c1, float r2c2)
+			: r0c0(r0c0), r0c1(r0c1), r0c2(r0c2),
+			r1c0(r1c0), r1c1(r1c1), r1c2(r1c2),
+			r2c0(r2c0), r2c1(r2c1), r2c2(r2c2)
+		{
+		}
 
 		/// <summary>
 		/// Creates a new 3 by 3 matrix with a specified value for its diagonal elements. The other elements will be initialized to 0.
 		/// </summary>
 		/// <param name="diagonal">The value of the diagonal elements.</param>
-		Matrix3x3(float diagonal);
+		constexpr Matrix3x3(float diagonal)
+			: r0c0(diagonal), r0c1(0), r0c2(0),
+			r1c0(0), r1c1(diagonal), r1c2(0),
+			r2c0(0), r2c1(0), r2c2(diagonal)
+		{
+		}
 
 		/// <summary>
 		/// Gets a 2 by 2 matrix with the top left corner of this.
 		/// </summary>
-		explicit operator Matrix2x2();
+		explicit constexpr operator Matrix2x2()
+		{
+			return Matrix2x2(r0c0, r0c1, r1c0, r1c1);
+		}
 
 		#pragma region Basic construction methods.
 		/// <summary>
 		/// Creates a new matrix with vectors for the rows.
 		/// </summary>
-		static Matrix3x3 FromRows(
+		static constexpr Matrix3x3 FromRows(
 			const Vector3D& firstRow,
 			const Vector3D& secondRow,
-			const Vector3D& thirdRow);
+			const Vector3D& thirdRow)
+		{
+			return Matrix3x3(
+				firstRow.x, firstRow.y, firstRow.z,
+				secondRow.x, secondRow.y, secondRow.z,
+				thirdRow.x, thirdRow.y, thirdRow.z);
+		}
 
 		/// <summary>
 		/// Creates a new matrix with vectors for the columns.
 		/// </summary>
-		static Matrix3x3 FromColumns(
+		static constexpr Matrix3x3 FromColumns(
 			const Vector3D& firstColumn,
 			const Vector3D& secondColumn,
-			const Vector3D& thirdColumn);
+			const Vector3D& thirdColumn)
+		{
+			return Matrix3x3(
+				firstColumn.x, secondColumn.x, thirdColumn.x,
+				firstColumn.y, secondColumn.y, thirdColumn.y,
+				firstColumn.z, secondColumn.z, thirdColumn.z);
+		}
 		#pragma endregion
 
 		#pragma region Transformation construction methods.
@@ -127,45 +153,81 @@ namespace SupergodCore { namespace Math
 		/// </summary>
 		/// <param name="x">The scale along the x axis.</param>
 		/// <param name="y">The scale along the y axis.</param>
-		static Matrix3x3 Scale(float x, float y);
+		static constexpr Matrix3x3 Scale(float x, float y)
+		{
+			return Matrix3x3(
+				x, 0, 0,
+				0, y, 0,
+				0, 0, 1);
+		}
 
 		/// <summary>
 		/// Creates a scale matrix.
 		/// </summary>
 		/// <param name="scale">The scale along the x and y axes.</param>
-		static Matrix3x3 Scale(const Vector2D& scale);
+		static constexpr Matrix3x3 Scale(const Vector2D& scale)
+		{
+			return Scale(scale.x, scale.y);
+		}
 
 		/// <summary>
 		/// Creates a rotation matrix.
 		/// </summary>
 		/// <param name="rotation">The angle of rotation.</param>
-		static Matrix3x3 Rotate(Angle rotation);
+		static constexpr Matrix3x3 Rotate(Angle rotation)
+		{
+			float sin = SMath::Constexpr::Sin(rotation);
+			float cos = SMath::Constexpr::Cos(rotation);
+
+			return Matrix3x3(
+				cos, -sin, 0,
+				sin, cos, 0,
+				0, 0, 1);
+		}
 
 		/// <summary>
 		/// Creates a shear matrix.
 		/// </summary>
 		/// <param name="x">The amount of shear along the x axis.</param>
 		/// <param name="y">The amount of shear along the y axis.</param>
-		static Matrix3x3 Shear(float x, float y);
+		static constexpr Matrix3x3 Shear(float x, float y)
+		{
+			return Matrix3x3(
+				1, x, 0,
+				y, 1, 0,
+				0, 0, 1);
+		}
 
 		/// <summary>
 		/// Creates a shear matrix.
 		/// </summary>
 		/// <param name="shear">The amount of shear along the x and y axes.</param>
-		static Matrix3x3 Shear(const Vector2D& shear);
+		static constexpr Matrix3x3 Shear(const Vector2D& shear)
+		{
+			return Shear(shear.x, shear.y);
+		}
 
 		/// <summary>
 		/// Creates a translation matrix.
 		/// </summary>
 		/// <param name="x">The amount of translation along the x axis.</param>
 		/// <param name="y">The amount of translation along the y axis.</param>
-		static Matrix3x3 Translate(float x, float y);
+		static constexpr Matrix3x3 Translate(float x, float y)
+		{
+			return Matrix3x3(
+				1, 0, x,
+				0, 1, y,
+				0, 0, 1);
+		}
 
 		/// <summary>
 		/// Creates a translation matrix.
 		/// </summary>
 		/// <param name="translation">The amount of translation along the x and y axes.</param>
-		static Matrix3x3 Translate(const Vector2D& translation);
+		static constexpr Matrix3x3 Translate(const Vector2D& translation)
+		{
+			return Translate(translation.x, translation.y);
+		}
 		#pragma endregion
 
 		#pragma region Indexers.
@@ -180,7 +242,7 @@ namespace SupergodCore { namespace Math
 		Vector3D& GetRow(int index);
 
 		/// <summary>
-		/// Gets the value of the column at the index of index. (Will construct a new vector.)
+		/// Gets the value of the column at the index of index. (Will construct a new vector, GetColumnView reads it in place.)
 		/// </summary>
 		/// <param name="index">The index of the column.</param>
 		Vector3D GetColumn(int index) const;
@@ -217,96 +279,234 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Is the distance between each element in this and its corresponding elemtn in other smaller or equal to threshold?
 		/// </summary>
-		bool CloseEnough(const Matrix3x3& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const Matrix3x3& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return
+				SMath::CloseEnough(r0c0, other.r0c0, threshold) && SMath::CloseEnough(r0c1, other.r0c1, threshold) && SMath::CloseEnough(r0c2, other.r0c2, threshold) &&
+				SMath::CloseEnough(r1c0, other.r1c0, threshold) && SMath::CloseEnough(r1c1, other.r1c1, threshold) && SMath::CloseEnough(r1c2, other.r1c2, threshold) &&
+				SMath::CloseEnough(r2c0, other.r2c0, threshold) && SMath::CloseEnough(r2c1, other.r2c1, threshold) && SMath::CloseEnough(r2c2, other.r2c2, threshold);
+		}
 
 		/// <summary>
 		/// Is every element of this the same as its corresponding component in other?
 		/// </summary>
-		bool Equals(const Matrix3x3& other) const;
+		constexpr bool Equals(const Matrix3x3& other) const
+		{
+			return
+				r0c0 == other.r0c0 && r0c1 == other.r0c1 && r0c2 == other.r0c2 &&
+				r1c0 == other.r1c0 && r1c1 == other.r1c1 && r1c2 == other.r1c2 &&
+				r2c0 == other.r2c0 && r2c1 == other.r2c1 && r2c2 == other.r2c2;
+		}
 		#pragma endregion
 
 		#pragma region Multiplication and division.
 		/// <summary>
 		/// Multiplies every component of this by its corresponding component in other.
 		/// </summary>
-		Matrix3x3 MultiplyComponentWise(const Matrix3x3& other) const;
+		constexpr Matrix3x3 MultiplyComponentWise(const Matrix3x3& other) const
+		{
+			return Matrix3x3(
+				r0c0 * other.r0c0, r0c1 * other.r0c1, r0c2 * other.r0c2,
+				r1c0 * other.r1c0, r1c1 * other.r1c1, r1c2 * other.r1c2,
+				r2c0 * other.r2c0, r2c1 * other.r2c1, r2c2 * other.r2c2);
+		}
 
 		/// <summary>
 		/// Multiplies this matrix by other.
 		/// </summary>
-		Matrix3x3 Multiply(const Matrix3x3& other) const;
+		constexpr Matrix3x3 Multiply(const Matrix3x3& other) const
+		{
+			// Every row of the product is the row of this multiplied by other from the left.
+			return FromRows(
+				other.LeftMultiply(Vector3D(r0c0, r0c1, r0c2)),
+				other.LeftMultiply(Vector3D(r1c0, r1c1, r1c2)),
+				other.LeftMultiply(Vector3D(r2c0, r2c1, r2c2)));
+		}
 
 		/// <summary>
 		/// Multiplies this by vector (where vector is a column vector). This will transform vector.
 		/// </summary>
-		Vector3D Multiply(const Vector3D& vector) const;
+		constexpr Vector3D Multiply(const Vector3D& vector) const
+		{
+			return Vector3D(
+				r0c0 * vector.x + r0c1 * vector.y + r0c2 * vector.z,
+				r1c0 * vector.x + r1c1 * vector.y + r1c2 * vector.z,
+				r2c0 * vector.x + r2c1 * vector.y + r2c2 * vector.z);
+		}
+
+		/// <summary>
+		/// Multiplies vector (where vector is a row vector) by this, without transposing this. This will NOT transform vector.
+		/// </summary>
+		constexpr Vector3D LeftMultiply(const Vector3D& vector) const
+		{
+			return Vector3D(
+				vector.x * r0c0 + vector.y * r1c0 + vector.z * r2c0,
+				vector.x * r0c1 + vector.y * r1c1 + vector.z * r2c1,
+				vector.x * r0c2 + vector.y * r1c2 + vector.z * r2c2);
+		}
 
 		/// <summary>
 		/// Multiplies every component of this by scalar.
 		/// </summary>
-		Matrix3x3 Multiply(float scalar) const;
+		constexpr Matrix3x3 Multiply(float scalar) const
+		{
+			return Matrix3x3(
+				r0c0 * scalar, r0c1 * scalar, r0c2 * scalar,
+				r1c0 * scalar, r1c1 * scalar, r1c2 * scalar,
+				r2c0 * scalar, r2c1 * scalar, r2c2 * scalar);
+		}
 
 		/// <summary>
 		/// Divides every elemnt of this by scalar.
 		/// </summary>
-		Matrix3x3 Divide(float scalar) const;
+		constexpr Matrix3x3 Divide(float scalar) const
+		{
+			return Matrix3x3(
+				r0c0 / scalar, r0c1 / scalar, r0c2 / scalar,
+				r1c0 / scalar, r1c1 / scalar, r1c2 / scalar,
+				r2c0 / scalar, r2c1 / scalar, r2c2 / scalar);
+		}
 		#pragma endregion
 
 		#pragma region Addition and subtraction.
 		/// <summary>Adds every element of this to the corresponding element in other.</summary>
-		Matrix3x3 Add(const Matrix3x3& other) const;
+		constexpr Matrix3x3 Add(const Matrix3x3& other) const
+		{
+			return Matrix3x3(
+				r0c0 + other.r0c0, r0c1 + other.r0c1, r0c2 + other.r0c2,
+				r1c0 + other.r1c0, r1c1 + other.r1c1, r1c2 + other.r1c2,
+				r2c0 + other.r2c0, r2c1 + other.r2c1, r2c2 + other.r2c2);
+		}
 
 		/// <summary>Subtracts every element of this by the corresponding element in other.</summary>
-		Matrix3x3 Subtract(const Matrix3x3& other) const;
+		constexpr Matrix3x3 Subtract(const Matrix3x3& other) const
+		{
+			return Matrix3x3(
+				r0c0 - other.r0c0, r0c1 - other.r0c1, r0c2 - other.r0c2,
+				r1c0 - other.r1c0, r1c1 - other.r1c1, r1c2 - other.r1c2,
+				r2c0 - other.r2c0, r2c1 - other.r2c1, r2c2 - other.r2c2);
+		}
 		#pragma endregion
 
 		#pragma region Negating, transposing, minor, cofactor and absolute value.
 		/// <summary>
 		/// The matrix with all of its elements negated (multiplied by -1).
 		/// </summary>
-		Matrix3x3 Negated() const;
+		constexpr Matrix3x3 Negated() const
+		{
+			return Matrix3x3(
+				-r0c0, -r0c1, -r0c2,
+				-r1c0, -r1c1, -r1c2,
+				-r2c0, -r2c1, -r2c2);
+		}
 
 		/// <summary>
 		/// Gets the transpose (replaced rows with columns and columns with rows) of this matrix.
 		/// </summary>
-		Matrix3x3 Transposed() const;
+		constexpr Matrix3x3 Transposed() const
+		{
+			return Matrix3x3(
+				r0c0, r1c0, r2c0,
+				r0c1, r1c1, r2c1,
+				r0c2, r1c2, r2c2);
+		}
 
 		/// <summary>
 		/// Gets the minor matrix of this.
 		/// </summary>
-		Matrix3x3 Minor() const;
+		constexpr Matrix3x3 Minor() const
+		{
+			return Matrix3x3(
+				Matrix2x2(r1c1, r1c2, r2c1, r2c2).Determinant(),
+				Matrix2x2(r1c0, r1c2, r2c0, r2c2).Determinant(),
+				Matrix2x2(r1c0, r1c1, r2c0, r2c1).Determinant(),
+
+				Matrix2x2(r0c1, r0c2, r2c1, r2c2).Determinant(),
+				Matrix2x2(r0c0, r0c2, r2c0, r2c2).Determinant(),
+				Matrix2x2(r0c0, r0c1, r2c0, r2c1).Determinant(),
+
+				Matrix2x2(r0c1, r0c2, r1c1, r1c2).Determinant(),
+				Matrix2x2(r0c0, r0c2, r1c0, r1c2).Determinant(),
+				Matrix2x2(r0c0, r0c1, r1c0, r1c1).Determinant()
+				);
+		}
 
 		/// <summary>
 		/// Gets the cofactor matrix of this.
 		/// </summary>
-		Matrix3x3 Cofactor() const;
+		constexpr Matrix3x3 Cofactor() const
+		{
+			return Minor().MultiplyComponentWise(Matrix3x3(
+				1, -1, 1,
+				-1, 1, -1,
+				1, -1, 1));
+		}
 
 		/// <summary>
 		/// Gets a new matrix where each element has the absolute value of the corresponding element in this.
 		/// </summary>
-		Matrix3x3 Abs() const;
+		constexpr Matrix3x3 Abs() const
+		{
+			return Matrix3x3(
+				SMath::Abs(r0c0), SMath::Abs(r0c1), SMath::Abs(r0c2),
+				SMath::Abs(r1c0), SMath::Abs(r1c1), SMath::Abs(r1c2),
+				SMath::Abs(r2c0), SMath::Abs(r2c1), SMath::Abs(r2c2));
+		}
 		#pragma endregion
 
 		#pragma region Determinant and trace.
 		/// <summary>The determinant (Volume between the vectors of the three columns) of this matrix.</summary>
-		float Determinant() const;
+		constexpr float Determinant() const
+		{
+			return
+				r0c0 * Matrix2x2(r1c1, r1c2, r2c1, r2c2).Determinant() -
+				r0c1 * Matrix2x2(r1c0, r1c2, r2c0, r2c2).Determinant() +
+				r0c2 * Matrix2x2(r1c0, r1c1, r2c0, r2c1).Determinant();
+		}
 
 		/// <summary>Gest the trace (sum of diagonal elements) of this matrix.</summary>
-		float Trace() const;
+		constexpr float Trace() const
+		{
+			return r0c0 + r1c1 + r2c2;
+		}
 		#pragma endregion
 
 		#pragma region Clamp methods (Clamp, ClampElements, ClampRows. ClampColumns).
 		/// <summary>Clamps each element of this so it's never smaller than the corresponding element in min and never bigger than the corresponding element in max.</summary>
-		Matrix3x3 Clamp(const Matrix3x3& min, const Matrix3x3& max) const;
+		constexpr Matrix3x3 Clamp(const Matrix3x3& min, const Matrix3x3& max) const
+		{
+			return Matrix3x3(
+				SMath::Clamp(r0c0, min.r0c0, max.r0c0), SMath::Clamp(r0c1, min.r0c1, max.r0c1), SMath::Clamp(r0c2, min.r0c2, max.r0c2),
+				SMath::Clamp(r1c0, min.r1c0, max.r1c0), SMath::Clamp(r1c1, min.r1c1, max.r1c1), SMath::Clamp(r1c2, min.r1c2, max.r1c2),
+				SMath::Clamp(r2c0, min.r2c0, max.r2c0), SMath::Clamp(r2c1, min.r2c1, max.r2c1), SMath::Clamp(r2c2, min.r2c2, max.r2c2));
+		}
 
 		/// <summary>Clamps each element of this so it's never smaller than min and never bigger than max.</summary>
-		Matrix3x3 ClampElements(float min, float max) const;
+		constexpr Matrix3x3 ClampElements(float min, float max) const
+		{
+			return Matrix3x3(
+				SMath::Clamp(r0c0, min, max), SMath::Clamp(r0c1, min, max), SMath::Clamp(r0c2, min, max),
+				SMath::Clamp(r1c0, min, max), SMath::Clamp(r1c1, min, max), SMath::Clamp(r1c2, min, max),
+				SMath::Clamp(r2c0, min, max), SMath::Clamp(r2c1, min, max), SMath::Clamp(r2c2, min, max));
+		}
 
 		/// <summary>Clamps each element of each row in this so that it's never smaller than the corresponding element in min and never bigger than the corresponding element in max.</summary>
-		Matrix3x3 ClampRows(const Vector3D& min, const Vector3D& max) const;
+		constexpr Matrix3x3 ClampRows(const Vector3D& min, const Vector3D& max) const
+		{
+			return FromRows(
+				Vector3D(r0c0, r0c1, r0c2).Clamp(min, max),
+				Vector3D(r1c0, r1c1, r1c2).Clamp(min, max),
+				Vector3D(r2c0, r2c1, r2c2).Clamp(min, max));
+		}
 
 		/// <summary>Clamps each element of each column in this so that it's never smaller than the corresponding element in min and never bigger than the corresponding element in max.</summary>
-		Matrix3x3 ClampColumns(const Vector3D& min, const Vector3D& max) const;
+		constexpr Matrix3x3 ClampColumns(const Vector3D& min, const Vector3D& max) const
+		{
+			return FromColumns(
+				Vector3D(r0c0, r1c0, r2c0).Clamp(min, max),
+				Vector3D(r0c1, r1c1, r2c1).Clamp(min, max),
+				Vector3D(r0c2, r1c2, r2c2).Clamp(min, max));
+		}
 		#pragma endregion
 	};
 } }
\ No newline at end of file
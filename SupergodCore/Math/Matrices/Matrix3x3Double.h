@@ -0,0 +1,264 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../Interfaces/ISupergodEquatable.h"
+#include "../Interfaces/ArithmeticInterfaces.h"
+#include "../Vectors/Vector3DDouble.h"
+#include "Matrix3x3.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Represents a 3 by 3 mathematical matrix with double precision elements.<para/>
+	/// Useful for the rotation and scale of objects that are positioned with a Vector3DDouble, where accumulating transformations in float would drift.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Matrix3x3Double final : public ISupergodEquatable<Matrix3x3Double>,
+		public IAddable<Matrix3x3Double>, public ISubtractable<Matrix3x3Double>, public IMultipliable<Matrix3x3Double>, public INegatable<Matrix3x3Double>
+	{
+		#pragma region Presets for common matrices.
+		/// <summary>
+		/// The multiplicative identity.
+		/// </summary>
+		DEFINE_STRUCT_VALUE_PRESET(Matrix3x3Double, Identity, (1))
+
+		/// <summary>
+		/// The additive identity.
+		/// </summary>
+		DEFINE_STRUCT_VALUE_PRESET(Matrix3x3Double, Zero, (0))
+		#pragma endregion
+
+		union
+		{
+			struct
+			{
+				double r0c0, r0c1, r0c2;
+				double r1c0, r1c1, r1c2;
+				double r2c0, r2c1, r2c2;
+			};
+
+			/// <summary>
+			/// The elements of the matrix as a double array, row after row.
+			/// </summary>
+			double elements9[9];
+
+			/// <summary>
+			/// The elements of the matrix as an array of double arrays where the index in the first array is the row and the index in the second array is the column.
+			/// </summary>
+			double elements3x3[3][3];
+		};
+
+		/// <summary>
+		/// Creates a 3 by 3 matrix and initializes all of its elements to 0.
+		/// </summary>
+		constexpr Matrix3x3Double()
+			: Matrix3x3Double(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new 3 by 3 matrix with a specified value for every element.
+		/// </summary>
+		constexpr Matrix3x3Double(
+			double r0c0, double r0c1, double r0c2,
+			double r1c0, double r1c1, double r1c2,
+			double r2c0, double r2c1, double r2c2)
+			: r0c0(r0c0), r0c1(r0c1), r0c2(r0c2),
+			r1c0(r1c0), r1c1(r1c1), r1c2(r1c2),
+			r2c0(r2c0), r2c1(r2c1), r2c2(r2c2)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new 3 by 3 matrix with a specified value for its diagonal elements. The other elements will be initialized to 0.
+		/// </summary>
+		/// <param name="diagonal">The value of the diagonal elements.</param>
+		constexpr Matrix3x3Double(double diagonal)
+			: r0c0(diagonal), r0c1(0), r0c2(0),
+			r1c0(0), r1c1(diagonal), r1c2(0),
+			r2c0(0), r2c1(0), r2c2(diagonal)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new 3 by 3 matrix with the elements of matrix.
+		/// </summary>
+		explicit constexpr Matrix3x3Double(const Matrix3x3& matrix)
+			: r0c0(matrix.r0c0), r0c1(matrix.r0c1), r0c2(matrix.r0c2),
+			r1c0(matrix.r1c0), r1c1(matrix.r1c1), r1c2(matrix.r1c2),
+			r2c0(matrix.r2c0), r2c1(matrix.r2c1), r2c2(matrix.r2c2)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new Matrix3x3 with the elements of this rounded to float.
+		/// </summary>
+		explicit constexpr operator Matrix3x3() const
+		{
+			return Matrix3x3(
+				(float)r0c0, (float)r0c1, (float)r0c2,
+				(float)r1c0, (float)r1c1, (float)r1c2,
+				(float)r2c0, (float)r2c1, (float)r2c2);
+		}
+
+		#pragma region Comparison methods (Equals and CloseEnough).
+		/// <summary>
+		/// Is the distance between each element in this and its corresponding element in other smaller or equal to threshold?
+		/// </summary>
+		constexpr bool CloseEnough(const Matrix3x3Double& other, double threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return
+				Vector3DDouble(r0c0, r0c1, r0c2).CloseEnough(Vector3DDouble(other.r0c0, other.r0c1, other.r0c2), threshold) &&
+				Vector3DDouble(r1c0, r1c1, r1c2).CloseEnough(Vector3DDouble(other.r1c0, other.r1c1, other.r1c2), threshold) &&
+				Vector3DDouble(r2c0, r2c1, r2c2).CloseEnough(Vector3DDouble(other.r2c0, other.r2c1, other.r2c2), threshold);
+		}
+
+		/// <summary>
+		/// Is every element of this the same as its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const Matrix3x3Double& other) const
+		{
+			return
+				r0c0 == other.r0c0 && r0c1 == other.r0c1 && r0c2 == other.r0c2 &&
+				r1c0 == other.r1c0 && r1c1 == other.r1c1 && r1c2 == other.r1c2 &&
+				r2c0 == other.r2c0 && r2c1 == other.r2c1 && r2c2 == other.r2c2;
+		}
+		#pragma endregion
+
+		#pragma region Multiplication.
+		/// <summary>
+		/// Multiplies this matrix by other.
+		/// </summary>
+		constexpr Matrix3x3Double Multiply(const Matrix3x3Double& other) const
+		{
+			return Matrix3x3Double(
+				r0c0 * other.r0c0 + r0c1 * other.r1c0 + r0c2 * other.r2c0,
+				r0c0 * other.r0c1 + r0c1 * other.r1c1 + r0c2 * other.r2c1,
+				r0c0 * other.r0c2 + r0c1 * other.r1c2 + r0c2 * other.r2c2,
+
+				r1c0 * other.r0c0 + r1c1 * other.r1c0 + r1c2 * other.r2c0,
+				r1c0 * other.r0c1 + r1c1 * other.r1c1 + r1c2 * other.r2c1,
+				r1c0 * other.r0c2 + r1c1 * other.r1c2 + r1c2 * other.r2c2,
+
+				r2c0 * other.r0c0 + r2c1 * other.r1c0 + r2c2 * other.r2c0,
+				r2c0 * other.r0c1 + r2c1 * other.r1c1 + r2c2 * other.r2c1,
+				r2c0 * other.r0c2 + r2c1 * other.r1c2 + r2c2 * other.r2c2);
+		}
+
+		/// <summary>
+		/// Multiplies this by vector (where vector is a column vector). This will transform vector.
+		/// </summary>
+		constexpr Vector3DDouble Multiply(const Vector3DDouble& vector) const
+		{
+			return Vector3DDouble(
+				r0c0 * vector.x + r0c1 * vector.y + r0c2 * vector.z,
+				r1c0 * vector.x + r1c1 * vector.y + r1c2 * vector.z,
+				r2c0 * vector.x + r2c1 * vector.y + r2c2 * vector.z);
+		}
+
+		/// <summary>
+		/// Multiplies every element of this by scalar.
+		/// </summary>
+		constexpr Matrix3x3Double Multiply(double scalar) const
+		{
+			return Matrix3x3Double(
+				r0c0 * scalar, r0c1 * scalar, r0c2 * scalar,
+				r1c0 * scalar, r1c1 * scalar, r1c2 * scalar,
+				r2c0 * scalar, r2c1 * scalar, r2c2 * scalar);
+		}
+
+		/// <summary>
+		/// Multiplies matrix by vector (where vector is a column vector). This will transform vector.
+		/// </summary>
+		inline friend constexpr Vector3DDouble operator*(const Matrix3x3Double& matrix, const Vector3DDouble& vector)
+		{
+			return matrix.Multiply(vector);
+		}
+
+		/// <summary>
+		/// Multiplies every element of matrix by scalar.
+		/// </summary>
+		inline friend constexpr Matrix3x3Double operator*(const Matrix3x3Double& matrix, double scalar)
+		{
+			return matrix.Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Multiplies every element of matrix by scalar.
+		/// </summary>
+		inline friend constexpr Matrix3x3Double operator*(double scalar, const Matrix3x3Double& matrix)
+		{
+			return matrix.Multiply(scalar);
+		}
+		#pragma endregion
+
+		#pragma region Addition, subtraction and negation.
+		/// <summary>Adds every element of this to the corresponding element in other.</summary>
+		constexpr Matrix3x3Double Add(const Matrix3x3Double& other) const
+		{
+			return Matrix3x3Double(
+				r0c0 + other.r0c0, r0c1 + other.r0c1, r0c2 + other.r0c2,
+				r1c0 + other.r1c0, r1c1 + other.r1c1, r1c2 + other.r1c2,
+				r2c0 + other.r2c0, r2c1 + other.r2c1, r2c2 + other.r2c2);
+		}
+
+		/// <summary>Subtracts every element of this by the corresponding element in other.</summary>
+		constexpr Matrix3x3Double Subtract(const Matrix3x3Double& other) const
+		{
+			return Matrix3x3Double(
+				r0c0 - other.r0c0, r0c1 - other.r0c1, r0c2 - other.r0c2,
+				r1c0 - other.r1c0, r1c1 - other.r1c1, r1c2 - other.r1c2,
+				r2c0 - other.r2c0, r2c1 - other.r2c1, r2c2 - other.r2c2);
+		}
+
+		/// <summary>
+		/// The matrix with all of its elements negated (multiplied by -1).
+		/// </summary>
+		constexpr Matrix3x3Double Negated() const
+		{
+			return Matrix3x3Double(
+				-r0c0, -r0c1, -r0c2,
+				-r1c0, -r1c1, -r1c2,
+				-r2c0, -r2c1, -r2c2);
+		}
+		#pragma endregion
+
+		#pragma region Transpose, determinant, trace and inverse.
+		/// <summary>
+		/// Gets the transpose (replaced rows with columns and columns with rows) of this matrix.
+		/// </summary>
+		constexpr Matrix3x3Double Transposed() const
+		{
+			return Matrix3x3Double(
+				r0c0, r1c0, r2c0,
+				r0c1, r1c1, r2c1,
+				r0c2, r1c2, r2c2);
+		}
+
+		/// <summary>The determinant (Volume between the vectors of the three columns) of this matrix.</summary>
+		constexpr double Determinant() const
+		{
+			return
+				r0c0 * (r1c1 * r2c2 - r1c2 * r2c1) -
+				r0c1 * (r1c0 * r2c2 - r1c2 * r2c0) +
+				r0c2 * (r1c0 * r2c1 - r1c1 * r2c0);
+		}
+
+		/// <summary>Gest the trace (sum of diagonal elements) of this matrix.</summary>
+		constexpr double Trace() const
+		{
+			return r0c0 + r1c1 + r2c2;
+		}
+
+		/// <summary>
+		/// Gets the multiplicative inverse of this matrix.
+		/// </summary>
+		constexpr Matrix3x3Double Inverted() const
+		{
+			return Matrix3x3Double(
+				r1c1 * r2c2 - r1c2 * r2c1, r0c2 * r2c1 - r0c1 * r2c2, r0c1 * r1c2 - r0c2 * r1c1,
+				r1c2 * r2c0 - r1c0 * r2c2, r0c0 * r2c2 - r0c2 * r2c0, r0c2 * r1c0 - r0c0 * r1c2,
+				r1c0 * r2c1 - r1c1 * r2c0, r0c1 * r2c0 - r0c0 * r2c1, r0c0 * r1c1 - r0c1 * r1c0).Multiply(1 / Determinant());
+		}
+		#pragma endregion
+	};
+} }
\ No newline at end of file
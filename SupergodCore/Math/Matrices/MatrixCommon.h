@@ -4,6 +4,7 @@
 #include "../Interfaces/ArithmeticInterfaces.h"
 #include "../Interfaces/ISupergodEquatable.h"
 #include "../Interfaces/ILerpable.h"
+#include "MatrixViews.h"
 
 // I want to keep the virtual methods here for now, in case I will use it again...even though I doubt it will happen.
 
@@ -39,7 +40,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the transpose of the cofactor matrix.
 		/// </summary>
 		/// <returns></returns>
-		inline T Adjugate() const
+		inline constexpr T Adjugate() const
 		{
 			return TEMPLATED_INTERFACE_THIS.Cofactor().Transposed();
 		}
@@ -48,7 +49,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the multiplicative inverse of this matrix.
 		/// </summary>
 		/// <returns></returns>
-		inline T Inverted() const
+		inline constexpr T Inverted() const
 		{
 			return TEMPLATED_INTERFACE_THIS.Adjugate() / TEMPLATED_INTERFACE_THIS.Determinant();
 		}
@@ -56,7 +57,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Multiplies every element of matrix by scalar.
 		/// </summary>
-		inline friend T operator*(float scalar, const T& matrix)
+		inline friend constexpr T operator*(float scalar, const T& matrix)
 		{
 			return matrix * scalar;
 		}
@@ -79,21 +80,49 @@ namespace SupergodCore { namespace Math
 		//virtual TMatrix ClampRows(const TVector& min, const TVector& max) const = 0;
 		//virtual TMatrix ClampColumns(const TVector& min, const TVector& max) const = 0;
 
+		/// <summary>
+		/// Gets a view of the row at the index of index that reads it in place. Matrices are stored row by row, so the elements of a row are next to each other.
+		/// </summary>
+		inline StridedVectorView<TVector> GetRowView(int index) const
+		{
+			return View(index * SIZE, 1);
+		}
+
+		/// <summary>
+		/// Gets a view of the column at the index of index that reads it in place. Matrices are stored row by row, so the elements of a column are a row apart.
+		/// </summary>
+		inline StridedVectorView<TVector> GetColumnView(int index) const
+		{
+			return View(index, SIZE);
+		}
+
 		/// <summary>
 		/// Multiplies vector by this (where vector is a row vector). This will NOT transform vector.
 		/// </summary>
-		inline friend TVector operator*(const TVector& vector, const TMatrix& matrix)
+		inline friend constexpr TVector operator*(const TVector& vector, const TMatrix& matrix)
 		{
-			return matrix.Transposed().Multiply(vector);
+			return matrix.LeftMultiply(vector);
 		}
 
 		/// <summary>
 		/// Multiplies vector by this (where vector is a row vector). This will NOT transform vector.
 		/// </summary>
-		inline friend TVector operator*(const TMatrix& matrix, const TVector& vector)
+		inline friend constexpr TVector operator*(const TMatrix& matrix, const TVector& vector)
 		{
 			return matrix.Multiply(vector);
 		}
+
+	private:
+		/// <summary>
+		/// The number of rows and columns.
+		/// </summary>
+		static constexpr int SIZE = StridedVectorView<TVector>::COUNT;
+
+		inline StridedVectorView<TVector> View(int firstIndex, int stride) const
+		{
+			static_assert(sizeof(TMatrix) == SIZE * SIZE * sizeof(float), "The views expect the matrix to be only its elements.");
+			return StridedVectorView<TVector>(reinterpret_cast<const float*>(&TEMPLATED_INTERFACE_THIS_CUSTOM_NAME(TMatrix)) + firstIndex, stride);
+		}
 	};
 
 	/// <summary>
@@ -105,7 +134,7 @@ namespace SupergodCore { namespace Math
 		/// Calls the ClampRows method on matrix and passes min as the minimum and max as the maximum.
 		/// </summary>
 		template<class TMatrix, class TVector>
-		inline TMatrix ClampRows(const TMatrix& matrix, const TVector& min, const TVector& max)
+		inline constexpr TMatrix ClampRows(const TMatrix& matrix, const TVector& min, const TVector& max)
 		{
 			return matrix.ClampRows(min, max);
 		}
@@ -114,7 +143,7 @@ namespace SupergodCore { namespace Math
 		/// Calls the ClampColumns method on matrix and passes min as the minimum and max as the maximum.
 		/// </summary>
 		template<class TMatrix, class TVector>
-		inline TMatrix ClampColumns(const TMatrix& matrix, const TVector& min, const TVector& max)
+		inline constexpr TMatrix ClampColumns(const TMatrix& matrix, const TVector& min, const TVector& max)
 		{
 			return matrix.ClampColumns(min, max);
 		}
@@ -123,7 +152,7 @@ namespace SupergodCore { namespace Math
 		/// Gest the Transposed property of matrix.
 		/// </summary>
 		template<class T>
-		inline T Transpose(const T& matrix)
+		inline constexpr T Transpose(const T& matrix)
 		{
 			return matrix.Transposed();
 		}
@@ -132,7 +161,7 @@ namespace SupergodCore { namespace Math
 		/// Gest the Cofactor property of matrix.
 		/// </summary>
 		template<class T>
-		inline T Cofactor(const T& matrix)
+		inline constexpr T Cofactor(const T& matrix)
 		{
 			return matrix.Cofactor();
 		}
@@ -141,7 +170,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the determinant of matrix.
 		/// </summary>
 		template<class T>
-		inline float Det(const T& matrix)
+		inline constexpr float Det(const T& matrix)
 		{
 			return matrix.Determinant();
 		}
@@ -150,7 +179,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the trace of matrix.
 		/// </summary>
 		template<class T>
-		inline float Tr(const T& matrix)
+		inline constexpr float Tr(const T& matrix)
 		{
 			return matrix.Trace();
 		}
@@ -159,7 +188,7 @@ namespace SupergodCore { namespace Math
 		/// Calls teh ClampAxes method of vector and passes min as the minimum and max as the maximum.
 		/// </summary>
 		template<class T>
-		inline T ClampElements(const T& matrix, float min, float max)
+		inline constexpr T ClampElements(const T& matrix, float min, float max)
 		{
 			return matrix.ClampElements(min, max);
 		}
@@ -168,7 +197,7 @@ namespace SupergodCore { namespace Math
 		/// Calls the Abs method of matrix.
 		/// </summary>
 		template<class T>
-		inline T Abs(const T& matrix)
+		inline constexpr T Abs(const T& matrix)
 		{
 			return matrix.Abs();
 		}
@@ -178,7 +207,7 @@ namespace SupergodCore { namespace Math
 		/// Same as the transpose of the cofactor matrix.
 		/// </summary>
 		template<class T>
-		inline T Adjugate(const T& matrix)
+		inline constexpr T Adjugate(const T& matrix)
 		{
 			return matrix.Adjugate();
 		}
@@ -188,7 +217,7 @@ namespace SupergodCore { namespace Math
 		/// Same case when multiplying matrix by the resulting matrix from this method.
 		/// </summary>
 		template<class T>
-		inline T Invert(const T& matrix)
+		inline constexpr T Invert(const T& matrix)
 		{
 			return matrix.Inverted();
 		}
@@ -197,7 +226,7 @@ namespace SupergodCore { namespace Math
 		/// Multiplies vector by this (where vector is a row vector). This will NOT transform vector.
 		/// </summary>
 		template<class TVector, class TMatrix>
-		inline TVector Multiply(const TVector& vector, const TMatrix& matrix)
+		inline constexpr TVector Multiply(const TVector& vector, const TMatrix& matrix)
 		{
 			return vector * matrix;
 		}
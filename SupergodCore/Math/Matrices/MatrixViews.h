@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A row or a column of a matrix read in place instead of copied into a vector: its elements are stride floats apart, starting at first.<para/>
+	/// It points into the matrix, so it can only be used while the matrix exists.
+	/// </summary>
+	template<class TVector>
+	struct StridedVectorView
+	{
+		/// <summary>
+		/// The number of elements, the same as the number of components of TVector.
+		/// </summary>
+		static constexpr int COUNT = sizeof(TVector) / sizeof(float);
+
+		const float* first;
+		int stride;
+
+		constexpr StridedVectorView(const float* first, int stride)
+			: first(first), stride(stride)
+		{
+		}
+
+		/// <summary>
+		/// Gets a reference to the element at index.
+		/// </summary>
+		constexpr const float& operator[](int index) const
+		{
+			return first[index * stride];
+		}
+
+		/// <summary>
+		/// Gets the dot product of the viewed elements and vector, in the same order as TVector::Dot.
+		/// </summary>
+		inline float Dot(const TVector& vector) const
+		{
+			float dot = first[0] * vector[0];
+			for (int i = 1; i < COUNT; i++)
+				dot += first[i * stride] * vector[i];
+			return dot;
+		}
+
+		/// <summary>
+		/// Copies the viewed elements into a vector.
+		/// </summary>
+		inline operator TVector() const
+		{
+			TVector vector;
+			for (int i = 0; i < COUNT; i++)
+				vector[i] = first[i * stride];
+			return vector;
+		}
+	};
+} }
\ No newline at end of file
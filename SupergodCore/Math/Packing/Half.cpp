@@ -0,0 +1,94 @@
+#include "Half.h"
+#include "Common/CpuFeatures.h"
+#include <cstring>
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	static_assert(sizeof(Half) == 2, "The bulk conversions expect Half arrays to be tightly packed.");
+
+	ushort Half::FloatToBits(float value)
+	{
+		uint floatBits;
+		std::memcpy(&floatBits, &value, sizeof(floatBits));
+
+		uint sign = (floatBits >> 16) & 0x8000;
+		floatBits &= 0x7fffffff;
+
+		// Infinity, NaN (kept quiet, with as much of the payload as fits) and everything that overflows the half range.
+		if (floatBits >= 0x47800000)
+			return (ushort)(sign | (floatBits > 0x7f800000 ? 0x7e00 | ((floatBits >> 13) & 0x3ff) : 0x7c00));
+
+		// Values smaller than the smallest normal half become subnormals (or 0).
+		// Adding 0.5 aligns the mantissa so the float addition does the rounding to nearest even for us.
+		if (floatBits < 0x38800000)
+		{
+			float absolute;
+			std::memcpy(&absolute, &floatBits, sizeof(absolute));
+			absolute += .5f;
+
+			uint roundedBits;
+			std::memcpy(&roundedBits, &absolute, sizeof(roundedBits));
+			return (ushort)(sign | (roundedBits - 0x3f000000));
+		}
+
+		// Normal values: rebias the exponent and round the 13 mantissa bits that are cut off to nearest even.
+		uint oddMantissa = (floatBits >> 13) & 1;
+		floatBits += 0xc8000fff + oddMantissa;
+		return (ushort)(sign | (floatBits >> 13));
+	}
+
+	float Half::BitsToFloat(ushort bits)
+	{
+		const uint shiftedExponent = 0x7c00 << 13;
+
+		uint floatBits = (bits & 0x7fff) << 13;
+		uint exponent = floatBits & shiftedExponent;
+		floatBits += (127 - 15) << 23;
+
+		float value;
+		if (exponent == shiftedExponent)
+		{
+			// Infinity or NaN.
+			floatBits += (128 - 16) << 23;
+			std::memcpy(&value, &floatBits, sizeof(value));
+		}
+		else if (exponent == 0)
+		{
+			// Subnormal, renormalized by letting the float subtraction do the work.
+			floatBits += 1 << 23;
+			std::memcpy(&value, &floatBits, sizeof(value));
+			value -= 6.103515625e-05f;
+		}
+		else
+			std::memcpy(&value, &floatBits, sizeof(value));
+
+		return (bits & 0x8000) != 0 ? -value : value;
+	}
+
+	void Half::Pack(const float* source, Half* destination, size_t count)
+	{
+		size_t i = 0;
+		if (CpuFeatures::HasF16C())
+		{
+			for (; i + 4 <= count; i += 4)
+				_mm_storel_epi64((__m128i*)(destination + i), _mm_cvtps_ph(_mm_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		for (; i < count; i++)
+			destination[i].bits = FloatToBits(source[i]);
+	}
+
+	void Half::Unpack(const Half* source, float* destination, size_t count)
+	{
+		size_t i = 0;
+		if (CpuFeatures::HasF16C())
+		{
+			for (; i + 4 <= count; i += 4)
+				_mm_storeu_ps(destination + i, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)(source + i))));
+		}
+
+		for (; i < count; i++)
+			destination[i] = BitsToFloat(source[i].bits);
+	}
+} }
\ No newline at end of file
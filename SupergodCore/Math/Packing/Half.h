@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../Interfaces/ISupergodEquatable.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Represents an IEEE 754 half precision (16-bit) float. Used to store values that don't need the precision of a float, like vertex attributes, with half the memory.<para/>
+	/// Arithmetic should be done on floats, so convert to float, do the math and convert back.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Half final : public ISupergodEquatable<Half>
+	{
+		#pragma region Presets for common values.
+		/// <summary>Gets a half with the value of 0.</summary>
+		inline static constexpr Half Zero() { return FromBits(0); }
+
+		/// <summary>Gets a half with the value of 1.</summary>
+		inline static constexpr Half One() { return FromBits(0x3c00); }
+
+		/// <summary>Gets the biggest finite value a half can hold (65504).</summary>
+		inline static constexpr Half Max() { return FromBits(0x7bff); }
+
+		/// <summary>Gets a half with the value of positive infinity.</summary>
+		inline static constexpr Half Infinity() { return FromBits(0x7c00); }
+		#pragma endregion
+
+		/// <summary>
+		/// The raw bits of the half: 1 sign bit, 5 exponent bits and 10 mantissa bits.
+		/// </summary>
+		ushort bits;
+
+		/// <summary>
+		/// Creates a new half with the value of 0.
+		/// </summary>
+		constexpr Half()
+			: bits(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new half with value rounded to the nearest half (ties to even). Values that are too big become infinity.
+		/// </summary>
+		explicit Half(float value)
+			: bits(FloatToBits(value))
+		{
+		}
+
+		/// <summary>
+		/// Creates a new half from its raw bits.
+		/// </summary>
+		inline static constexpr Half FromBits(ushort bits)
+		{
+			Half half;
+			half.bits = bits;
+			return half;
+		}
+
+		/// <summary>
+		/// Gets the value of this as a float. This is exact, every half can be represented by a float.
+		/// </summary>
+		inline operator float() const
+		{
+			return BitsToFloat(bits);
+		}
+
+		/// <summary>
+		/// Are the bits of this the same as the bits of other?<para/>
+		/// Note that this compares the bits, so 0 and -0 are different and a NaN is equal to itself.
+		/// </summary>
+		constexpr bool Equals(const Half& other) const
+		{
+			return bits == other.bits;
+		}
+
+		/// <summary>
+		/// Is this not a number?
+		/// </summary>
+		constexpr bool IsNaN() const
+		{
+			return (bits & 0x7c00) == 0x7c00 && (bits & 0x3ff) != 0;
+		}
+
+		#pragma region Conversions.
+		/// <summary>
+		/// Gets the bits of value rounded to the nearest half (ties to even).
+		/// </summary>
+		static ushort FloatToBits(float value);
+
+		/// <summary>
+		/// Gets the float value of the half with the bits of bits.
+		/// </summary>
+		static float BitsToFloat(ushort bits);
+
+		/// <summary>
+		/// Converts count floats to halves. Uses F16C when the CPU supports it.<para/>
+		/// To pack vectors, pass their components (for example vectors->components and count * 3 for Vector3D).
+		/// </summary>
+		static void Pack(const float* source, Half* destination, size_t count);
+
+		/// <summary>
+		/// Converts count halves to floats. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Unpack(const Half* source, float* destination, size_t count);
+		#pragma endregion
+	};
+} }
\ No newline at end of file
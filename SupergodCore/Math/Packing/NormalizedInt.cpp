@@ -0,0 +1,223 @@
+#include "NormalizedInt.h"
+#include "../SMath.h"
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	// The scalar functions round with cvtss2si, the same instruction the bulk functions use, so both give the same results.
+
+	/// <summary>
+	/// Rounds value to the nearest integer (ties to even).
+	/// </summary>
+	static inline int RoundToInt(float value)
+	{
+		return _mm_cvtss_si32(_mm_set_ss(value));
+	}
+
+	#pragma region Single values.
+	byte NormalizedInt::PackUnorm8(float value)
+	{
+		return (byte)RoundToInt(SMath::Clamp(value, 0, 1) * 255);
+	}
+
+	ushort NormalizedInt::PackUnorm16(float value)
+	{
+		return (ushort)RoundToInt(SMath::Clamp(value, 0, 1) * 65535);
+	}
+
+	sbyte NormalizedInt::PackSnorm8(float value)
+	{
+		return (sbyte)RoundToInt(SMath::Clamp(value, -1, 1) * 127);
+	}
+
+	short NormalizedInt::PackSnorm16(float value)
+	{
+		return (short)RoundToInt(SMath::Clamp(value, -1, 1) * 32767);
+	}
+
+	float NormalizedInt::UnpackUnorm8(byte value)
+	{
+		return value * (1.f / 255);
+	}
+
+	float NormalizedInt::UnpackUnorm16(ushort value)
+	{
+		return value * (1.f / 65535);
+	}
+
+	float NormalizedInt::UnpackSnorm8(sbyte value)
+	{
+		return SMath::Max(value * (1.f / 127), -1.f);
+	}
+
+	float NormalizedInt::UnpackSnorm16(short value)
+	{
+		return SMath::Max(value * (1.f / 32767), -1.f);
+	}
+	#pragma endregion
+
+	#pragma region Bulk.
+	/// <summary>
+	/// Loads 4 floats, clamps them between min and max, scales them and rounds them to ints.
+	/// </summary>
+	static inline __m128i LoadScaled(const float* source, __m128 min, __m128 max, __m128 scale)
+	{
+		return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(source), min), max), scale));
+	}
+
+	void NormalizedInt::PackUnorm8(const float* source, byte* destination, size_t count)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 one = _mm_set1_ps(1);
+		__m128 scale = _mm_set1_ps(255);
+
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i first = _mm_packs_epi32(LoadScaled(source + i, zero, one, scale), LoadScaled(source + i + 4, zero, one, scale));
+			__m128i second = _mm_packs_epi32(LoadScaled(source + i + 8, zero, one, scale), LoadScaled(source + i + 12, zero, one, scale));
+			_mm_storeu_si128((__m128i*)(destination + i), _mm_packus_epi16(first, second));
+		}
+
+		for (; i < count; i++)
+			destination[i] = PackUnorm8(source[i]);
+	}
+
+	void NormalizedInt::PackUnorm16(const float* source, ushort* destination, size_t count)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 one = _mm_set1_ps(1);
+		__m128 scale = _mm_set1_ps(65535);
+
+		// SSE2 only has a signed saturating pack, so the values are moved to the signed range and back.
+		__m128i bias32 = _mm_set1_epi32(32768);
+		__m128i bias16 = _mm_set1_epi16(-32768);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i low = _mm_sub_epi32(LoadScaled(source + i, zero, one, scale), bias32);
+			__m128i high = _mm_sub_epi32(LoadScaled(source + i + 4, zero, one, scale), bias32);
+			_mm_storeu_si128((__m128i*)(destination + i), _mm_xor_si128(_mm_packs_epi32(low, high), bias16));
+		}
+
+		for (; i < count; i++)
+			destination[i] = PackUnorm16(source[i]);
+	}
+
+	void NormalizedInt::PackSnorm8(const float* source, sbyte* destination, size_t count)
+	{
+		__m128 minusOne = _mm_set1_ps(-1);
+		__m128 one = _mm_set1_ps(1);
+		__m128 scale = _mm_set1_ps(127);
+
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i first = _mm_packs_epi32(LoadScaled(source + i, minusOne, one, scale), LoadScaled(source + i + 4, minusOne, one, scale));
+			__m128i second = _mm_packs_epi32(LoadScaled(source + i + 8, minusOne, one, scale), LoadScaled(source + i + 12, minusOne, one, scale));
+			_mm_storeu_si128((__m128i*)(destination + i), _mm_packs_epi16(first, second));
+		}
+
+		for (; i < count; i++)
+			destination[i] = PackSnorm8(source[i]);
+	}
+
+	void NormalizedInt::PackSnorm16(const float* source, short* destination, size_t count)
+	{
+		__m128 minusOne = _mm_set1_ps(-1);
+		__m128 one = _mm_set1_ps(1);
+		__m128 scale = _mm_set1_ps(32767);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i low = LoadScaled(source + i, minusOne, one, scale);
+			__m128i high = LoadScaled(source + i + 4, minusOne, one, scale);
+			_mm_storeu_si128((__m128i*)(destination + i), _mm_packs_epi32(low, high));
+		}
+
+		for (; i < count; i++)
+			destination[i] = PackSnorm16(source[i]);
+	}
+
+	void NormalizedInt::UnpackUnorm8(const byte* source, float* destination, size_t count)
+	{
+		__m128i zero = _mm_setzero_si128();
+		__m128 scale = _mm_set1_ps(1.f / 255);
+
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i bytes = _mm_loadu_si128((const __m128i*)(source + i));
+			__m128i low = _mm_unpacklo_epi8(bytes, zero);
+			__m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+			_mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+			_mm_storeu_ps(destination + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+			_mm_storeu_ps(destination + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+			_mm_storeu_ps(destination + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+		}
+
+		for (; i < count; i++)
+			destination[i] = UnpackUnorm8(source[i]);
+	}
+
+	void NormalizedInt::UnpackUnorm16(const ushort* source, float* destination, size_t count)
+	{
+		__m128i zero = _mm_setzero_si128();
+		__m128 scale = _mm_set1_ps(1.f / 65535);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i values = _mm_loadu_si128((const __m128i*)(source + i));
+			_mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(values, zero)), scale));
+			_mm_storeu_ps(destination + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(values, zero)), scale));
+		}
+
+		for (; i < count; i++)
+			destination[i] = UnpackUnorm16(source[i]);
+	}
+
+	void NormalizedInt::UnpackSnorm8(const sbyte* source, float* destination, size_t count)
+	{
+		__m128 scale = _mm_set1_ps(1.f / 127);
+		__m128 minusOne = _mm_set1_ps(-1);
+
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			// Sign extension: put every value in the high part of a wider lane and shift it back arithmetically.
+			__m128i bytes = _mm_loadu_si128((const __m128i*)(source + i));
+			__m128i low = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+			__m128i high = _mm_srai_epi16(_mm_unpackhi_epi8(bytes, bytes), 8);
+
+			_mm_storeu_ps(destination + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(low, low), 16)), scale), minusOne));
+			_mm_storeu_ps(destination + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(low, low), 16)), scale), minusOne));
+			_mm_storeu_ps(destination + i + 8, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(high, high), 16)), scale), minusOne));
+			_mm_storeu_ps(destination + i + 12, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(high, high), 16)), scale), minusOne));
+		}
+
+		for (; i < count; i++)
+			destination[i] = UnpackSnorm8(source[i]);
+	}
+
+	void NormalizedInt::UnpackSnorm16(const short* source, float* destination, size_t count)
+	{
+		__m128 scale = _mm_set1_ps(1.f / 32767);
+		__m128 minusOne = _mm_set1_ps(-1);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i values = _mm_loadu_si128((const __m128i*)(source + i));
+			_mm_storeu_ps(destination + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16)), scale), minusOne));
+			_mm_storeu_ps(destination + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16)), scale), minusOne));
+		}
+
+		for (; i < count; i++)
+			destination[i] = UnpackSnorm16(source[i]);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
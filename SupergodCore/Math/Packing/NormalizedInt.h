@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Functions that store floats as normalized integers:<para/>
+	/// unorm maps [0, 1] to [0, 255] (8-bit) or [0, 65535] (16-bit), snorm maps [-1, 1] to [-127, 127] (8-bit) or [-32767, 32767] (16-bit).<para/>
+	/// Values out of range are clamped and values are rounded to the nearest integer (ties to even).<para/>
+	/// The bulk functions work on streams of floats, so to pack vectors or colors, pass their components (for example vectors->components and count * 3 for Vector3D).
+	/// </summary>
+	namespace NormalizedInt
+	{
+		#pragma region Single values.
+		/// <summary>Packs value from [0, 1] to [0, 255].</summary>
+		SUPERGOD_API_FUNC byte PackUnorm8(float value);
+
+		/// <summary>Packs value from [0, 1] to [0, 65535].</summary>
+		SUPERGOD_API_FUNC ushort PackUnorm16(float value);
+
+		/// <summary>Packs value from [-1, 1] to [-127, 127].</summary>
+		SUPERGOD_API_FUNC sbyte PackSnorm8(float value);
+
+		/// <summary>Packs value from [-1, 1] to [-32767, 32767].</summary>
+		SUPERGOD_API_FUNC short PackSnorm16(float value);
+
+		/// <summary>Unpacks value from [0, 255] to [0, 1].</summary>
+		SUPERGOD_API_FUNC float UnpackUnorm8(byte value);
+
+		/// <summary>Unpacks value from [0, 65535] to [0, 1].</summary>
+		SUPERGOD_API_FUNC float UnpackUnorm16(ushort value);
+
+		/// <summary>Unpacks value from [-127, 127] to [-1, 1]. -128 is treated as -127.</summary>
+		SUPERGOD_API_FUNC float UnpackSnorm8(sbyte value);
+
+		/// <summary>Unpacks value from [-32767, 32767] to [-1, 1]. -32768 is treated as -32767.</summary>
+		SUPERGOD_API_FUNC float UnpackSnorm16(short value);
+		#pragma endregion
+
+		#pragma region Bulk (SSE2).
+		/// <summary>Packs count floats from [0, 1] to [0, 255].</summary>
+		SUPERGOD_API_FUNC void PackUnorm8(const float* source, byte* destination, size_t count);
+
+		/// <summary>Packs count floats from [0, 1] to [0, 65535].</summary>
+		SUPERGOD_API_FUNC void PackUnorm16(const float* source, ushort* destination, size_t count);
+
+		/// <summary>Packs count floats from [-1, 1] to [-127, 127].</summary>
+		SUPERGOD_API_FUNC void PackSnorm8(const float* source, sbyte* destination, size_t count);
+
+		/// <summary>Packs count floats from [-1, 1] to [-32767, 32767].</summary>
+		SUPERGOD_API_FUNC void PackSnorm16(const float* source, short* destination, size_t count);
+
+		/// <summary>Unpacks count values from [0, 255] to [0, 1].</summary>
+		SUPERGOD_API_FUNC void UnpackUnorm8(const byte* source, float* destination, size_t count);
+
+		/// <summary>Unpacks count values from [0, 65535] to [0, 1].</summary>
+		SUPERGOD_API_FUNC void UnpackUnorm16(const ushort* source, float* destination, size_t count);
+
+		/// <summary>Unpacks count values from [-127, 127] to [-1, 1].</summary>
+		SUPERGOD_API_FUNC void UnpackSnorm8(const sbyte* source, float* destination, size_t count);
+
+		/// <summary>Unpacks count values from [-32767, 32767] to [-1, 1].</summary>
+		SUPERGOD_API_FUNC void UnpackSnorm16(const short* source, float* destination, size_t count);
+		#pragma endregion
+	}
+} }
\ No newline at end of file
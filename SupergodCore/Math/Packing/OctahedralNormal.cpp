@@ -0,0 +1,138 @@
+#include "OctahedralNormal.h"
+#include "NormalizedInt.h"
+#include <cmath>
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Math
+{
+	// The bulk functions do exactly the same operations as the scalar ones (in the same order), so they give the same results unless the compiler contracts the scalar ones into fused multiply-adds.
+
+	static_assert(sizeof(OctahedralNormal) == 4, "The bulk functions expect OctahedralNormal arrays to be tightly packed.");
+
+	OctahedralNormal::OctahedralNormal(const Vector3D& normal)
+	{
+		float inverseL1 = 1 / (SMath::Abs(normal.x) + SMath::Abs(normal.y) + SMath::Abs(normal.z));
+		float octahedronX = normal.x * inverseL1;
+		float octahedronY = normal.y * inverseL1;
+
+		// The lower half of the octahedron is folded over the diagonals of the square.
+		if (normal.z < 0)
+		{
+			float foldedX = (1 - SMath::Abs(octahedronY)) * (octahedronX >= 0 ? 1 : -1);
+			float foldedY = (1 - SMath::Abs(octahedronX)) * (octahedronY >= 0 ? 1 : -1);
+			octahedronX = foldedX;
+			octahedronY = foldedY;
+		}
+
+		x = NormalizedInt::PackSnorm16(octahedronX);
+		y = NormalizedInt::PackSnorm16(octahedronY);
+	}
+
+	OctahedralNormal::operator Vector3D() const
+	{
+		float decodedX = NormalizedInt::UnpackSnorm16(x);
+		float decodedY = NormalizedInt::UnpackSnorm16(y);
+		float decodedZ = 1 - SMath::Abs(decodedX) - SMath::Abs(decodedY);
+
+		float fold = SMath::Max(-decodedZ, 0.f);
+		decodedX += decodedX >= 0 ? -fold : fold;
+		decodedY += decodedY >= 0 ? -fold : fold;
+
+		float inverseLength = 1 / std::sqrt(decodedX * decodedX + decodedY * decodedY + decodedZ * decodedZ);
+		return Vector3D(decodedX * inverseLength, decodedY * inverseLength, decodedZ * inverseLength);
+	}
+
+	/// <summary>
+	/// Gets the absolute value of every lane of value.
+	/// </summary>
+	static inline __m128 Abs(__m128 value)
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.f), value);
+	}
+
+	/// <summary>
+	/// Negates every lane of value.
+	/// </summary>
+	static inline __m128 Negate(__m128 value)
+	{
+		return _mm_xor_ps(_mm_set1_ps(-0.f), value);
+	}
+
+	/// <summary>
+	/// Picks ifTrue for the lanes where mask is set and ifFalse for the rest.
+	/// </summary>
+	static inline __m128 Select(__m128 mask, __m128 ifTrue, __m128 ifFalse)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+	}
+
+	void OctahedralNormal::Pack(const Vector3D* source, OctahedralNormal* destination, size_t count)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 one = _mm_set1_ps(1);
+		__m128 minusOne = _mm_set1_ps(-1);
+		__m128 scale = _mm_set1_ps(32767);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const Vector3D* normals = source + i;
+			__m128 normalX = _mm_setr_ps(normals[0].x, normals[1].x, normals[2].x, normals[3].x);
+			__m128 normalY = _mm_setr_ps(normals[0].y, normals[1].y, normals[2].y, normals[3].y);
+			__m128 normalZ = _mm_setr_ps(normals[0].z, normals[1].z, normals[2].z, normals[3].z);
+
+			__m128 inverseL1 = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(Abs(normalX), Abs(normalY)), Abs(normalZ)));
+			__m128 octahedronX = _mm_mul_ps(normalX, inverseL1);
+			__m128 octahedronY = _mm_mul_ps(normalY, inverseL1);
+
+			__m128 foldedX = _mm_mul_ps(_mm_sub_ps(one, Abs(octahedronY)), Select(_mm_cmpge_ps(octahedronX, zero), one, minusOne));
+			__m128 foldedY = _mm_mul_ps(_mm_sub_ps(one, Abs(octahedronX)), Select(_mm_cmpge_ps(octahedronY, zero), one, minusOne));
+			__m128 lowerHalf = _mm_cmplt_ps(normalZ, zero);
+			octahedronX = Select(lowerHalf, foldedX, octahedronX);
+			octahedronY = Select(lowerHalf, foldedY, octahedronY);
+
+			__m128i encodedX = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(octahedronX, minusOne), one), scale));
+			__m128i encodedY = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(octahedronY, minusOne), one), scale));
+			__m128i encoded = _mm_or_si128(_mm_and_si128(encodedX, _mm_set1_epi32(0xffff)), _mm_slli_epi32(encodedY, 16));
+			_mm_storeu_si128((__m128i*)(destination + i), encoded);
+		}
+
+		for (; i < count; i++)
+			destination[i] = OctahedralNormal(source[i]);
+	}
+
+	void OctahedralNormal::Unpack(const OctahedralNormal* source, Vector3D* destination, size_t count)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 one = _mm_set1_ps(1);
+		__m128 minusOne = _mm_set1_ps(-1);
+		__m128 scale = _mm_set1_ps(1.f / 32767);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			// Every 32-bit lane holds x in its low half and y in its high half, the shifts sign extend them.
+			__m128i encoded = _mm_loadu_si128((const __m128i*)(source + i));
+			__m128 decodedX = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(encoded, 16), 16)), scale), minusOne);
+			__m128 decodedY = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(encoded, 16)), scale), minusOne);
+			__m128 decodedZ = _mm_sub_ps(_mm_sub_ps(one, Abs(decodedX)), Abs(decodedY));
+
+			__m128 fold = _mm_max_ps(Negate(decodedZ), zero);
+			decodedX = _mm_add_ps(decodedX, Select(_mm_cmpge_ps(decodedX, zero), Negate(fold), fold));
+			decodedY = _mm_add_ps(decodedY, Select(_mm_cmpge_ps(decodedY, zero), Negate(fold), fold));
+
+			__m128 squaredLength = _mm_add_ps(_mm_add_ps(_mm_mul_ps(decodedX, decodedX), _mm_mul_ps(decodedY, decodedY)), _mm_mul_ps(decodedZ, decodedZ));
+			__m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(squaredLength));
+
+			float xs[4], ys[4], zs[4];
+			_mm_storeu_ps(xs, _mm_mul_ps(decodedX, inverseLength));
+			_mm_storeu_ps(ys, _mm_mul_ps(decodedY, inverseLength));
+			_mm_storeu_ps(zs, _mm_mul_ps(decodedZ, inverseLength));
+			for (int j = 0; j < 4; j++)
+				destination[i + j] = Vector3D(xs[j], ys[j], zs[j]);
+		}
+
+		for (; i < count; i++)
+			destination[i] = source[i];
+	}
+} }
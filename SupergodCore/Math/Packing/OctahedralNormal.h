@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../Interfaces/ISupergodEquatable.h"
+#include "../Vectors/Vector3D.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A unit vector stored with octahedral encoding in 2 snorm16 components (4 bytes instead of 12).<para/>
+	/// The sphere is projected onto an octahedron which is unfolded into a square, so the precision is spread evenly over all directions (the error is smaller than 0.0001 radians).
+	/// </summary>
+	struct SUPERGOD_API_CLASS OctahedralNormal final : public ISupergodEquatable<OctahedralNormal>
+	{
+		/// <summary>
+		/// The encoded coordinates on the unfolded octahedron, from -32767 to 32767.
+		/// </summary>
+		short x, y;
+
+		/// <summary>
+		/// Creates a new encoded normal pointing at (0, 0, 1).
+		/// </summary>
+		constexpr OctahedralNormal()
+			: x(0), y(0)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new encoded normal from the raw encoded coordinates.
+		/// </summary>
+		constexpr OctahedralNormal(short x, short y)
+			: x(x), y(y)
+		{
+		}
+
+		/// <summary>
+		/// Encodes normal. It doesn't have to be normalized, but it can't be (0, 0, 0).
+		/// </summary>
+		explicit OctahedralNormal(const Vector3D& normal);
+
+		/// <summary>
+		/// Decodes this into a unit vector.
+		/// </summary>
+		operator Vector3D() const;
+
+		/// <summary>
+		/// Are the encoded coordinates of this the same as the encoded coordinates of other?
+		/// </summary>
+		constexpr bool Equals(const OctahedralNormal& other) const
+		{
+			return x == other.x && y == other.y;
+		}
+
+		/// <summary>
+		/// Encodes count normals (SSE2).
+		/// </summary>
+		static void Pack(const Vector3D* source, OctahedralNormal* destination, size_t count);
+
+		/// <summary>
+		/// Decodes count normals into unit vectors (SSE2).
+		/// </summary>
+		static void Unpack(const OctahedralNormal* source, Vector3D* destination, size_t count);
+	};
+} }
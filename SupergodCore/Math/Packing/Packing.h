@@ -0,0 +1,7 @@
+#pragma once
+
+#include "Half.h"
+#include "Vector3DHalf.h"
+#include "Vector4DHalf.h"
+#include "NormalizedInt.h"
+#include "OctahedralNormal.h"
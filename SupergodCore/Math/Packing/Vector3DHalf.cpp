@@ -0,0 +1,18 @@
+#include "Vector3DHalf.h"
+
+namespace SupergodCore { namespace Math
+{
+	static_assert(sizeof(Vector3DHalf) == sizeof(Half) * 3, "Vector3DHalf arrays are converted as flat arrays of halves.");
+
+	void Vector3DHalf::Pack(const Vector3D* source, Vector3DHalf* destination, size_t count)
+	{
+		if (count != 0)
+			Half::Pack(source->components, (Half*)destination, count * 3);
+	}
+
+	void Vector3DHalf::Unpack(const Vector3DHalf* source, Vector3D* destination, size_t count)
+	{
+		if (count != 0)
+			Half::Unpack((const Half*)source, destination->components, count * 3);
+	}
+} }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Half.h"
+#include "../Vectors/Vector3D.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A 3D vector stored as 3 halves (6 bytes instead of 12). Meant for storage (vertex buffers, snapshots), convert to Vector3D to do math.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Vector3DHalf final : public ISupergodEquatable<Vector3DHalf>
+	{
+		Half x, y, z;
+
+		/// <summary>Creates a new half vector and initializes all of its components to 0.</summary>
+		constexpr Vector3DHalf()
+			: x(), y(), z()
+		{
+		}
+
+		/// <summary>Creates a new half vector and initializes its components to x, y and z.</summary>
+		constexpr Vector3DHalf(Half x, Half y, Half z)
+			: x(x), y(y), z(z)
+		{
+		}
+
+		/// <summary>Creates a new half vector with the components of vector rounded to the nearest half.</summary>
+		explicit Vector3DHalf(const Vector3D& vector)
+			: x(vector.x), y(vector.y), z(vector.z)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new Vector3D with the components of this.
+		/// </summary>
+		inline operator Vector3D() const
+		{
+			return Vector3D(x, y, z);
+		}
+
+		/// <summary>
+		/// Are the bits of every component of this the same as the bits of its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const Vector3DHalf& other) const
+		{
+			return x.Equals(other.x) && y.Equals(other.y) && z.Equals(other.z);
+		}
+
+		/// <summary>
+		/// Converts count vectors to half vectors. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Pack(const Vector3D* source, Vector3DHalf* destination, size_t count);
+
+		/// <summary>
+		/// Converts count half vectors to vectors. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Unpack(const Vector3DHalf* source, Vector3D* destination, size_t count);
+	};
+} }
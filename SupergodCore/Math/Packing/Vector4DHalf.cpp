@@ -0,0 +1,30 @@
+#include "Vector4DHalf.h"
+
+namespace SupergodCore { namespace Math
+{
+	static_assert(sizeof(Vector4DHalf) == sizeof(Half) * 4, "Vector4DHalf arrays are converted as flat arrays of halves.");
+
+	void Vector4DHalf::Pack(const Vector4D* source, Vector4DHalf* destination, size_t count)
+	{
+		if (count != 0)
+			Half::Pack(source->components, (Half*)destination, count * 4);
+	}
+
+	void Vector4DHalf::Pack(const FColor* source, Vector4DHalf* destination, size_t count)
+	{
+		if (count != 0)
+			Half::Pack(source->components, (Half*)destination, count * 4);
+	}
+
+	void Vector4DHalf::Unpack(const Vector4DHalf* source, Vector4D* destination, size_t count)
+	{
+		if (count != 0)
+			Half::Unpack((const Half*)source, destination->components, count * 4);
+	}
+
+	void Vector4DHalf::Unpack(const Vector4DHalf* source, FColor* destination, size_t count)
+	{
+		if (count != 0)
+			Half::Unpack((const Half*)source, destination->components, count * 4);
+	}
+} }
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Half.h"
+#include "../Vectors/Vector4D.h"
+#include "../Colors/FColor.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A 4D vector (or a color) stored as 4 halves (8 bytes instead of 16). Meant for storage (vertex buffers, HDR colors), convert to Vector4D or FColor to do math.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Vector4DHalf final : public ISupergodEquatable<Vector4DHalf>
+	{
+		Half x, y, z, w;
+
+		/// <summary>Creates a new half vector and initializes all of its components to 0.</summary>
+		constexpr Vector4DHalf()
+			: x(), y(), z(), w()
+		{
+		}
+
+		/// <summary>Creates a new half vector and initializes its components to x, y, z and w.</summary>
+		constexpr Vector4DHalf(Half x, Half y, Half z, Half w)
+			: x(x), y(y), z(z), w(w)
+		{
+		}
+
+		/// <summary>Creates a new half vector with the components of vector rounded to the nearest half.</summary>
+		explicit Vector4DHalf(const Vector4D& vector)
+			: x(vector.x), y(vector.y), z(vector.z), w(vector.w)
+		{
+		}
+
+		/// <summary>Creates a new half vector with red, green, blue and alpha of color (in that order) rounded to the nearest half.</summary>
+		explicit Vector4DHalf(const FColor& color)
+			: x(color.red), y(color.green), z(color.blue), w(color.alpha)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new Vector4D with the components of this.
+		/// </summary>
+		inline operator Vector4D() const
+		{
+			return Vector4D(x, y, z, w);
+		}
+
+		/// <summary>
+		/// Creates a new color where red, green, blue and alpha are x, y, z and w.
+		/// </summary>
+		inline explicit operator FColor() const
+		{
+			return FColor(x, y, z, w);
+		}
+
+		/// <summary>
+		/// Are the bits of every component of this the same as the bits of its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const Vector4DHalf& other) const
+		{
+			return x.Equals(other.x) && y.Equals(other.y) && z.Equals(other.z) && w.Equals(other.w);
+		}
+
+		#pragma region Bulk conversions.
+		/// <summary>
+		/// Converts count vectors to half vectors. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Pack(const Vector4D* source, Vector4DHalf* destination, size_t count);
+
+		/// <summary>
+		/// Converts count colors to half vectors. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Pack(const FColor* source, Vector4DHalf* destination, size_t count);
+
+		/// <summary>
+		/// Converts count half vectors to vectors. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Unpack(const Vector4DHalf* source, Vector4D* destination, size_t count);
+
+		/// <summary>
+		/// Converts count half vectors to colors. Uses F16C when the CPU supports it.
+		/// </summary>
+		static void Unpack(const Vector4DHalf* source, FColor* destination, size_t count);
+		#pragma endregion
+	};
+} }
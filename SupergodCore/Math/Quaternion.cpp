@@ -0,0 +1,76 @@
+#include "Quaternion.h"
+#include "SMath.h"
+
+namespace SupergodCore { namespace Math
+{
+	Quaternion Quaternion::FromAxisAngle(const Vector3D& axis, Angle angle)
+	{
+		float halfAngle = angle.GetRadians() * .5f;
+		float sin = SMath::Sin(halfAngle);
+		return Quaternion(axis.x * sin, axis.y * sin, axis.z * sin, SMath::Cos(halfAngle));
+	}
+
+	Matrix3x3 Quaternion::ToMatrix() const
+	{
+		float xx = x * x, yy = y * y, zz = z * z;
+		float xy = x * y, xz = x * z, yz = y * z;
+		float wx = w * x, wy = w * y, wz = w * z;
+
+		return Matrix3x3(
+			1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy),
+			2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx),
+			2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy));
+	}
+
+	float Quaternion::Magnitude() const
+	{
+		return SMath::Sqrt(Dot(*this));
+	}
+
+	Quaternion Quaternion::Normalized() const
+	{
+		float magnitude = Magnitude();
+		if (magnitude == 0)
+			return Identity();
+
+		return Scaled(1 / magnitude);
+	}
+
+	Quaternion Quaternion::Integrate(const Vector3D& angularVelocity, float deltaTime) const
+	{
+		Quaternion spin = Quaternion(angularVelocity.x, angularVelocity.y, angularVelocity.z, 0).Multiply(*this).Scaled(deltaTime * .5f);
+		return Quaternion(x + spin.x, y + spin.y, z + spin.z, w + spin.w).Normalized();
+	}
+
+	Quaternion Quaternion::Slerp(const Quaternion& target, float alpha, bool clampAlpha) const
+	{
+		if (clampAlpha)
+			alpha = SMath::Clamp(alpha, 0, 1);
+
+		// Going to -target instead of target when they are more than half a turn apart takes the short way around.
+		float cos = Dot(target);
+		Quaternion end = cos < 0 ? target.Scaled(-1) : target;
+		cos = SMath::Abs(cos);
+
+		float sourceWeight, targetWeight;
+		if (cos > .9995f)
+		{
+			// The sine below gets too close to 0, and the arc is straight enough for a normalized lerp.
+			sourceWeight = 1 - alpha;
+			targetWeight = alpha;
+		}
+		else
+		{
+			float angle = SMath::Acos(cos);
+			float inverseSin = 1 / SMath::Sin(angle);
+			sourceWeight = SMath::Sin((1 - alpha) * angle) * inverseSin;
+			targetWeight = SMath::Sin(alpha * angle) * inverseSin;
+		}
+
+		return Quaternion(
+			x * sourceWeight + end.x * targetWeight,
+			y * sourceWeight + end.y * targetWeight,
+			z * sourceWeight + end.z * targetWeight,
+			w * sourceWeight + end.w * targetWeight).Normalized();
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Interfaces/ISupergodEquatable.h"
+#include "Interfaces/ArithmeticInterfaces.h"
+#include "Vectors/Vector3D.h"
+#include "Matrices/Matrix3x3.h"
+#include "Angle.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// A rotation in 3D space as a unit quaternion x * i + y * j + z * k + w.<para/>
+	/// Multiplying a * b gives the rotation that first rotates by b and then by a, the same order as multiplying rotation matrices.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Quaternion final : public ISupergodEquatable<Quaternion>, public IMultipliable<Quaternion>
+	{
+		/// <summary>
+		/// Gets the quaternion that doesn't rotate (0, 0, 0, 1).
+		/// </summary>
+		inline static constexpr Quaternion Identity() { return Quaternion(0, 0, 0, 1); }
+
+		float x, y, z, w;
+
+		/// <summary>
+		/// Creates the identity quaternion.
+		/// </summary>
+		constexpr Quaternion()
+			: x(0), y(0), z(0), w(1)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new quaternion and initializes its components to x, y, z and w. Rotations have to be unit quaternions.
+		/// </summary>
+		constexpr Quaternion(float x, float y, float z, float w)
+			: x(x), y(y), z(z), w(w)
+		{
+		}
+
+		/// <summary>
+		/// Creates a rotation of angle around axis (counterclockwise when looking at the axis pointing at you).
+		/// </summary>
+		/// <param name="axis">A unit vector.</param>
+		static Quaternion FromAxisAngle(const Vector3D& axis, Angle angle);
+
+		/// <summary>
+		/// Gets the rotation matrix of this (for column vectors, like Matrix3x3::Multiply(const Vector3D&)).
+		/// </summary>
+		Matrix3x3 ToMatrix() const;
+
+		#pragma region Comparison methods.
+		/// <summary>
+		/// Is every component of this same as its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const Quaternion& other) const
+		{
+			return x == other.x && y == other.y && z == other.z && w == other.w;
+		}
+
+		/// <summary>
+		/// Is every component of this close enough to its corresponding component in other with the threshold of threshold?<para/>
+		/// q and -q are the same rotation but not close enough, use IsSameRotation for that.
+		/// </summary>
+		constexpr bool CloseEnough(const Quaternion& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(x, other.x, threshold) && SMath::CloseEnough(y, other.y, threshold) &&
+				SMath::CloseEnough(z, other.z, threshold) && SMath::CloseEnough(w, other.w, threshold);
+		}
+
+		/// <summary>
+		/// Do this and other rotate by the same amount (with the threshold of threshold), given that q and -q are the same rotation?
+		/// </summary>
+		constexpr bool IsSameRotation(const Quaternion& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return CloseEnough(other, threshold) || CloseEnough(other.Scaled(-1), threshold);
+		}
+		#pragma endregion
+
+		#pragma region Arithmetic.
+		/// <summary>
+		/// Gets the Hamilton product this * other: the rotation that rotates by other and then by this.
+		/// </summary>
+		constexpr Quaternion Multiply(const Quaternion& other) const
+		{
+			return Quaternion(
+				w * other.x + x * other.w + y * other.z - z * other.y,
+				w * other.y - x * other.z + y * other.w + z * other.x,
+				w * other.z + x * other.y - y * other.x + z * other.w,
+				w * other.w - x * other.x - y * other.y - z * other.z);
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		constexpr Quaternion Scaled(float scalar) const
+		{
+			return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar);
+		}
+
+		/// <summary>
+		/// Gets the dot product of this and other.
+		/// </summary>
+		constexpr float Dot(const Quaternion& other) const
+		{
+			return x * other.x + y * other.y + z * other.z + w * other.w;
+		}
+
+		/// <summary>
+		/// Gets the conjugate of this, which is the opposite rotation of unit quaternions.
+		/// </summary>
+		constexpr Quaternion Conjugate() const
+		{
+			return Quaternion(-x, -y, -z, w);
+		}
+
+		/// <summary>
+		/// Gets the magnitude (length) of this quaternion.
+		/// </summary>
+		float Magnitude() const;
+
+		/// <summary>
+		/// Gets a unit quaternion in the same direction as this, so it's a rotation again after rounding errors piled up. A zero quaternion gives the identity.
+		/// </summary>
+		Quaternion Normalized() const;
+		#pragma endregion
+
+		#pragma region Rotation.
+		/// <summary>
+		/// Rotates vector by this.
+		/// </summary>
+		constexpr Vector3D Rotate(const Vector3D& vector) const
+		{
+			// v + 2w(q x v) + 2q x (q x v), where q is the vector part.
+			return RotateWithCross(vector, Vector3D(x, y, z).Cross(vector) * 2);
+		}
+
+		/// <summary>
+		/// Rotates vector by the opposite rotation of this.
+		/// </summary>
+		constexpr Vector3D InverseRotate(const Vector3D& vector) const
+		{
+			return Conjugate().Rotate(vector);
+		}
+
+		/// <summary>
+		/// Gets this rotated by angularVelocity (in radians per second around its direction) for deltaTime, and normalized.<para/>
+		/// This is the first order integration q + (angularVelocity, 0) * q * deltaTime / 2, which is what rigid body integrators usually use.
+		/// </summary>
+		Quaternion Integrate(const Vector3D& angularVelocity, float deltaTime) const;
+
+		/// <summary>
+		/// Interpolates between this and target along the shortest arc on the sphere, by alpha.
+		/// </summary>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		Quaternion Slerp(const Quaternion& target, float alpha, bool clampAlpha = true) const;
+		#pragma endregion
+
+	private:
+		constexpr Vector3D RotateWithCross(const Vector3D& vector, const Vector3D& twiceCross) const
+		{
+			return vector + twiceCross * w + Vector3D(x, y, z).Cross(twiceCross);
+		}
+	};
+} }
\ No newline at end of file
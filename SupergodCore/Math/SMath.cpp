@@ -4,39 +4,29 @@
 
 namespace SupergodCore { namespace Math
 {
-	bool SMath::CloseEnough(float a, float b, float threshold)
-	{
-		return SMath::Abs(a - b) <= threshold;
-	}
-	
-	float SMath::Clamp(float value, float min, float max)
-	{
-		if (value < min)
-			return min;
-
-		if (value > max)
-			return max;
-
-		return value;
-	}
-
-	float SMath::Abs(float value)
-	{
-		return value > 0 ? value : -value;
-	}
-
-	int SMath::Sign(float value)
-	{
-		return value >= 0 ? 1 : -1;
-	}
-
-	uint SMath::Factorial(uint n)
-	{
-		if (n == 0 || n == 1)
-			return 1;
-
-		return Factorial(n - 1) * n;
-	}
+	#ifdef SUPERGOD_DETERMINISTIC_MATH
+	// Opted in: SMath gives the same bits on every compiler, standard library and CPU, at the cost of the slower SMath::Deterministic functions.
+	namespace Implementation = SMath::Deterministic;
+	#else
+	/// <summary>
+	/// The functions SMath forwards to. By default these are the standard library ones, which are the fastest but may differ between compilers, standard libraries and CPUs.<para/>
+	/// Define SUPERGOD_DETERMINISTIC_MATH when building the core to use SMath::Deterministic instead.
+	/// </summary>
+	namespace Implementation
+	{
+		static inline float Sqrt(float x) { return std::sqrt(x); }
+		static inline float Exp(float x) { return std::exp(x); }
+		static inline float Pow(float base, float exponent) { return std::pow(base, exponent); }
+		static inline float Log(float x) { return std::log(x); }
+		static inline float Sin(float theta) { return std::sin(theta); }
+		static inline float Cos(float theta) { return std::cos(theta); }
+		static inline float Tan(float theta) { return std::tan(theta); }
+		static inline float Asin(float sin) { return std::asin(sin); }
+		static inline float Acos(float cos) { return std::acos(cos); }
+		static inline float Atan(float tan) { return std::atan(tan); }
+		static inline float Atan2(float y, float x) { return std::atan2(y, x); }
+	}
+	#endif
 
 	float SMath::Average(const std::vector<float>& numbers)
 	{
@@ -47,11 +37,6 @@ namespace SupergodCore { namespace Math
 		return sum / numbers.size();
 	}
 
-	bool SMath::IsNaN(float value)
-	{
-		return value != value;
-	}
-
 	// TODO: Add custom floor and ceil functionality.
 	#pragma region Rounding functions.
 	int SMath::Floor(float value)
@@ -76,30 +61,6 @@ namespace SupergodCore { namespace Math
 	}
 	#pragma endregion
 
-	#pragma region Wrap functions.
-	float SMath::Wrap(float value, float min, float max)
-	{
-		float minToMaxRange = Abs(max - min);
-		if (value > max)
-		{
-			while (value > max)
-				value -= minToMaxRange;
-		}
-		else
-		{
-			while (value < min)
-				value += minToMaxRange;
-		}
-		return value;
-	}
-
-	float SMath::Wrap(float value, float length)
-	{
-		return Wrap(value, 0, length);
-	}
-	#pragma endregion
-
-	// TODO: Make custom implementation for Pow and Log.
 	#pragma region Powers, roots, exponentionals and logarithms.
 	float SMath::Root(float x, float n)
 	{
@@ -108,32 +69,22 @@ namespace SupergodCore { namespace Math
 
 	float SMath::Sqrt(float x)
 	{
-		return Root(x, 2);
+		return Implementation::Sqrt(x);
 	}
 
 	float SMath::Exp(float x)
 	{
-		return Pow(Constants::E, x);
+		return Implementation::Exp(x);
 	}
 
 	float SMath::Pow(float base, float exponent)
 	{
-		return std::pow(base, exponent);
-	}
-
-	float SMath::Squared(float value)
-	{
-		return value * value;
-	}
-
-	float SMath::Cubed(float value)
-	{
-		return Squared(value) * value;
+		return Implementation::Pow(base, exponent);
 	}
 
 	float SMath::Log(float x, float base)
 	{
-		return std::log10(x) / std::log10(base);
+		return Implementation::Log(x) / Implementation::Log(base);
 	}
 
 	float SMath::Log10(float x)
@@ -143,21 +94,11 @@ namespace SupergodCore { namespace Math
 
 	float SMath::Ln(float x)
 	{
-		return Log(x, Constants::E);
+		return Implementation::Log(x);
 	}
 	#pragma endregion
 
 	#pragma region Min/Max.
-	const float& SMath::Max(const float& a, const float& b)
-	{
-		return a > b ? a : b;
-	}
-
-	float& SMath::Max(float& a, float& b)
-	{
-		return a > b ? a : b;
-	}
-
 	float SMath::Max(const std::vector<float>& values)
 	{
 		float biggest = values[0];
@@ -169,16 +110,6 @@ namespace SupergodCore { namespace Math
 		return biggest;
 	}
 
-	const float& SMath::Min(const float& a, const float& b)
-	{
-		return a < b ? a : b;
-	}
-
-	float& SMath::Min(float& a, float& b)
-	{
-		return a < b ? a : b;
-	}
-
 	float SMath::Min(const std::vector<float>& values)
 	{
 		float smallest = values[0];
@@ -191,41 +122,40 @@ namespace SupergodCore { namespace Math
 	}
 	#pragma endregion
 
-	// TODO: Make custom implementation for Sin and the inverse functions.
 	#pragma region Trig functions.
 	float SMath::Sin(float theta)
 	{
-		return std::sin(theta);
+		return Implementation::Sin(theta);
 	}
 
 	float SMath::Cos(float theta)
 	{
-		return Sin(Constants::PI / 2 - theta);
+		return Implementation::Cos(theta);
 	}
 
 	float SMath::Tan(float theta)
 	{
-		return Sin(theta) / cos(theta);
+		return Implementation::Tan(theta);
 	}
 
 	float SMath::Asin(float sin)
 	{
-		return std::asin(sin);
+		return Implementation::Asin(sin);
 	}
 
 	float SMath::Acos(float cos)
 	{
-		return std::acos(cos);
+		return Implementation::Acos(cos);
 	}
 
 	float SMath::Atan(float tan)
 	{
-		return std::atan(tan);
+		return Implementation::Atan(tan);
 	}
 
 	float SMath::Atan2(float y, float x)
 	{
-		return std::atan2(y, x);
+		return Implementation::Atan2(y, x);
 	}
 	#pragma endregion
 } }
\ No newline at end of file
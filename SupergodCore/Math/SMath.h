@@ -15,7 +15,7 @@ namespace SupergodCore { namespace Math
 		/// Clamps target so it's never smaller than min and never bigger than max.
 		/// </summary>
 		template<class T>
-		inline T Clamp(const T& target, const T& min, const T& max)
+		inline constexpr T Clamp(const T& target, const T& min, const T& max)
 		{
 			return target.Clamp(min, max);
 		}
@@ -24,36 +24,57 @@ namespace SupergodCore { namespace Math
 		/// Gets the absolute value of target..
 		/// </summary>
 		template<class T>
-		T Abs(const T& target)
+		inline constexpr T Abs(const T& target)
 		{
 			return target.Abs();
 		}
 
 		/// <summary>
-		/// Checks if the distance between a and b is threshold.
+		/// Clamps value so it's never smaller than min and never bigger than max.
 		/// </summary>
-		SUPERGOD_API_FUNC bool CloseEnough(float a, float b, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD);
+		inline constexpr float Clamp(float value, float min, float max)
+		{
+			if (value < min)
+				return min;
+
+			if (value > max)
+				return max;
+
+			return value;
+		}
 
 		/// <summary>
-		/// Clamps value so it's never smaller than min and never bigger than max.
+		/// Gets the absolute value of value.
 		/// </summary>
-		SUPERGOD_API_FUNC float Clamp(float value, float min, float max);
+		inline constexpr float Abs(float value)
+		{
+			return value > 0 ? value : -value;
+		}
 
 		/// <summary>
-		/// Gets the absolute value of value.
+		/// Checks if the distance between a and b is threshold.
 		/// </summary>
-		SUPERGOD_API_FUNC float Abs(float value);
+		inline constexpr bool CloseEnough(float a, float b, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD)
+		{
+			return Abs(a - b) <= threshold;
+		}
 	
 		/// <summary>
 		/// Gets the sign (+ (1) or - (-1)) of value.
 		/// </summary>
 		/// <param name="value">The value to get the sign of.</param>
-		SUPERGOD_API_FUNC int Sign(float value);
+		inline constexpr int Sign(float value)
+		{
+			return value >= 0 ? 1 : -1;
+		}
 
 		/// <summary>
 		/// Gets the factorial of n.
 		/// </summary>
-		SUPERGOD_API_FUNC uint Factorial(uint n);
+		inline constexpr uint Factorial(uint n)
+		{
+			return n == 0 || n == 1 ? 1 : Factorial(n - 1) * n;
+		}
 
 		/// <summary>
 		/// Gets the avrage of a list of numbers.
@@ -64,7 +85,10 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Does value NOT exist?
 		/// </summary>
-		SUPERGOD_API_FUNC bool IsNaN(float value);
+		inline constexpr bool IsNaN(float value)
+		{
+			return value != value;
+		}
 		
 		#pragma region Rounding functions.
 		/// <summary>
@@ -99,12 +123,29 @@ namespace SupergodCore { namespace Math
 		/// <param name="min">The minimum value in the range.</param>
 		/// <param name="max">The maximum value in the range.</param>
 		/// <returns>Value wrapped between min and max.</returns>
-		SUPERGOD_API_FUNC float Wrap(float value, float min, float max);
+		inline constexpr float Wrap(float value, float min, float max)
+		{
+			float minToMaxRange = Abs(max - min);
+			if (value > max)
+			{
+				while (value > max)
+					value -= minToMaxRange;
+			}
+			else
+			{
+				while (value < min)
+					value += minToMaxRange;
+			}
+			return value;
+		}
 
 		/// <summary>
 		/// Wraps value between 0 to length. See <seealso cref="Wrap(float, float, float)"/>.
 		/// </summary>
-		SUPERGOD_API_FUNC float Wrap(float value, float length);
+		inline constexpr float Wrap(float value, float length)
+		{
+			return Wrap(value, 0, length);
+		}
 		#pragma endregion
 
 		#pragma region Powers, roots, exponentials and logarithms.
@@ -131,12 +172,18 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Returns value to the power of 2 (value times value).
 		/// </summary>
-		SUPERGOD_API_FUNC float Squared(float value);
+		inline constexpr float Squared(float value)
+		{
+			return value * value;
+		}
 
 		/// <summary>
 		/// Returns value to the power of 3 (value times value times value).
 		/// </summary>
-		SUPERGOD_API_FUNC float Cubed(float value);
+		inline constexpr float Cubed(float value)
+		{
+			return Squared(value) * value;
+		}
 
 		/// <summary>
 		/// base to the power of what equals x?
@@ -160,12 +207,18 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Gets the bigger number of the two.
 		/// </summary>
-		SUPERGOD_API_FUNC const float& Max(const float& a, const float& b);
+		inline constexpr const float& Max(const float& a, const float& b)
+		{
+			return a > b ? a : b;
+		}
 
 		/// <summary>
 		/// Gets the bigger number of the two.
 		/// </summary>
-		SUPERGOD_API_FUNC float& Max(float& a, float& b);
+		inline constexpr float& Max(float& a, float& b)
+		{
+			return a > b ? a : b;
+		}
 
 		/// <summary>
 		/// Gets the biggest number in the values array.
@@ -175,12 +228,18 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Gets the smallest number between the two.
 		/// </summary>
-		SUPERGOD_API_FUNC const float& Min(const float& a, const float& b);
+		inline constexpr const float& Min(const float& a, const float& b)
+		{
+			return a < b ? a : b;
+		}
 
 		/// <summary>
 		/// Gets the smallest number between the two.
 		/// </summary>
-		SUPERGOD_API_FUNC float& Min(float& a, float& b);
+		inline constexpr float& Min(float& a, float& b)
+		{
+			return a < b ? a : b;
+		}
 
 		/// <summary>
 		/// Gets the smallest number in the values array.
@@ -225,5 +284,123 @@ namespace SupergodCore { namespace Math
 		/// </summary>
 		SUPERGOD_API_FUNC float Atan2(float y, float x);
 		#pragma endregion
+
+		/// <summary>
+		/// Math functions that can be evaluated at compile time (in constant expressions).<para/>
+		/// They don't use the standard library, and are calculated with double precision so the float results are as accurate as the ones in SMath.
+		/// </summary>
+		namespace Constexpr
+		{
+			/// <summary>
+			/// Pi with double precision.
+			/// </summary>
+			constexpr double PI_DOUBLE = 3.14159265358979323846;
+
+			/// <summary>
+			/// Gets the sine of angle theta (in radians).
+			/// </summary>
+			inline constexpr float Sin(double theta)
+			{
+				// Wrap theta between -pi and pi, then mirror it between -pi/2 and pi/2 where the Taylor series converges quickly.
+				double turns = theta / (2 * PI_DOUBLE);
+				long long wholeTurns = (long long)(turns < 0 ? turns - .5 : turns + .5);
+				double x = theta - wholeTurns * (2 * PI_DOUBLE);
+				if (x > PI_DOUBLE / 2)
+					x = PI_DOUBLE - x;
+				else if (x < -PI_DOUBLE / 2)
+					x = -PI_DOUBLE - x;
+
+				double xSquared = x * x;
+				double term = x;
+				double sum = x;
+				for (int i = 1; i <= 9; i++)
+				{
+					term *= -xSquared / ((2 * i) * (2 * i + 1));
+					sum += term;
+				}
+				return (float)sum;
+			}
+
+			/// <summary>
+			/// Gets the cosine of angle theta (in radians).
+			/// </summary>
+			inline constexpr float Cos(double theta)
+			{
+				return Sin(PI_DOUBLE / 2 - theta);
+			}
+
+			/// <summary>
+			/// Gets the tangent of angle theta (in radians).
+			/// </summary>
+			inline constexpr float Tan(double theta)
+			{
+				return Sin(theta) / Cos(theta);
+			}
+		}
+
+		/// <summary>
+		/// Math functions that give the same bits on every compiler, standard library and CPU.<para/>
+		/// They use only the basic IEEE operations (+, -, *, / and square root), which are exactly rounded everywhere, instead of the standard library where every vendor has its own approximations.
+		/// They are calculated with double precision internally, so the float results are within 1 ulp of the exact ones (arguments of Sin, Cos and Tan above about a million radians lose precision but stay deterministic).<para/>
+		/// The results are only identical if the compiler doesn't contract a * b + c into fused multiply-adds (MSVC doesn't with /fp:precise, GCC and Clang need -ffp-contract=off) and the CPU isn't set to flush denormals to zero.
+		/// The regular SMath functions use the faster standard library functions. Define SUPERGOD_DETERMINISTIC_MATH when building the core to make them use these instead, so everything built on them (like Normalized and SmallestAngle) is deterministic as well.
+		/// </summary>
+		namespace Deterministic
+		{
+			/// <summary>
+			/// Gets the square root of x. This is a single IEEE operation.
+			/// </summary>
+			SUPERGOD_API_FUNC float Sqrt(float x);
+
+			/// <summary>
+			/// Gets the sine of angle theta (in radians).
+			/// </summary>
+			SUPERGOD_API_FUNC float Sin(float theta);
+
+			/// <summary>
+			/// Gets the cosine of angle theta (in radians).
+			/// </summary>
+			SUPERGOD_API_FUNC float Cos(float theta);
+
+			/// <summary>
+			/// Gets the tangent of angle theta (in radians).
+			/// </summary>
+			SUPERGOD_API_FUNC float Tan(float theta);
+
+			/// <summary>
+			/// Gets the angle (in radians, between -pi/2 and pi/2) whos sine is sin.
+			/// </summary>
+			SUPERGOD_API_FUNC float Asin(float sin);
+
+			/// <summary>
+			/// Gets the angle (in radians, between 0 and pi) whos cosine is cos.
+			/// </summary>
+			SUPERGOD_API_FUNC float Acos(float cos);
+
+			/// <summary>
+			/// Gets the angle (in radians, between -pi/2 and pi/2) whos tangent is tan.
+			/// </summary>
+			SUPERGOD_API_FUNC float Atan(float tan);
+
+			/// <summary>
+			/// Gets the angle (in radians, between -pi and pi) whos tangent is y/x, in the quadrant of the point (x, y).
+			/// </summary>
+			SUPERGOD_API_FUNC float Atan2(float y, float x);
+
+			/// <summary>
+			/// Returns e raised to the power of x.
+			/// </summary>
+			SUPERGOD_API_FUNC float Exp(float x);
+
+			/// <summary>
+			/// e to the power of what equals x? (the natural logarithm).
+			/// </summary>
+			SUPERGOD_API_FUNC float Log(float x);
+
+			/// <summary>
+			/// Returns base to the power of exponent. Negative bases work with whole exponents.
+			/// </summary>
+			SUPERGOD_API_FUNC float Pow(float base, float exponent);
+		}
 	}
 } }
\ No newline at end of file
@@ -0,0 +1,606 @@
+#include "FloatChars.h"
+#include <cmath>
+#include <cstring>
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// The powers of 10 up to what formatting any float needs. Doubles hold the ones up to 1e22 exactly.
+	/// </summary>
+	static constexpr double POWERS_OF_10[] =
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+		1e23, 1e24, 1e25, 1e26, 1e27, 1e28, 1e29, 1e30, 1e31, 1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39, 1e40, 1e41, 1e42, 1e43,
+		1e44, 1e45, 1e46, 1e47, 1e48, 1e49, 1e50, 1e51, 1e52, 1e53
+	};
+	static constexpr int MAX_EXACT_POWER_OF_10 = 22;
+
+	/// <summary>
+	/// The most significant digits that always fit in 64 bits.
+	/// </summary>
+	static constexpr int MAX_FAST_DIGITS = 19;
+
+	/// <summary>
+	/// The significant digits parsing keeps. The midpoints between floats have at most 112 of them, so the digits after these only matter by whether they are all 0.
+	/// </summary>
+	static constexpr int MAX_DIGITS = 120;
+
+	static constexpr uint INFINITY_BITS = 0x7f800000;
+
+	static inline uint FloatToBits(float value)
+	{
+		uint bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	static inline float BitsToFloat(uint bits)
+	{
+		float value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	/// <summary>
+	/// Gets the positive float of bits as a double, where infinity is 2^128 (where the float after the biggest one would be).
+	/// </summary>
+	static inline double FloatBitsToDouble(uint bits)
+	{
+		return bits == INFINITY_BITS ? 3.4028236692093846e38 : BitsToFloat(bits);
+	}
+
+	#pragma region Parsing.
+	/// <summary>
+	/// The significant digits of a positive decimal number, which is digits * 10^exponent.
+	/// </summary>
+	struct Decimal
+	{
+		byte digits[MAX_DIGITS];
+		int count;
+		int exponent;
+
+		/// <summary>
+		/// Were nonzero digits cut off after MAX_DIGITS? The number is then a little bigger than the digits.
+		/// </summary>
+		bool truncated;
+
+		Decimal()
+			: count(0), exponent(0), truncated(false)
+		{
+		}
+
+		inline void AddDigit(int digit, bool afterPoint)
+		{
+			if (count == 0 && digit == 0)
+				exponent -= afterPoint;
+			else if (count < MAX_DIGITS)
+			{
+				digits[count++] = (byte)digit;
+				exponent -= afterPoint;
+			}
+			else
+			{
+				truncated |= digit != 0;
+				exponent += !afterPoint;
+			}
+		}
+	};
+
+	/// <summary>
+	/// An unsigned integer big enough to compare decimals with the midpoints between floats exactly.
+	/// </summary>
+	class BigInteger
+	{
+	public:
+		explicit BigInteger(uint value)
+			: size(value != 0)
+		{
+			limbs[0] = value;
+		}
+
+		void MultiplyAdd(uint factor, uint addend)
+		{
+			unsigned long long carry = addend;
+			for (int i = 0; i < size; i++)
+			{
+				unsigned long long product = (unsigned long long)limbs[i] * factor + carry;
+				limbs[i] = (uint)product;
+				carry = product >> 32;
+			}
+			if (carry != 0)
+				limbs[size++] = (uint)carry;
+		}
+
+		void MultiplyByPowerOf5(int power)
+		{
+			// 5^13 is the biggest power of 5 that fits in 32 bits.
+			static constexpr uint SMALL_POWERS_OF_5[] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125 };
+			for (; power >= 13; power -= 13)
+				MultiplyAdd(SMALL_POWERS_OF_5[13], 0);
+			MultiplyAdd(SMALL_POWERS_OF_5[power], 0);
+		}
+
+		void ShiftLeft(int bits)
+		{
+			if (size == 0)
+				return;
+
+			int words = bits / 32, shift = bits % 32;
+			limbs[size] = 0;
+			for (int i = size; i >= 0; i--)
+			{
+				uint low = i > 0 && shift != 0 ? limbs[i - 1] >> (32 - shift) : 0;
+				limbs[i + words] = limbs[i] << shift | low;
+			}
+			for (int i = 0; i < words; i++)
+				limbs[i] = 0;
+			size += words + 1;
+			while (size > 0 && limbs[size - 1] == 0)
+				size--;
+		}
+
+		/// <summary>
+		/// Returns a negative number, 0 or a positive number if this is smaller than, equal to or bigger than other.
+		/// </summary>
+		int Compare(const BigInteger& other) const
+		{
+			if (size != other.size)
+				return size - other.size;
+			for (int i = size - 1; i >= 0; i--)
+			{
+				if (limbs[i] != other.limbs[i])
+					return limbs[i] < other.limbs[i] ? -1 : 1;
+			}
+			return 0;
+		}
+
+	private:
+		/// <summary>
+		/// Enough for 120 digits times 5^166 or shifted by 270 bits, the most the comparisons need.
+		/// </summary>
+		static constexpr int MAX_LIMBS = 64;
+
+		uint limbs[MAX_LIMBS];
+		int size;
+	};
+
+	/// <summary>
+	/// Compares a decimal (whose digits are already in digits) with mantissa * 2^twoExponent.
+	/// </summary>
+	static int CompareWithBinary(const Decimal& decimal, const BigInteger& digits, uint mantissa, int twoExponent)
+	{
+		// Both sides are made integers by moving the powers of 2 and 5 to the other side.
+		BigInteger left = digits, right(mantissa);
+		if (decimal.exponent >= 0)
+			left.MultiplyByPowerOf5(decimal.exponent);
+		else
+			right.MultiplyByPowerOf5(-decimal.exponent);
+		if (decimal.exponent >= twoExponent)
+			left.ShiftLeft(decimal.exponent - twoExponent);
+		else
+			right.ShiftLeft(twoExponent - decimal.exponent);
+
+		int comparison = left.Compare(right);
+		return comparison == 0 && decimal.truncated ? 1 : comparison;
+	}
+
+	/// <summary>
+	/// Compares a decimal (whose digits are already in digits) with the midpoint between the positive float of bits and the one after it.
+	/// </summary>
+	static inline int CompareWithMidpoint(const Decimal& decimal, const BigInteger& digits, uint bits)
+	{
+		// The midpoint is (2 * mantissa + 1) * 2^(exponent - 1).
+		uint exponentBits = bits >> 23;
+		uint mantissa = exponentBits == 0 ? bits & 0x7fffff : (bits & 0x7fffff) | 0x800000;
+		int twoExponent = exponentBits == 0 ? -149 : (int)exponentBits - 150;
+		return CompareWithBinary(decimal, digits, 2 * mantissa + 1, twoExponent - 1);
+	}
+
+	/// <summary>
+	/// Is value exactly in the middle between the positive float rounded (which it was rounded to) and one of the floats next to it? The rounding could be wrong then.
+	/// </summary>
+	static inline bool IsMidpoint(double value, float rounded)
+	{
+		uint bits = FloatToBits(rounded);
+		double asDouble = FloatBitsToDouble(bits);
+		return (bits > 0 && value == (FloatBitsToDouble(bits - 1) + asDouble) / 2) ||
+			(bits < INFINITY_BITS && value == (asDouble + FloatBitsToDouble(bits + 1)) / 2);
+	}
+
+	/// <summary>
+	/// Rounds a positive decimal to the nearest float, with ties to even.
+	/// </summary>
+	static float DecimalToFloat(const Decimal& decimal)
+	{
+		if (decimal.count == 0)
+			return 0;
+
+		// Numbers of at least 10^39 are bigger than the biggest float, and numbers below 10^-46 are closer to 0 than to the smallest float.
+		int magnitude = decimal.exponent + decimal.count;
+		if (magnitude > 39)
+			return BitsToFloat(INFINITY_BITS);
+		if (magnitude < -45)
+			return 0;
+
+		// Clinger's fast path: when both the digits and the power of 10 are exact doubles, a single rounded multiplication or division gets the nearest double.
+		// Rounding that to a float again is only wrong if it lands exactly between two floats.
+		if (decimal.count <= MAX_FAST_DIGITS && !decimal.truncated)
+		{
+			unsigned long long mantissa = 0;
+			for (int i = 0; i < decimal.count; i++)
+				mantissa = mantissa * 10 + decimal.digits[i];
+
+			const unsigned long long maxExact = 1ull << 53;
+			int exponent = decimal.exponent;
+			for (; exponent > MAX_EXACT_POWER_OF_10 && mantissa <= maxExact / 10; exponent--)
+				mantissa *= 10;
+
+			if (mantissa <= maxExact && exponent >= -MAX_EXACT_POWER_OF_10 && exponent <= MAX_EXACT_POWER_OF_10)
+			{
+				double value = exponent < 0 ? mantissa / POWERS_OF_10[-exponent] : mantissa * POWERS_OF_10[exponent];
+				float rounded = (float)value;
+				if (!IsMidpoint(value, rounded))
+					return rounded;
+			}
+		}
+
+		// The slow path guesses with doubles, which is at most a few floats off, and moves to the float whose midpoints with its neighbors are around the decimal, compared exactly.
+		BigInteger digits(0);
+		double guess = 0;
+		for (int i = 0; i < decimal.count; i++)
+		{
+			digits.MultiplyAdd(10, decimal.digits[i]);
+			if (i < MAX_FAST_DIGITS)
+				guess = guess * 10 + decimal.digits[i];
+		}
+		int guessDigits = decimal.count < MAX_FAST_DIGITS ? decimal.count : MAX_FAST_DIGITS;
+		guess *= std::pow(10., decimal.exponent + decimal.count - guessDigits);
+
+		uint bits = FloatToBits((float)guess);
+		while (bits < INFINITY_BITS)
+		{
+			int comparison = CompareWithMidpoint(decimal, digits, bits);
+			if (comparison < 0 || (comparison == 0 && (bits & 1) == 0))
+				break;
+			bits++;
+		}
+		while (bits > 0)
+		{
+			int comparison = CompareWithMidpoint(decimal, digits, bits - 1);
+			if (comparison > 0 || (comparison == 0 && (bits & 1) == 0))
+				break;
+			bits--;
+		}
+		return BitsToFloat(bits);
+	}
+
+	static inline bool IsDigit(char character)
+	{
+		return character >= '0' && character <= '9';
+	}
+
+	/// <summary>
+	/// Does [first, last) start with word, in any case?
+	/// </summary>
+	static bool StartsWithWord(const char* first, const char* last, const char* word)
+	{
+		for (; *word != 0; first++, word++)
+		{
+			if (first == last || (*first | 0x20) != *word)
+				return false;
+		}
+		return true;
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, float& value)
+	{
+		const char* position = first;
+		bool negative = position != last && *position == '-';
+		position += negative;
+
+		if (StartsWithWord(position, last, "inf"))
+		{
+			value = negative ? -BitsToFloat(INFINITY_BITS) : BitsToFloat(INFINITY_BITS);
+			return position + (StartsWithWord(position, last, "infinity") ? 8 : 3);
+		}
+		if (StartsWithWord(position, last, "nan"))
+		{
+			value = negative ? -BitsToFloat(INFINITY_BITS | 0x400000) : BitsToFloat(INFINITY_BITS | 0x400000);
+			return position + 3;
+		}
+
+		Decimal decimal;
+		bool hasDigits = false;
+		for (; position != last && IsDigit(*position); position++, hasDigits = true)
+			decimal.AddDigit(*position - '0', false);
+		if (position != last && *position == '.')
+		{
+			for (position++; position != last && IsDigit(*position); position++, hasDigits = true)
+				decimal.AddDigit(*position - '0', true);
+		}
+		if (!hasDigits)
+			return nullptr;
+
+		// The exponent is only part of the number if it has digits, otherwise the number ends before the 'e'.
+		if (position != last && (*position == 'e' || *position == 'E'))
+		{
+			const char* exponentPosition = position + 1;
+			bool negativeExponent = exponentPosition != last && *exponentPosition == '-';
+			exponentPosition += exponentPosition != last && (*exponentPosition == '-' || *exponentPosition == '+');
+			if (exponentPosition != last && IsDigit(*exponentPosition))
+			{
+				int exponent = 0;
+				for (; exponentPosition != last && IsDigit(*exponentPosition); exponentPosition++)
+				{
+					if (exponent < 100000)
+						exponent = exponent * 10 + (*exponentPosition - '0');
+				}
+				decimal.exponent += negativeExponent ? -exponent : exponent;
+				position = exponentPosition;
+			}
+		}
+
+		while (decimal.count > 0 && decimal.digits[decimal.count - 1] == 0)
+		{
+			decimal.count--;
+			decimal.exponent++;
+		}
+
+		float magnitude = DecimalToFloat(decimal);
+		value = negative ? -magnitude : magnitude;
+		return position;
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, int& value)
+	{
+		const char* position = first;
+		bool negative = position != last && *position == '-';
+		position += negative;
+		if (position == last || !IsDigit(*position))
+			return nullptr;
+
+		unsigned long long magnitude = 0;
+		for (; position != last && IsDigit(*position); position++)
+		{
+			magnitude = magnitude * 10 + (*position - '0');
+			if (magnitude > 2147483648ull)
+				return nullptr;
+		}
+		if (magnitude == 2147483648ull && !negative)
+			return nullptr;
+
+		value = negative ? (int)(0 - magnitude) : (int)magnitude;
+		return position;
+	}
+	#pragma endregion
+
+	#pragma region Formatting.
+	/// <summary>
+	/// Writes the digits of value (which isn't 0) to the end of destination, and returns their count.
+	/// </summary>
+	static int WriteDigits(char* destination, unsigned long long value)
+	{
+		char reversed[20];
+		int count = 0;
+		for (; value != 0; value /= 10)
+			reversed[count++] = (char)('0' + value % 10);
+		for (int i = 0; i < count; i++)
+			destination[i] = reversed[count - 1 - i];
+		return count;
+	}
+
+	/// <summary>
+	/// Does digits * 10^exponent parse back to exactly value?
+	/// </summary>
+	static bool RoundTrips(unsigned long long digits, int exponent, float value)
+	{
+		// Decimals between the midpoints to the floats around value parse back to it. The midpoints are exact in doubles, but scaling them isn't,
+		// so only decimals that are clearly inside or outside are decided here, and the rest are parsed.
+		uint bits = FloatToBits(value);
+		double lower = (FloatBitsToDouble(bits - 1) + value) / 2;
+		double upper = (FloatBitsToDouble(bits + 1) + value) / 2;
+		if (exponent <= 0)
+		{
+			lower *= POWERS_OF_10[-exponent];
+			upper *= POWERS_OF_10[-exponent];
+		}
+		else
+		{
+			lower /= POWERS_OF_10[exponent];
+			upper /= POWERS_OF_10[exponent];
+		}
+
+		double candidate = (double)digits;
+		double margin = candidate * 1e-13;
+		if (candidate > lower + margin && candidate < upper - margin)
+			return true;
+		if (candidate < lower - margin || candidate > upper + margin)
+			return false;
+
+		Decimal decimal;
+		decimal.exponent = exponent;
+		char text[20];
+		int count = WriteDigits(text, digits);
+		for (int i = 0; i < count; i++)
+			decimal.digits[decimal.count++] = (byte)(text[i] - '0');
+		return DecimalToFloat(decimal) == value;
+	}
+
+	/// <summary>
+	/// Is the decimal (2 * below + 1) * 5 * 10^(exponent - 1), which is halfway between below and below + 1 times 10^exponent, bigger than the positive value?
+	/// Returns false when they are equal and below is odd, so exact ties go to the even one like in std::to_chars.
+	/// </summary>
+	static bool IsBelowCloser(unsigned long long below, int exponent, float value)
+	{
+		Decimal halfway;
+		halfway.exponent = exponent - 1;
+		char text[21];
+		int count = WriteDigits(text, (2 * below + 1) * 5);
+		BigInteger digits(0);
+		for (int i = 0; i < count; i++)
+		{
+			halfway.digits[halfway.count++] = (byte)(text[i] - '0');
+			digits.MultiplyAdd(10, text[i] - '0');
+		}
+
+		uint bits = FloatToBits(value);
+		uint exponentBits = bits >> 23;
+		uint mantissa = exponentBits == 0 ? bits & 0x7fffff : (bits & 0x7fffff) | 0x800000;
+		int comparison = CompareWithBinary(halfway, digits, mantissa, exponentBits == 0 ? -149 : (int)exponentBits - 150);
+		return comparison > 0 || (comparison == 0 && below % 2 == 0);
+	}
+
+	/// <summary>
+	/// Finds the decimal with significantDigits digits closest to the positive value that parses back to it, if there is one: one of the two around it.
+	/// </summary>
+	static bool FindDigits(float value, int decimalExponent, int significantDigits, unsigned long long& digits, int& exponent)
+	{
+		int shift = significantDigits - 1 - decimalExponent;
+		double scaled = shift >= 0 ? value * POWERS_OF_10[shift] : value / POWERS_OF_10[-shift];
+		unsigned long long below = (unsigned long long)scaled;
+		exponent = -shift;
+
+		// Scaling rounds, so when value is about halfway between the two it is compared exactly.
+		double fraction = scaled - below;
+		bool belowIsCloser = std::abs(fraction - .5) > scaled * 1e-13 ? fraction < .5 : IsBelowCloser(below, exponent, value);
+		unsigned long long candidates[] = { belowIsCloser ? below : below + 1, belowIsCloser ? below + 1 : below };
+		for (unsigned long long candidate : candidates)
+		{
+			if (candidate != 0 && RoundTrips(candidate, exponent, value))
+			{
+				digits = candidate;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// <summary>
+	/// Writes the shortest decimal that parses back to the positive value, and returns the end of what was written.
+	/// </summary>
+	static char* WriteShortest(char* destination, float value)
+	{
+		// The exponent of the first digit, from the logarithm and fixed if the rounding of the logarithm crossed a power of 10.
+		int decimalExponent = (int)std::floor(std::log10((double)value));
+		int shift = -decimalExponent;
+		double firstDigit = shift >= 0 ? value * POWERS_OF_10[shift] : value / POWERS_OF_10[-shift];
+		decimalExponent += firstDigit >= 10 ? 1 : firstDigit < 1 ? -1 : 0;
+
+		// Getting closer with more digits never stops round tripping, so the fewest digits can be searched for. 9 digits are always enough for a float.
+		unsigned long long digits;
+		int exponent;
+		int low = 1, high = 9;
+		for (; !FindDigits(value, decimalExponent, high, digits, exponent); high++);
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+			unsigned long long middleDigits;
+			int middleExponent;
+			if (FindDigits(value, decimalExponent, middle, middleDigits, middleExponent))
+			{
+				high = middle;
+				digits = middleDigits;
+				exponent = middleExponent;
+			}
+			else
+				low = middle + 1;
+		}
+		for (; digits % 10 == 0; digits /= 10)
+			exponent++;
+
+		char text[20];
+		int count = WriteDigits(text, digits);
+		int scientificExponent = exponent + count - 1;
+		int absoluteExponent = scientificExponent < 0 ? -scientificExponent : scientificExponent;
+		int fixedLength = exponent >= 0 ? count + exponent : scientificExponent >= 0 ? count + 1 : count + 1 - scientificExponent;
+		int scientificLength = count + (count > 1) + 2 + (absoluteExponent >= 100 ? 3 : 2);
+
+		// Like std::to_chars, fixed notation wins ties.
+		if (fixedLength <= scientificLength)
+		{
+			// Floats that the shortest digits end in zeros for are integers, and like std::to_chars, all of their digits are written instead of the zeros.
+			if (exponent > 0)
+				return destination + WriteDigits(destination, (unsigned long long)value);
+			if (exponent == 0)
+			{
+				std::memcpy(destination, text, count);
+				return destination + count;
+			}
+			if (scientificExponent >= 0)
+			{
+				std::memcpy(destination, text, scientificExponent + 1);
+				destination[scientificExponent + 1] = '.';
+				std::memcpy(destination + scientificExponent + 2, text + scientificExponent + 1, count - scientificExponent - 1);
+				return destination + count + 1;
+			}
+
+			destination[0] = '0';
+			destination[1] = '.';
+			std::memset(destination + 2, '0', -scientificExponent - 1);
+			std::memcpy(destination + 1 - scientificExponent, text, count);
+			return destination + fixedLength;
+		}
+
+		char* position = destination;
+		*position++ = text[0];
+		if (count > 1)
+		{
+			*position++ = '.';
+			std::memcpy(position, text + 1, count - 1);
+			position += count - 1;
+		}
+		*position++ = 'e';
+		*position++ = scientificExponent < 0 ? '-' : '+';
+		if (absoluteExponent >= 100)
+			*position++ = (char)('0' + absoluteExponent / 100);
+		*position++ = (char)('0' + absoluteExponent / 10 % 10);
+		*position++ = (char)('0' + absoluteExponent % 10);
+		return position;
+	}
+
+	/// <summary>
+	/// Copies the text in [text, textEnd) to [first, last) if it fits.
+	/// </summary>
+	static inline char* CopyIfFits(char* first, char* last, const char* text, const char* textEnd)
+	{
+		if (textEnd - text > last - first)
+			return nullptr;
+
+		std::memcpy(first, text, textEnd - text);
+		return first + (textEnd - text);
+	}
+
+	char* Text::ToChars(char* first, char* last, float value)
+	{
+		char text[MAX_FLOAT_CHARS];
+		char* end = text;
+		uint bits = FloatToBits(value);
+		if (bits >> 31)
+			*end++ = '-';
+
+		bits &= 0x7fffffff;
+		if (bits > INFINITY_BITS)
+			end = (char*)std::memcpy(end, "nan", 3) + 3;
+		else if (bits == INFINITY_BITS)
+			end = (char*)std::memcpy(end, "inf", 3) + 3;
+		else if (bits == 0)
+			*end++ = '0';
+		else
+			end = WriteShortest(end, BitsToFloat(bits));
+		return CopyIfFits(first, last, text, end);
+	}
+
+	char* Text::ToChars(char* first, char* last, int value)
+	{
+		char text[11];
+		char* end = text;
+		unsigned long long magnitude = value < 0 ? 0 - (long long)value : value;
+		if (value < 0)
+			*end++ = '-';
+		if (magnitude == 0)
+			*end++ = '0';
+		end += WriteDigits(end, magnitude);
+		return CopyIfFits(first, last, text, end);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Formatting and parsing of numbers and math types as text, in the spirit of std::to_chars and std::from_chars:
+	/// nothing depends on the locale, nothing is allocated, and nothing is null terminated.<para/>
+	/// ToChars writes into [first, last) and returns the end of what it wrote, or null if it didn't fit.
+	/// FromChars reads from [first, last) and returns the end of what it read, or null (leaving value as it was) if the text doesn't start with a valid value.
+	/// </summary>
+	namespace Text
+	{
+		/// <summary>
+		/// The most characters ToChars writes for a float, like "-1.17549435e-38".
+		/// </summary>
+		static constexpr int MAX_FLOAT_CHARS = 15;
+
+		/// <summary>
+		/// Writes the shortest text that parses back to exactly value, in fixed or scientific notation (whichever is shorter, like "0.1", "1e+10" or "1.5e-07"),
+		/// the same as std::to_chars without a format. Infinity and NaN are "inf" and "nan".
+		/// </summary>
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, float value);
+
+		/// <summary>
+		/// Writes value in decimal.
+		/// </summary>
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, int value);
+
+		/// <summary>
+		/// Parses a float in fixed or scientific notation, or "inf", "infinity" or "nan" in any case, with an optional '-' in front, rounded to the nearest float.<para/>
+		/// Like std::from_chars, it doesn't skip whitespace or allow a '+' in front. Numbers too big for a float become infinity.
+		/// </summary>
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, float& value);
+
+		/// <summary>
+		/// Parses an int in decimal, with an optional '-' in front. Fails if the number doesn't fit in an int.
+		/// </summary>
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, int& value);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,222 @@
+#include "MathChars.h"
+
+namespace SupergodCore { namespace Math
+{
+	static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+	/// <summary>
+	/// Writes count floats with a space between every two of them.
+	/// </summary>
+	static char* FloatsToChars(char* first, char* last, const float* values, int count)
+	{
+		return Text::ToChars(first, last, values, count);
+	}
+
+	/// <summary>
+	/// Parses count floats separated by whitespace and commas into values, and only changes values if all of them are valid.
+	/// </summary>
+	static const char* FloatsFromChars(const char* first, const char* last, float* values, int count)
+	{
+		float parsed[9];
+		first = Text::FromChars(first, last, parsed, count);
+		if (first != nullptr)
+		{
+			for (int i = 0; i < count; i++)
+				values[i] = parsed[i];
+		}
+		return first;
+	}
+
+	/// <summary>
+	/// Gets the value of a hex digit in any case, or -1 if character isn't one.
+	/// </summary>
+	static inline int HexDigitValue(char character)
+	{
+		if (character >= '0' && character <= '9')
+			return character - '0';
+		character |= 0x20;
+		return character >= 'a' && character <= 'f' ? character - 'a' + 10 : -1;
+	}
+
+	/// <summary>
+	/// Parses a hex color starting with '#': "#rgb", "#rgba", "#rrggbb" or "#rrggbbaa".
+	/// </summary>
+	static const char* HexFromChars(const char* first, const char* last, BColor& value)
+	{
+		int digits[8];
+		int count = 0;
+		const char* position = first + 1;
+		for (; position != last && count < 8 && HexDigitValue(*position) >= 0; position++)
+			digits[count++] = HexDigitValue(*position);
+		if (position != last && HexDigitValue(*position) >= 0)
+			return nullptr;
+
+		byte components[4] = { 0, 0, 0, 255 };
+		if (count == 3 || count == 4)
+		{
+			for (int i = 0; i < count; i++)
+				components[i] = (byte)(digits[i] * 17);
+		}
+		else if (count == 6 || count == 8)
+		{
+			for (int i = 0; i < count / 2; i++)
+				components[i] = (byte)(digits[i * 2] * 16 + digits[i * 2 + 1]);
+		}
+		else
+			return nullptr;
+
+		value = BColor(components[0], components[1], components[2], components[3]);
+		return position;
+	}
+
+	#pragma region Formatting.
+	char* Text::ToChars(char* first, char* last, const Vector2D& value)
+	{
+		return FloatsToChars(first, last, value.components, 2);
+	}
+
+	char* Text::ToChars(char* first, char* last, const Vector3D& value)
+	{
+		return FloatsToChars(first, last, value.components, 3);
+	}
+
+	char* Text::ToChars(char* first, char* last, const Vector4D& value)
+	{
+		return FloatsToChars(first, last, value.components, 4);
+	}
+
+	char* Text::ToChars(char* first, char* last, const Matrix2x2& value)
+	{
+		return FloatsToChars(first, last, value.elements4, 4);
+	}
+
+	char* Text::ToChars(char* first, char* last, const Matrix3x3& value)
+	{
+		return FloatsToChars(first, last, value.elements9, 9);
+	}
+
+	char* Text::ToChars(char* first, char* last, const Angle& value)
+	{
+		return ToChars(first, last, value.GetRadians());
+	}
+
+	char* Text::ToChars(char* first, char* last, const FColor& value)
+	{
+		return FloatsToChars(first, last, value.components, 4);
+	}
+
+	char* Text::ToChars(char* first, char* last, const BColor& value)
+	{
+		if (last - first < 9)
+			return nullptr;
+
+		*first++ = '#';
+		for (byte component : value.components)
+		{
+			*first++ = HEX_DIGITS[component >> 4];
+			*first++ = HEX_DIGITS[component & 15];
+		}
+		return first;
+	}
+
+	char* Text::ToHexChars(char* first, char* last, const FColor& value)
+	{
+		return ToChars(first, last, (BColor)value);
+	}
+	#pragma endregion
+
+	#pragma region Parsing.
+	const char* Text::SkipSeparators(const char* first, const char* last)
+	{
+		while (first != last && (*first == ' ' || *first == ',' || *first == '\t' || *first == '\n' || *first == '\r'))
+			first++;
+		return first;
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, Vector2D& value)
+	{
+		return FloatsFromChars(first, last, value.components, 2);
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, Vector3D& value)
+	{
+		return FloatsFromChars(first, last, value.components, 3);
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, Vector4D& value)
+	{
+		return FloatsFromChars(first, last, value.components, 4);
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, Matrix2x2& value)
+	{
+		return FloatsFromChars(first, last, value.elements4, 4);
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, Matrix3x3& value)
+	{
+		return FloatsFromChars(first, last, value.elements9, 9);
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, Angle& value)
+	{
+		float number;
+		first = FromChars(SkipSeparators(first, last), last, number);
+		if (first == nullptr)
+			return nullptr;
+
+		// The unit, if there is one, must be a whole word.
+		Angle::Measurement measurement = Angle::Measurement::Radians;
+		static const struct { const char* name; Angle::Measurement measurement; } UNITS[] =
+		{
+			{ "rad", Angle::Measurement::Radians }, { "deg", Angle::Measurement::Degrees }, { "rev", Angle::Measurement::Revolutions }
+		};
+		for (const auto& unit : UNITS)
+		{
+			if (last - first >= 3 && first[0] == unit.name[0] && first[1] == unit.name[1] && first[2] == unit.name[2])
+			{
+				measurement = unit.measurement;
+				first += 3;
+				break;
+			}
+		}
+		if (first != last && ((*first | 0x20) >= 'a' && (*first | 0x20) <= 'z'))
+			return nullptr;
+
+		value = Angle(number, measurement);
+		return first;
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, FColor& value)
+	{
+		first = SkipSeparators(first, last);
+		if (first != last && *first == '#')
+		{
+			BColor color;
+			first = HexFromChars(first, last, color);
+			if (first != nullptr)
+				value = (FColor)color;
+			return first;
+		}
+		return FloatsFromChars(first, last, value.components, 4);
+	}
+
+	const char* Text::FromChars(const char* first, const char* last, BColor& value)
+	{
+		first = SkipSeparators(first, last);
+		if (first != last && *first == '#')
+			return HexFromChars(first, last, value);
+
+		int components[4];
+		first = FromChars(first, last, components, 4);
+		for (int i = 0; i < 4 && first != nullptr; i++)
+		{
+			if (components[i] < 0 || components[i] > 255)
+				return nullptr;
+		}
+		if (first != nullptr)
+			value = BColor((byte)components[0], (byte)components[1], (byte)components[2], (byte)components[3]);
+		return first;
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "FloatChars.h"
+#include "../Angle.h"
+#include "../Vectors/Vector2D.h"
+#include "../Vectors/Vector3D.h"
+#include "../Vectors/Vector4D.h"
+#include "../Matrices/Matrix2x2.h"
+#include "../Matrices/Matrix3x3.h"
+#include "../Colors/BColor.h"
+#include "../Colors/FColor.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// See FloatChars.h for how ToChars and FromChars work.<para/>
+	/// Vectors, matrices (by rows) and FColors are written as their floats with a space between them, like "1 0.5 -2", and parsed from floats separated by any whitespace and commas, like "1, 0.5, -2".
+	/// Angles are written as radians, and parsed from a float with an optional unit right after it: "rad", "deg" or "rev".
+	/// BColors are written as hex, like "#ff8000ff", and parsed from hex ("#rgb", "#rgba", "#rrggbb" or "#rrggbbaa") or from 4 integers from 0 to 255.
+	/// FColors are parsed from hex too. Unlike floats, all of these skip whitespace and commas before themselves.
+	/// </summary>
+	namespace Text
+	{
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const Vector2D& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const Vector3D& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const Vector4D& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const Matrix2x2& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const Matrix3x3& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const Angle& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const FColor& value);
+		SUPERGOD_API_FUNC char* ToChars(char* first, char* last, const BColor& value);
+
+		/// <summary>
+		/// Writes value as hex, like "#ff8000ff", rounding it to bytes.
+		/// </summary>
+		SUPERGOD_API_FUNC char* ToHexChars(char* first, char* last, const FColor& value);
+
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, Vector2D& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, Vector3D& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, Vector4D& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, Matrix2x2& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, Matrix3x3& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, Angle& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, FColor& value);
+		SUPERGOD_API_FUNC const char* FromChars(const char* first, const char* last, BColor& value);
+
+		/// <summary>
+		/// Skips whitespace and commas.
+		/// </summary>
+		SUPERGOD_API_FUNC const char* SkipSeparators(const char* first, const char* last);
+
+		/// <summary>
+		/// Writes count values with a space between every two of them. Returns null if they didn't all fit.
+		/// </summary>
+		template<class T>
+		inline char* ToChars(char* first, char* last, const T* values, size_t count)
+		{
+			for (size_t i = 0; i < count && first != nullptr; i++)
+			{
+				if (i > 0)
+				{
+					if (first == last)
+						return nullptr;
+					*first++ = ' ';
+				}
+				first = ToChars(first, last, values[i]);
+			}
+			return first;
+		}
+
+		/// <summary>
+		/// Parses exactly count values separated by whitespace and commas into values, without allocating anything. Returns null if there aren't count valid values.
+		/// </summary>
+		template<class T>
+		inline const char* FromChars(const char* first, const char* last, T* values, size_t count)
+		{
+			for (size_t i = 0; i < count && first != nullptr; i++)
+				first = FromChars(SkipSeparators(first, last), last, values[i]);
+			return first;
+		}
+
+		/// <summary>
+		/// Parses values separated by whitespace and commas until the end of the text, adding them to values (reserve it to avoid growing it while parsing).<para/>
+		/// Returns last, or null if something that isn't a value was found. The values before it are still added.
+		/// </summary>
+		template<class T>
+		inline const char* FromChars(const char* first, const char* last, std::vector<T>& values)
+		{
+			for (first = SkipSeparators(first, last); first != last; first = SkipSeparators(first, last))
+			{
+				values.emplace_back();
+				first = FromChars(first, last, values.back());
+				if (first == nullptr)
+				{
+					values.pop_back();
+					return nullptr;
+				}
+			}
+			return last;
+		}
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,4 @@
+#pragma once
+
+#include "FloatChars.h"
+#include "MathChars.h"
\ No newline at end of file
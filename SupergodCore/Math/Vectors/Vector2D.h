@@ -42,10 +42,16 @@ namespace SupergodCore { namespace Math
 		};
 		
 		/// <summary>Creates a new 2D vector and initializes both of its components to 0.</summary>
-		Vector2D();
+		constexpr Vector2D()
+			: x(0), y(0)
+		{
+		}
 
 		/// <summary>Creates a new 2D vector and initializes its components to x and y.</summary>
-		Vector2D(float x, float y);
+		constexpr Vector2D(float x, float y)
+			: x(x), y(y)
+		{
+		}
 
 		/// <summary>
 		/// Gets a reference to a component at the index of index.
@@ -89,14 +95,20 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Is every component of this same as its corresponding component in other?
 		/// </summary>
-		bool Equals(const Vector2D& other) const;
+		constexpr bool Equals(const Vector2D& other) const
+		{
+			return x == other.x && y == other.y;
+		}
 
 		/// <summary>
 		/// Is every component of this close enough to its corresponding component in other with the threshold of threshold?<para/>
 		/// See SupergodEngine::Math::Smath::CloseEnough.
 		/// </summary>
 		/// <param name="threshold">The threshold for each component to be considered close enough.</param>
-		bool CloseEnough(const Vector2D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const Vector2D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(x, other.x, threshold) && SMath::CloseEnough(y, other.y, threshold);
+		}
 
 		/// <summary>
 		/// Does any component pass test?
@@ -109,46 +121,70 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Adds every component of this with its corresponding component in other.
 		/// </summary>
-		Vector2D Add(const Vector2D& other) const;
+		constexpr Vector2D Add(const Vector2D& other) const
+		{
+			return Vector2D(x + other.x, y + other.y);
+		}
 
 		/// <summary>
 		/// Subtracts every component of other from its corresponding component in this.
 		/// </summary>
-		Vector2D Subtract(const Vector2D& other) const;
+		constexpr Vector2D Subtract(const Vector2D& other) const
+		{
+			return Vector2D(x - other.x, y - other.y);
+		}
 		
 		/// <summary>
 		/// Negates every component of this.
 		/// </summary>
-		Vector2D Negated() const;
+		constexpr Vector2D Negated() const
+		{
+			return Vector2D(-x, -y);
+		}
 		#pragma endregion
 
 		#pragma region Multiplication (Dot and Multiply).
 		/// <summary>
 		/// Gets the dot product of this and other.
 		/// </summary>
-		float Dot(const Vector2D& other) const;
+		constexpr float Dot(const Vector2D& other) const
+		{
+			return x * other.x + y * other.y;
+		}
 
 		/// <summary>
 		/// Multiplies this and other component-wise.
 		/// </summary>
-		Vector2D Multiply(const Vector2D& other) const;
+		constexpr Vector2D Multiply(const Vector2D& other) const
+		{
+			return Vector2D(x * other.x, y * other.y);
+		}
 
 		/// <summary>
 		/// Multiplies every component of this by scalar.
 		/// </summary>
-		Vector2D Multiply(float scalar) const;
+		constexpr Vector2D Multiply(float scalar) const
+		{
+			return Vector2D(x * scalar, y * scalar);
+		}
 		#pragma endregion
 
 		#pragma region Division.
 		/// <summary>
 		/// Divides every component of this by scalar.
 		/// </summary>
-		Vector2D Divide(float scalar) const;
+		constexpr Vector2D Divide(float scalar) const
+		{
+			return Vector2D(x / scalar, y / scalar);
+		}
 
 		/// <summary>
 		/// Divides every component of this by its corresponding component in scalar.
 		/// </summary>
-		Vector2D Divide(const Vector2D& other) const;
+		constexpr Vector2D Divide(const Vector2D& other) const
+		{
+			return Vector2D(x / other.x, y / other.y);
+		}
 		#pragma endregion
 
 		#pragma region BiggestComponent/BiggestComponent.
@@ -178,17 +214,26 @@ namespace SupergodCore { namespace Math
 		/// Gets a vector where all of its components are the absolute value of their corresponding component in this.
 		/// </summary>
 		/// <returns></returns>
-		Vector2D Abs() const;
+		constexpr Vector2D Abs() const
+		{
+			return Vector2D(SMath::Abs(x), SMath::Abs(y));
+		}
 
 		/// <summary>
 		/// Clamps every component of this so it's never smaller than its corresponding component in min and never bigger than its corresponding component in max.
 		/// </summary>
-		Vector2D Clamp(const Vector2D& min, const Vector2D& max) const;
+		constexpr Vector2D Clamp(const Vector2D& min, const Vector2D& max) const
+		{
+			return Vector2D(SMath::Clamp(x, min.x, max.x), SMath::Clamp(y, min.y, max.y));
+		}
 
 		/// <summary>
 		/// Clamps every component of this so it's never smaller than min and never bigger than max.
 		/// </summary>
-		Vector2D ClampComponents(float min, float max) const;
+		constexpr Vector2D ClampComponents(float min, float max) const
+		{
+			return Vector2D(SMath::Clamp(x, min, max), SMath::Clamp(y, min, max));
+		}
 		#pragma endregion
 	};
 } }
\ No newline at end of file
@@ -47,16 +47,28 @@ namespace SupergodCore { namespace Math
 		};
 	
 		/// <summary>Creates a new 3D vector and initializes all of its components to 0.</summary>
-		Vector3D();
+		constexpr Vector3D()
+			: x(0), y(0), z(0)
+		{
+		}
 
 		/// <summary>Creates a new 3D vector and initializes its components to x, y and z.</summary>
-		Vector3D(float x, float y, float z);
+		constexpr Vector3D(float x, float y, float z)
+			: x(x), y(y), z(z)
+		{
+		}
 
 		/// <summary>Creates a new 3D vector and initializes its x and y components to xy and its z component to z.</summary>
-		Vector3D(const Vector2D& xy, float z);
+		constexpr Vector3D(const Vector2D& xy, float z)
+			: x(xy.x), y(xy.y), z(z)
+		{
+		}
 
 		/// <summary>Creates a new 3D vector and initializes its x component x and its y and z components to yz.</summary>
-		Vector3D(float x, const Vector2D& yz);
+		constexpr Vector3D(float x, const Vector2D& yz)
+			: x(x), y(yz.x), z(yz.y)
+		{
+		}
 
 		/// <summary>
 		/// Gets a reference to a component at the index of index.
@@ -79,7 +91,10 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new Vector2D with x and y as its components.
 		/// </summary>
-		explicit operator Vector2D() const;
+		explicit constexpr operator Vector2D() const
+		{
+			return Vector2D(x, y);
+		}
 
 		/// <summary>
 		/// Creates a new Vector4D with x, y, z and 0 as its components.
@@ -99,36 +114,42 @@ namespace SupergodCore { namespace Math
 
 		#pragma region Axis Combinations.
 		/// <summary>A Vector2D with the x and y components of this vector.</summary>
-		inline Vector2D XY() const { return Vector2D(x, y); }
+		inline constexpr Vector2D XY() const { return Vector2D(x, y); }
 
         /// <summary>A Vector2D with the y and x components of this vector.</summary>
-		inline Vector2D YX() const { return Vector2D(y, x); }
+		inline constexpr Vector2D YX() const { return Vector2D(y, x); }
 
         /// <summary>A Vector2D with the x and z components of this vector.</summary>
-        inline Vector2D XZ() const { return Vector2D(x, z); }
+        inline constexpr Vector2D XZ() const { return Vector2D(x, z); }
 
         /// <summary>A Vector2D with the z and x components of this vector.</summary>
-        inline Vector2D ZX() const { return Vector2D(z, x); }
+        inline constexpr Vector2D ZX() const { return Vector2D(z, x); }
 
         /// <summary>A Vector2D with the y and z components of this vector.</summary>
-		inline Vector2D YZ() const { return Vector2D(y, z); }
+		inline constexpr Vector2D YZ() const { return Vector2D(y, z); }
 
         /// <summary>A Vector2D with the z and y components of this vector.</summary>
-		inline Vector2D ZY() const { return Vector2D(z, y); }
+		inline constexpr Vector2D ZY() const { return Vector2D(z, y); }
 		#pragma endregion
 
 		#pragma region Comparison methods (Equals, ContainsComponent and CloseEnough).
 		/// <summary>
 		/// Is every component of this same as its corresponding component in other?
 		/// </summary>
-		bool Equals(const Vector3D& other) const;
+		constexpr bool Equals(const Vector3D& other) const
+		{
+			return x == other.x && y == other.y && z == other.z;
+		}
 
 		/// <summary>
 		/// Is every component of this close enough to its corresponding component in other with the threshold of threshold?<para/>
 		/// See SupergodEngine::Math::Smath::CloseEnough.
 		/// </summary>
 		/// <param name="threshold">The threshold for each component to be considered close enough.</param>
-		bool CloseEnough(const Vector3D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const Vector3D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(x, other.x, threshold) && SMath::CloseEnough(y, other.y, threshold) && SMath::CloseEnough(z, other.z, threshold);
+		}
 
 		/// <summary>
 		/// Does any component pass test?
@@ -141,44 +162,68 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Adds every component of this with its corresponding component in other.
 		/// </summary>
-		Vector3D Add(const Vector3D& other) const;
+		constexpr Vector3D Add(const Vector3D& other) const
+		{
+			return Vector3D(x + other.x, y + other.y, z + other.z);
+		}
 
 		/// <summary>
 		/// Subtracts every component of other from its corresponding component in this.
 		/// </summary>
-		Vector3D Subtract(const Vector3D& other) const;
+		constexpr Vector3D Subtract(const Vector3D& other) const
+		{
+			return Vector3D(x - other.x, y - other.y, z - other.z);
+		}
 
 		/// <summary>
 		/// Negates every component of this.
 		/// </summary>
-		Vector3D Negated() const;
+		constexpr Vector3D Negated() const
+		{
+			return Vector3D(-x, -y, -z);
+		}
 		#pragma endregion
 
 		#pragma region Multiplication (Dot, Multiply and Cross).
 		/// <summary>
 		/// Gets the dot product of this and other.
 		/// </summary>
-		float Dot(const Vector3D& other) const;
+		constexpr float Dot(const Vector3D& other) const
+		{
+			return x * other.x + y * other.y + z * other.z;
+		}
 
 		/// <summary>
 		/// Multiplies this and other component-wise.
 		/// </summary>
-		Vector3D Multiply(const Vector3D& other) const;
+		constexpr Vector3D Multiply(const Vector3D& other) const
+		{
+			return Vector3D(x * other.x, y * other.y, z * other.z);
+		}
 
 		/// <summary>
 		/// Multiplies every component of this by scalar.
 		/// </summary>
-		Vector3D Multiply(float scalar) const;
+		constexpr Vector3D Multiply(float scalar) const
+		{
+			return Vector3D(x * scalar, y * scalar, z * scalar);
+		}
 
 		/// <summary>
 		/// Gets the cross product of this and other.
 		/// </summary>
-		Vector3D Cross(const Vector3D& other) const;
+		constexpr Vector3D Cross(const Vector3D& other) const
+		{
+			return Vector3D(
+				y * other.z - z * other.y,
+				z * other.x - x * other.z,
+				x * other.y - y * other.x);
+		}
 
 		/// <summary>
 		/// Gets the cross product of a and b.
 		/// </summary>
-		inline static Vector3D Cross(const Vector3D& a, const Vector3D& b)
+		inline static constexpr Vector3D Cross(const Vector3D& a, const Vector3D& b)
 		{
 			return a.Cross(b);
 		}
@@ -188,12 +233,18 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Divides every component of this by scalar.
 		/// </summary>
-		Vector3D Divide(float scalar) const;
+		constexpr Vector3D Divide(float scalar) const
+		{
+			return Vector3D(x / scalar, y / scalar, z / scalar);
+		}
 
 		/// <summary>
 		/// Divides every component of this by its corresponding component in scalar.
 		/// </summary>
-		Vector3D Divide(const Vector3D& other) const;
+		constexpr Vector3D Divide(const Vector3D& other) const
+		{
+			return Vector3D(x / other.x, y / other.y, z / other.z);
+		}
 		#pragma endregion
 
 		#pragma region BiggestComponent/BiggestComponent.
@@ -223,17 +274,26 @@ namespace SupergodCore { namespace Math
 		/// Gets a vector where all of its components are the absolute value of their corresponding component in this.
 		/// </summary>
 		/// <returns></returns>
-		Vector3D Abs() const;
+		constexpr Vector3D Abs() const
+		{
+			return Vector3D(SMath::Abs(x), SMath::Abs(y), SMath::Abs(z));
+		}
 
 		/// <summary>
 		/// Clamps every component of this so it's never smaller than its corresponding component in min and never bigger than its corresponding component in max.
 		/// </summary>
-		Vector3D Clamp(const Vector3D& min, const Vector3D& max) const;
+		constexpr Vector3D Clamp(const Vector3D& min, const Vector3D& max) const
+		{
+			return Vector3D(SMath::Clamp(x, min.x, max.x), SMath::Clamp(y, min.y, max.y), SMath::Clamp(z, min.z, max.z));
+		}
 
 		/// <summary>
 		/// Clamps every component of this so it's never smaller than min and never bigger than max.
 		/// </summary>
-		Vector3D ClampComponents(float min, float max) const;
+		constexpr Vector3D ClampComponents(float min, float max) const
+		{
+			return Vector3D(SMath::Clamp(x, min, max), SMath::Clamp(y, min, max), SMath::Clamp(z, min, max));
+		}
 		#pragma endregion
 	};
 } }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include "Vector3DDouble.h"
+#include <cmath>
+
+namespace SupergodCore { namespace Math
+{
+	double Vector3DDouble::Magnitude() const
+	{
+		return std::sqrt(SqrMagnitude());
+	}
+
+	double Vector3DDouble::Distance(const Vector3DDouble& other) const
+	{
+		return std::sqrt(SqrDistance(other));
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "../Interfaces/ISupergodEquatable.h"
+#include "../Interfaces/ArithmeticInterfaces.h"
+#include "Vector3D.h"
+
+namespace SupergodCore { namespace Math
+{
+	/// <summary>
+	/// Represents a 3-component mathematical vector with double precision components.<para/>
+	/// Use it for world positions that can be far away from the origin, where a Vector3D would lose precision (a float only has about a millimeter of precision 10 km from the origin).<para/>
+	/// See FloatingOrigin for converting these into float positions that are relative to a camera.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Vector3DDouble final : public ISupergodEquatable<Vector3DDouble>,
+		public IAddable<Vector3DDouble>, public ISubtractable<Vector3DDouble>, public INegatable<Vector3DDouble>
+	{
+		#pragma region Presets for common vectors.
+		/// <summary>
+		/// Gets a 3D vector with all of its components set to 0.
+		/// </summary>
+		DEFINE_STRUCT_VALUE_PRESET(Vector3DDouble, Zero, (0, 0, 0))
+
+		/// <summary>
+		/// Gets a 3D vector with all of its components set to 1.
+		/// </summary>
+		DEFINE_STRUCT_VALUE_PRESET(Vector3DDouble, One, (1, 1, 1))
+		#pragma endregion
+
+		union
+		{
+			struct { double x, y, z; };
+			double components[3];
+		};
+
+		/// <summary>Creates a new 3D vector and initializes all of its components to 0.</summary>
+		constexpr Vector3DDouble()
+			: x(0), y(0), z(0)
+		{
+		}
+
+		/// <summary>Creates a new 3D vector and initializes its components to x, y and z.</summary>
+		constexpr Vector3DDouble(double x, double y, double z)
+			: x(x), y(y), z(z)
+		{
+		}
+
+		/// <summary>Creates a new 3D vector with the components of vector.</summary>
+		explicit constexpr Vector3DDouble(const Vector3D& vector)
+			: x(vector.x), y(vector.y), z(vector.z)
+		{
+		}
+
+		/// <summary>
+		/// Gets a reference to a component at the index of index.
+		/// </summary>
+		/// <param name="index">The index of the component (0, 1 or 2).</param>
+		inline double& operator[](int index)
+		{
+			return components[index];
+		}
+
+		/// <summary>
+		/// Gets a reference to a component at the index of index.
+		/// </summary>
+		/// <param name="index">The index of the component (0, 1 or 2).</param>
+		inline const double& operator[](int index) const
+		{
+			return components[index];
+		}
+
+		/// <summary>
+		/// Creates a new Vector3D with the components of this rounded to float. This loses precision when this is far away from the origin.
+		/// </summary>
+		explicit constexpr operator Vector3D() const
+		{
+			return Vector3D((float)x, (float)y, (float)z);
+		}
+
+		#pragma region Comparison methods (Equals and CloseEnough).
+		/// <summary>
+		/// Is every component of this same as its corresponding component in other?
+		/// </summary>
+		constexpr bool Equals(const Vector3DDouble& other) const
+		{
+			return x == other.x && y == other.y && z == other.z;
+		}
+
+		/// <summary>
+		/// Is the distance between every component of this and its corresponding component in other smaller or equal to threshold?
+		/// </summary>
+		/// <param name="threshold">The threshold for each component to be considered close enough.</param>
+		constexpr bool CloseEnough(const Vector3DDouble& other, double threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			Vector3DDouble difference = Subtract(other);
+			return
+				(difference.x < 0 ? -difference.x : difference.x) <= threshold &&
+				(difference.y < 0 ? -difference.y : difference.y) <= threshold &&
+				(difference.z < 0 ? -difference.z : difference.z) <= threshold;
+		}
+		#pragma endregion
+
+		#pragma region Addition, subtraction and negation.
+		/// <summary>
+		/// Adds every component of this with its corresponding component in other.
+		/// </summary>
+		constexpr Vector3DDouble Add(const Vector3DDouble& other) const
+		{
+			return Vector3DDouble(x + other.x, y + other.y, z + other.z);
+		}
+
+		/// <summary>
+		/// Subtracts every component of other from its corresponding component in this.
+		/// </summary>
+		constexpr Vector3DDouble Subtract(const Vector3DDouble& other) const
+		{
+			return Vector3DDouble(x - other.x, y - other.y, z - other.z);
+		}
+
+		/// <summary>
+		/// Negates every component of this.
+		/// </summary>
+		constexpr Vector3DDouble Negated() const
+		{
+			return Vector3DDouble(-x, -y, -z);
+		}
+		#pragma endregion
+
+		#pragma region Multiplication and division.
+		/// <summary>
+		/// Gets the dot product of this and other.
+		/// </summary>
+		constexpr double Dot(const Vector3DDouble& other) const
+		{
+			return x * other.x + y * other.y + z * other.z;
+		}
+
+		/// <summary>
+		/// Gets the cross product of this and other.
+		/// </summary>
+		constexpr Vector3DDouble Cross(const Vector3DDouble& other) const
+		{
+			return Vector3DDouble(
+				y * other.z - z * other.y,
+				z * other.x - x * other.z,
+				x * other.y - y * other.x);
+		}
+
+		/// <summary>
+		/// Multiplies every component of this by scalar.
+		/// </summary>
+		constexpr Vector3DDouble Multiply(double scalar) const
+		{
+			return Vector3DDouble(x * scalar, y * scalar, z * scalar);
+		}
+
+		/// <summary>
+		/// Divides every component of this by scalar.
+		/// </summary>
+		constexpr Vector3DDouble Divide(double scalar) const
+		{
+			return Vector3DDouble(x / scalar, y / scalar, z / scalar);
+		}
+
+		/// <summary>
+		/// Multiplies every component of vector by scalar.
+		/// </summary>
+		inline friend constexpr Vector3DDouble operator*(const Vector3DDouble& vector, double scalar)
+		{
+			return vector.Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Multiplies every component of vector by scalar.
+		/// </summary>
+		inline friend constexpr Vector3DDouble operator*(double scalar, const Vector3DDouble& vector)
+		{
+			return vector.Multiply(scalar);
+		}
+
+		/// <summary>
+		/// Divides every component of vector by scalar.
+		/// </summary>
+		inline friend constexpr Vector3DDouble operator/(const Vector3DDouble& vector, double scalar)
+		{
+			return vector.Divide(scalar);
+		}
+		#pragma endregion
+
+		#pragma region Magnitude, distance and interpolation.
+		/// <summary>
+		/// Gets the squared magnitude (length) of this vector. This is faster than squaring the magnitude.
+		/// </summary>
+		constexpr double SqrMagnitude() const
+		{
+			return Dot(*this);
+		}
+
+		/// <summary>
+		/// Gets the magnitude (length) of this vector.
+		/// </summary>
+		double Magnitude() const;
+
+		/// <summary>
+		/// Gets the distance squared between this and other. This is faster than squaring the distance.
+		/// </summary>
+		constexpr double SqrDistance(const Vector3DDouble& other) const
+		{
+			return Subtract(other).SqrMagnitude();
+		}
+
+		/// <summary>
+		/// Gets the distance between this and other.
+		/// </summary>
+		double Distance(const Vector3DDouble& other) const;
+
+		/// <summary>
+		/// Linearly interpolates between this and target by alpha.
+		/// </summary>
+		/// <param name="target">The value to interpolate to.</param>
+		/// <param name="alpha">The interpolation factor.</param>
+		/// <param name="clampAlpha">Should alpha be clamped between 0 and 1?</param>
+		constexpr Vector3DDouble Lerp(const Vector3DDouble& target, double alpha, bool clampAlpha = true) const
+		{
+			if (clampAlpha)
+				alpha = alpha < 0 ? 0 : alpha > 1 ? 1 : alpha;
+
+			return Vector3DDouble(x + (target.x - x) * alpha, y + (target.y - y) * alpha, z + (target.z - z) * alpha);
+		}
+		#pragma endregion
+	};
+} }
\ No newline at end of file
@@ -40,28 +40,52 @@ namespace SupergodCore { namespace Math
 		};
 		
 		/// <summary>Initializes a new Vector4D with all of its components set to 0.</summary>
-		Vector4D();
+		constexpr Vector4D()
+			: x(0), y(0), z(0), w(0)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D for with an x, a y, a z, and a w.</summary>
-		Vector4D(float x, float y, float z, float w);
+		constexpr Vector4D(float x, float y, float z, float w)
+			: x(x), y(y), z(z), w(w)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D with a vector for x and y and a vector for z and w.</summary>
-		Vector4D(const Vector2D& xy, const Vector2D& zw);
+		constexpr Vector4D(const Vector2D& xy, const Vector2D& zw)
+			: x(xy.x), y(xy.y), z(zw.x), w(zw.y)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D with a vector for x, y and z and a float for w.</summary>
-		Vector4D(const Vector3D& xyz, float w);
+		constexpr Vector4D(const Vector3D& xyz, float w)
+			: x(xyz.x), y(xyz.y), z(xyz.z), w(w)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D with a float for x and a vector for y, z and w.</summary>
-		Vector4D(float x, const Vector3D& yzw);
+		constexpr Vector4D(float x, const Vector3D& yzw)
+			: x(x), y(yzw.x), z(yzw.y), w(yzw.z)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D with a float for x, y, and a vector for z and w.</summary>
-		Vector4D(float x, float y, const Vector2D& zw);
+		constexpr Vector4D(float x, float y, const Vector2D& zw)
+			: x(x), y(y), z(zw.x), w(zw.y)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D with a float for x, a vector for y and z, and a float for w.</summary>
-		Vector4D(float x, const Vector2D& yz, float w);
+		constexpr Vector4D(float x, const Vector2D& yz, float w)
+			: x(x), y(yz.x), z(yz.y), w(w)
+		{
+		}
 
 		/// <summary>Initializes a new Vector4D with a vector for x and y and floats for z and w.</summary>
-		Vector4D(const Vector2D& xy, float z, float w);
+		constexpr Vector4D(const Vector2D& xy, float z, float w)
+			: x(xy.x), y(xy.y), z(z), w(w)
+		{
+		}
 
 		/// <summary>
 		/// Gets a reference to a component at the index of index.
@@ -84,12 +108,18 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Creates a new Vector2D with x and y as its components.
 		/// </summary>
-		explicit operator Vector2D() const;
+		explicit constexpr operator Vector2D() const
+		{
+			return Vector2D(x, y);
+		}
 
 		/// <summary>
 		/// Creates a new Vector3D with x, y and z as its components.
 		/// </summary>
-		explicit operator Vector3D() const;
+		explicit constexpr operator Vector3D() const
+		{
+			return Vector3D(x, y, z);
+		}
 
 		/// <summary>
 		/// Creates a new color with red green blue alpha set as x y z w (in that order).
@@ -98,78 +128,84 @@ namespace SupergodCore { namespace Math
 
         #pragma region Specific Vector3D Axes.
         // X y and z combinations:
-        inline Vector3D YXZ() const { return Vector3D(y, x, z); }
-        inline Vector3D YZX() const { return Vector3D(y, z, x); }
+        inline constexpr Vector3D YXZ() const { return Vector3D(y, x, z); }
+        inline constexpr Vector3D YZX() const { return Vector3D(y, z, x); }
 
-        inline Vector3D ZXY() const { return Vector3D(z, x, y); }
-        inline Vector3D XZY() const { return Vector3D(x, z, y); }
+        inline constexpr Vector3D ZXY() const { return Vector3D(z, x, y); }
+        inline constexpr Vector3D XZY() const { return Vector3D(x, z, y); }
 
-        inline Vector3D ZYX() const { return Vector3D(z, y, x); }
-        inline Vector3D XYZ() const { return Vector3D(x, y, z); }
+        inline constexpr Vector3D ZYX() const { return Vector3D(z, y, x); }
+        inline constexpr Vector3D XYZ() const { return Vector3D(x, y, z); }
 
         // Y z and w combinations:
-        inline Vector3D YZW() const { return Vector3D(y, z, w); }
-        inline Vector3D YWZ() const { return Vector3D(y, w, z); }
+        inline constexpr Vector3D YZW() const { return Vector3D(y, z, w); }
+        inline constexpr Vector3D YWZ() const { return Vector3D(y, w, z); }
 
-        inline Vector3D ZYW() const { return Vector3D(z, y, w); }
-        inline Vector3D WYZ() const { return Vector3D(w, y, z); }
+        inline constexpr Vector3D ZYW() const { return Vector3D(z, y, w); }
+        inline constexpr Vector3D WYZ() const { return Vector3D(w, y, z); }
 
-        inline Vector3D ZWY() const { return Vector3D(z, w, y); }
-        inline Vector3D WZY() const { return Vector3D(w, z, y); }
+        inline constexpr Vector3D ZWY() const { return Vector3D(z, w, y); }
+        inline constexpr Vector3D WZY() const { return Vector3D(w, z, y); }
 
         // X z and w combinations:
-        inline Vector3D XZW() const { return Vector3D(x, z, w); }
-        inline Vector3D XWZ() const { return Vector3D(x, w, z); }
+        inline constexpr Vector3D XZW() const { return Vector3D(x, z, w); }
+        inline constexpr Vector3D XWZ() const { return Vector3D(x, w, z); }
 
-        inline Vector3D ZXW() const { return Vector3D(z, x, w); }
-        inline Vector3D WXZ() const { return Vector3D(w, x, z); }
+        inline constexpr Vector3D ZXW() const { return Vector3D(z, x, w); }
+        inline constexpr Vector3D WXZ() const { return Vector3D(w, x, z); }
 
-        inline Vector3D ZWX() const { return Vector3D(z, w, x); }
-        inline Vector3D WZX() const { return Vector3D(w, z, x); }
+        inline constexpr Vector3D ZWX() const { return Vector3D(z, w, x); }
+        inline constexpr Vector3D WZX() const { return Vector3D(w, z, x); }
 
         // Y w and x combinations:
-        inline Vector3D YWX() const { return Vector3D(y, w, x); }
-        inline Vector3D YXW() const { return Vector3D(y, x, w); }
+        inline constexpr Vector3D YWX() const { return Vector3D(y, w, x); }
+        inline constexpr Vector3D YXW() const { return Vector3D(y, x, w); }
 
-        inline Vector3D XYW() const { return Vector3D(x, y, w); }
-        inline Vector3D WYX() const { return Vector3D(w, y, x); }
+        inline constexpr Vector3D XYW() const { return Vector3D(x, y, w); }
+        inline constexpr Vector3D WYX() const { return Vector3D(w, y, x); }
 
-        inline Vector3D XWY() const { return Vector3D(x, w, y); }
-        inline Vector3D WXY() const { return Vector3D(w, x, y); }
+        inline constexpr Vector3D XWY() const { return Vector3D(x, w, y); }
+        inline constexpr Vector3D WXY() const { return Vector3D(w, x, y); }
         #pragma endregion
 
         #pragma region Specific Vector2D Axes.
-        inline Vector2D XY() const { return Vector2D(x, y); }
-        inline Vector2D YX() const { return Vector2D(y, x); }
+        inline constexpr Vector2D XY() const { return Vector2D(x, y); }
+        inline constexpr Vector2D YX() const { return Vector2D(y, x); }
 
-        inline Vector2D XZ() const { return Vector2D(x, z); }
-        inline Vector2D ZX() const { return Vector2D(z, x); }
+        inline constexpr Vector2D XZ() const { return Vector2D(x, z); }
+        inline constexpr Vector2D ZX() const { return Vector2D(z, x); }
 
-        inline Vector2D XW() const { return Vector2D(x, w); }
-        inline Vector2D WX() const { return Vector2D(w, x); }
+        inline constexpr Vector2D XW() const { return Vector2D(x, w); }
+        inline constexpr Vector2D WX() const { return Vector2D(w, x); }
 
-        inline Vector2D YZ() const { return Vector2D(y, z); }
-        inline Vector2D ZY() const { return Vector2D(z, y); }
+        inline constexpr Vector2D YZ() const { return Vector2D(y, z); }
+        inline constexpr Vector2D ZY() const { return Vector2D(z, y); }
 
-        inline Vector2D YW() const { return Vector2D(y, w); }
-        inline Vector2D WY() const { return Vector2D(w, y); }
+        inline constexpr Vector2D YW() const { return Vector2D(y, w); }
+        inline constexpr Vector2D WY() const { return Vector2D(w, y); }
 
-        inline Vector2D ZW() const { return Vector2D(z, w); }
-        inline Vector2D WZ() const { return Vector2D(w, z); }
+        inline constexpr Vector2D ZW() const { return Vector2D(z, w); }
+        inline constexpr Vector2D WZ() const { return Vector2D(w, z); }
         #pragma endregion
 
 		#pragma region Comparison methods (Equals, ContainsComponent and CloseEnough)
 		/// <summary>
 		/// Is every component of this same as its corresponding component in other?
 		/// </summary>
-		bool Equals(const Vector4D& other) const;
+		constexpr bool Equals(const Vector4D& other) const
+		{
+			return x == other.x && y == other.y && z == other.z && w == other.w;
+		}
 
 		/// <summary>
 		/// Is every component of this close enough to its corresponding component in other with the threshold of threshold?<para/>
 		/// See SupergodEngine::Math::Smath::CloseEnough.
 		/// </summary>
 		/// <param name="threshold">The threshold for each component to be considered close enough.</param>
-		bool CloseEnough(const Vector4D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const;
+		constexpr bool CloseEnough(const Vector4D& other, float threshold = Constants::CLOSE_ENOUGH_DEFAULT_THRESHOLD) const
+		{
+			return SMath::CloseEnough(x, other.x, threshold) && SMath::CloseEnough(y, other.y, threshold) && SMath::CloseEnough(z, other.z, threshold) && SMath::CloseEnough(w, other.w, threshold);
+		}
 
 		/// <summary>
 		/// Does any component pass test?
@@ -182,46 +218,70 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Adds every component of this with its corresponding component in other.
 		/// </summary>
-		Vector4D Add(const Vector4D& other) const;
+		constexpr Vector4D Add(const Vector4D& other) const
+		{
+			return Vector4D(x + other.x, y + other.y, z + other.z, w + other.w);
+		}
 
 		/// <summary>
 		/// Subtracts every component of other from its corresponding component in this.
 		/// </summary>
-		Vector4D Subtract(const Vector4D& other) const;
+		constexpr Vector4D Subtract(const Vector4D& other) const
+		{
+			return Vector4D(x - other.x, y - other.y, z - other.z, w - other.w);
+		}
 
 		/// <summary>
 		/// Negates every component of this.
 		/// </summary>
-		Vector4D Negated() const;
+		constexpr Vector4D Negated() const
+		{
+			return Vector4D(-x, -y, -z, -w);
+		}
 		#pragma endregion
 
 		#pragma region Multiplication (Dot and Multiply).
 		/// <summary>
 		/// Gets the dot product of this and other.
 		/// </summary>
-		float Dot(const Vector4D& other) const;
+		constexpr float Dot(const Vector4D& other) const
+		{
+			return x * other.x + y * other.y + z * other.z + w * other.w;
+		}
 
 		/// <summary>
 		/// Multiplies this and other component-wise.
 		/// </summary>
-		Vector4D Multiply(const Vector4D& other) const;
+		constexpr Vector4D Multiply(const Vector4D& other) const
+		{
+			return Vector4D(x * other.x, y * other.y, z * other.z, w * other.w);
+		}
 
 		/// <summary>
 		/// Multiplies every component of this by scalar.
 		/// </summary>
-		Vector4D Multiply(float scalar) const;
+		constexpr Vector4D Multiply(float scalar) const
+		{
+			return Vector4D(x * scalar, y * scalar, z * scalar, w * scalar);
+		}
 		#pragma endregion
 
 		#pragma region Division.
 		/// <summary>
 		/// Divides every component of this by scalar.
 		/// </summary>
-		Vector4D Divide(float scalar) const;
+		constexpr Vector4D Divide(float scalar) const
+		{
+			return Vector4D(x / scalar, y / scalar, z / scalar, w / scalar);
+		}
 
 		/// <summary>
 		/// Divides every component of this by its corresponding component in scalar.
 		/// </summary>
-		Vector4D Divide(const Vector4D& other) const;
+		constexpr Vector4D Divide(const Vector4D& other) const
+		{
+			return Vector4D(x / other.x, y / other.y, z / other.z, w / other.w);
+		}
 		#pragma endregion
 
 		#pragma region BiggestComponent/BiggestComponent.
@@ -251,17 +311,26 @@ namespace SupergodCore { namespace Math
 		/// Gets a vector where all of its components are the absolute value of their corresponding component in this.
 		/// </summary>
 		/// <returns></returns>
-		Vector4D Abs() const;
+		constexpr Vector4D Abs() const
+		{
+			return Vector4D(SMath::Abs(x), SMath::Abs(y), SMath::Abs(z), SMath::Abs(w));
+		}
 
 		/// <summary>
 		/// Clamps every component of this so it's never smaller than its corresponding component in min and never bigger than its corresponding component in max.
 		/// </summary>
-		Vector4D Clamp(const Vector4D& min, const Vector4D& max) const;
+		constexpr Vector4D Clamp(const Vector4D& min, const Vector4D& max) const
+		{
+			return Vector4D(SMath::Clamp(x, min.x, max.x), SMath::Clamp(y, min.y, max.y), SMath::Clamp(z, min.z, max.z), SMath::Clamp(w, min.w, max.w));
+		}
 
 		/// <summary>
 		/// Clamps every component of this so it's never smaller than min and never bigger than max.
 		/// </summary>
-		Vector4D ClampComponents(float min, float max) const;
+		constexpr Vector4D ClampComponents(float min, float max) const
+		{
+			return Vector4D(SMath::Clamp(x, min, max), SMath::Clamp(y, min, max), SMath::Clamp(z, min, max), SMath::Clamp(w, min, max));
+		}
 		#pragma endregion
 	};
 } }
\ No newline at end of file
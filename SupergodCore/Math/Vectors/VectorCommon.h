@@ -37,7 +37,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Gets the squared magnitude (length) of this vector. This is faster than squaring the magnitude.
 		/// </summary>
-		inline float SqrMagnitude() const
+		inline constexpr float SqrMagnitude() const
 		{
 			return TEMPLATED_INTERFACE_THIS.Dot((const T&)*this);
 		}
@@ -71,7 +71,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Projects this onto target.
 		/// </summary>
-		inline T ProjectOnto(const T& target) const
+		inline constexpr T ProjectOnto(const T& target) const
 		{
 			return TEMPLATED_INTERFACE_THIS.Dot(target) / target.SqrMagnitude() * target;
 		}
@@ -79,7 +79,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Reflects this through mirror using the formula "2 * m * ((v dot m) / |m|) - v" where v is this and m is mirror.
 		/// </summary>
-		inline T Reflect(const T& mirror) const
+		inline constexpr T Reflect(const T& mirror) const
 		{
 			return 2 * ProjectOnto(mirror) - (const T&)*this;
 		}
@@ -87,7 +87,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Gets a vector that goes from this to other.
 		/// </summary>
-		inline T LookAt(const T& other) const
+		inline constexpr T LookAt(const T& other) const
 		{
 			return ArithmeticOps::Subtract(other, (const T&)*this);
 		}
@@ -103,7 +103,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Gets the distance squared between this and other. This is faster than squaring the distance.
 		/// </summary>
-		inline float SqrDistance(const T& other) const
+		inline constexpr float SqrDistance(const T& other) const
 		{
 			return this->LookAt(other).SqrMagnitude();
 		}
@@ -142,7 +142,7 @@ namespace SupergodCore { namespace Math
 		/// <summary>
 		/// Multiplies every component of vector by scalar.
 		/// </summary>
-		inline friend T operator*(float scalar, const T& vector)
+		inline friend constexpr T operator*(float scalar, const T& vector)
 		{
 			return vector * scalar;
 		}
@@ -193,7 +193,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the dot product of a and b.
 		/// </summary>
 		template<class T>
-		inline float Dot(const T& a, const T& b)
+		inline constexpr float Dot(const T& a, const T& b)
 		{
 			return a.Dot(b);
 		}
@@ -212,7 +212,7 @@ namespace SupergodCore { namespace Math
 		/// Gets a vector where all of its components are the absolute value their corresponding component in vector.
 		///	</summary>
 		template<class T>
-		inline T Abs(const T& vector)
+		inline constexpr T Abs(const T& vector)
 		{
 			return vector.Abs();
 		}
@@ -221,7 +221,7 @@ namespace SupergodCore { namespace Math
 		/// Clamps all of the components of vector so they are never smaller than min and never bigger than max.
 		///	</summary>
 		template<class T>
-		inline T ClampComponents(const T& vector, float min, float max)
+		inline constexpr T ClampComponents(const T& vector, float min, float max)
 		{
 			return vector.ClampComponents(min, max);
 		}
@@ -230,7 +230,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the squared magnitude of vector. This is faster than squaring the magnitude.
 		/// </summary>
 		template<class T>
-		inline float SqrMagnitude(const T& vector)
+		inline constexpr float SqrMagnitude(const T& vector)
 		{
 			return vector.SqrMagnitude();
 		}
@@ -275,7 +275,7 @@ namespace SupergodCore { namespace Math
 		/// Projects source onto target.
 		/// </summary>
 		template<class T>
-		inline T ProjectOnto(const T& source, const T& target)
+		inline constexpr T ProjectOnto(const T& source, const T& target)
 		{
 			return source.ProjectOnto(target);
 		}
@@ -284,7 +284,7 @@ namespace SupergodCore { namespace Math
 		/// Reflects source through mirror using the formula "2 * m * ((v dot m) / |m|) - v" where v is source and m is mirror.
 		/// </summary>
 		template<class T>
-		inline T Reflect(const T& source, const T& mirror)
+		inline constexpr T Reflect(const T& source, const T& mirror)
 		{
 			return source.ProjectOnto(mirror);
 		}
@@ -293,7 +293,7 @@ namespace SupergodCore { namespace Math
 		/// Gets a vector that goes from a to b.
 		/// </summary>
 		template<class T>
-		inline T LookAt(const T& a, const T& b)
+		inline constexpr T LookAt(const T& a, const T& b)
 		{
 			return a.LookAt(b);
 		}
@@ -311,7 +311,7 @@ namespace SupergodCore { namespace Math
 		/// Gets the distance squared between a and b. This is faster than squaring the distance.
 		/// </summary>
 		template<class T>
-		inline float SqrDistance(const T& a, const T& b)
+		inline constexpr float SqrDistance(const T& a, const T& b)
 		{
 			return a.SqrDistance(b);
 		}
@@ -3,4 +3,5 @@
 #include "VectorCommon.h"
 #include "Vector2D.h"
 #include "Vector3D.h"
-#include "Vector4D.h"
\ No newline at end of file
+#include "Vector4D.h"
+#include "Vector3DDouble.h"
\ No newline at end of file
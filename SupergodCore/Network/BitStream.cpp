@@ -0,0 +1,144 @@
+#include "BitStream.h"
+
+namespace SupergodCore { namespace Network
+{
+	/// <summary>
+	/// The numbers of bits of the short codes of WriteDelta, for zigzag differences 0, 1 to 16 and 17 to 272.
+	/// Every code starts with a 1 for every shorter code it isn't and a 0, and anything bigger than all of them is written whole after 3 ones.
+	/// </summary>
+	static constexpr uint DELTA_BUCKET_BITS[] = { 0, 4, 8 };
+
+	/// <summary>
+	/// A mask of the low bits bits.
+	/// </summary>
+	static inline uint LowBits(uint bits)
+	{
+		return bits >= 32 ? 0xffffffff : (1u << bits) - 1;
+	}
+
+	/// <summary>
+	/// The difference between value and baseline modulo 2^bits, as the signed difference closest to 0, zigzag encoded so small differences of both signs are small numbers.
+	/// </summary>
+	static inline uint ZigzagDifference(uint value, uint baseline, uint bits)
+	{
+		uint difference = (value - baseline) & LowBits(bits);
+		if (bits < 32 && difference >> (bits - 1) != 0)
+			difference |= ~LowBits(bits);
+		return (difference << 1) ^ (uint)((int)difference >> 31);
+	}
+
+	/// <summary>
+	/// Undoes ZigzagDifference.
+	/// </summary>
+	static inline uint AddZigzagDifference(uint baseline, uint zigzag, uint bits)
+	{
+		uint difference = (zigzag >> 1) ^ (0 - (zigzag & 1));
+		return (baseline + difference) & LowBits(bits);
+	}
+
+	#pragma region BitWriter.
+	BitWriter::BitWriter()
+		: scratch(0), scratchBits(0), bitCount(0)
+	{
+	}
+
+	void BitWriter::Write(uint value, uint bits)
+	{
+		scratch |= (unsigned long long)(value & LowBits(bits)) << scratchBits;
+		scratchBits += bits;
+		bitCount += bits;
+		if (scratchBits >= 32)
+		{
+			for (int i = 0; i < 4; i++)
+				bytes.push_back((byte)(scratch >> (i * 8)));
+			scratch >>= 32;
+			scratchBits -= 32;
+		}
+	}
+
+	void BitWriter::WriteDelta(uint value, uint baseline, uint bits)
+	{
+		uint zigzag = ZigzagDifference(value, baseline, bits);
+		uint offset = 0;
+		for (uint bucketBits : DELTA_BUCKET_BITS)
+		{
+			if (zigzag - offset < (1u << bucketBits))
+			{
+				Write(0, 1);
+				Write(zigzag - offset, bucketBits);
+				return;
+			}
+			Write(1, 1);
+			offset += 1u << bucketBits;
+		}
+		Write(value, bits);
+	}
+
+	void BitWriter::Flush()
+	{
+		for (; scratchBits > 0; scratchBits = scratchBits > 8 ? scratchBits - 8 : 0)
+		{
+			bytes.push_back((byte)scratch);
+			scratch >>= 8;
+		}
+		scratch = 0;
+	}
+
+	void BitWriter::Clear()
+	{
+		bytes.clear();
+		scratch = 0;
+		scratchBits = 0;
+		bitCount = 0;
+	}
+	#pragma endregion
+
+	#pragma region BitReader.
+	BitReader::BitReader(const byte* data, size_t size)
+		: data(data), size(size), position(0), scratch(0), scratchBits(0), overflowed(false)
+	{
+	}
+
+	uint BitReader::Read(uint bits)
+	{
+		if (scratchBits < bits)
+		{
+			// There are at most 31 bits left, so 32 more always fit.
+			if (size - position >= 4)
+			{
+				uint word = (uint)data[position] | (uint)data[position + 1] << 8 | (uint)data[position + 2] << 16 | (uint)data[position + 3] << 24;
+				scratch |= (unsigned long long)word << scratchBits;
+				scratchBits += 32;
+				position += 4;
+			}
+			for (; scratchBits < bits && position < size; scratchBits += 8)
+				scratch |= (unsigned long long)data[position++] << scratchBits;
+
+			if (scratchBits < bits)
+			{
+				overflowed = true;
+				scratch = 0;
+				scratchBits = 0;
+				return 0;
+			}
+		}
+
+		uint value = (uint)scratch & LowBits(bits);
+		scratch >>= bits;
+		scratchBits -= bits;
+		return value;
+	}
+
+	uint BitReader::ReadDelta(uint baseline, uint bits)
+	{
+		uint offset = 0;
+		for (uint bucketBits : DELTA_BUCKET_BITS)
+		{
+			if (!ReadBool())
+				return AddZigzagDifference(baseline, offset + Read(bucketBits), bits);
+			offset += 1u << bucketBits;
+		}
+		return Read(bits);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
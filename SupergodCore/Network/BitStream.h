@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+
+namespace SupergodCore { namespace Network
+{
+	/// <summary>
+	/// Writes values of any number of bits (up to 32) one after the other, with nothing between them, into a growing buffer of bytes.<para/>
+	/// Values are written from their lowest bit, little-endian, so BitReader reads them back in the same order.
+	/// </summary>
+	class BitWriter final
+	{
+	public:
+		SUPERGOD_API_FUNC BitWriter();
+
+		/// <summary>
+		/// Writes the low bits of value. bits can be 0 (nothing is written) to 32.
+		/// </summary>
+		SUPERGOD_API_FUNC void Write(uint value, uint bits);
+
+		/// <summary>
+		/// Writes value as a single bit.
+		/// </summary>
+		inline void WriteBool(bool value) { Write(value ? 1 : 0, 1); }
+
+		/// <summary>
+		/// Writes a value of bits bits as its difference from baseline, in as few as 1 bit when they are the same and a few more when they are close.<para/>
+		/// The difference is taken modulo 2^bits, so values that wrap around (like quantized angles) are close to each other across the wrap too.
+		/// </summary>
+		SUPERGOD_API_FUNC void WriteDelta(uint value, uint baseline, uint bits);
+
+		/// <summary>
+		/// Writes the bits that are still waiting to fill 32 bits, padding the last byte with zeros. Call it before using GetBytes.
+		/// </summary>
+		SUPERGOD_API_FUNC void Flush();
+
+		/// <summary>
+		/// Removes everything that was written.
+		/// </summary>
+		SUPERGOD_API_FUNC void Clear();
+
+		/// <summary>
+		/// The bytes written so far. Bits written after the last Flush aren't there yet.
+		/// </summary>
+		inline const std::vector<byte>& GetBytes() const { return bytes; }
+
+		/// <summary>
+		/// The number of bits written, without the padding added by Flush.
+		/// </summary>
+		inline size_t GetBitCount() const { return bitCount; }
+
+	private:
+		std::vector<byte> bytes;
+		unsigned long long scratch;
+		uint scratchBits;
+		size_t bitCount;
+	};
+
+	/// <summary>
+	/// Reads values written by BitWriter, in the same order and with the same numbers of bits.<para/>
+	/// Reading past the end of the data reads zeros and marks the reader as overflowed, so a whole message can be read before checking HasOverflowed once.
+	/// </summary>
+	class SUPERGOD_API_CLASS BitReader final
+	{
+	public:
+		/// <summary>
+		/// Reads from the size bytes at data, which must stay alive while reading.
+		/// </summary>
+		BitReader(const byte* data, size_t size);
+
+		/// <summary>
+		/// Reads a value of bits bits, 0 to 32.
+		/// </summary>
+		uint Read(uint bits);
+
+		/// <summary>
+		/// Reads a single bit.
+		/// </summary>
+		inline bool ReadBool() { return Read(1) != 0; }
+
+		/// <summary>
+		/// Reads a value written by BitWriter::WriteDelta with the same baseline and bits.
+		/// </summary>
+		uint ReadDelta(uint baseline, uint bits);
+
+		/// <summary>
+		/// Did anything read past the end of the data?
+		/// </summary>
+		inline bool HasOverflowed() const { return overflowed; }
+
+		/// <summary>
+		/// The number of bits that weren't read yet.
+		/// </summary>
+		inline size_t GetBitsLeft() const { return (size - position) * 8 + scratchBits; }
+
+	private:
+		const byte* data;
+		size_t size;
+		size_t position;
+		unsigned long long scratch;
+		uint scratchBits;
+		bool overflowed;
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "BitStream.h"
+#include "Quantization.h"
+#include "Snapshot.h"
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Quantization.h"
+#include "Math/SMath.h"
+#include <cmath>
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Network
+{
+	using namespace Math;
+
+	/// <summary>
+	/// Rounds value to the nearest integer (ties to even), with cvtss2si like the bulk functions, so both give the same results.
+	/// </summary>
+	static inline int RoundToInt(float value)
+	{
+		return _mm_cvtss_si32(_mm_set_ss(value));
+	}
+
+	#pragma region Quantization.
+	Quantization::Quantization(float min, float max, uint bits)
+		: min(min), max(max), bits(bits), scale(((1u << bits) - 1) / (max - min)), step((max - min) / ((1u << bits) - 1)), biggest((float)((1u << bits) - 1))
+	{
+	}
+
+	uint Quantization::Quantize(float value) const
+	{
+		return (uint)RoundToInt(SMath::Min((SMath::Clamp(value, min, max) - min) * scale, biggest));
+	}
+
+	float Quantization::Dequantize(uint value) const
+	{
+		return min + (int)value * step;
+	}
+
+	void Quantization::Quantize(const float* source, uint* destination, size_t count) const
+	{
+		__m128 minimum = _mm_set1_ps(min);
+		__m128 maximum = _mm_set1_ps(max);
+		__m128 scales = _mm_set1_ps(scale);
+		__m128 biggests = _mm_set1_ps(biggest);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source + i), minimum), maximum);
+			_mm_storeu_si128((__m128i*)(destination + i), _mm_cvtps_epi32(_mm_min_ps(_mm_mul_ps(_mm_sub_ps(clamped, minimum), scales), biggests)));
+		}
+
+		for (; i < count; i++)
+			destination[i] = Quantize(source[i]);
+	}
+
+	void Quantization::Dequantize(const uint* source, float* destination, size_t count) const
+	{
+		__m128 minimum = _mm_set1_ps(min);
+		__m128 steps = _mm_set1_ps(step);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(destination + i, _mm_add_ps(minimum, _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(source + i))), steps)));
+
+		for (; i < count; i++)
+			destination[i] = Dequantize(source[i]);
+	}
+	#pragma endregion
+
+	#pragma region Angles.
+	uint AngleQuantization::Quantize(const Angle& angle, uint bits)
+	{
+		// Angles right before a full rotation round up to it, which is 0 again.
+		return (uint)RoundToInt(angle.GetRadians() * ((1u << bits) / Constants::TAU)) & ((1u << bits) - 1);
+	}
+
+	Angle AngleQuantization::Dequantize(uint value, uint bits)
+	{
+		return Angle(value * (Constants::TAU / (1u << bits)));
+	}
+	#pragma endregion
+
+	#pragma region Smallest three.
+	uint SmallestThree::Pack(const Quaternion& rotation, uint componentBits)
+	{
+		float components[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+		uint largest = 0;
+		for (uint i = 1; i < 4; i++)
+		{
+			if (std::abs(components[i]) > std::abs(components[largest]))
+				largest = i;
+		}
+
+		float sign = components[largest] < 0 ? -1.f : 1.f;
+		Quantization quantization(-Constants::SQRT2_OVER2, Constants::SQRT2_OVER2, componentBits);
+		uint packed = largest;
+		for (int i = 3; i >= 0; i--)
+		{
+			if ((uint)i != largest)
+				packed = packed << componentBits | quantization.Quantize(components[i] * sign);
+		}
+		return packed;
+	}
+
+	Quaternion SmallestThree::Unpack(uint packed, uint componentBits)
+	{
+		Quantization quantization(-Constants::SQRT2_OVER2, Constants::SQRT2_OVER2, componentBits);
+		uint mask = (1u << componentBits) - 1;
+		uint largest = packed >> (3 * componentBits);
+
+		float components[4];
+		float lengthSquared = 0;
+		for (uint i = 0; i < 4; i++)
+		{
+			if (i == largest)
+				continue;
+
+			components[i] = quantization.Dequantize(packed & mask);
+			lengthSquared += components[i] * components[i];
+			packed >>= componentBits;
+		}
+		components[largest] = std::sqrt(SMath::Max(1 - lengthSquared, 0.f));
+		return Quaternion(components[0], components[1], components[2], components[3]).Normalized();
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Angle.h"
+#include "Math/Quaternion.h"
+
+namespace SupergodCore { namespace Network
+{
+	/// <summary>
+	/// Quantizes floats in [min, max] to integers of bits bits, evenly spaced so 0 is min and the biggest integer is max.<para/>
+	/// Values out of the range are clamped, and values are rounded to the nearest integer (ties to even), by the scalar and the bulk (SSE2) functions alike.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Quantization final
+	{
+		/// <summary>
+		/// The most bits a quantized value can have, which is as precise as floats get anyway.
+		/// </summary>
+		static constexpr uint MAX_BITS = 24;
+
+		float min;
+		float max;
+		uint bits;
+
+		/// <summary>
+		/// The number of steps in 1, (2^bits - 1) / (max - min).
+		/// </summary>
+		float scale;
+
+		/// <summary>
+		/// The size of a step, (max - min) / (2^bits - 1).
+		/// </summary>
+		float step;
+
+		/// <summary>
+		/// The biggest quantized value, 2^bits - 1. With 23 bits or more, max times scale can round past it, so quantized values are clamped to it.
+		/// </summary>
+		float biggest;
+
+		/// <summary>
+		/// Creates a quantization of [min, max] to bits bits (1 to MAX_BITS). max must be bigger than min.
+		/// </summary>
+		Quantization(float min, float max, uint bits);
+
+		/// <summary>
+		/// The distance between two neighboring values, twice the biggest error of quantizing a value in the range.
+		/// </summary>
+		inline float GetPrecision() const { return step; }
+
+		uint Quantize(float value) const;
+		float Dequantize(uint value) const;
+
+		/// <summary>
+		/// Quantizes count floats (SSE2).
+		/// </summary>
+		void Quantize(const float* source, uint* destination, size_t count) const;
+
+		/// <summary>
+		/// Dequantizes count values (SSE2).
+		/// </summary>
+		void Dequantize(const uint* source, float* destination, size_t count) const;
+	};
+
+	/// <summary>
+	/// Quantizes angles to integers of bits bits (1 to Quantization::MAX_BITS) around the whole circle, so the biggest value is right before a full rotation and wraps around to 0.
+	/// Deltas of quantized angles (see BitWriter::WriteDelta) are small across the wrap too.
+	/// </summary>
+	namespace AngleQuantization
+	{
+		SUPERGOD_API_FUNC uint Quantize(const Math::Angle& angle, uint bits);
+		SUPERGOD_API_FUNC Math::Angle Dequantize(uint value, uint bits);
+	}
+
+	/// <summary>
+	/// Quantizes rotations with the smallest three encoding: the biggest component of a unit quaternion is dropped (and rebuilt from the others, since the length is 1),
+	/// and the 3 others, which are all in [-1/sqrt(2), 1/sqrt(2)], are quantized to componentBits bits each.<para/>
+	/// The packed value has the 3 components from the lowest bits up, then 2 bits of the index of the dropped component, 2 + 3 * componentBits bits in total.
+	/// With the default 10 bits a rotation takes 32 bits, and the error is smaller than 0.001 for every component.
+	/// </summary>
+	namespace SmallestThree
+	{
+		static constexpr uint DEFAULT_COMPONENT_BITS = 10;
+
+		/// <summary>
+		/// The most bits a component can have so a packed rotation fits in a uint.
+		/// </summary>
+		static constexpr uint MAX_COMPONENT_BITS = 10;
+
+		/// <summary>
+		/// The number of bits of a packed rotation.
+		/// </summary>
+		inline constexpr uint GetPackedBits(uint componentBits) { return 2 + 3 * componentBits; }
+
+		/// <summary>
+		/// Packs rotation, which should be normalized. q and -q are the same rotation, so the sign is chosen to make the dropped component positive.
+		/// </summary>
+		SUPERGOD_API_FUNC uint Pack(const Math::Quaternion& rotation, uint componentBits = DEFAULT_COMPONENT_BITS);
+
+		/// <summary>
+		/// Unpacks a packed rotation, normalizing it.
+		/// </summary>
+		SUPERGOD_API_FUNC Math::Quaternion Unpack(uint packed, uint componentBits = DEFAULT_COMPONENT_BITS);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "Snapshot.h"
+#include <emmintrin.h>
+
+namespace SupergodCore { namespace Network
+{
+	using namespace Math;
+
+	SnapshotSettings::SnapshotSettings(const Vector3D& minPosition, const Vector3D& maxPosition, uint positionBits, uint rotationBits)
+		: minPosition(minPosition), maxPosition(maxPosition), positionBits(positionBits), rotationBits(rotationBits)
+	{
+	}
+
+	SnapshotCodec::SnapshotCodec(const SnapshotSettings& settings)
+		: settings(settings), axes
+		{
+			Quantization(settings.minPosition.x, settings.maxPosition.x, settings.positionBits),
+			Quantization(settings.minPosition.y, settings.maxPosition.y, settings.positionBits),
+			Quantization(settings.minPosition.z, settings.maxPosition.z, settings.positionBits)
+		}
+	{
+	}
+
+	#pragma region Quantization.
+	/// <summary>
+	/// Sets the 3 patterns of 4 lanes that follow the x, y and z of 4 positions (12 floats) from the values of the 3 axes.
+	/// </summary>
+	static inline void SetAxisPatterns(float x, float y, float z, __m128 patterns[3])
+	{
+		patterns[0] = _mm_setr_ps(x, y, z, x);
+		patterns[1] = _mm_setr_ps(y, z, x, y);
+		patterns[2] = _mm_setr_ps(z, x, y, z);
+	}
+
+	void SnapshotCodec::Quantize(const Vector3D* positions, const Quaternion* rotations, size_t count, QuantizedSnapshot& snapshot) const
+	{
+		snapshot.positions.resize(count * 3);
+		snapshot.rotations.resize(count);
+
+		// The same as Quantization::Quantize, with a different quantization for every lane. All the axes have the same bits, so they have the same biggest value.
+		__m128 minimums[3], maximums[3], scales[3];
+		SetAxisPatterns(axes[0].min, axes[1].min, axes[2].min, minimums);
+		SetAxisPatterns(axes[0].max, axes[1].max, axes[2].max, maximums);
+		SetAxisPatterns(axes[0].scale, axes[1].scale, axes[2].scale, scales);
+		__m128 biggest = _mm_set1_ps(axes[0].biggest);
+
+		const float* source = &positions[0].x;
+		uint* destination = snapshot.positions.data();
+		size_t i = 0;
+		for (; i + 12 <= count * 3; i += 12)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				__m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source + i + j * 4), minimums[j]), maximums[j]);
+				_mm_storeu_si128((__m128i*)(destination + i + j * 4), _mm_cvtps_epi32(_mm_min_ps(_mm_mul_ps(_mm_sub_ps(clamped, minimums[j]), scales[j]), biggest)));
+			}
+		}
+		for (; i < count * 3; i++)
+			destination[i] = axes[i % 3].Quantize(source[i]);
+
+		for (i = 0; i < count; i++)
+			snapshot.rotations[i] = SmallestThree::Pack(rotations[i], settings.rotationBits);
+	}
+
+	void SnapshotCodec::Dequantize(const QuantizedSnapshot& snapshot, Vector3D* positions, Quaternion* rotations) const
+	{
+		size_t count = snapshot.GetCount();
+		__m128 minimums[3], steps[3];
+		SetAxisPatterns(axes[0].min, axes[1].min, axes[2].min, minimums);
+		SetAxisPatterns(axes[0].step, axes[1].step, axes[2].step, steps);
+
+		const uint* source = snapshot.positions.data();
+		float* destination = &positions[0].x;
+		size_t i = 0;
+		for (; i + 12 <= count * 3; i += 12)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				__m128 values = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(source + i + j * 4)));
+				_mm_storeu_ps(destination + i + j * 4, _mm_add_ps(minimums[j], _mm_mul_ps(values, steps[j])));
+			}
+		}
+		for (; i < count * 3; i++)
+			destination[i] = axes[i % 3].Dequantize(source[i]);
+
+		for (i = 0; i < count; i++)
+			rotations[i] = SmallestThree::Unpack(snapshot.rotations[i], settings.rotationBits);
+	}
+	#pragma endregion
+
+	#pragma region Encoding.
+	void SnapshotCodec::Encode(const QuantizedSnapshot& snapshot, const QuantizedSnapshot* baseline, BitWriter& writer) const
+	{
+		size_t count = snapshot.GetCount();
+		size_t baselineCount = baseline == nullptr ? 0 : baseline->GetCount();
+		uint componentBits = settings.rotationBits;
+		uint componentMask = (1u << componentBits) - 1;
+		uint rotationBits = SmallestThree::GetPackedBits(componentBits);
+
+		writer.Write((uint)count, 32);
+		for (size_t i = 0; i < count; i++)
+		{
+			const uint* position = &snapshot.positions[i * 3];
+			uint rotation = snapshot.rotations[i];
+			if (i >= baselineCount)
+			{
+				for (int axis = 0; axis < 3; axis++)
+					writer.Write(position[axis], settings.positionBits);
+				writer.Write(rotation, rotationBits);
+				continue;
+			}
+
+			const uint* basePosition = &baseline->positions[i * 3];
+			uint baseRotation = baseline->rotations[i];
+			bool changed = position[0] != basePosition[0] || position[1] != basePosition[1] || position[2] != basePosition[2] || rotation != baseRotation;
+			writer.WriteBool(changed);
+			if (!changed)
+				continue;
+
+			for (int axis = 0; axis < 3; axis++)
+				writer.WriteDelta(position[axis], basePosition[axis], settings.positionBits);
+
+			// The components can only be deltas of each other if the same one was dropped.
+			bool sameDropped = rotation >> (3 * componentBits) == baseRotation >> (3 * componentBits);
+			writer.WriteBool(sameDropped);
+			if (sameDropped)
+			{
+				for (uint component = 0; component < 3; component++)
+					writer.WriteDelta(rotation >> (component * componentBits) & componentMask, baseRotation >> (component * componentBits) & componentMask, componentBits);
+			}
+			else
+				writer.Write(rotation, rotationBits);
+		}
+	}
+
+	bool SnapshotCodec::Decode(BitReader& reader, const QuantizedSnapshot* baseline, QuantizedSnapshot& snapshot) const
+	{
+		// Every entity takes at least a bit, so bigger counts can only come from broken data.
+		size_t count = reader.Read(32);
+		if (reader.HasOverflowed() || count > reader.GetBitsLeft())
+			return false;
+
+		size_t baselineCount = baseline == nullptr ? 0 : baseline->GetCount();
+		uint componentBits = settings.rotationBits;
+		uint componentMask = (1u << componentBits) - 1;
+		uint rotationBits = SmallestThree::GetPackedBits(componentBits);
+
+		snapshot.positions.resize(count * 3);
+		snapshot.rotations.resize(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			uint* position = &snapshot.positions[i * 3];
+			if (i >= baselineCount)
+			{
+				for (int axis = 0; axis < 3; axis++)
+					position[axis] = reader.Read(settings.positionBits);
+				snapshot.rotations[i] = reader.Read(rotationBits);
+				continue;
+			}
+
+			const uint* basePosition = &baseline->positions[i * 3];
+			uint baseRotation = baseline->rotations[i];
+			if (!reader.ReadBool())
+			{
+				for (int axis = 0; axis < 3; axis++)
+					position[axis] = basePosition[axis];
+				snapshot.rotations[i] = baseRotation;
+				continue;
+			}
+
+			for (int axis = 0; axis < 3; axis++)
+				position[axis] = reader.ReadDelta(basePosition[axis], settings.positionBits);
+
+			if (reader.ReadBool())
+			{
+				uint rotation = baseRotation >> (3 * componentBits) << (3 * componentBits);
+				for (uint component = 0; component < 3; component++)
+					rotation |= reader.ReadDelta(baseRotation >> (component * componentBits) & componentMask, componentBits) << (component * componentBits);
+				snapshot.rotations[i] = rotation;
+			}
+			else
+				snapshot.rotations[i] = reader.Read(rotationBits);
+		}
+		return !reader.HasOverflowed();
+	}
+	#pragma endregion
+} }
\ No newline at end of file
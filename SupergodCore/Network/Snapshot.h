@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "Math/Quaternion.h"
+#include "BitStream.h"
+#include "Quantization.h"
+
+namespace SupergodCore { namespace Network
+{
+	/// <summary>
+	/// How the transforms of a snapshot are quantized.
+	/// </summary>
+	struct SUPERGOD_API_CLASS SnapshotSettings final
+	{
+		/// <summary>
+		/// The corners of the box all positions are in. Positions outside of it are clamped.
+		/// </summary>
+		Math::Vector3D minPosition, maxPosition;
+
+		/// <summary>
+		/// The bits of every axis of a position, up to Quantization::MAX_BITS.
+		/// </summary>
+		uint positionBits;
+
+		/// <summary>
+		/// The bits of every component of a rotation packed with SmallestThree, up to SmallestThree::MAX_COMPONENT_BITS.
+		/// </summary>
+		uint rotationBits;
+
+		/// <summary>
+		/// Creates settings for positions in the box between minPosition and maxPosition.
+		/// </summary>
+		SnapshotSettings(const Math::Vector3D& minPosition, const Math::Vector3D& maxPosition, uint positionBits = 18, uint rotationBits = SmallestThree::DEFAULT_COMPONENT_BITS);
+	};
+
+	/// <summary>
+	/// The quantized transforms of the entities in a snapshot, in separate arrays so they can be quantized in bulk.
+	/// Servers keep the snapshots clients acknowledged, to encode the next ones as deltas from them.
+	/// </summary>
+	struct QuantizedSnapshot final
+	{
+		/// <summary>
+		/// The quantized x, y and z of every position, one after the other.
+		/// </summary>
+		std::vector<uint> positions;
+
+		/// <summary>
+		/// Every rotation, packed with SmallestThree.
+		/// </summary>
+		std::vector<uint> rotations;
+
+		inline size_t GetCount() const { return rotations.size(); }
+	};
+
+	/// <summary>
+	/// Quantizes the positions and rotations of entities into snapshots and encodes them into bit streams, as deltas from a baseline snapshot when there is one.<para/>
+	/// A delta costs 1 bit for every entity that didn't move, and a few bits more for every component that changed by a little.
+	/// Entities that aren't in the baseline (the ones after its count) are written whole.
+	/// </summary>
+	class SUPERGOD_API_CLASS SnapshotCodec final
+	{
+	public:
+		SnapshotCodec(const SnapshotSettings& settings);
+
+		inline const SnapshotSettings& GetSettings() const { return settings; }
+
+		/// <summary>
+		/// Quantizes count positions and rotations into snapshot (the positions with SSE2).
+		/// </summary>
+		void Quantize(const Math::Vector3D* positions, const Math::Quaternion* rotations, size_t count, QuantizedSnapshot& snapshot) const;
+
+		/// <summary>
+		/// Dequantizes the positions and rotations of snapshot into arrays of its count (the positions with SSE2).
+		/// </summary>
+		void Dequantize(const QuantizedSnapshot& snapshot, Math::Vector3D* positions, Math::Quaternion* rotations) const;
+
+		/// <summary>
+		/// Writes snapshot to writer, as a delta from baseline unless it's null.
+		/// </summary>
+		void Encode(const QuantizedSnapshot& snapshot, const QuantizedSnapshot* baseline, BitWriter& writer) const;
+
+		/// <summary>
+		/// Reads a snapshot written by Encode with the same baseline into snapshot. Returns false if the data was cut short.
+		/// </summary>
+		bool Decode(BitReader& reader, const QuantizedSnapshot* baseline, QuantizedSnapshot& snapshot) const;
+
+	private:
+		SnapshotSettings settings;
+		Quantization axes[3];
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// An axis aligned bounding box, the space between min and max.
+	/// </summary>
+	struct SUPERGOD_API_CLASS BoundingBox final
+	{
+		Math::Vector3D min;
+		Math::Vector3D max;
+
+		/// <summary>
+		/// Creates an empty box at the origin.
+		/// </summary>
+		constexpr BoundingBox()
+			: min(), max()
+		{
+		}
+
+		/// <summary>
+		/// Creates a box from its minimum and maximum corners.
+		/// </summary>
+		constexpr BoundingBox(const Math::Vector3D& min, const Math::Vector3D& max)
+			: min(min), max(max)
+		{
+		}
+
+		/// <summary>
+		/// Creates a box around center that extends by extents to every side.
+		/// </summary>
+		static constexpr BoundingBox FromCenter(const Math::Vector3D& center, const Math::Vector3D& extents)
+		{
+			return BoundingBox(center - extents, center + extents);
+		}
+
+		/// <summary>
+		/// Do this and other overlap (touching counts)?
+		/// </summary>
+		constexpr bool Overlaps(const BoundingBox& other) const
+		{
+			return min.x <= other.max.x && other.min.x <= max.x &&
+				min.y <= other.max.y && other.min.y <= max.y &&
+				min.z <= other.max.z && other.min.z <= max.z;
+		}
+
+		/// <summary>
+		/// Is point inside this box (or on its sides)?
+		/// </summary>
+		constexpr bool Contains(const Math::Vector3D& point) const
+		{
+			return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y && point.z >= min.z && point.z <= max.z;
+		}
+
+		/// <summary>
+		/// Gets this box grown by margin on every side.
+		/// </summary>
+		constexpr BoundingBox Expanded(float margin) const
+		{
+			return BoundingBox(min - Math::Vector3D(margin, margin, margin), max + Math::Vector3D(margin, margin, margin));
+		}
+
+		/// <summary>
+		/// Gets the smallest box that contains both this and other.
+		/// </summary>
+		constexpr BoundingBox Merged(const BoundingBox& other) const
+		{
+			return BoundingBox(
+				Math::Vector3D(min.x < other.min.x ? min.x : other.min.x, min.y < other.min.y ? min.y : other.min.y, min.z < other.min.z ? min.z : other.min.z),
+				Math::Vector3D(max.x > other.max.x ? max.x : other.max.x, max.y > other.max.y ? max.y : other.max.y, max.z > other.max.z ? max.z : other.max.z));
+		}
+
+		/// <summary>
+		/// Gets the center of this box.
+		/// </summary>
+		constexpr Math::Vector3D Center() const
+		{
+			return (min + max) * .5f;
+		}
+
+		/// <summary>
+		/// Gets half the size of this box.
+		/// </summary>
+		constexpr Math::Vector3D Extents() const
+		{
+			return (max - min) * .5f;
+		}
+	};
+} }
\ No newline at end of file
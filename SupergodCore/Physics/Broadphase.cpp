@@ -0,0 +1,27 @@
+#include "Broadphase.h"
+#include <algorithm>
+
+namespace SupergodCore { namespace Physics
+{
+	void Broadphase::FindOverlaps(const BoundingBox* boxes, size_t count, std::vector<OverlapPair>& pairs, std::vector<uint>& order)
+	{
+		pairs.clear();
+
+		order.resize(count);
+		for (size_t i = 0; i < count; i++)
+			order[i] = (uint)i;
+		std::sort(order.begin(), order.end(), [boxes](uint a, uint b) { return boxes[a].min.x < boxes[b].min.x; });
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const BoundingBox& box = boxes[order[i]];
+			for (size_t j = i + 1; j < count && boxes[order[j]].min.x <= box.max.x; j++)
+			{
+				if (box.Overlaps(boxes[order[j]]))
+					pairs.push_back(order[i] < order[j] ? OverlapPair{ order[i], order[j] } : OverlapPair{ order[j], order[i] });
+			}
+		}
+
+		std::sort(pairs.begin(), pairs.end(), [](const OverlapPair& a, const OverlapPair& b) { return a.Key() < b.Key(); });
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "BoundingBox.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// Two indices of overlapping objects, where a is smaller than b.
+	/// </summary>
+	struct SUPERGOD_API_CLASS OverlapPair final
+	{
+		uint a;
+		uint b;
+
+		/// <summary>
+		/// Gets a key that sorts pairs by a and then by b.
+		/// </summary>
+		inline unsigned long long Key() const
+		{
+			return (unsigned long long)a << 32 | b;
+		}
+	};
+
+	/// <summary>
+	/// Finds the pairs of bounding boxes that might collide.
+	/// </summary>
+	namespace Broadphase
+	{
+		/// <summary>
+		/// Finds every pair of overlapping boxes with sweep and prune: the boxes are sorted by their minimum x, and every box is only tested against the boxes that start before it ends.<para/>
+		/// pairs is cleared first, and filled sorted by OverlapPair::Key. This sorts from scratch, so for boxes that move every frame use SweepAndPrune, which keeps the order between updates.
+		/// </summary>
+		/// <param name="order">Scratch memory for the sorted indices of the boxes. Keep it between calls (like pairs) so it's only allocated when count grows.</param>
+		SUPERGOD_API_FUNC void FindOverlaps(const BoundingBox* boxes, size_t count, std::vector<OverlapPair>& pairs, std::vector<uint>& order);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,552 @@
+#include "Collision.h"
+#include "Math/SMath.h"
+#include <limits>
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	/// <summary>
+	/// Lengths and squared lengths below this are treated as 0.
+	/// </summary>
+	constexpr float EPSILON = 1e-6f;
+
+	static inline float Sign(float value)
+	{
+		return value >= 0 ? 1.f : -1.f;
+	}
+
+	/// <summary>
+	/// Adds a point to manifold if there is room for it.
+	/// </summary>
+	static inline void AddPoint(ContactManifold& manifold, const Vector3D& position, float depth)
+	{
+		if (manifold.pointCount == ContactManifold::MAX_POINTS)
+			return;
+
+		ContactPoint& point = manifold.points[manifold.pointCount++];
+		point = ContactPoint();
+		point.position = position;
+		point.depth = depth;
+	}
+
+	/// <summary>
+	/// Gets the segment in the middle of a sphere (both ends at its center) or a capsule.
+	/// </summary>
+	static inline void GetSegment(const RigidBody& body, Vector3D& start, Vector3D& end)
+	{
+		Vector3D halfAxis = body.shape.type == ShapeType::Capsule ? body.orientation.Rotate(Vector3D(0, body.shape.halfHeight, 0)) : Vector3D::Zero();
+		start = body.position - halfAxis;
+		end = body.position + halfAxis;
+	}
+
+	/// <summary>
+	/// Gets where (from 0 to 1) the point of the segment from start to end that is closest to point is.
+	/// </summary>
+	static inline float ClosestOnSegment(const Vector3D& point, const Vector3D& start, const Vector3D& end)
+	{
+		Vector3D direction = end - start;
+		float sqrLength = direction.Dot(direction);
+		return sqrLength <= EPSILON ? 0 : SMath::Clamp((point - start).Dot(direction) / sqrLength, 0, 1);
+	}
+
+	/// <summary>
+	/// Finds the closest points between the segments from start1 to end1 and from start2 to end2, as s and t between 0 and 1 along each of them.
+	/// </summary>
+	static void ClosestBetweenSegments(const Vector3D& start1, const Vector3D& end1, const Vector3D& start2, const Vector3D& end2, float& s, float& t)
+	{
+		Vector3D direction1 = end1 - start1;
+		Vector3D direction2 = end2 - start2;
+		Vector3D offset = start1 - start2;
+		float a = direction1.Dot(direction1);
+		float e = direction2.Dot(direction2);
+		float f = direction2.Dot(offset);
+
+		if (a <= EPSILON && e <= EPSILON)
+		{
+			s = t = 0;
+			return;
+		}
+
+		if (a <= EPSILON)
+		{
+			s = 0;
+			t = SMath::Clamp(f / e, 0, 1);
+			return;
+		}
+
+		float c = direction1.Dot(offset);
+		if (e <= EPSILON)
+		{
+			t = 0;
+			s = SMath::Clamp(-c / a, 0, 1);
+			return;
+		}
+
+		float b = direction1.Dot(direction2);
+		float denominator = a * e - b * b;
+		s = denominator != 0 ? SMath::Clamp((b * f - c * e) / denominator, 0, 1) : 0;
+		t = (b * s + f) / e;
+		if (t < 0)
+		{
+			t = 0;
+			s = SMath::Clamp(-c / a, 0, 1);
+		}
+		else if (t > 1)
+		{
+			t = 1;
+			s = SMath::Clamp((b - c) / a, 0, 1);
+		}
+	}
+
+	#pragma region Spheres and capsules.
+	/// <summary>
+	/// Adds a contact between the points pointA and pointB of two round shapes if they are closer than the sum of their radii.
+	/// </summary>
+	/// <param name="normal">Set to the direction from pointA to pointB when a contact is added, and used as is when the points are at the same place.</param>
+	static bool AddRoundContact(ContactManifold& manifold, const Vector3D& pointA, float radiusA, const Vector3D& pointB, float radiusB, Vector3D& normal)
+	{
+		Vector3D offset = pointB - pointA;
+		float sqrDistance = offset.Dot(offset);
+		float radii = radiusA + radiusB;
+		if (sqrDistance > radii * radii)
+			return false;
+
+		float distance = SMath::Sqrt(sqrDistance);
+		if (distance > EPSILON)
+			normal = offset / distance;
+
+		Vector3D surfaceA = pointA + normal * radiusA;
+		Vector3D surfaceB = pointB - normal * radiusB;
+		AddPoint(manifold, (surfaceA + surfaceB) * .5f, radii - distance);
+		return true;
+	}
+
+	/// <summary>
+	/// Collides two spheres or capsules as segments with radii.
+	/// </summary>
+	static int CollideRound(const RigidBody& a, const RigidBody& b, ContactManifold& manifold)
+	{
+		Vector3D startA, endA, startB, endB;
+		GetSegment(a, startA, endA);
+		GetSegment(b, startB, endB);
+
+		float s, t;
+		ClosestBetweenSegments(startA, endA, startB, endB, s, t);
+		Vector3D directionA = endA - startA, directionB = endB - startB;
+
+		manifold.normal = Vector3D::UnitY();
+		if (!AddRoundContact(manifold, startA + directionA * s, a.shape.radius, startB + directionB * t, b.shape.radius, manifold.normal))
+			return 0;
+
+		// Parallel capsules touch along a line, which needs a contact at each end of it to keep them from rolling over each other.
+		float sqrLengthA = directionA.Dot(directionA), sqrLengthB = directionB.Dot(directionB);
+		Vector3D cross = directionA.Cross(directionB);
+		if (sqrLengthA > EPSILON && sqrLengthB > EPSILON && cross.Dot(cross) <= 1e-4f * sqrLengthA * sqrLengthB)
+		{
+			float first = ClosestOnSegment(startB, startA, endA), second = ClosestOnSegment(endB, startA, endA);
+			float from = SMath::Min(first, second), to = SMath::Max(first, second);
+			if ((to - from) * (to - from) * sqrLengthA > .01f * a.shape.radius * a.shape.radius)
+			{
+				manifold.pointCount = 0;
+				for (float along : { from, to })
+				{
+					Vector3D pointA = startA + directionA * along;
+					Vector3D pointB = startB + directionB * ClosestOnSegment(pointA, startB, endB);
+					Vector3D normal = manifold.normal;
+					AddRoundContact(manifold, pointA, a.shape.radius, pointB, b.shape.radius, normal);
+				}
+			}
+		}
+
+		return manifold.pointCount;
+	}
+	#pragma endregion
+
+	#pragma region Boxes and round shapes.
+	/// <summary>
+	/// A contact between a box and a sphere in the local space of the box.
+	/// </summary>
+	struct BoxPointContact
+	{
+		/// <summary>From the box to the sphere.</summary>
+		Vector3D normal;
+		Vector3D position;
+		float depth;
+	};
+
+	/// <summary>
+	/// Collides a box with halfExtents at the origin and a sphere with radius at center.
+	/// </summary>
+	static bool CollideBoxPoint(const Vector3D& halfExtents, const Vector3D& center, float radius, BoxPointContact& contact)
+	{
+		Vector3D clamped = center.Clamp(-halfExtents, halfExtents);
+		Vector3D boxPoint;
+		if (!(clamped == center))
+		{
+			Vector3D offset = center - clamped;
+			float sqrDistance = offset.Dot(offset);
+			if (sqrDistance > radius * radius)
+				return false;
+
+			float distance = SMath::Sqrt(sqrDistance);
+			contact.normal = offset / distance;
+			contact.depth = radius - distance;
+			boxPoint = clamped;
+		}
+		else
+		{
+			// The center is inside the box, so it's pushed out through the closest face.
+			int axis = 0;
+			float closest = halfExtents.x - SMath::Abs(center.x);
+			for (int i = 1; i < 3; i++)
+			{
+				float distance = halfExtents.components[i] - SMath::Abs(center.components[i]);
+				if (distance < closest)
+				{
+					closest = distance;
+					axis = i;
+				}
+			}
+
+			contact.normal = Vector3D::Zero();
+			contact.normal.components[axis] = Sign(center.components[axis]);
+			contact.depth = radius + closest;
+			boxPoint = center;
+			boxPoint.components[axis] = Sign(center.components[axis]) * halfExtents.components[axis];
+		}
+
+		contact.position = (boxPoint + center - contact.normal * radius) * .5f;
+		return true;
+	}
+
+	/// <summary>
+	/// Collides a box with a sphere or capsule. The normal points from the box to the round shape.
+	/// </summary>
+	static int CollideBoxRound(const RigidBody& box, const RigidBody& round, ContactManifold& manifold)
+	{
+		Vector3D start, end;
+		GetSegment(round, start, end);
+		start = box.ToLocal(start);
+		end = box.ToLocal(end);
+		const Vector3D& halfExtents = box.shape.halfExtents;
+		float radius = round.shape.radius;
+
+		BoxPointContact contacts[2];
+		int count = 0;
+		if (round.shape.type == ShapeType::Capsule)
+		{
+			// A capsule lying on a face touches it at both ends.
+			BoxPointContact startContact, endContact;
+			if (CollideBoxPoint(halfExtents, start, radius, startContact) && CollideBoxPoint(halfExtents, end, radius, endContact) &&
+				startContact.normal.Dot(endContact.normal) > .95f)
+			{
+				contacts[0] = startContact;
+				contacts[1] = endContact;
+				count = 2;
+			}
+		}
+
+		if (count == 0)
+		{
+			// Alternating between the closest point in the box and the closest point on the segment converges to the closest pair, since both are convex.
+			Vector3D point = (start + end) * .5f;
+			for (int i = 0; i < 4; i++)
+				point = start + (end - start) * ClosestOnSegment(point.Clamp(-halfExtents, halfExtents), start, end);
+
+			if (!CollideBoxPoint(halfExtents, point, radius, contacts[0]))
+				return 0;
+			count = 1;
+		}
+
+		manifold.normal = box.orientation.Rotate(contacts[0].normal);
+		for (int i = 0; i < count; i++)
+			AddPoint(manifold, box.ToWorld(contacts[i].position), contacts[i].depth);
+		return count;
+	}
+	#pragma endregion
+
+	#pragma region Boxes.
+	/// <summary>
+	/// A box in world space, as its center, axes and half extents.
+	/// </summary>
+	struct OrientedBox
+	{
+		Vector3D center;
+		Vector3D axes[3];
+		float halfExtents[3];
+
+		explicit OrientedBox(const RigidBody& body)
+			: center(body.position)
+		{
+			Matrix3x3 rotation = body.orientation.ToMatrix();
+			for (int i = 0; i < 3; i++)
+			{
+				axes[i] = rotation.GetColumn(i);
+				halfExtents[i] = body.shape.halfExtents.components[i];
+			}
+		}
+
+		/// <summary>
+		/// Gets half the length of the projection of this box on axis.
+		/// </summary>
+		inline float ProjectedRadius(const Vector3D& axis) const
+		{
+			return halfExtents[0] * SMath::Abs(axes[0].Dot(axis)) + halfExtents[1] * SMath::Abs(axes[1].Dot(axis)) + halfExtents[2] * SMath::Abs(axes[2].Dot(axis));
+		}
+	};
+
+	/// <summary>
+	/// Keeps the points of polygon that are on the inner side of a plane (dot(normal, point) smaller or equal to offset), adding the points where its edges cross the plane.
+	/// </summary>
+	static int ClipPolygon(const Vector3D* polygon, int count, const Vector3D& normal, float offset, Vector3D* clipped)
+	{
+		int clippedCount = 0;
+		for (int i = 0; i < count; i++)
+		{
+			const Vector3D& current = polygon[i];
+			const Vector3D& next = polygon[(i + 1) % count];
+			float currentDistance = normal.Dot(current) - offset;
+			float nextDistance = normal.Dot(next) - offset;
+
+			if (currentDistance <= 0)
+				clipped[clippedCount++] = current;
+
+			if ((currentDistance < 0 && nextDistance > 0) || (currentDistance > 0 && nextDistance < 0))
+				clipped[clippedCount++] = current + (next - current) * (currentDistance / (currentDistance - nextDistance));
+		}
+		return clippedCount;
+	}
+
+	/// <summary>
+	/// Adds the deepest of count contact points and 3 more that cover the biggest area to manifold.
+	/// </summary>
+	static void AddReducedPoints(ContactManifold& manifold, const Vector3D* positions, const float* depths, int count)
+	{
+		if (count <= ContactManifold::MAX_POINTS)
+		{
+			for (int i = 0; i < count; i++)
+				AddPoint(manifold, positions[i], depths[i]);
+			return;
+		}
+
+		int deepest = 0;
+		for (int i = 1; i < count; i++)
+		{
+			if (depths[i] > depths[deepest])
+				deepest = i;
+		}
+
+		int farthest = deepest == 0 ? 1 : 0;
+		for (int i = 0; i < count; i++)
+		{
+			if (positions[i].SqrDistance(positions[deepest]) > positions[farthest].SqrDistance(positions[deepest]))
+				farthest = i;
+		}
+
+		// The points that make the biggest triangles with the first two, on each side of the line between them.
+		int left = -1, right = -1;
+		float leftArea = 0, rightArea = 0;
+		Vector3D edge = positions[farthest] - positions[deepest];
+		for (int i = 0; i < count; i++)
+		{
+			float area = edge.Cross(positions[i] - positions[deepest]).Dot(manifold.normal);
+			if (area > leftArea)
+			{
+				leftArea = area;
+				left = i;
+			}
+			else if (area < rightArea)
+			{
+				rightArea = area;
+				right = i;
+			}
+		}
+
+		for (int i : { deepest, left, farthest, right })
+		{
+			if (i >= 0)
+				AddPoint(manifold, positions[i], depths[i]);
+		}
+	}
+
+	/// <summary>
+	/// Collides the face of reference with the normal axisIndex * sign that faces incident. normal points out of reference.
+	/// </summary>
+	static int CollideFaces(const OrientedBox& reference, int axisIndex, const Vector3D& normal, const OrientedBox& incident, ContactManifold& manifold)
+	{
+		// The face of incident that faces the reference face the most.
+		int incidentAxis = 0;
+		float mostAligned = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			float aligned = SMath::Abs(incident.axes[i].Dot(normal));
+			if (aligned > mostAligned)
+			{
+				mostAligned = aligned;
+				incidentAxis = i;
+			}
+		}
+
+		float incidentSign = incident.axes[incidentAxis].Dot(normal) > 0 ? -1.f : 1.f;
+		Vector3D faceCenter = incident.center + incident.axes[incidentAxis] * (incidentSign * incident.halfExtents[incidentAxis]);
+		Vector3D side1 = incident.axes[(incidentAxis + 1) % 3] * incident.halfExtents[(incidentAxis + 1) % 3];
+		Vector3D side2 = incident.axes[(incidentAxis + 2) % 3] * incident.halfExtents[(incidentAxis + 2) % 3];
+
+		// Every clip can add a point, so 4 sides grow a quad to at most 8 points.
+		Vector3D polygon[8] = { faceCenter + side1 + side2, faceCenter - side1 + side2, faceCenter - side1 - side2, faceCenter + side1 - side2 };
+		Vector3D clipped[8];
+		int count = 4;
+		for (int side = 1; side <= 2 && count > 0; side++)
+		{
+			const Vector3D& axis = reference.axes[(axisIndex + side) % 3];
+			float extent = reference.halfExtents[(axisIndex + side) % 3];
+			float center = axis.Dot(reference.center);
+
+			count = ClipPolygon(polygon, count, axis, center + extent, clipped);
+			count = ClipPolygon(clipped, count, -axis, extent - center, polygon);
+		}
+
+		float faceOffset = normal.Dot(reference.center) + reference.halfExtents[axisIndex];
+		Vector3D positions[8];
+		float depths[8];
+		int contactCount = 0;
+		for (int i = 0; i < count; i++)
+		{
+			float separation = normal.Dot(polygon[i]) - faceOffset;
+			if (separation <= 0)
+			{
+				positions[contactCount] = polygon[i] - normal * (separation * .5f);
+				depths[contactCount++] = -separation;
+			}
+		}
+
+		AddReducedPoints(manifold, positions, depths, contactCount);
+		return manifold.pointCount;
+	}
+
+	/// <summary>
+	/// Collides two boxes with the separating axis test on the 6 face normals and 9 edge cross products.
+	/// </summary>
+	static int CollideBoxes(const RigidBody& a, const RigidBody& b, ContactManifold& manifold)
+	{
+		OrientedBox boxA(a), boxB(b);
+		Vector3D offset = boxB.center - boxA.center;
+
+		auto separation = [&](const Vector3D& axis)
+		{
+			return SMath::Abs(offset.Dot(axis)) - boxA.ProjectedRadius(axis) - boxB.ProjectedRadius(axis);
+		};
+
+		const float lowest = std::numeric_limits<float>::lowest();
+		float faceSeparationA = lowest, faceSeparationB = lowest, edgeSeparation = lowest;
+		int faceA = 0, faceB = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			float separationA = separation(boxA.axes[i]);
+			float separationB = separation(boxB.axes[i]);
+			if (separationA > 0 || separationB > 0)
+				return 0;
+
+			if (separationA > faceSeparationA)
+			{
+				faceSeparationA = separationA;
+				faceA = i;
+			}
+			if (separationB > faceSeparationB)
+			{
+				faceSeparationB = separationB;
+				faceB = i;
+			}
+		}
+
+		int edgeA = -1, edgeB = -1;
+		Vector3D edgeAxis;
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				// Parallel edges have no cross product, and the face axes already cover them.
+				Vector3D axis = boxA.axes[i].Cross(boxB.axes[j]);
+				float length = axis.Magnitude();
+				if (length < 1e-4f)
+					continue;
+
+				axis = axis / length;
+				float edge = separation(axis);
+				if (edge > 0)
+					return 0;
+
+				if (edge > edgeSeparation)
+				{
+					edgeSeparation = edge;
+					edgeA = i;
+					edgeB = j;
+					edgeAxis = axis;
+				}
+			}
+		}
+
+		// Faces are preferred unless an edge axis is clearly better, so resting contacts don't flicker between the cases.
+		const float relativeTolerance = .95f, absoluteTolerance = .01f;
+		bool useFaceB = faceSeparationB > relativeTolerance * faceSeparationA + absoluteTolerance;
+		float faceSeparation = useFaceB ? faceSeparationB : faceSeparationA;
+
+		if (edgeA >= 0 && edgeSeparation > relativeTolerance * faceSeparation + absoluteTolerance)
+		{
+			Vector3D normal = edgeAxis * Sign(edgeAxis.Dot(offset));
+			manifold.normal = normal;
+
+			// The edge of each box that is the furthest towards the other box.
+			Vector3D pointA = boxA.center, pointB = boxB.center;
+			for (int i = 0; i < 3; i++)
+			{
+				if (i != edgeA)
+					pointA += boxA.axes[i] * (boxA.halfExtents[i] * Sign(boxA.axes[i].Dot(normal)));
+				if (i != edgeB)
+					pointB -= boxB.axes[i] * (boxB.halfExtents[i] * Sign(boxB.axes[i].Dot(normal)));
+			}
+
+			Vector3D halfEdgeA = boxA.axes[edgeA] * boxA.halfExtents[edgeA], halfEdgeB = boxB.axes[edgeB] * boxB.halfExtents[edgeB];
+			float s, t;
+			ClosestBetweenSegments(pointA - halfEdgeA, pointA + halfEdgeA, pointB - halfEdgeB, pointB + halfEdgeB, s, t);
+			Vector3D closestA = pointA - halfEdgeA + halfEdgeA * (2 * s);
+			Vector3D closestB = pointB - halfEdgeB + halfEdgeB * (2 * t);
+			AddPoint(manifold, (closestA + closestB) * .5f, -edgeSeparation);
+			return 1;
+		}
+
+		if (useFaceB)
+		{
+			Vector3D normal = boxB.axes[faceB] * -Sign(boxB.axes[faceB].Dot(offset));
+			manifold.normal = -normal;
+			return CollideFaces(boxB, faceB, normal, boxA, manifold);
+		}
+
+		Vector3D normal = boxA.axes[faceA] * Sign(boxA.axes[faceA].Dot(offset));
+		manifold.normal = normal;
+		return CollideFaces(boxA, faceA, normal, boxB, manifold);
+	}
+	#pragma endregion
+
+	int Collision::Collide(const RigidBody& a, const RigidBody& b, ContactManifold& manifold)
+	{
+		manifold.pointCount = 0;
+		bool boxA = a.shape.type == ShapeType::Box, boxB = b.shape.type == ShapeType::Box;
+
+		if (boxA && boxB)
+			return CollideBoxes(a, b, manifold);
+
+		if (boxA)
+			return CollideBoxRound(a, b, manifold);
+
+		if (boxB)
+		{
+			int count = CollideBoxRound(b, a, manifold);
+			manifold.normal = -manifold.normal;
+			return count;
+		}
+
+		return CollideRound(a, b, manifold);
+	}
+} }
\ No newline at end of file
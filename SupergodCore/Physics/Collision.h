@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "RigidBody.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// A point where two bodies touch.
+	/// </summary>
+	struct SUPERGOD_API_CLASS ContactPoint final
+	{
+		/// <summary>
+		/// The point in world space, halfway between the surfaces of the bodies.
+		/// </summary>
+		Math::Vector3D position;
+
+		/// <summary>
+		/// How deep the bodies are inside each other along the normal of the manifold.
+		/// </summary>
+		float depth = 0;
+
+		/// <summary>
+		/// position in the local space of the first body, used to recognize the same point in the next step.
+		/// </summary>
+		Math::Vector3D localPosition;
+
+		/// <summary>
+		/// The impulses the solver applied along the normal and the two tangents, reused as the starting guess of the next step (warm starting).
+		/// </summary>
+		float normalImpulse = 0;
+		float tangentImpulse1 = 0;
+		float tangentImpulse2 = 0;
+	};
+
+	/// <summary>
+	/// The contact points between two bodies that share a normal.
+	/// </summary>
+	struct SUPERGOD_API_CLASS ContactManifold final
+	{
+		/// <summary>
+		/// The most points a manifold keeps. 4 points are enough for a box to rest stably on a face.
+		/// </summary>
+		static constexpr int MAX_POINTS = 4;
+
+		uint bodyA = 0;
+		uint bodyB = 0;
+
+		/// <summary>
+		/// The direction that pushes body B away from body A.
+		/// </summary>
+		Math::Vector3D normal;
+
+		ContactPoint points[MAX_POINTS];
+		int pointCount = 0;
+	};
+
+	/// <summary>
+	/// Narrowphase collision detection between spheres, boxes and capsules.
+	/// </summary>
+	namespace Collision
+	{
+		/// <summary>
+		/// Finds the contact points between a and b. Sets the normal and the positions and depths of the points of manifold (with impulses of 0).<para/>
+		/// Spheres and capsules are handled as segments with a radius, boxes use the separating axis test and clip the faces against each other.
+		/// </summary>
+		/// <returns>The number of contact points, 0 when the bodies don't touch.</returns>
+		SUPERGOD_API_FUNC int Collide(const RigidBody& a, const RigidBody& b, ContactManifold& manifold);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,734 @@
+#include "Gjk.h"
+#include <algorithm>
+#include <limits>
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	/// <summary>
+	/// The maximum number of support points GJK uses before it stops with the closest point it has.
+	/// </summary>
+	static constexpr int MAX_ITERATIONS = 64;
+
+	/// <summary>
+	/// GJK stops when a new support point gets closer to the origin than the simplex by less than this fraction of the squared distance.
+	/// </summary>
+	static constexpr float RELATIVE_TOLERANCE = 1e-5f;
+
+	/// <summary>
+	/// Cores closer than this overlap.
+	/// </summary>
+	static constexpr float INTERSECTION_DISTANCE = 1e-5f;
+
+	/// <summary>
+	/// EPA stops when the closest face is within this distance from the surface of the Minkowski difference.
+	/// </summary>
+	static constexpr float EPA_TOLERANCE = 1e-4f;
+
+	static constexpr int EPA_MAX_VERTICES = 64;
+	static constexpr int EPA_MAX_FACES = 128;
+
+	#pragma region Simplex.
+	/// <summary>
+	/// A point of the Minkowski difference a - b, with the support points, their vertex indices and the direction it came from.
+	/// </summary>
+	template<class TVector>
+	struct SimplexVertex
+	{
+		TVector w;
+		TVector a;
+		TVector b;
+		TVector direction;
+		int vertexA;
+		int vertexB;
+		float weight;
+	};
+
+	/// <summary>
+	/// Up to N points of the Minkowski difference. The closest point to the origin is the sum of the points multiplied by their weights.
+	/// </summary>
+	template<class TVector, int N>
+	struct Simplex
+	{
+		SimplexVertex<TVector> vertices[N];
+		int count;
+
+		inline void Set(const SimplexVertex<TVector>& a)
+		{
+			vertices[0] = a;
+			vertices[0].weight = 1;
+			count = 1;
+		}
+
+		inline void Set(const SimplexVertex<TVector>& a, float weightA, const SimplexVertex<TVector>& b, float weightB)
+		{
+			vertices[0] = a;
+			vertices[0].weight = weightA;
+			vertices[1] = b;
+			vertices[1].weight = weightB;
+			count = 2;
+		}
+
+		inline void Set(const SimplexVertex<TVector>& a, float weightA, const SimplexVertex<TVector>& b, float weightB, const SimplexVertex<TVector>& c, float weightC)
+		{
+			Set(a, weightA, b, weightB);
+			vertices[2] = c;
+			vertices[2].weight = weightC;
+			count = 3;
+		}
+
+		/// <summary>
+		/// Gets the weighted sum of field of the vertices, like the closest point (w) or the closest point of a shape (a or b).
+		/// </summary>
+		inline TVector Sum(TVector SimplexVertex<TVector>::*field) const
+		{
+			TVector sum = vertices[0].*field * vertices[0].weight;
+			for (int i = 1; i < count; i++)
+				sum += vertices[i].*field * vertices[i].weight;
+			return sum;
+		}
+	};
+
+	/// <summary>
+	/// Finds the closest point of the segment ab to the origin, keeping only the vertices it lies between.
+	/// </summary>
+	template<class TVector, int N>
+	static void SolveSegment(const SimplexVertex<TVector>& a, const SimplexVertex<TVector>& b, Simplex<TVector, N>& result)
+	{
+		TVector ab = b.w - a.w;
+		float t = -a.w.Dot(ab);
+		if (t <= 0)
+			return result.Set(a);
+
+		float length = ab.Dot(ab);
+		if (t >= length)
+			return result.Set(b);
+
+		t /= length;
+		result.Set(a, 1 - t, b, t);
+	}
+
+	/// <summary>
+	/// Finds the closest point of the triangle abc to the origin by its Voronoi regions, keeping only the vertices of the region it's in.
+	/// </summary>
+	template<class TVector, int N>
+	static void SolveTriangle(const SimplexVertex<TVector>& a, const SimplexVertex<TVector>& b, const SimplexVertex<TVector>& c, Simplex<TVector, N>& result)
+	{
+		TVector ab = b.w - a.w;
+		TVector ac = c.w - a.w;
+		float d1 = -ab.Dot(a.w);
+		float d2 = -ac.Dot(a.w);
+		if (d1 <= 0 && d2 <= 0)
+			return result.Set(a);
+
+		float d3 = -ab.Dot(b.w);
+		float d4 = -ac.Dot(b.w);
+		if (d3 >= 0 && d4 <= d3)
+			return result.Set(b);
+
+		float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0 && d1 >= 0 && d3 <= 0)
+		{
+			float t = d1 / (d1 - d3);
+			return result.Set(a, 1 - t, b, t);
+		}
+
+		float d5 = -ab.Dot(c.w);
+		float d6 = -ac.Dot(c.w);
+		if (d6 >= 0 && d5 <= d6)
+			return result.Set(c);
+
+		float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0 && d2 >= 0 && d6 <= 0)
+		{
+			float t = d2 / (d2 - d6);
+			return result.Set(a, 1 - t, c, t);
+		}
+
+		float va = d3 * d6 - d5 * d4;
+		if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+		{
+			float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			return result.Set(b, 1 - t, c, t);
+		}
+
+		float sum = va + vb + vc;
+		if (sum <= 0)
+		{
+			// The triangle is flat (its points are on a line), so the closest point is on its longest side.
+			float abLength = ab.SqrMagnitude(), acLength = ac.SqrMagnitude(), bcLength = (c.w - b.w).SqrMagnitude();
+			if (abLength >= acLength && abLength >= bcLength)
+				return SolveSegment(a, b, result);
+			return acLength >= bcLength ? SolveSegment(a, c, result) : SolveSegment(b, c, result);
+		}
+
+		result.Set(a, va / sum, b, vb / sum, c, vc / sum);
+	}
+
+	/// <summary>
+	/// Finds the closest point of the tetrahedron to the origin, keeping only the vertices of the closest face (or part of it). Returns true if the origin is inside.
+	/// </summary>
+	static bool SolveTetrahedron(const Simplex<Vector3D, 4>& simplex, Simplex<Vector3D, 4>& result)
+	{
+		// Every face, followed by the vertex that isn't on it.
+		static constexpr int FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+		const SimplexVertex<Vector3D>* v = simplex.vertices;
+
+		Vector3D ab = v[1].w - v[0].w, ac = v[2].w - v[0].w, ad = v[3].w - v[0].w;
+		float volume = ab.Dot(ac.Cross(ad));
+		bool flat = SMath::Abs(volume) <= 1e-6f * ab.Magnitude() * ac.Magnitude() * ad.Magnitude();
+
+		float bestDistance = std::numeric_limits<float>::max();
+		Simplex<Vector3D, 4> candidate;
+		for (const int* face : FACES)
+		{
+			const Vector3D& a = v[face[0]].w;
+			Vector3D normal = (v[face[1]].w - a).Cross(v[face[2]].w - a);
+
+			// The origin can only be closest to faces that have it and the fourth vertex on different sides (every face of a flat tetrahedron is checked).
+			if (!flat && -a.Dot(normal) * (v[face[3]].w - a).Dot(normal) >= 0)
+				continue;
+
+			SolveTriangle(v[face[0]], v[face[1]], v[face[2]], candidate);
+			float distance = candidate.Sum(&SimplexVertex<Vector3D>::w).SqrMagnitude();
+			if (distance < bestDistance)
+			{
+				bestDistance = distance;
+				result = candidate;
+			}
+		}
+
+		if (bestDistance != std::numeric_limits<float>::max())
+			return false;
+
+		result = simplex;
+		for (int i = 0; i < 4; i++)
+			result.vertices[i].weight = .25f;
+		return true;
+	}
+
+	/// <summary>
+	/// Reduces simplex to the vertices of its closest feature to the origin. Returns true if the origin is inside it.
+	/// </summary>
+	static bool Solve(Simplex<Vector3D, 4>& simplex)
+	{
+		Simplex<Vector3D, 4> result;
+		switch (simplex.count)
+		{
+		case 1:
+			simplex.vertices[0].weight = 1;
+			return false;
+
+		case 2:
+			SolveSegment(simplex.vertices[0], simplex.vertices[1], simplex);
+			return false;
+
+		case 3:
+			SolveTriangle(simplex.vertices[0], simplex.vertices[1], simplex.vertices[2], result);
+			simplex = result;
+			return false;
+
+		default:
+		{
+			bool inside = SolveTetrahedron(simplex, result);
+			simplex = result;
+			return inside;
+		}
+		}
+	}
+
+	/// <summary>
+	/// Reduces simplex to the vertices of its closest feature to the origin. Returns true if the origin is inside it.
+	/// </summary>
+	static bool Solve(Simplex<Vector2D, 3>& simplex)
+	{
+		Simplex<Vector2D, 3> result;
+		switch (simplex.count)
+		{
+		case 1:
+			simplex.vertices[0].weight = 1;
+			return false;
+
+		case 2:
+			SolveSegment(simplex.vertices[0], simplex.vertices[1], simplex);
+			return false;
+
+		default:
+			// In 2D the origin is inside the triangle exactly when it's closest to the inside of the triangle.
+			SolveTriangle(simplex.vertices[0], simplex.vertices[1], simplex.vertices[2], result);
+			simplex = result;
+			return result.count == 3;
+		}
+	}
+	#pragma endregion
+
+	#pragma region GJK.
+	/// <summary>
+	/// Gets the point of the Minkowski difference of the cores of a and b that is the furthest along direction.
+	/// </summary>
+	template<class TVector, class TMapping>
+	static inline SimplexVertex<TVector> Support(const TMapping& a, const TMapping& b, const TVector& direction)
+	{
+		SimplexVertex<TVector> vertex;
+		vertex.direction = direction;
+		vertex.a = a.Support(direction, vertex.vertexA);
+		vertex.b = b.Support(-direction, vertex.vertexB);
+		vertex.w = vertex.a - vertex.b;
+		vertex.weight = 0;
+		return vertex;
+	}
+
+	/// <summary>
+	/// Gets the point of the Minkowski difference of the cores of a and b the cache points at, by its vertices when both cores are polytopes and by its direction otherwise.
+	/// </summary>
+	template<class TVector, class TMapping, class TCache>
+	static inline SimplexVertex<TVector> CachedSupport(const TMapping& a, const TMapping& b, const TCache& cache, int index)
+	{
+		if (cache.verticesA[index] < 0 || cache.verticesB[index] < 0)
+			return Support(a, b, cache.directions[index]);
+
+		SimplexVertex<TVector> vertex;
+		vertex.direction = cache.directions[index];
+		vertex.vertexA = cache.verticesA[index];
+		vertex.vertexB = cache.verticesB[index];
+		vertex.a = a.Vertex(vertex.vertexA);
+		vertex.b = b.Vertex(vertex.vertexB);
+		vertex.w = vertex.a - vertex.b;
+		vertex.weight = 0;
+		return vertex;
+	}
+
+	/// <summary>
+	/// Is vertex (almost) the same point as one of the vertices of simplex?
+	/// </summary>
+	template<class TVector, int N>
+	static inline bool Contains(const Simplex<TVector, N>& simplex, const SimplexVertex<TVector>& vertex)
+	{
+		for (int i = 0; i < simplex.count; i++)
+		{
+			if ((simplex.vertices[i].w - vertex.w).SqrMagnitude() <= INTERSECTION_DISTANCE * INTERSECTION_DISTANCE)
+				return true;
+		}
+		return false;
+	}
+
+	/// <summary>
+	/// Runs GJK on the cores of a and b, starting from the directions of cache. Returns true if the cores overlap, and otherwise leaves the closest feature in simplex.
+	/// </summary>
+	template<class TVector, int N, class TMapping, class TCache>
+	static bool RunGjk(const TMapping& a, const TMapping& b, TCache* cache, Simplex<TVector, N>& simplex, int& iterations)
+	{
+		simplex.count = 0;
+		iterations = 0;
+		if (cache)
+		{
+			for (int i = 0; i < cache->count; i++)
+			{
+				SimplexVertex<TVector> vertex = CachedSupport<TVector>(a, b, *cache, i);
+				iterations++;
+				if (!Contains(simplex, vertex))
+					simplex.vertices[simplex.count++] = vertex;
+			}
+		}
+
+		if (simplex.count == 0)
+		{
+			simplex.vertices[simplex.count++] = Support(a, b, TVector::UnitX());
+			iterations++;
+		}
+
+		bool intersecting = false;
+		float previousDistance = std::numeric_limits<float>::max();
+		while (true)
+		{
+			if (Solve(simplex))
+			{
+				intersecting = true;
+				break;
+			}
+
+			TVector closest = simplex.Sum(&SimplexVertex<TVector>::w);
+			float distance = closest.SqrMagnitude();
+			if (distance <= INTERSECTION_DISTANCE * INTERSECTION_DISTANCE)
+			{
+				intersecting = true;
+				break;
+			}
+
+			// Rounding can stop GJK from getting closer, and then it has already found the closest point it can.
+			if (distance >= previousDistance || iterations >= MAX_ITERATIONS)
+				break;
+			previousDistance = distance;
+
+			SimplexVertex<TVector> vertex = Support(a, b, -closest);
+			iterations++;
+			if (distance - closest.Dot(vertex.w) <= RELATIVE_TOLERANCE * distance || Contains(simplex, vertex))
+				break;
+			simplex.vertices[simplex.count++] = vertex;
+		}
+
+		if (cache)
+		{
+			cache->count = simplex.count;
+			for (int i = 0; i < simplex.count; i++)
+			{
+				cache->directions[i] = simplex.vertices[i].direction;
+				cache->verticesA[i] = simplex.vertices[i].vertexA;
+				cache->verticesB[i] = simplex.vertices[i].vertexB;
+			}
+		}
+		return intersecting;
+	}
+
+	/// <summary>
+	/// Fills result from the closest feature of the cores, adding the radii of a and b.
+	/// </summary>
+	template<class TVector, int N, class TMapping, class TResult>
+	static void FinishSeparated(const TMapping& a, const TMapping& b, const Simplex<TVector, N>& simplex, TResult& result)
+	{
+		TVector coreA = simplex.Sum(&SimplexVertex<TVector>::a);
+		TVector coreB = simplex.Sum(&SimplexVertex<TVector>::b);
+		float coreDistance = (coreB - coreA).Magnitude();
+		result.normal = (coreB - coreA) / coreDistance;
+		result.pointA = coreA + result.normal * a.radius;
+		result.pointB = coreB - result.normal * b.radius;
+
+		float distance = coreDistance - a.radius - b.radius;
+		result.intersecting = distance <= 0;
+		result.distance = distance > 0 ? distance : 0;
+		result.depth = distance > 0 ? 0 : -distance;
+	}
+
+	/// <summary>
+	/// Fills result from the deepest point of the Minkowski difference of the cores, adding the radii of a and b.
+	/// </summary>
+	template<class TVector, class TMapping, class TResult>
+	static void FinishPenetrating(const TMapping& a, const TMapping& b, const TVector& normal, float coreDepth, const TVector& coreA, const TVector& coreB, TResult& result)
+	{
+		result.intersecting = true;
+		result.distance = 0;
+		result.depth = (coreDepth > 0 ? coreDepth : 0) + a.radius + b.radius;
+		result.normal = normal;
+		result.pointA = coreA + normal * a.radius;
+		result.pointB = coreB - normal * b.radius;
+	}
+
+	GjkResult Gjk::Distance(const SupportMapping& a, const SupportMapping& b, GjkCache* cache)
+	{
+		GjkResult result = {};
+		Simplex<Vector3D, 4> simplex;
+		if (RunGjk(a, b, cache, simplex, result.iterations))
+			result.intersecting = true;
+		else
+			FinishSeparated(a, b, simplex, result);
+		return result;
+	}
+
+	GjkResult2D Gjk::Distance(const SupportMapping2D& a, const SupportMapping2D& b, GjkCache2D* cache)
+	{
+		GjkResult2D result = {};
+		Simplex<Vector2D, 3> simplex;
+		if (RunGjk(a, b, cache, simplex, result.iterations))
+			result.intersecting = true;
+		else
+			FinishSeparated(a, b, simplex, result);
+		return result;
+	}
+	#pragma endregion
+
+	#pragma region EPA.
+	/// <summary>
+	/// A face of the EPA polytope, with its outward normal and its distance from the origin.
+	/// </summary>
+	struct EpaFace
+	{
+		int a, b, c;
+		Vector3D normal;
+		float distance;
+	};
+
+	/// <summary>
+	/// Adds support points to the simplex of overlapping cores until it's a tetrahedron. When the Minkowski difference of the cores is flat, it has no inside,
+	/// so this returns false and the cores penetrate by 0 along flatNormal.
+	/// </summary>
+	static bool ExpandToTetrahedron(const SupportMapping& a, const SupportMapping& b, Simplex<Vector3D, 4>& simplex, Vector3D& flatNormal, int& iterations)
+	{
+		static const Vector3D AXES[3] = { Vector3D::UnitX(), Vector3D::UnitY(), Vector3D::UnitZ() };
+		SimplexVertex<Vector3D>* v = simplex.vertices;
+
+		for (int axis = 0; axis < 6 && simplex.count == 1; axis++)
+		{
+			SimplexVertex<Vector3D> vertex = Support(a, b, axis < 3 ? AXES[axis] : -AXES[axis - 3]);
+			iterations++;
+			if (!Contains(simplex, vertex))
+				v[simplex.count++] = vertex;
+		}
+		if (simplex.count == 1)
+		{
+			flatNormal = Vector3D::UnitY();
+			return false;
+		}
+
+		if (simplex.count == 2)
+		{
+			Vector3D line = v[1].w - v[0].w;
+			for (int axis = 0; axis < 6 && simplex.count == 2; axis++)
+			{
+				Vector3D direction = line.Cross(AXES[axis % 3]);
+				if (direction.SqrMagnitude() <= EPA_TOLERANCE * EPA_TOLERANCE * line.SqrMagnitude())
+					continue;
+
+				SimplexVertex<Vector3D> vertex = Support(a, b, axis < 3 ? direction : -direction);
+				iterations++;
+				if ((vertex.w - v[0].w).Cross(line).SqrMagnitude() > EPA_TOLERANCE * EPA_TOLERANCE * line.SqrMagnitude())
+					v[simplex.count++] = vertex;
+			}
+			if (simplex.count == 2)
+			{
+				// The axis that is the least aligned with the line is never parallel to it.
+				Vector3D absolute = line.Abs();
+				int axis = absolute.x <= absolute.y && absolute.x <= absolute.z ? 0 : absolute.y <= absolute.z ? 1 : 2;
+				flatNormal = line.Cross(AXES[axis]).Normalized();
+				return false;
+			}
+		}
+
+		if (simplex.count == 3)
+		{
+			Vector3D normal = (v[1].w - v[0].w).Cross(v[2].w - v[0].w);
+			float length = normal.Magnitude();
+			for (int side = 0; side < 2 && simplex.count == 3; side++)
+			{
+				SimplexVertex<Vector3D> vertex = Support(a, b, side == 0 ? normal : -normal);
+				iterations++;
+				if (SMath::Abs((vertex.w - v[0].w).Dot(normal)) > EPA_TOLERANCE * length)
+					v[simplex.count++] = vertex;
+			}
+			if (simplex.count == 3)
+			{
+				flatNormal = normal / length;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	GjkResult Gjk::Penetration(const SupportMapping& a, const SupportMapping& b, GjkCache* cache)
+	{
+		GjkResult result = {};
+		Simplex<Vector3D, 4> simplex;
+		if (!RunGjk(a, b, cache, simplex, result.iterations))
+		{
+			FinishSeparated(a, b, simplex, result);
+			return result;
+		}
+
+		Vector3D flatNormal;
+		if (!ExpandToTetrahedron(a, b, simplex, flatNormal, result.iterations))
+		{
+			Vector3D coreA = simplex.vertices[0].a, coreB = simplex.vertices[0].b;
+			FinishPenetrating(a, b, flatNormal, 0, coreA, coreB, result);
+			return result;
+		}
+
+		SimplexVertex<Vector3D> vertices[EPA_MAX_VERTICES];
+		EpaFace faces[EPA_MAX_FACES];
+		int edges[EPA_MAX_FACES * 3][2];
+		int vertexCount = 4, faceCount = 0;
+		for (int i = 0; i < 4; i++)
+			vertices[i] = simplex.vertices[i];
+
+		// The polytope only grows, so the center of the first tetrahedron stays inside and tells which side of every face is out.
+		Vector3D inside = (vertices[0].w + vertices[1].w + vertices[2].w + vertices[3].w) * .25f;
+		auto addFace = [&](int i, int j, int k)
+		{
+			Vector3D normal = (vertices[j].w - vertices[i].w).Cross(vertices[k].w - vertices[i].w);
+			float length = normal.Magnitude();
+			if (length <= 0 || faceCount == EPA_MAX_FACES)
+				return;
+
+			normal = normal / length;
+			if ((inside - vertices[i].w).Dot(normal) > 0)
+			{
+				std::swap(j, k);
+				normal = -normal;
+			}
+			faces[faceCount++] = EpaFace{ i, j, k, normal, normal.Dot(vertices[i].w) };
+		};
+		addFace(0, 1, 2);
+		addFace(0, 3, 1);
+		addFace(0, 2, 3);
+		addFace(1, 3, 2);
+
+		EpaFace closest = faces[0];
+		while (faceCount > 0)
+		{
+			closest = faces[0];
+			for (int i = 1; i < faceCount; i++)
+			{
+				if (faces[i].distance < closest.distance)
+					closest = faces[i];
+			}
+
+			SimplexVertex<Vector3D> vertex = Support(a, b, closest.normal);
+			result.iterations++;
+			if (vertex.w.Dot(closest.normal) - closest.distance <= EPA_TOLERANCE || vertexCount == EPA_MAX_VERTICES || result.iterations >= MAX_ITERATIONS * 2)
+				break;
+
+			// Remove every face the new point sees, and keep the edges around the hole (the edges only one removed face has).
+			int newVertex = vertexCount++;
+			vertices[newVertex] = vertex;
+			int edgeCount = 0;
+			for (int i = faceCount - 1; i >= 0; i--)
+			{
+				const EpaFace& face = faces[i];
+				if (face.normal.Dot(vertex.w - vertices[face.a].w) <= 0)
+					continue;
+
+				int faceEdges[3][2] = { { face.a, face.b }, { face.b, face.c }, { face.c, face.a } };
+				for (const int* edge : faceEdges)
+				{
+					int shared = -1;
+					for (int e = 0; e < edgeCount && shared < 0; e++)
+					{
+						if (edges[e][0] == edge[1] && edges[e][1] == edge[0])
+							shared = e;
+					}
+
+					if (shared >= 0)
+					{
+						edges[shared][0] = edges[edgeCount - 1][0];
+						edges[shared][1] = edges[edgeCount - 1][1];
+						edgeCount--;
+					}
+					else
+					{
+						edges[edgeCount][0] = edge[0];
+						edges[edgeCount][1] = edge[1];
+						edgeCount++;
+					}
+				}
+				faces[i] = faces[--faceCount];
+			}
+
+			for (int e = 0; e < edgeCount; e++)
+				addFace(edges[e][0], edges[e][1], newVertex);
+		}
+
+		// The deepest point is the projection of the origin on the closest face, and its barycentric coordinates give the points on the cores.
+		const SimplexVertex<Vector3D>& va = vertices[closest.a];
+		const SimplexVertex<Vector3D>& vb = vertices[closest.b];
+		const SimplexVertex<Vector3D>& vc = vertices[closest.c];
+		Vector3D ab = vb.w - va.w, ac = vc.w - va.w, ap = closest.normal * closest.distance - va.w;
+		float d00 = ab.Dot(ab), d01 = ab.Dot(ac), d11 = ac.Dot(ac), d20 = ap.Dot(ab), d21 = ap.Dot(ac);
+		float denominator = d00 * d11 - d01 * d01;
+		float v = denominator != 0 ? (d11 * d20 - d01 * d21) / denominator : 0;
+		float w = denominator != 0 ? (d00 * d21 - d01 * d20) / denominator : 0;
+		float u = 1 - v - w;
+
+		FinishPenetrating(a, b, closest.normal, closest.distance, va.a * u + vb.a * v + vc.a * w, va.b * u + vb.b * v + vc.b * w, result);
+		return result;
+	}
+
+	/// <summary>
+	/// Gets the outward normal of the edge from p to q of a counterclockwise polygon.
+	/// </summary>
+	static inline Vector2D OutwardNormal(const Vector2D& p, const Vector2D& q)
+	{
+		return Vector2D(q.y - p.y, p.x - q.x);
+	}
+
+	GjkResult2D Gjk::Penetration(const SupportMapping2D& a, const SupportMapping2D& b, GjkCache2D* cache)
+	{
+		GjkResult2D result = {};
+		Simplex<Vector2D, 3> simplex;
+		if (!RunGjk(a, b, cache, simplex, result.iterations))
+		{
+			FinishSeparated(a, b, simplex, result);
+			return result;
+		}
+
+		// Grow the simplex to a triangle. A Minkowski difference without an inside (a point or a line) penetrates by 0 across it.
+		static const Vector2D AXES[4] = { Vector2D::UnitX(), Vector2D::UnitY(), -Vector2D::UnitX(), -Vector2D::UnitY() };
+		SimplexVertex<Vector2D>* v = simplex.vertices;
+		for (int axis = 0; axis < 4 && simplex.count == 1; axis++)
+		{
+			SimplexVertex<Vector2D> vertex = Support(a, b, AXES[axis]);
+			result.iterations++;
+			if (!Contains(simplex, vertex))
+				v[simplex.count++] = vertex;
+		}
+
+		Vector2D flatNormal = Vector2D::UnitY();
+		if (simplex.count == 2)
+		{
+			flatNormal = OutwardNormal(v[0].w, v[1].w);
+			float length = flatNormal.Magnitude();
+			for (int side = 0; side < 2 && simplex.count == 2; side++)
+			{
+				SimplexVertex<Vector2D> vertex = Support(a, b, side == 0 ? flatNormal : -flatNormal);
+				result.iterations++;
+				if (SMath::Abs((vertex.w - v[0].w).Dot(flatNormal)) > EPA_TOLERANCE * length)
+					v[simplex.count++] = vertex;
+			}
+			flatNormal = flatNormal / length;
+		}
+
+		if (simplex.count < 3)
+		{
+			FinishPenetrating(a, b, flatNormal, 0, v[0].a, v[0].b, result);
+			return result;
+		}
+
+		// The polygon is kept counterclockwise, so the outward normal of every edge is on its right.
+		SimplexVertex<Vector2D> vertices[EPA_MAX_VERTICES];
+		int count = 3;
+		bool clockwise = OutwardNormal(v[0].w, v[1].w).Dot(v[2].w - v[0].w) > 0;
+		vertices[0] = v[0];
+		vertices[1] = clockwise ? v[2] : v[1];
+		vertices[2] = clockwise ? v[1] : v[2];
+
+		int closest = 0;
+		Vector2D normal;
+		float distance = 0;
+		while (true)
+		{
+			distance = std::numeric_limits<float>::max();
+			for (int i = 0; i < count; i++)
+			{
+				Vector2D edgeNormal = OutwardNormal(vertices[i].w, vertices[(i + 1) % count].w);
+				float length = edgeNormal.Magnitude();
+				if (length <= 0)
+					continue;
+
+				edgeNormal = edgeNormal / length;
+				float edgeDistance = edgeNormal.Dot(vertices[i].w);
+				if (edgeDistance < distance)
+				{
+					distance = edgeDistance;
+					normal = edgeNormal;
+					closest = i;
+				}
+			}
+
+			SimplexVertex<Vector2D> vertex = Support(a, b, normal);
+			result.iterations++;
+			if (vertex.w.Dot(normal) - distance <= EPA_TOLERANCE || count == EPA_MAX_VERTICES || result.iterations >= MAX_ITERATIONS * 2)
+				break;
+
+			for (int i = count; i > closest + 1; i--)
+				vertices[i] = vertices[i - 1];
+			vertices[closest + 1] = vertex;
+			count++;
+		}
+
+		const SimplexVertex<Vector2D>& p = vertices[closest];
+		const SimplexVertex<Vector2D>& q = vertices[(closest + 1) % count];
+		Vector2D edge = q.w - p.w;
+		float t = SMath::Clamp((normal * distance - p.w).Dot(edge) / edge.Dot(edge), 0.f, 1.f);
+		FinishPenetrating(a, b, normal, distance, p.a + (q.a - p.a) * t, p.b + (q.b - p.b) * t, result);
+		return result;
+	}
+	#pragma endregion
+} }
\ No newline at end of file
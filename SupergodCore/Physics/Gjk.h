@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector2D.h"
+#include "Math/Vectors/Vector3D.h"
+#include "SupportMapping.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// The simplex a GJK query ended with, as the vertices of polytope cores (see SupportMapping::OfPolytope) or the directions its points were found in.<para/>
+	/// Passing it to the next query of the same two shapes starts from that simplex instead of from scratch, which usually leaves only one or two iterations when the shapes moved a little.
+	/// </summary>
+	struct SUPERGOD_API_CLASS GjkCache final
+	{
+		Math::Vector3D directions[4];
+		int verticesA[4];
+		int verticesB[4];
+		int count;
+
+		/// <summary>
+		/// Creates an empty cache, which starts the first query from scratch.
+		/// </summary>
+		constexpr GjkCache()
+			: directions(), verticesA(), verticesB(), count(0)
+		{
+		}
+	};
+
+	/// <summary>
+	/// The simplex a 2D GJK query ended with. See GjkCache.
+	/// </summary>
+	struct SUPERGOD_API_CLASS GjkCache2D final
+	{
+		Math::Vector2D directions[3];
+		int verticesA[3];
+		int verticesB[3];
+		int count;
+
+		/// <summary>
+		/// Creates an empty cache, which starts the first query from scratch.
+		/// </summary>
+		constexpr GjkCache2D()
+			: directions(), verticesA(), verticesB(), count(0)
+		{
+		}
+	};
+
+	/// <summary>
+	/// The result of a query between two convex shapes.
+	/// </summary>
+	struct SUPERGOD_API_CLASS GjkResult final
+	{
+		/// <summary>
+		/// Do the shapes overlap (touching counts)?
+		/// </summary>
+		bool intersecting;
+
+		/// <summary>
+		/// The distance between the shapes, or 0 when they overlap.
+		/// </summary>
+		float distance;
+
+		/// <summary>
+		/// How deep the shapes overlap. Penetration always finds it, and Distance only when just the radii overlap (it's 0 when the cores overlap).
+		/// </summary>
+		float depth;
+
+		/// <summary>
+		/// The direction from A to B: moving B by normal * depth separates overlapping shapes. Set whenever depth is.
+		/// </summary>
+		Math::Vector3D normal;
+
+		/// <summary>
+		/// The closest points of the shapes when they're apart, or the deepest points of each shape inside the other when they overlap.
+		/// </summary>
+		Math::Vector3D pointA;
+		Math::Vector3D pointB;
+
+		/// <summary>
+		/// The number of support points GJK and EPA used.
+		/// </summary>
+		int iterations;
+	};
+
+	/// <summary>
+	/// The result of a query between two 2D convex shapes. See GjkResult.
+	/// </summary>
+	struct SUPERGOD_API_CLASS GjkResult2D final
+	{
+		bool intersecting;
+		float distance;
+		float depth;
+		Math::Vector2D normal;
+		Math::Vector2D pointA;
+		Math::Vector2D pointB;
+		int iterations;
+	};
+
+	/// <summary>
+	/// Distance and penetration queries between any two convex shapes, with GJK (Gilbert-Johnson-Keerthi) on the Minkowski difference of their cores and EPA (expanding polytope) for penetration.
+	/// </summary>
+	namespace Gjk
+	{
+		/// <summary>
+		/// Finds the distance and the closest points between a and b.
+		/// </summary>
+		/// <param name="cache">The simplex of the previous query of a and b to start from, which gets the simplex of this query. Can be null.</param>
+		SUPERGOD_API_FUNC GjkResult Distance(const SupportMapping& a, const SupportMapping& b, GjkCache* cache = nullptr);
+
+		/// <summary>
+		/// Finds the distance and the closest points between a and b when they're apart, and how deep they are in each other when they overlap.<para/>
+		/// Overlaps of the radii alone are resolved by GJK, and EPA only runs when the cores overlap.
+		/// </summary>
+		/// <param name="cache">The simplex of the previous query of a and b to start from, which gets the simplex of this query. Can be null.</param>
+		SUPERGOD_API_FUNC GjkResult Penetration(const SupportMapping& a, const SupportMapping& b, GjkCache* cache = nullptr);
+
+		/// <summary>
+		/// Finds the distance and the closest points between the 2D shapes a and b.
+		/// </summary>
+		/// <param name="cache">The simplex of the previous query of a and b to start from, which gets the simplex of this query. Can be null.</param>
+		SUPERGOD_API_FUNC GjkResult2D Distance(const SupportMapping2D& a, const SupportMapping2D& b, GjkCache2D* cache = nullptr);
+
+		/// <summary>
+		/// Finds the distance between the 2D shapes a and b when they're apart, and how deep they are in each other when they overlap.
+		/// </summary>
+		/// <param name="cache">The simplex of the previous query of a and b to start from, which gets the simplex of this query. Can be null.</param>
+		SUPERGOD_API_FUNC GjkResult2D Penetration(const SupportMapping2D& a, const SupportMapping2D& b, GjkCache2D* cache = nullptr);
+	}
+} }
\ No newline at end of file
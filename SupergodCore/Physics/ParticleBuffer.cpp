@@ -0,0 +1,72 @@
+#include "ParticleBuffer.h"
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	void ParticleBuffer::Reserve(size_t capacity)
+	{
+		for (std::vector<float>& stream : streams)
+			stream.reserve(capacity);
+	}
+
+	size_t ParticleBuffer::Add(const Vector3D& position, const Vector3D& velocity, float inverseMass, float deltaTime)
+	{
+		for (std::vector<float>& stream : streams)
+			stream.push_back(0);
+
+		size_t index = Count() - 1;
+		ParticleStreams particles = GetStreams();
+		particles.positionX[index] = position.x;
+		particles.positionY[index] = position.y;
+		particles.positionZ[index] = position.z;
+		particles.previousPositionX[index] = position.x - velocity.x * deltaTime;
+		particles.previousPositionY[index] = position.y - velocity.y * deltaTime;
+		particles.previousPositionZ[index] = position.z - velocity.z * deltaTime;
+		particles.velocityX[index] = velocity.x;
+		particles.velocityY[index] = velocity.y;
+		particles.velocityZ[index] = velocity.z;
+		particles.inverseMass[index] = inverseMass;
+		return index;
+	}
+
+	void ParticleBuffer::RemoveSwapBack(size_t index)
+	{
+		for (std::vector<float>& stream : streams)
+		{
+			stream[index] = stream.back();
+			stream.pop_back();
+		}
+	}
+
+	void ParticleBuffer::Clear()
+	{
+		for (std::vector<float>& stream : streams)
+			stream.clear();
+	}
+
+	ParticleStreams ParticleBuffer::GetStreams()
+	{
+		ParticleStreams particles;
+		for (size_t stream = 0; stream < ParticleStreams::STREAM_COUNT; stream++)
+			particles.*ParticleStreams::STREAMS[stream] = streams[stream].data();
+		particles.count = Count();
+		return particles;
+	}
+
+	Vector3D ParticleBuffer::GetPosition(size_t index) const
+	{
+		return View().GetPosition(index);
+	}
+
+	Vector3D ParticleBuffer::GetVelocity(size_t index) const
+	{
+		return View().GetVelocity(index);
+	}
+
+	ParticleStreams ParticleBuffer::View() const
+	{
+		// Nothing writes through the streams of a const buffer.
+		return const_cast<ParticleBuffer*>(this)->GetStreams();
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "ParticleStreams.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// Owns the arrays of a group of particles. Add particles with Add, and pass GetStreams to the particle kernels.<para/>
+	/// The streams stay valid until particles are added or removed.
+	/// </summary>
+	class ParticleBuffer final
+	{
+	public:
+		/// <summary>
+		/// Creates a new buffer without particles.
+		/// </summary>
+		ParticleBuffer() = default;
+
+		/// <summary>
+		/// Gets the number of particles.
+		/// </summary>
+		inline size_t Count() const { return streams[0].size(); }
+
+		/// <summary>
+		/// Makes room for capacity particles without reallocating.
+		/// </summary>
+		SUPERGOD_API_FUNC void Reserve(size_t capacity);
+
+		/// <summary>
+		/// Adds a particle without forces and returns its index. The previous position is set as if it moved at velocity for deltaTime (for Verlet integration).
+		/// </summary>
+		/// <param name="inverseMass">1 / mass. 0 makes the particle immovable by forces.</param>
+		SUPERGOD_API_FUNC size_t Add(const Math::Vector3D& position, const Math::Vector3D& velocity, float inverseMass = 1, float deltaTime = 0);
+
+		/// <summary>
+		/// Removes the particle at index by moving the last particle into its place.
+		/// </summary>
+		SUPERGOD_API_FUNC void RemoveSwapBack(size_t index);
+
+		/// <summary>
+		/// Removes all the particles.
+		/// </summary>
+		SUPERGOD_API_FUNC void Clear();
+
+		/// <summary>
+		/// Gets the streams of all the particles.
+		/// </summary>
+		SUPERGOD_API_FUNC ParticleStreams GetStreams();
+
+		/// <summary>
+		/// Gets the position of the particle at index.
+		/// </summary>
+		SUPERGOD_API_FUNC Math::Vector3D GetPosition(size_t index) const;
+
+		/// <summary>
+		/// Gets the velocity of the particle at index.
+		/// </summary>
+		SUPERGOD_API_FUNC Math::Vector3D GetVelocity(size_t index) const;
+
+	private:
+		/// <summary>
+		/// The streams of GetStreams, for reading them from const functions.
+		/// </summary>
+		ParticleStreams View() const;
+
+		/// <summary>
+		/// Every stream, in the order of ParticleStreams::STREAMS.
+		/// </summary>
+		std::vector<float> streams[ParticleStreams::STREAM_COUNT];
+	};
+} }
\ No newline at end of file
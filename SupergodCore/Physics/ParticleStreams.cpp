@@ -0,0 +1,22 @@
+#include "ParticleStreams.h"
+
+namespace SupergodCore { namespace Physics
+{
+	float* ParticleStreams::* const ParticleStreams::STREAMS[STREAM_COUNT] =
+	{
+		&ParticleStreams::positionX, &ParticleStreams::positionY, &ParticleStreams::positionZ,
+		&ParticleStreams::previousPositionX, &ParticleStreams::previousPositionY, &ParticleStreams::previousPositionZ,
+		&ParticleStreams::velocityX, &ParticleStreams::velocityY, &ParticleStreams::velocityZ,
+		&ParticleStreams::forceX, &ParticleStreams::forceY, &ParticleStreams::forceZ,
+		&ParticleStreams::inverseMass,
+	};
+
+	ParticleStreams ParticleStreams::Slice(size_t first, size_t length) const
+	{
+		ParticleStreams slice;
+		for (float* ParticleStreams::* stream : STREAMS)
+			slice.*stream = this->*stream ? this->*stream + first : nullptr;
+		slice.count = length;
+		return slice;
+	}
+} }
\ No newline at end of file
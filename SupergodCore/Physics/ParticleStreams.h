@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// The state of count particles as separate arrays (structure of arrays) for every component, which is what the particle kernels work on.<para/>
+	/// This doesn't own the arrays. Streams that a kernel doesn't use can be null (previousPositions is only used by Verlet integration).
+	/// </summary>
+	struct SUPERGOD_API_CLASS ParticleStreams final
+	{
+		float* positionX = nullptr;
+		float* positionY = nullptr;
+		float* positionZ = nullptr;
+
+		/// <summary>
+		/// The positions from the previous step, used by Verlet integration instead of the velocities.
+		/// </summary>
+		float* previousPositionX = nullptr;
+		float* previousPositionY = nullptr;
+		float* previousPositionZ = nullptr;
+
+		float* velocityX = nullptr;
+		float* velocityY = nullptr;
+		float* velocityZ = nullptr;
+
+		/// <summary>
+		/// The forces that were added since they were last cleared.
+		/// </summary>
+		float* forceX = nullptr;
+		float* forceY = nullptr;
+		float* forceZ = nullptr;
+
+		/// <summary>
+		/// 1 / mass of every particle. 0 is an infinite mass: forces and gravity don't affect the particle.
+		/// </summary>
+		float* inverseMass = nullptr;
+
+		/// <summary>
+		/// The number of particles.
+		/// </summary>
+		size_t count = 0;
+
+		/// <summary>
+		/// The number of streams.
+		/// </summary>
+		static constexpr size_t STREAM_COUNT = 13;
+
+		/// <summary>
+		/// Every stream, in the order they are declared in, for the code that goes over all of them.
+		/// </summary>
+		static float* ParticleStreams::* const STREAMS[STREAM_COUNT];
+
+		/// <summary>
+		/// Gets the position of the particle at index.
+		/// </summary>
+		inline Math::Vector3D GetPosition(size_t index) const
+		{
+			return Math::Vector3D(positionX[index], positionY[index], positionZ[index]);
+		}
+
+		/// <summary>
+		/// Gets the velocity of the particle at index.
+		/// </summary>
+		inline Math::Vector3D GetVelocity(size_t index) const
+		{
+			return Math::Vector3D(velocityX[index], velocityY[index], velocityZ[index]);
+		}
+
+		/// <summary>
+		/// Gets the streams of the particles from first up to (not including) first + length.
+		/// </summary>
+		ParticleStreams Slice(size_t first, size_t length) const;
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,301 @@
+#include "Particles.h"
+#include "Common/Parallel.h"
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	/// <summary>
+	/// 4 copies of a vector, one per SIMD lane.
+	/// </summary>
+	struct WideVector
+	{
+		__m128 x, y, z;
+
+		explicit WideVector(const Vector3D& vector)
+			: x(_mm_set1_ps(vector.x)), y(_mm_set1_ps(vector.y)), z(_mm_set1_ps(vector.z))
+		{
+		}
+	};
+
+	/// <summary>
+	/// Runs kernel on the 4 particles after the first one in a copy of the streams padded with zeros, and copies the results back.<para/>
+	/// The padding lanes are computed and thrown away, which keeps the results of the last particles exactly the same as if they were in a full group.
+	/// </summary>
+	template<class TKernel>
+	static void RunPadded(const ParticleStreams& particles, size_t first, size_t count, const TKernel& kernel)
+	{
+		alignas(16) float lanes[ParticleStreams::STREAM_COUNT][4] = {};
+		ParticleStreams padded;
+		padded.count = 4;
+
+		for (size_t stream = 0; stream < ParticleStreams::STREAM_COUNT; stream++)
+		{
+			const float* source = particles.*ParticleStreams::STREAMS[stream];
+			if (source == nullptr)
+				continue;
+
+			for (size_t i = 0; i < count; i++)
+				lanes[stream][i] = source[first + i];
+			padded.*ParticleStreams::STREAMS[stream] = lanes[stream];
+		}
+
+		kernel(padded, 0);
+
+		for (size_t stream = 0; stream < ParticleStreams::STREAM_COUNT; stream++)
+		{
+			float* destination = particles.*ParticleStreams::STREAMS[stream];
+			if (destination == nullptr)
+				continue;
+
+			for (size_t i = 0; i < count; i++)
+				destination[first + i] = lanes[stream][i];
+		}
+	}
+
+	/// <summary>
+	/// Calls kernel(particles, i) for every group of 4 particles starting at i, in chunks on the threads of Parallel when multithreaded is true.
+	/// </summary>
+	template<class TKernel>
+	static void RunKernel(const ParticleStreams& particles, bool multithreaded, const TKernel& kernel)
+	{
+		static_assert(Particles::PARALLEL_CHUNK_SIZE % 4 == 0, "Chunks have to be made of whole groups of 4 particles, or the particles at their ends would be padded.");
+
+		auto range = [&](size_t begin, size_t end)
+		{
+			size_t i = begin;
+			for (; i + 4 <= end; i += 4)
+				kernel(particles, i);
+
+			if (i < end)
+				RunPadded(particles, i, end - i, kernel);
+		};
+
+		if (multithreaded)
+			Parallel::For(particles.count, Particles::PARALLEL_CHUNK_SIZE, range);
+		else
+			range(0, particles.count);
+	}
+
+	/// <summary>
+	/// Gets a where mask is set, and b everywhere else.
+	/// </summary>
+	static inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	#pragma region Forces.
+	void Particles::ClearForces(const ParticleStreams& particles, bool multithreaded)
+	{
+		RunKernel(particles, multithreaded, [](const ParticleStreams& p, size_t i)
+		{
+			_mm_storeu_ps(p.forceX + i, _mm_setzero_ps());
+			_mm_storeu_ps(p.forceY + i, _mm_setzero_ps());
+			_mm_storeu_ps(p.forceZ + i, _mm_setzero_ps());
+		});
+	}
+
+	void Particles::AddGravity(const ParticleStreams& particles, const Vector3D& gravity, bool multithreaded)
+	{
+		WideVector g(gravity);
+		RunKernel(particles, multithreaded, [&g](const ParticleStreams& p, size_t i)
+		{
+			__m128 inverseMass = _mm_loadu_ps(p.inverseMass + i);
+			__m128 mass = _mm_and_ps(_mm_cmpgt_ps(inverseMass, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1), inverseMass));
+
+			_mm_storeu_ps(p.forceX + i, _mm_add_ps(_mm_loadu_ps(p.forceX + i), _mm_mul_ps(g.x, mass)));
+			_mm_storeu_ps(p.forceY + i, _mm_add_ps(_mm_loadu_ps(p.forceY + i), _mm_mul_ps(g.y, mass)));
+			_mm_storeu_ps(p.forceZ + i, _mm_add_ps(_mm_loadu_ps(p.forceZ + i), _mm_mul_ps(g.z, mass)));
+		});
+	}
+
+	/// <summary>
+	/// Gets the drag coefficient (linear + quadratic * speed) of velocities.
+	/// </summary>
+	static inline __m128 DragCoefficient(__m128 vx, __m128 vy, __m128 vz, __m128 linear, __m128 quadratic)
+	{
+		__m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+		return _mm_add_ps(linear, _mm_mul_ps(quadratic, speed));
+	}
+
+	void Particles::AddDrag(const ParticleStreams& particles, float linear, float quadratic, bool multithreaded)
+	{
+		__m128 linearDrag = _mm_set1_ps(linear);
+		__m128 quadraticDrag = _mm_set1_ps(quadratic);
+		RunKernel(particles, multithreaded, [=](const ParticleStreams& p, size_t i)
+		{
+			__m128 vx = _mm_loadu_ps(p.velocityX + i);
+			__m128 vy = _mm_loadu_ps(p.velocityY + i);
+			__m128 vz = _mm_loadu_ps(p.velocityZ + i);
+			__m128 drag = DragCoefficient(vx, vy, vz, linearDrag, quadraticDrag);
+
+			_mm_storeu_ps(p.forceX + i, _mm_sub_ps(_mm_loadu_ps(p.forceX + i), _mm_mul_ps(drag, vx)));
+			_mm_storeu_ps(p.forceY + i, _mm_sub_ps(_mm_loadu_ps(p.forceY + i), _mm_mul_ps(drag, vy)));
+			_mm_storeu_ps(p.forceZ + i, _mm_sub_ps(_mm_loadu_ps(p.forceZ + i), _mm_mul_ps(drag, vz)));
+		});
+	}
+	#pragma endregion
+
+	#pragma region Integration.
+	void Particles::SemiImplicitEuler(const ParticleStreams& particles, float deltaTime, bool multithreaded)
+	{
+		__m128 dt = _mm_set1_ps(deltaTime);
+		RunKernel(particles, multithreaded, [dt](const ParticleStreams& p, size_t i)
+		{
+			__m128 impulseScale = _mm_mul_ps(_mm_loadu_ps(p.inverseMass + i), dt);
+			float* positions[] = { p.positionX, p.positionY, p.positionZ };
+			float* velocities[] = { p.velocityX, p.velocityY, p.velocityZ };
+			const float* forces[] = { p.forceX, p.forceY, p.forceZ };
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				__m128 velocity = _mm_add_ps(_mm_loadu_ps(velocities[axis] + i), _mm_mul_ps(_mm_loadu_ps(forces[axis] + i), impulseScale));
+				_mm_storeu_ps(velocities[axis] + i, velocity);
+				_mm_storeu_ps(positions[axis] + i, _mm_add_ps(_mm_loadu_ps(positions[axis] + i), _mm_mul_ps(velocity, dt)));
+			}
+		});
+	}
+
+	void Particles::PrepareVerlet(const ParticleStreams& particles, float deltaTime, bool multithreaded)
+	{
+		__m128 dt = _mm_set1_ps(deltaTime);
+		RunKernel(particles, multithreaded, [dt](const ParticleStreams& p, size_t i)
+		{
+			_mm_storeu_ps(p.previousPositionX + i, _mm_sub_ps(_mm_loadu_ps(p.positionX + i), _mm_mul_ps(_mm_loadu_ps(p.velocityX + i), dt)));
+			_mm_storeu_ps(p.previousPositionY + i, _mm_sub_ps(_mm_loadu_ps(p.positionY + i), _mm_mul_ps(_mm_loadu_ps(p.velocityY + i), dt)));
+			_mm_storeu_ps(p.previousPositionZ + i, _mm_sub_ps(_mm_loadu_ps(p.positionZ + i), _mm_mul_ps(_mm_loadu_ps(p.velocityZ + i), dt)));
+		});
+	}
+
+	void Particles::Verlet(const ParticleStreams& particles, float deltaTime, bool multithreaded)
+	{
+		__m128 dtSquared = _mm_set1_ps(deltaTime * deltaTime);
+		__m128 inverseDt = _mm_set1_ps(1 / deltaTime);
+		RunKernel(particles, multithreaded, [=](const ParticleStreams& p, size_t i)
+		{
+			__m128 accelerationScale = _mm_mul_ps(_mm_loadu_ps(p.inverseMass + i), dtSquared);
+			float* positions[] = { p.positionX, p.positionY, p.positionZ };
+			float* previousPositions[] = { p.previousPositionX, p.previousPositionY, p.previousPositionZ };
+			float* velocities[] = { p.velocityX, p.velocityY, p.velocityZ };
+			const float* forces[] = { p.forceX, p.forceY, p.forceZ };
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				__m128 position = _mm_loadu_ps(positions[axis] + i);
+				__m128 movement = _mm_add_ps(_mm_sub_ps(position, _mm_loadu_ps(previousPositions[axis] + i)), _mm_mul_ps(_mm_loadu_ps(forces[axis] + i), accelerationScale));
+				__m128 newPosition = _mm_add_ps(position, movement);
+
+				_mm_storeu_ps(previousPositions[axis] + i, position);
+				_mm_storeu_ps(positions[axis] + i, newPosition);
+				_mm_storeu_ps(velocities[axis] + i, _mm_mul_ps(_mm_sub_ps(newPosition, position), inverseDt));
+			}
+		});
+	}
+
+	void Particles::RungeKutta4(const ParticleStreams& particles, const Vector3D& gravity, float linearDrag, float quadraticDrag, float deltaTime, bool multithreaded)
+	{
+		WideVector g(gravity);
+		__m128 linear = _mm_set1_ps(linearDrag);
+		__m128 quadratic = _mm_set1_ps(quadraticDrag);
+		__m128 dt = _mm_set1_ps(deltaTime);
+		__m128 halfDt = _mm_set1_ps(deltaTime * .5f);
+		__m128 sixthDt = _mm_set1_ps(deltaTime / 6);
+		__m128 two = _mm_set1_ps(2);
+
+		RunKernel(particles, multithreaded, [&](const ParticleStreams& p, size_t i)
+		{
+			__m128 inverseMass = _mm_loadu_ps(p.inverseMass + i);
+			__m128 dynamic = _mm_cmpgt_ps(inverseMass, _mm_setzero_ps());
+			__m128 gx = _mm_and_ps(dynamic, g.x), gy = _mm_and_ps(dynamic, g.y), gz = _mm_and_ps(dynamic, g.z);
+			__m128 fx = _mm_loadu_ps(p.forceX + i), fy = _mm_loadu_ps(p.forceY + i), fz = _mm_loadu_ps(p.forceZ + i);
+
+			// The acceleration only depends on the velocity: gravity + (force - drag) / mass.
+			auto accelerate = [&](__m128 vx, __m128 vy, __m128 vz, __m128& ax, __m128& ay, __m128& az)
+			{
+				__m128 drag = DragCoefficient(vx, vy, vz, linear, quadratic);
+				ax = _mm_add_ps(gx, _mm_mul_ps(inverseMass, _mm_sub_ps(fx, _mm_mul_ps(drag, vx))));
+				ay = _mm_add_ps(gy, _mm_mul_ps(inverseMass, _mm_sub_ps(fy, _mm_mul_ps(drag, vy))));
+				az = _mm_add_ps(gz, _mm_mul_ps(inverseMass, _mm_sub_ps(fz, _mm_mul_ps(drag, vz))));
+			};
+
+			__m128 v1x = _mm_loadu_ps(p.velocityX + i), v1y = _mm_loadu_ps(p.velocityY + i), v1z = _mm_loadu_ps(p.velocityZ + i);
+			__m128 a1x, a1y, a1z;
+			accelerate(v1x, v1y, v1z, a1x, a1y, a1z);
+
+			__m128 v2x = _mm_add_ps(v1x, _mm_mul_ps(a1x, halfDt)), v2y = _mm_add_ps(v1y, _mm_mul_ps(a1y, halfDt)), v2z = _mm_add_ps(v1z, _mm_mul_ps(a1z, halfDt));
+			__m128 a2x, a2y, a2z;
+			accelerate(v2x, v2y, v2z, a2x, a2y, a2z);
+
+			__m128 v3x = _mm_add_ps(v1x, _mm_mul_ps(a2x, halfDt)), v3y = _mm_add_ps(v1y, _mm_mul_ps(a2y, halfDt)), v3z = _mm_add_ps(v1z, _mm_mul_ps(a2z, halfDt));
+			__m128 a3x, a3y, a3z;
+			accelerate(v3x, v3y, v3z, a3x, a3y, a3z);
+
+			__m128 v4x = _mm_add_ps(v1x, _mm_mul_ps(a3x, dt)), v4y = _mm_add_ps(v1y, _mm_mul_ps(a3y, dt)), v4z = _mm_add_ps(v1z, _mm_mul_ps(a3z, dt));
+			__m128 a4x, a4y, a4z;
+			accelerate(v4x, v4y, v4z, a4x, a4y, a4z);
+
+			// (k1 + 2k2 + 2k3 + k4) * dt / 6, where the k of the position is the velocity and the k of the velocity is the acceleration.
+			auto combine = [&](__m128 k1, __m128 k2, __m128 k3, __m128 k4)
+			{
+				return _mm_mul_ps(_mm_add_ps(_mm_add_ps(k1, _mm_mul_ps(two, _mm_add_ps(k2, k3))), k4), sixthDt);
+			};
+
+			_mm_storeu_ps(p.positionX + i, _mm_add_ps(_mm_loadu_ps(p.positionX + i), combine(v1x, v2x, v3x, v4x)));
+			_mm_storeu_ps(p.positionY + i, _mm_add_ps(_mm_loadu_ps(p.positionY + i), combine(v1y, v2y, v3y, v4y)));
+			_mm_storeu_ps(p.positionZ + i, _mm_add_ps(_mm_loadu_ps(p.positionZ + i), combine(v1z, v2z, v3z, v4z)));
+			_mm_storeu_ps(p.velocityX + i, _mm_add_ps(v1x, combine(a1x, a2x, a3x, a4x)));
+			_mm_storeu_ps(p.velocityY + i, _mm_add_ps(v1y, combine(a1y, a2y, a3y, a4y)));
+			_mm_storeu_ps(p.velocityZ + i, _mm_add_ps(v1z, combine(a1z, a2z, a3z, a4z)));
+		});
+	}
+	#pragma endregion
+
+	void Particles::CollidePlane(const ParticleStreams& particles, const Vector3D& normal, float distance, float restitution, float friction, float deltaTime, bool multithreaded)
+	{
+		WideVector n(normal);
+		__m128 planeDistance = _mm_set1_ps(distance);
+		__m128 bounce = _mm_set1_ps(-restitution);
+		__m128 slide = _mm_set1_ps(1 - friction);
+		__m128 dt = _mm_set1_ps(deltaTime);
+
+		RunKernel(particles, multithreaded, [&](const ParticleStreams& p, size_t i)
+		{
+			__m128 px = _mm_loadu_ps(p.positionX + i), py = _mm_loadu_ps(p.positionY + i), pz = _mm_loadu_ps(p.positionZ + i);
+			__m128 vx = _mm_loadu_ps(p.velocityX + i), vy = _mm_loadu_ps(p.velocityY + i), vz = _mm_loadu_ps(p.velocityZ + i);
+
+			__m128 depth = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(px, n.x), _mm_mul_ps(py, n.y)), _mm_mul_ps(pz, n.z)), planeDistance);
+			__m128 inside = _mm_cmplt_ps(depth, _mm_setzero_ps());
+			if (_mm_movemask_ps(inside) == 0)
+				return;
+
+			// Pushing by min(depth, 0) leaves the particles in front of the plane where they are.
+			__m128 push = _mm_min_ps(depth, _mm_setzero_ps());
+			px = _mm_sub_ps(px, _mm_mul_ps(n.x, push));
+			py = _mm_sub_ps(py, _mm_mul_ps(n.y, push));
+			pz = _mm_sub_ps(pz, _mm_mul_ps(n.z, push));
+			_mm_storeu_ps(p.positionX + i, px);
+			_mm_storeu_ps(p.positionY + i, py);
+			_mm_storeu_ps(p.positionZ + i, pz);
+
+			// Only velocities that go into the plane bounce, the ones that already leave it are kept.
+			__m128 normalSpeed = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, n.x), _mm_mul_ps(vy, n.y)), _mm_mul_ps(vz, n.z));
+			__m128 hit = _mm_and_ps(inside, _mm_cmplt_ps(normalSpeed, _mm_setzero_ps()));
+			__m128 bounced = _mm_mul_ps(normalSpeed, bounce);
+			vx = Select(hit, _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx, _mm_mul_ps(n.x, normalSpeed)), slide), _mm_mul_ps(n.x, bounced)), vx);
+			vy = Select(hit, _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vy, _mm_mul_ps(n.y, normalSpeed)), slide), _mm_mul_ps(n.y, bounced)), vy);
+			vz = Select(hit, _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vz, _mm_mul_ps(n.z, normalSpeed)), slide), _mm_mul_ps(n.z, bounced)), vz);
+			_mm_storeu_ps(p.velocityX + i, vx);
+			_mm_storeu_ps(p.velocityY + i, vy);
+			_mm_storeu_ps(p.velocityZ + i, vz);
+
+			if (p.previousPositionX != nullptr)
+			{
+				_mm_storeu_ps(p.previousPositionX + i, Select(inside, _mm_sub_ps(px, _mm_mul_ps(vx, dt)), _mm_loadu_ps(p.previousPositionX + i)));
+				_mm_storeu_ps(p.previousPositionY + i, Select(inside, _mm_sub_ps(py, _mm_mul_ps(vy, dt)), _mm_loadu_ps(p.previousPositionY + i)));
+				_mm_storeu_ps(p.previousPositionZ + i, Select(inside, _mm_sub_ps(pz, _mm_mul_ps(vz, dt)), _mm_loadu_ps(p.previousPositionZ + i)));
+			}
+		});
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "ParticleStreams.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// Kernels that apply forces to and integrate whole particle streams (see ParticleStreams and ParticleBuffer).<para/>
+	/// Every kernel processes 4 particles at a time with SSE2. The last particles go through the same SIMD code on a padded copy, so every particle gets exactly the same result no matter where it is in the streams.<para/>
+	/// With multithreaded, big streams are split into chunks that run on the threads of Parallel. The chunks never share particles, so the results are the same with and without threads.<para/>
+	/// A usual step clears the forces, adds gravity, drag and other forces, integrates, and then collides.
+	/// </summary>
+	namespace Particles
+	{
+		/// <summary>
+		/// The number of particles in every chunk of a multithreaded kernel.
+		/// </summary>
+		constexpr size_t PARALLEL_CHUNK_SIZE = 16384;
+
+		#pragma region Forces.
+		/// <summary>
+		/// Sets the forces of all the particles to 0.
+		/// </summary>
+		SUPERGOD_API_FUNC void ClearForces(const ParticleStreams& particles, bool multithreaded = true);
+
+		/// <summary>
+		/// Adds the weight of every particle (gravity multiplied by its mass) to its force. Particles with an infinite mass are skipped.
+		/// </summary>
+		SUPERGOD_API_FUNC void AddGravity(const ParticleStreams& particles, const Math::Vector3D& gravity, bool multithreaded = true);
+
+		/// <summary>
+		/// Adds a force against the velocity of every particle: -(linear + quadratic * speed) * velocity.
+		/// </summary>
+		/// <param name="linear">The drag that grows with the speed, like the drag of slow objects in thick fluids.</param>
+		/// <param name="quadratic">The drag that grows with the speed squared, like air resistance.</param>
+		SUPERGOD_API_FUNC void AddDrag(const ParticleStreams& particles, float linear, float quadratic, bool multithreaded = true);
+		#pragma endregion
+
+		#pragma region Integration.
+		/// <summary>
+		/// Moves the particles by deltaTime with semi-implicit (symplectic) Euler: velocity += force / mass * deltaTime, then position += velocity * deltaTime.
+		/// </summary>
+		SUPERGOD_API_FUNC void SemiImplicitEuler(const ParticleStreams& particles, float deltaTime, bool multithreaded = true);
+
+		/// <summary>
+		/// Sets the previous positions to where the particles were deltaTime ago according to their velocities. Call this before Verlet after changing velocities directly.
+		/// </summary>
+		SUPERGOD_API_FUNC void PrepareVerlet(const ParticleStreams& particles, float deltaTime, bool multithreaded = true);
+
+		/// <summary>
+		/// Moves the particles by deltaTime with position Verlet: position += position - previous position + force / mass * deltaTime^2.<para/>
+		/// The velocities are derived from the positions and only written for the force kernels, so deltaTime has to be the same every step (or PrepareVerlet has to be called when it changes).
+		/// </summary>
+		SUPERGOD_API_FUNC void Verlet(const ParticleStreams& particles, float deltaTime, bool multithreaded = true);
+
+		/// <summary>
+		/// Moves the particles by deltaTime with the classic fourth order Runge-Kutta method.<para/>
+		/// The acceleration is evaluated 4 times per step, so gravity and drag are passed here instead of added to the forces (which are treated as constant during the step).
+		/// Particles with an infinite mass are not affected by gravity or drag.
+		/// </summary>
+		SUPERGOD_API_FUNC void RungeKutta4(const ParticleStreams& particles, const Math::Vector3D& gravity, float linearDrag, float quadraticDrag, float deltaTime, bool multithreaded = true);
+		#pragma endregion
+
+		/// <summary>
+		/// Pushes the particles that are behind the plane (dot(normal, position) smaller than distance) back on to it, and bounces the ones that move into it.<para/>
+		/// The velocity along the normal is reflected and multiplied by restitution, and the velocity along the plane is multiplied by 1 - friction.
+		/// When the streams have previous positions, they are moved to match the new velocities for Verlet integration with deltaTime.
+		/// </summary>
+		/// <param name="normal">A unit vector pointing out of the plane.</param>
+		SUPERGOD_API_FUNC void CollidePlane(const ParticleStreams& particles, const Math::Vector3D& normal, float distance, float restitution, float friction, float deltaTime, bool multithreaded = true);
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "ParticleStreams.h"
+#include "ParticleBuffer.h"
+#include "Particles.h"
+#include "BoundingBox.h"
+#include "Shape.h"
+#include "RigidBody.h"
+#include "Broadphase.h"
+#include "SweepAndPrune.h"
+#include "Collision.h"
+#include "PhysicsWorld.h"
+#include "SupportMapping.h"
+#include "Gjk.h"
+#include "Sweep.h"
\ No newline at end of file
@@ -0,0 +1,590 @@
+#include "PhysicsWorld.h"
+#include "Common/Parallel.h"
+#include "Math/SMath.h"
+#include <algorithm>
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	/// <summary>
+	/// The fraction of the penetration that is corrected every step.
+	/// </summary>
+	constexpr float BAUMGARTE = .2f;
+
+	/// <summary>
+	/// The penetration that is allowed, so resting contacts don't jitter between touching and not.
+	/// </summary>
+	constexpr float PENETRATION_SLOP = .005f;
+
+	/// <summary>
+	/// Bodies that hit each other slower than this don't bounce, which keeps resting bodies from vibrating.
+	/// </summary>
+	constexpr float RESTITUTION_THRESHOLD = 1;
+
+	/// <summary>
+	/// Contact points closer than this (in the space of the first body) to a point of the last step are treated as the same point.
+	/// </summary>
+	constexpr float CONTACT_MATCH_DISTANCE = .05f;
+
+	/// <summary>
+	/// Bounds are grown by this so touching bodies stay in the broadphase.
+	/// </summary>
+	constexpr float BOUNDS_MARGIN = .01f;
+
+	constexpr uint NO_ISLAND = 0xffffffff;
+
+	/// <summary>
+	/// Islands with at least this many manifolds solve their contacts by color, which splits them between the threads when multithreaded is set.
+	/// Smaller islands are solved one island per thread, with the contacts in order, which makes stacks settle faster.
+	/// </summary>
+	constexpr uint LARGE_ISLAND_MANIFOLDS = 128;
+
+	/// <summary>
+	/// The number of colors (groups of manifolds that don't share a moving body) the manifolds of an island are split into, one bit of a uint each.
+	/// Manifolds that don't fit in any of them go to an extra overflow color, which is solved on a single thread.
+	/// </summary>
+	constexpr uint COLOR_COUNT = 32;
+
+	/// <summary>
+	/// How many manifolds of a color every chunk of a parallel loop solves.
+	/// </summary>
+	constexpr size_t COLOR_CHUNK_SIZE = 16;
+
+	/// <summary>
+	/// The velocities and mass of a body while its island is being solved. Index 0 of every island stands for all static bodies.
+	/// </summary>
+	struct SolverBody
+	{
+		Vector3D linearVelocity;
+		Vector3D angularVelocity;
+		float inverseMass;
+		Matrix3x3 inverseInertia;
+	};
+
+	/// <summary>
+	/// A contact point prepared for the solver.
+	/// </summary>
+	struct SolverContact
+	{
+		uint bodyA, bodyB;
+		Vector3D offsetA, offsetB;
+		Vector3D normal, tangent1, tangent2;
+		float normalMass, tangentMass1, tangentMass2;
+		float bias;
+		float friction;
+		float normalImpulse, tangentImpulse1, tangentImpulse2;
+		ContactPoint* point;
+	};
+
+	/// <summary>
+	/// The memory SolveIsland works in. Every thread keeps its own, so it's only allocated when an island is bigger than the ones the thread solved before.
+	/// </summary>
+	struct SolverScratch
+	{
+		std::vector<SolverBody> bodies;
+		std::vector<SolverContact> contacts;
+
+		/// <summary>
+		/// The contacts of the i'th manifold of the island are from contactStarts[i] up to contactStarts[i + 1].
+		/// </summary>
+		std::vector<uint> contactStarts;
+
+		/// <summary>
+		/// The colors of the manifolds that use every solver body (a bit per color), and the color of every manifold.
+		/// </summary>
+		std::vector<uint> bodyColors;
+		std::vector<uint> manifoldColors;
+
+		/// <summary>
+		/// The manifolds of color c are colorManifolds[colorStarts[c]] up to colorManifolds[colorStarts[c + 1]], in the order of the island. The overflow color is COLOR_COUNT.
+		/// colorEnds is where the next manifold of every color goes while they are sorted.
+		/// </summary>
+		std::vector<uint> colorStarts;
+		std::vector<uint> colorEnds;
+		std::vector<uint> colorManifolds;
+	};
+
+	/// <summary>
+	/// Gets two unit vectors that are perpendicular to normal and to each other.
+	/// </summary>
+	static void GetTangents(const Vector3D& normal, Vector3D& tangent1, Vector3D& tangent2)
+	{
+		if (SMath::Abs(normal.x) >= .57735f)
+			tangent1 = Vector3D(normal.y, -normal.x, 0).Normalized();
+		else
+			tangent1 = Vector3D(0, normal.z, -normal.y).Normalized();
+		tangent2 = normal.Cross(tangent1);
+	}
+
+	/// <summary>
+	/// Gets 1 / the effective mass of the two bodies at the offsets along direction.
+	/// </summary>
+	static inline float InverseEffectiveMass(const SolverBody& a, const SolverBody& b, const Vector3D& offsetA, const Vector3D& offsetB, const Vector3D& direction)
+	{
+		Vector3D crossA = offsetA.Cross(direction), crossB = offsetB.Cross(direction);
+		return a.inverseMass + b.inverseMass + crossA.Dot(a.inverseInertia.Multiply(crossA)) + crossB.Dot(b.inverseInertia.Multiply(crossB));
+	}
+
+	/// <summary>
+	/// Applies impulse to b and the opposite impulse to a.<para/>
+	/// The static body (with an inverse mass of 0) is never written to, so manifolds that are solved at the same time can share it.
+	/// </summary>
+	static inline void ApplyImpulse(SolverBody& a, SolverBody& b, const Vector3D& offsetA, const Vector3D& offsetB, const Vector3D& impulse)
+	{
+		if (a.inverseMass != 0)
+		{
+			a.linearVelocity -= impulse * a.inverseMass;
+			a.angularVelocity -= a.inverseInertia.Multiply(offsetA.Cross(impulse));
+		}
+
+		if (b.inverseMass != 0)
+		{
+			b.linearVelocity += impulse * b.inverseMass;
+			b.angularVelocity += b.inverseInertia.Multiply(offsetB.Cross(impulse));
+		}
+	}
+
+	static inline Vector3D RelativeVelocity(const SolverBody& a, const SolverBody& b, const Vector3D& offsetA, const Vector3D& offsetB)
+	{
+		return b.linearVelocity + b.angularVelocity.Cross(offsetB) - a.linearVelocity - a.angularVelocity.Cross(offsetA);
+	}
+
+	/// <summary>
+	/// Does one sequential impulse iteration on contact.
+	/// </summary>
+	static inline void SolveContact(SolverContact& contact, std::vector<SolverBody>& solverBodies)
+	{
+		SolverBody& a = solverBodies[contact.bodyA];
+		SolverBody& b = solverBodies[contact.bodyB];
+
+		// Friction first, limited by the normal impulse of the last iteration, so the normal impulse has the last word on penetration.
+		float maxFriction = contact.friction * contact.normalImpulse;
+		Vector3D velocity = RelativeVelocity(a, b, contact.offsetA, contact.offsetB);
+		float impulse1 = -velocity.Dot(contact.tangent1) * contact.tangentMass1;
+		float accumulated1 = SMath::Clamp(contact.tangentImpulse1 + impulse1, -maxFriction, maxFriction);
+		impulse1 = accumulated1 - contact.tangentImpulse1;
+		contact.tangentImpulse1 = accumulated1;
+
+		float impulse2 = -velocity.Dot(contact.tangent2) * contact.tangentMass2;
+		float accumulated2 = SMath::Clamp(contact.tangentImpulse2 + impulse2, -maxFriction, maxFriction);
+		impulse2 = accumulated2 - contact.tangentImpulse2;
+		contact.tangentImpulse2 = accumulated2;
+		ApplyImpulse(a, b, contact.offsetA, contact.offsetB, contact.tangent1 * impulse1 + contact.tangent2 * impulse2);
+
+		// The accumulated normal impulse can only push.
+		float normalSpeed = RelativeVelocity(a, b, contact.offsetA, contact.offsetB).Dot(contact.normal);
+		float normalImpulse = (contact.bias - normalSpeed) * contact.normalMass;
+		float accumulated = SMath::Max(contact.normalImpulse + normalImpulse, 0);
+		normalImpulse = accumulated - contact.normalImpulse;
+		contact.normalImpulse = accumulated;
+		ApplyImpulse(a, b, contact.offsetA, contact.offsetB, contact.normal * normalImpulse);
+	}
+
+	/// <summary>
+	/// Splits the manifolds of the island in scratch into colors, where the manifolds of every color share no moving bodies, and sorts them by color.<para/>
+	/// Every manifold gets the first color that none of its moving bodies has yet. The static body never gets colors, so it doesn't limit them.
+	/// </summary>
+	static void ColorManifolds(SolverScratch& scratch)
+	{
+		size_t manifoldCount = scratch.contactStarts.size() - 1;
+		scratch.bodyColors.assign(scratch.bodies.size(), 0);
+		scratch.manifoldColors.resize(manifoldCount);
+		for (size_t manifold = 0; manifold < manifoldCount; manifold++)
+		{
+			const SolverContact& contact = scratch.contacts[scratch.contactStarts[manifold]];
+			uint usedColors = scratch.bodyColors[contact.bodyA] | scratch.bodyColors[contact.bodyB];
+			uint color = 0;
+			while (color < COLOR_COUNT && (usedColors >> color & 1))
+				color++;
+
+			if (color < COLOR_COUNT)
+			{
+				if (contact.bodyA != 0)
+					scratch.bodyColors[contact.bodyA] |= 1u << color;
+				if (contact.bodyB != 0)
+					scratch.bodyColors[contact.bodyB] |= 1u << color;
+			}
+			scratch.manifoldColors[manifold] = color;
+		}
+
+		// Counting sort of the manifolds by color, which keeps every color in the order of the island.
+		scratch.colorStarts.assign(COLOR_COUNT + 2, 0);
+		for (uint color : scratch.manifoldColors)
+			scratch.colorStarts[color + 1]++;
+		for (uint color = 0; color <= COLOR_COUNT; color++)
+			scratch.colorStarts[color + 1] += scratch.colorStarts[color];
+
+		scratch.colorManifolds.resize(manifoldCount);
+		scratch.colorEnds.assign(scratch.colorStarts.begin(), scratch.colorStarts.end() - 1);
+		for (uint manifold = 0; manifold < manifoldCount; manifold++)
+			scratch.colorManifolds[scratch.colorEnds[scratch.manifoldColors[manifold]]++] = manifold;
+	}
+
+	PhysicsWorld::PhysicsWorld()
+		: gravity(0, -9.81f, 0), velocityIterations(10), sleepDelay(.5f), sleepLinearSpeed(.05f), sleepAngularSpeed(.05f), multithreaded(true)
+	{
+	}
+
+	uint PhysicsWorld::AddBody(const RigidBody& body)
+	{
+		bodies.push_back(body);
+		bodies.back().UpdateDerivedState();
+		return (uint)bodies.size() - 1;
+	}
+
+	void PhysicsWorld::WakeUp(uint index)
+	{
+		RigidBody& body = bodies[index];
+		body.awake = true;
+		body.restingTime = 0;
+		body.UpdateDerivedState();
+	}
+
+	size_t PhysicsWorld::AwakeBodyCount() const
+	{
+		size_t count = 0;
+		for (const RigidBody& body : bodies)
+			count += !body.IsStatic() && body.awake;
+		return count;
+	}
+
+	void PhysicsWorld::Step(float deltaTime)
+	{
+		bounds.resize(bodies.size());
+		for (size_t i = 0; i < bodies.size(); i++)
+			bounds[i] = bodies[i].bounds.Expanded(BOUNDS_MARGIN);
+
+		broadphase.Update(bounds.data(), bounds.size());
+		FindContacts();
+		BuildIslands();
+
+		// Large islands split their own contacts between the threads, one island after the other. The rest are solved one island per thread.
+		size_t islands = AwakeIslandCount();
+		for (size_t island = 0; island < islands; island++)
+		{
+			if (IsLargeIsland(island))
+				SolveIsland(island, deltaTime);
+		}
+
+		Parallel::For(islands, multithreaded ? 1 : islands, [this, deltaTime](size_t begin, size_t end)
+		{
+			for (size_t island = begin; island < end; island++)
+			{
+				if (!IsLargeIsland(island))
+					SolveIsland(island, deltaTime);
+			}
+		});
+	}
+
+	bool PhysicsWorld::IsLargeIsland(size_t island) const
+	{
+		return islandManifoldStarts[island + 1] - islandManifoldStarts[island] >= LARGE_ISLAND_MANIFOLDS;
+	}
+
+	void PhysicsWorld::FindContacts()
+	{
+		std::swap(manifolds, previousManifolds);
+		const std::vector<OverlapPair>& pairs = broadphase.GetPairs();
+		manifolds.resize(pairs.size());
+
+		Parallel::For(pairs.size(), multithreaded ? 64 : pairs.size(), [this, &pairs](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				const OverlapPair& pair = pairs[i];
+				const RigidBody& a = bodies[pair.a];
+				const RigidBody& b = bodies[pair.b];
+				ContactManifold& manifold = manifolds[i];
+				manifold.bodyA = pair.a;
+				manifold.bodyB = pair.b;
+				manifold.pointCount = 0;
+
+				bool activeA = !a.IsStatic() && a.awake, activeB = !b.IsStatic() && b.awake;
+				if (a.IsStatic() && b.IsStatic())
+					continue;
+
+				// The manifold of the last step, if the bodies touched then.
+				auto previous = std::lower_bound(previousManifolds.begin(), previousManifolds.end(), pair.Key(), [](const ContactManifold& manifold, unsigned long long key)
+				{
+					return ((unsigned long long)manifold.bodyA << 32 | manifold.bodyB) < key;
+				});
+				bool hasPrevious = previous != previousManifolds.end() && previous->bodyA == pair.a && previous->bodyB == pair.b;
+
+				// Nothing moved, so the contacts of sleeping bodies are kept as they were. They still connect the bodies into islands.
+				if (!activeA && !activeB)
+				{
+					if (hasPrevious)
+						manifold = *previous;
+					continue;
+				}
+
+				Collision::Collide(a, b, manifold);
+				for (int j = 0; j < manifold.pointCount; j++)
+				{
+					ContactPoint& point = manifold.points[j];
+					point.localPosition = a.ToLocal(point.position);
+					if (!hasPrevious)
+						continue;
+
+					for (int k = 0; k < previous->pointCount; k++)
+					{
+						const ContactPoint& old = previous->points[k];
+						if (old.localPosition.SqrDistance(point.localPosition) < CONTACT_MATCH_DISTANCE * CONTACT_MATCH_DISTANCE)
+						{
+							point.normalImpulse = old.normalImpulse;
+							point.tangentImpulse1 = old.tangentImpulse1;
+							point.tangentImpulse2 = old.tangentImpulse2;
+							break;
+						}
+					}
+				}
+			}
+		});
+
+		manifolds.erase(std::remove_if(manifolds.begin(), manifolds.end(), [](const ContactManifold& manifold) { return manifold.pointCount == 0; }), manifolds.end());
+	}
+
+	uint PhysicsWorld::FindRoot(uint body)
+	{
+		while (parents[body] != body)
+		{
+			parents[body] = parents[parents[body]];
+			body = parents[body];
+		}
+		return body;
+	}
+
+	void PhysicsWorld::BuildIslands()
+	{
+		size_t count = bodies.size();
+		parents.resize(count);
+		solverIndices.resize(count);
+		for (uint i = 0; i < count; i++)
+			parents[i] = i;
+
+		// Static bodies don't move, so they don't connect the bodies that touch them.
+		for (const ContactManifold& manifold : manifolds)
+		{
+			if (!bodies[manifold.bodyA].IsStatic() && !bodies[manifold.bodyB].IsStatic())
+			{
+				uint rootA = FindRoot(manifold.bodyA), rootB = FindRoot(manifold.bodyB);
+				if (rootA != rootB)
+					parents[rootA < rootB ? rootB : rootA] = rootA < rootB ? rootA : rootB;
+			}
+		}
+
+		// Roots of islands with an awake body get an island, the others sleep.
+		std::vector<uint> islandOfRoot(count, NO_ISLAND);
+		for (uint i = 0; i < count; i++)
+		{
+			if (!bodies[i].IsStatic() && bodies[i].awake)
+				islandOfRoot[FindRoot(i)] = 0;
+		}
+
+		uint islandCount = 0;
+		islandBodyStarts.assign(1, 0);
+		for (uint i = 0; i < count; i++)
+		{
+			if (islandOfRoot[i] == 0 && parents[i] == i)
+			{
+				islandOfRoot[i] = islandCount++;
+				islandBodyStarts.push_back(0);
+			}
+		}
+
+		// Counting sort of the bodies and then the manifolds by island, which keeps both in index order inside every island.
+		auto sortByIsland = [&](size_t itemCount, const auto& getIsland, std::vector<uint>& starts, std::vector<uint>& items)
+		{
+			starts.assign(islandCount + 1, 0);
+			for (size_t i = 0; i < itemCount; i++)
+			{
+				uint island = getIsland(i);
+				if (island != NO_ISLAND)
+					starts[island + 1]++;
+			}
+
+			for (uint island = 0; island < islandCount; island++)
+				starts[island + 1] += starts[island];
+
+			items.resize(starts[islandCount]);
+			std::vector<uint> next(starts.begin(), starts.end() - 1);
+			for (size_t i = 0; i < itemCount; i++)
+			{
+				uint island = getIsland(i);
+				if (island != NO_ISLAND)
+					items[next[island]++] = (uint)i;
+			}
+		};
+
+		sortByIsland(count, [&](size_t body)
+		{
+			return bodies[body].IsStatic() ? NO_ISLAND : islandOfRoot[FindRoot((uint)body)];
+		}, islandBodyStarts, islandBodies);
+
+		sortByIsland(manifolds.size(), [&](size_t manifold)
+		{
+			uint body = bodies[manifolds[manifold].bodyA].IsStatic() ? manifolds[manifold].bodyB : manifolds[manifold].bodyA;
+			return islandOfRoot[FindRoot(body)];
+		}, islandManifoldStarts, islandManifolds);
+
+		// A body touched by an awake island wakes up with it.
+		for (uint body : islandBodies)
+		{
+			if (!bodies[body].awake)
+			{
+				bodies[body].awake = true;
+				bodies[body].restingTime = 0;
+			}
+		}
+	}
+
+	void PhysicsWorld::SolveIsland(size_t island, float deltaTime)
+	{
+		// The chunks of the parallel loops below use the scratch of this thread through the reference.
+		static thread_local SolverScratch threadScratch;
+		SolverScratch& scratch = threadScratch;
+		std::vector<SolverBody>& solverBodies = scratch.bodies;
+		std::vector<SolverContact>& contacts = scratch.contacts;
+
+		#pragma region Integrate the velocities.
+		solverBodies.resize(1);
+		solverBodies[0] = SolverBody{ Vector3D::Zero(), Vector3D::Zero(), 0, Matrix3x3::Zero() };
+		for (uint i = islandBodyStarts[island]; i < islandBodyStarts[island + 1]; i++)
+		{
+			const RigidBody& body = bodies[islandBodies[i]];
+			solverIndices[islandBodies[i]] = (uint)solverBodies.size();
+			solverBodies.push_back(SolverBody{ body.linearVelocity + gravity * deltaTime, body.angularVelocity, body.inverseMass, body.inverseWorldInertia });
+		}
+		#pragma endregion
+
+		#pragma region Prepare the contacts.
+		contacts.clear();
+		scratch.contactStarts.clear();
+		float inverseDeltaTime = 1 / deltaTime;
+		for (uint i = islandManifoldStarts[island]; i < islandManifoldStarts[island + 1]; i++)
+		{
+			ContactManifold& manifold = manifolds[islandManifolds[i]];
+			const RigidBody& a = bodies[manifold.bodyA];
+			const RigidBody& b = bodies[manifold.bodyB];
+			uint solverA = a.IsStatic() ? 0 : solverIndices[manifold.bodyA];
+			uint solverB = b.IsStatic() ? 0 : solverIndices[manifold.bodyB];
+			const SolverBody& bodyA = solverBodies[solverA];
+			const SolverBody& bodyB = solverBodies[solverB];
+			scratch.contactStarts.push_back((uint)contacts.size());
+
+			Vector3D tangent1, tangent2;
+			GetTangents(manifold.normal, tangent1, tangent2);
+			float friction = SMath::Sqrt(a.friction * b.friction);
+			float restitution = SMath::Max(a.restitution, b.restitution);
+
+			for (int j = 0; j < manifold.pointCount; j++)
+			{
+				ContactPoint& point = manifold.points[j];
+				SolverContact contact;
+				contact.bodyA = solverA;
+				contact.bodyB = solverB;
+				contact.offsetA = point.position - a.position;
+				contact.offsetB = point.position - b.position;
+				contact.normal = manifold.normal;
+				contact.tangent1 = tangent1;
+				contact.tangent2 = tangent2;
+				contact.normalMass = 1 / InverseEffectiveMass(bodyA, bodyB, contact.offsetA, contact.offsetB, manifold.normal);
+				contact.tangentMass1 = 1 / InverseEffectiveMass(bodyA, bodyB, contact.offsetA, contact.offsetB, tangent1);
+				contact.tangentMass2 = 1 / InverseEffectiveMass(bodyA, bodyB, contact.offsetA, contact.offsetB, tangent2);
+				contact.friction = friction;
+				contact.normalImpulse = point.normalImpulse;
+				contact.tangentImpulse1 = point.tangentImpulse1;
+				contact.tangentImpulse2 = point.tangentImpulse2;
+				contact.point = &point;
+
+				// Pushes the bodies apart to fix the penetration, or bounces them when they hit fast enough.
+				contact.bias = BAUMGARTE * inverseDeltaTime * SMath::Max(point.depth - PENETRATION_SLOP, 0);
+				float normalSpeed = RelativeVelocity(bodyA, bodyB, contact.offsetA, contact.offsetB).Dot(manifold.normal);
+				if (normalSpeed < -RESTITUTION_THRESHOLD)
+					contact.bias = SMath::Max(contact.bias, -restitution * normalSpeed);
+
+				contacts.push_back(contact);
+			}
+		}
+		scratch.contactStarts.push_back((uint)contacts.size());
+		#pragma endregion
+
+		#pragma region Warm start and solve.
+		for (SolverContact& contact : contacts)
+		{
+			ApplyImpulse(solverBodies[contact.bodyA], solverBodies[contact.bodyB], contact.offsetA, contact.offsetB,
+				contact.normal * contact.normalImpulse + contact.tangent1 * contact.tangentImpulse1 + contact.tangent2 * contact.tangentImpulse2);
+		}
+
+		if (IsLargeIsland(island))
+		{
+			// The manifolds of a color share no moving bodies, so they give the same results in any order and on any number of threads.
+			ColorManifolds(scratch);
+			for (int iteration = 0; iteration < velocityIterations; iteration++)
+			{
+				for (uint color = 0; color <= COLOR_COUNT; color++)
+				{
+					uint first = scratch.colorStarts[color], count = scratch.colorStarts[color + 1] - first;
+					Parallel::For(count, multithreaded && color < COLOR_COUNT ? COLOR_CHUNK_SIZE : count, [&scratch, first](size_t begin, size_t end)
+					{
+						for (size_t i = first + begin; i < first + end; i++)
+						{
+							uint manifold = scratch.colorManifolds[i];
+							for (uint contact = scratch.contactStarts[manifold]; contact < scratch.contactStarts[manifold + 1]; contact++)
+								SolveContact(scratch.contacts[contact], scratch.bodies);
+						}
+					});
+				}
+			}
+		}
+		else
+		{
+			for (int iteration = 0; iteration < velocityIterations; iteration++)
+			{
+				for (SolverContact& contact : contacts)
+					SolveContact(contact, solverBodies);
+			}
+		}
+
+		for (const SolverContact& contact : contacts)
+		{
+			contact.point->normalImpulse = contact.normalImpulse;
+			contact.point->tangentImpulse1 = contact.tangentImpulse1;
+			contact.point->tangentImpulse2 = contact.tangentImpulse2;
+		}
+		#pragma endregion
+
+		#pragma region Integrate the positions and sleep.
+		float sqrLinearSleep = sleepLinearSpeed * sleepLinearSpeed, sqrAngularSleep = sleepAngularSpeed * sleepAngularSpeed;
+		float minRestingTime = sleepDelay;
+		for (uint i = islandBodyStarts[island]; i < islandBodyStarts[island + 1]; i++)
+		{
+			RigidBody& body = bodies[islandBodies[i]];
+			const SolverBody& solved = solverBodies[solverIndices[islandBodies[i]]];
+			body.linearVelocity = solved.linearVelocity;
+			body.angularVelocity = solved.angularVelocity;
+			body.position += body.linearVelocity * deltaTime;
+			body.orientation = body.orientation.Integrate(body.angularVelocity, deltaTime);
+			body.UpdateDerivedState();
+
+			if (body.linearVelocity.SqrMagnitude() < sqrLinearSleep && body.angularVelocity.SqrMagnitude() < sqrAngularSleep)
+				body.restingTime += deltaTime;
+			else
+				body.restingTime = 0;
+			minRestingTime = SMath::Min(minRestingTime, body.restingTime);
+		}
+
+		if (minRestingTime >= sleepDelay)
+		{
+			for (uint i = islandBodyStarts[island]; i < islandBodyStarts[island + 1]; i++)
+			{
+				RigidBody& body = bodies[islandBodies[i]];
+				body.awake = false;
+				body.linearVelocity = Vector3D::Zero();
+				body.angularVelocity = Vector3D::Zero();
+			}
+		}
+		#pragma endregion
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "RigidBody.h"
+#include "Collision.h"
+#include "SweepAndPrune.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// Simulates a group of rigid bodies that collide with each other.<para/>
+	/// Every step finds overlapping bounds with sweep and prune, collides the overlapping bodies, splits the bodies into islands (groups that touch each other)
+	/// and solves the contacts of every island with sequential impulses. Islands never share moving bodies, so they are solved on the threads of Parallel when multithreaded is set.
+	/// The manifolds of large islands (like one big pile) are also split into colors that don't share moving bodies, and every color is split between the threads.<para/>
+	/// Islands whose bodies all rest for sleepDelay seconds fall asleep and cost almost nothing until an awake body touches them.
+	/// </summary>
+	class PhysicsWorld final
+	{
+	public:
+		/// <summary>
+		/// The acceleration of every dynamic body.
+		/// </summary>
+		Math::Vector3D gravity;
+
+		/// <summary>
+		/// How many times per step the solver goes over all the contacts. More iterations make stacks stiffer.
+		/// </summary>
+		int velocityIterations;
+
+		/// <summary>
+		/// For how long (in seconds) the bodies of an island have to rest before it falls asleep.
+		/// </summary>
+		float sleepDelay;
+
+		/// <summary>
+		/// Bodies that move and spin slower than these are resting.
+		/// </summary>
+		float sleepLinearSpeed;
+		float sleepAngularSpeed;
+
+		/// <summary>
+		/// Should the narrowphase and the islands run on multiple threads? The results are the same either way.
+		/// </summary>
+		bool multithreaded;
+
+		/// <summary>
+		/// Creates a world without bodies.
+		/// </summary>
+		SUPERGOD_API_FUNC PhysicsWorld();
+
+		/// <summary>
+		/// Adds body to the world and returns its index.
+		/// </summary>
+		SUPERGOD_API_FUNC uint AddBody(const RigidBody& body);
+
+		/// <summary>
+		/// Gets the number of bodies.
+		/// </summary>
+		inline size_t BodyCount() const { return bodies.size(); }
+
+		/// <summary>
+		/// Gets the body at index. Call WakeUp after moving a sleeping body.
+		/// </summary>
+		inline RigidBody& GetBody(uint index) { return bodies[index]; }
+
+		/// <summary>
+		/// Gets the body at index.
+		/// </summary>
+		inline const RigidBody& GetBody(uint index) const { return bodies[index]; }
+
+		/// <summary>
+		/// Wakes the body at index (and the bodies it touches on the next step) and updates its inertia and bounds.
+		/// </summary>
+		SUPERGOD_API_FUNC void WakeUp(uint index);
+
+		/// <summary>
+		/// Moves the simulation forward by deltaTime seconds.
+		/// </summary>
+		SUPERGOD_API_FUNC void Step(float deltaTime);
+
+		/// <summary>
+		/// Gets the contacts between bodies from the last step, sorted by their bodies.
+		/// </summary>
+		inline const std::vector<ContactManifold>& GetContacts() const { return manifolds; }
+
+		/// <summary>
+		/// Gets the number of islands that were simulated in the last step (sleeping islands are not counted).
+		/// </summary>
+		inline size_t AwakeIslandCount() const { return islandBodyStarts.empty() ? 0 : islandBodyStarts.size() - 1; }
+
+		/// <summary>
+		/// Gets the number of dynamic bodies that are awake.
+		/// </summary>
+		SUPERGOD_API_FUNC size_t AwakeBodyCount() const;
+
+	private:
+		/// <summary>
+		/// Collides the bodies of every broadphase pair into manifolds, reusing the impulses of the last step.
+		/// </summary>
+		void FindContacts();
+
+		/// <summary>
+		/// Groups the dynamic bodies into islands and wakes the islands that have an awake body.
+		/// </summary>
+		void BuildIslands();
+
+		/// <summary>
+		/// Solves the contacts of an island and moves its bodies.
+		/// </summary>
+		void SolveIsland(size_t island, float deltaTime);
+
+		/// <summary>
+		/// Is the island big enough to split its contacts between the threads?
+		/// </summary>
+		bool IsLargeIsland(size_t island) const;
+
+		/// <summary>
+		/// Gets the root of the union-find tree of body.
+		/// </summary>
+		uint FindRoot(uint body);
+
+		std::vector<RigidBody> bodies;
+		std::vector<BoundingBox> bounds;
+		SweepAndPrune broadphase;
+		std::vector<ContactManifold> manifolds;
+		std::vector<ContactManifold> previousManifolds;
+
+		/// <summary>
+		/// The union-find parents of the bodies, and the index of every dynamic body in the solver of its island.
+		/// </summary>
+		std::vector<uint> parents;
+		std::vector<uint> solverIndices;
+
+		/// <summary>
+		/// The bodies and manifolds of island i are from islandBodyStarts[i] up to islandBodyStarts[i + 1] (the same for manifolds).
+		/// </summary>
+		std::vector<uint> islandBodies;
+		std::vector<uint> islandBodyStarts;
+		std::vector<uint> islandManifolds;
+		std::vector<uint> islandManifoldStarts;
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "RigidBody.h"
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	RigidBody::RigidBody(const Shape& shape, const Vector3D& position, const Quaternion& orientation, float mass)
+		: shape(shape), position(position), orientation(orientation), linearVelocity(), angularVelocity(), inverseMass(0),
+		inverseLocalInertia(), inverseWorldInertia(), bounds(), friction(.5f), restitution(0), restingTime(0), awake(true)
+	{
+		SetMass(mass);
+	}
+
+	void RigidBody::SetMass(float mass)
+	{
+		if (mass <= 0)
+		{
+			inverseMass = 0;
+			inverseLocalInertia = Matrix3x3::Zero();
+			linearVelocity = Vector3D::Zero();
+			angularVelocity = Vector3D::Zero();
+		}
+		else
+		{
+			// The inertia tensors of the shapes are diagonal, so their inverse is too.
+			Matrix3x3 inertia = shape.Inertia(mass);
+			inverseMass = 1 / mass;
+			inverseLocalInertia = Matrix3x3(
+				1 / inertia.r0c0, 0, 0,
+				0, 1 / inertia.r1c1, 0,
+				0, 0, 1 / inertia.r2c2);
+		}
+
+		UpdateDerivedState();
+	}
+
+	void RigidBody::UpdateDerivedState()
+	{
+		Matrix3x3 rotation = orientation.ToMatrix();
+		inverseWorldInertia = rotation.Multiply(inverseLocalInertia).Multiply(rotation.Transposed());
+		bounds = shape.Bounds(position, orientation);
+	}
+
+	void RigidBody::ApplyImpulse(const Vector3D& impulse, const Vector3D& point)
+	{
+		if (IsStatic())
+			return;
+
+		linearVelocity += impulse * inverseMass;
+		angularVelocity += inverseWorldInertia.Multiply((point - position).Cross(impulse));
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "Math/Matrices/Matrix3x3.h"
+#include "Math/Quaternion.h"
+#include "Shape.h"
+#include "BoundingBox.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// A rigid body: a shape with a position, orientation, velocities and mass. Bodies with a mass of 0 are static, they never move.<para/>
+	/// Bodies are usually created and stepped by a PhysicsWorld.
+	/// </summary>
+	struct SUPERGOD_API_CLASS RigidBody final
+	{
+		Shape shape;
+		Math::Vector3D position;
+		Math::Quaternion orientation;
+		Math::Vector3D linearVelocity;
+
+		/// <summary>
+		/// The rotation speed in radians per second, around the direction of the vector (in world space).
+		/// </summary>
+		Math::Vector3D angularVelocity;
+
+		/// <summary>
+		/// 1 / mass, 0 for static bodies.
+		/// </summary>
+		float inverseMass;
+
+		/// <summary>
+		/// The inverse of the inertia tensor in the local space of the body.
+		/// </summary>
+		Math::Matrix3x3 inverseLocalInertia;
+
+		/// <summary>
+		/// The inverse of the inertia tensor in world space, rotation * inverseLocalInertia * rotation^T. Updated by UpdateDerivedState.
+		/// </summary>
+		Math::Matrix3x3 inverseWorldInertia;
+
+		/// <summary>
+		/// The bounds of the shape in world space. Updated by UpdateDerivedState.
+		/// </summary>
+		BoundingBox bounds;
+
+		/// <summary>
+		/// The friction coefficient. Contacts use the geometric mean of the friction of both bodies.
+		/// </summary>
+		float friction;
+
+		/// <summary>
+		/// How much of the speed is kept when bouncing, from 0 to 1. Contacts use the bigger restitution of both bodies.
+		/// </summary>
+		float restitution;
+
+		/// <summary>
+		/// For how long (in seconds) the body has been moving slowly enough to sleep.
+		/// </summary>
+		float restingTime;
+
+		/// <summary>
+		/// Is the body simulated? Sleeping bodies keep still until something wakes them.
+		/// </summary>
+		bool awake;
+
+		/// <summary>
+		/// Creates a body with shape at position. A mass of 0 makes it static.
+		/// </summary>
+		RigidBody(const Shape& shape, const Math::Vector3D& position, const Math::Quaternion& orientation, float mass);
+
+		/// <summary>
+		/// Is this body static (an infinite mass)?
+		/// </summary>
+		inline bool IsStatic() const { return inverseMass == 0; }
+
+		/// <summary>
+		/// Sets the mass and recomputes the inertia tensor from the shape. 0 makes the body static.
+		/// </summary>
+		void SetMass(float mass);
+
+		/// <summary>
+		/// Updates inverseWorldInertia and bounds after position or orientation changed.
+		/// </summary>
+		void UpdateDerivedState();
+
+		/// <summary>
+		/// Gets the velocity of the point of the body that is currently at point (in world space).
+		/// </summary>
+		inline Math::Vector3D VelocityAt(const Math::Vector3D& point) const
+		{
+			return linearVelocity + angularVelocity.Cross(point - position);
+		}
+
+		/// <summary>
+		/// Applies impulse (a change in momentum) at point (in world space).
+		/// </summary>
+		void ApplyImpulse(const Math::Vector3D& impulse, const Math::Vector3D& point);
+
+		/// <summary>
+		/// Converts point from world space to the local space of this body.
+		/// </summary>
+		inline Math::Vector3D ToLocal(const Math::Vector3D& point) const
+		{
+			return orientation.InverseRotate(point - position);
+		}
+
+		/// <summary>
+		/// Converts point from the local space of this body to world space.
+		/// </summary>
+		inline Math::Vector3D ToWorld(const Math::Vector3D& point) const
+		{
+			return position + orientation.Rotate(point);
+		}
+
+		/// <summary>
+		/// Gets the point of the core of the shape that is the furthest along direction in world space, and sets vertex to its index. See Shape::Support.
+		/// </summary>
+		inline Math::Vector3D Support(const Math::Vector3D& direction, int& vertex) const
+		{
+			return ToWorld(shape.Support(orientation.InverseRotate(direction), vertex));
+		}
+
+		/// <summary>
+		/// Gets the point of the core with the index Support gave, in world space.
+		/// </summary>
+		inline Math::Vector3D Vertex(int vertex) const
+		{
+			return ToWorld(shape.Vertex(vertex));
+		}
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "Shape.h"
+#include "Math/MathConstants.h"
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	float Shape::Volume() const
+	{
+		float sphere = 4 / 3.f * Constants::PI * radius * radius * radius;
+		switch (type)
+		{
+		case ShapeType::Sphere:
+			return sphere;
+		case ShapeType::Box:
+			return 8 * halfExtents.x * halfExtents.y * halfExtents.z;
+		case ShapeType::Capsule:
+			return sphere + Constants::PI * radius * radius * 2 * halfHeight;
+		}
+		return 0;
+	}
+
+	Matrix3x3 Shape::Inertia(float mass) const
+	{
+		switch (type)
+		{
+		case ShapeType::Sphere:
+			return Matrix3x3(.4f * mass * radius * radius);
+
+		case ShapeType::Box:
+		{
+			Vector3D squared = halfExtents.Multiply(halfExtents);
+			float third = mass / 3;
+			return Matrix3x3(
+				third * (squared.y + squared.z), 0, 0,
+				0, third * (squared.x + squared.z), 0,
+				0, 0, third * (squared.x + squared.y));
+		}
+
+		case ShapeType::Capsule:
+		{
+			// A cylinder and two half spheres (that make a sphere), each getting a share of the mass by volume.
+			float cylinderVolume = Constants::PI * radius * radius * 2 * halfHeight;
+			float cylinderMass = mass * cylinderVolume / Volume();
+			float sphereMass = mass - cylinderMass;
+			float squaredRadius = radius * radius;
+
+			float alongAxis = cylinderMass * squaredRadius * .5f + sphereMass * .4f * squaredRadius;
+			float acrossAxis = cylinderMass * (squaredRadius * .25f + halfHeight * halfHeight / 3) +
+				sphereMass * (.4f * squaredRadius + halfHeight * halfHeight + .75f * halfHeight * radius);
+			return Matrix3x3(
+				acrossAxis, 0, 0,
+				0, alongAxis, 0,
+				0, 0, acrossAxis);
+		}
+		}
+		return Matrix3x3();
+	}
+
+	BoundingBox Shape::Bounds(const Vector3D& position, const Quaternion& orientation) const
+	{
+		switch (type)
+		{
+		case ShapeType::Sphere:
+			return BoundingBox::FromCenter(position, Vector3D(radius, radius, radius));
+
+		case ShapeType::Box:
+		{
+			// The extent along every world axis is the sum of the box axes' projections on it.
+			Matrix3x3 rotation = orientation.ToMatrix().Abs();
+			return BoundingBox::FromCenter(position, rotation.Multiply(halfExtents));
+		}
+
+		case ShapeType::Capsule:
+		{
+			Vector3D axis = orientation.Rotate(Vector3D(0, halfHeight, 0)).Abs();
+			return BoundingBox::FromCenter(position, axis + Vector3D(radius, radius, radius));
+		}
+		}
+		return BoundingBox(position, position);
+	}
+
+	Vector3D Shape::Support(const Vector3D& direction, int& vertex) const
+	{
+		switch (type)
+		{
+		case ShapeType::Box:
+			vertex = (direction.x >= 0) | (direction.y >= 0) << 1 | (direction.z >= 0) << 2;
+			break;
+
+		case ShapeType::Capsule:
+			vertex = direction.y >= 0;
+			break;
+
+		default:
+			vertex = 0;
+			break;
+		}
+		return Vertex(vertex);
+	}
+
+	Vector3D Shape::Vertex(int vertex) const
+	{
+		switch (type)
+		{
+		case ShapeType::Sphere:
+			// The core of a sphere is its center.
+			return Vector3D();
+
+		case ShapeType::Box:
+			return Vector3D(vertex & 1 ? halfExtents.x : -halfExtents.x, vertex & 2 ? halfExtents.y : -halfExtents.y, vertex & 4 ? halfExtents.z : -halfExtents.z);
+
+		case ShapeType::Capsule:
+			return Vector3D(0, vertex ? halfHeight : -halfHeight, 0);
+		}
+		return Vector3D();
+	}
+} }
\ No newline at end of file
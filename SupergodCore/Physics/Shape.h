@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "Math/Matrices/Matrix3x3.h"
+#include "Math/Quaternion.h"
+#include "BoundingBox.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// The kinds of collision shapes.
+	/// </summary>
+	enum class ShapeType
+	{
+		Sphere = 1,
+		Box,
+		Capsule
+	};
+
+	/// <summary>
+	/// The collision shape of a rigid body, centered on the body's position. Create shapes with Sphere, Box or Capsule.
+	/// </summary>
+	struct SUPERGOD_API_CLASS Shape final
+	{
+		ShapeType type;
+
+		/// <summary>
+		/// Half the size of a box along its local axes.
+		/// </summary>
+		Math::Vector3D halfExtents;
+
+		/// <summary>
+		/// The radius of a sphere or capsule.
+		/// </summary>
+		float radius;
+
+		/// <summary>
+		/// Half the distance between the centers of the two half spheres of a capsule. Capsules lie along their local y axis.
+		/// </summary>
+		float halfHeight;
+
+		/// <summary>
+		/// Creates a sphere.
+		/// </summary>
+		static constexpr Shape Sphere(float radius)
+		{
+			return Shape(ShapeType::Sphere, Math::Vector3D(), radius, 0);
+		}
+
+		/// <summary>
+		/// Creates a box that extends by halfExtents from its center to every side.
+		/// </summary>
+		static constexpr Shape Box(const Math::Vector3D& halfExtents)
+		{
+			return Shape(ShapeType::Box, halfExtents, 0, 0);
+		}
+
+		/// <summary>
+		/// Creates a capsule along the local y axis: every point within radius of the segment from (0, -halfHeight, 0) to (0, halfHeight, 0).
+		/// </summary>
+		static constexpr Shape Capsule(float radius, float halfHeight)
+		{
+			return Shape(ShapeType::Capsule, Math::Vector3D(), radius, halfHeight);
+		}
+
+		/// <summary>
+		/// Gets the volume of the shape.
+		/// </summary>
+		float Volume() const;
+
+		/// <summary>
+		/// Gets the inertia tensor of the shape with mass (spread evenly), in its local space around its center.
+		/// </summary>
+		Math::Matrix3x3 Inertia(float mass) const;
+
+		/// <summary>
+		/// Gets the bounding box of the shape when it is placed at position with orientation.
+		/// </summary>
+		BoundingBox Bounds(const Math::Vector3D& position, const Math::Quaternion& orientation) const;
+
+		/// <summary>
+		/// Gets the point of the core of the shape (a point for spheres, a segment for capsules and the whole box for boxes) that is the furthest along direction, in local space, and sets vertex to its index.<para/>
+		/// Every point of the shape is within radius of its core, so this and radius make the support mapping of the shape (see SupportMapping::OfPolytope).
+		/// </summary>
+		Math::Vector3D Support(const Math::Vector3D& direction, int& vertex) const;
+
+		/// <summary>
+		/// Gets the point of the core with the index Support gave.
+		/// </summary>
+		Math::Vector3D Vertex(int vertex) const;
+
+	private:
+		constexpr Shape(ShapeType type, const Math::Vector3D& halfExtents, float radius, float halfHeight)
+			: type(type), halfExtents(halfExtents), radius(radius), halfHeight(halfHeight)
+		{
+		}
+	};
+} }
\ No newline at end of file
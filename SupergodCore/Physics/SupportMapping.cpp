@@ -0,0 +1,40 @@
+#include "SupportMapping.h"
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	Vector3D ConvexHull::Support(const Vector3D& direction, int& vertex) const
+	{
+		size_t best = 0;
+		float bestDistance = points[0].Dot(direction);
+		for (size_t i = 1; i < count; i++)
+		{
+			float distance = points[i].Dot(direction);
+			if (distance > bestDistance)
+			{
+				bestDistance = distance;
+				best = i;
+			}
+		}
+		vertex = (int)best;
+		return points[best];
+	}
+
+	Vector2D ConvexHull2D::Support(const Vector2D& direction, int& vertex) const
+	{
+		size_t best = 0;
+		float bestDistance = points[0].Dot(direction);
+		for (size_t i = 1; i < count; i++)
+		{
+			float distance = points[i].Dot(direction);
+			if (distance > bestDistance)
+			{
+				bestDistance = distance;
+				best = i;
+			}
+		}
+		vertex = (int)best;
+		return points[best];
+	}
+} }
\ No newline at end of file
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector2D.h"
+#include "Math/Vectors/Vector3D.h"
+#include "RigidBody.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// A convex shape given by its support function, which gets the point of the shape that is the furthest along a direction.<para/>
+	/// The shape is every point within radius of its core (the shape of the support function), so a sphere is a point with a radius and a capsule is a segment with a radius.
+	/// Queries work on the cores and add the radii at the end, which converges much faster on round shapes than supporting the curved surface.
+	/// </summary>
+	struct SUPERGOD_API_CLASS SupportMapping final
+	{
+		/// <summary>
+		/// Gets the point of the core that is the furthest along direction. When the core is a polytope, vertex gets the index of the point, and otherwise -1.
+		/// </summary>
+		typedef Math::Vector3D(*SupportFunction)(const void* shape, const Math::Vector3D& direction, int& vertex);
+
+		/// <summary>
+		/// Gets the point of a polytope core by the index SupportFunction gave.
+		/// </summary>
+		typedef Math::Vector3D(*VertexFunction)(const void* shape, int vertex);
+
+		SupportFunction supportFunction;
+		VertexFunction vertexFunction;
+		const void* shape;
+		float radius;
+
+		/// <summary>
+		/// Gets the point of the core that is the furthest along direction (which doesn't have to be normalized), and its index if the core is a polytope (or -1).
+		/// </summary>
+		inline Math::Vector3D Support(const Math::Vector3D& direction, int& vertex) const
+		{
+			return supportFunction(shape, direction, vertex);
+		}
+
+		/// <summary>
+		/// Gets the point of a polytope core with the index Support gave.
+		/// </summary>
+		inline Math::Vector3D Vertex(int vertex) const
+		{
+			return vertexFunction(shape, vertex);
+		}
+
+		/// <summary>
+		/// Creates a support mapping of shape, which needs a Support(direction) method for its core and has to outlive the mapping.
+		/// </summary>
+		template<class TShape>
+		inline static SupportMapping Of(const TShape& shape, float radius = 0)
+		{
+			return SupportMapping{
+				[](const void* data, const Math::Vector3D& direction, int& vertex) { vertex = -1; return static_cast<const TShape*>(data)->Support(direction); },
+				nullptr, &shape, radius };
+		}
+
+		/// <summary>
+		/// Creates a support mapping of shape with a polytope core, which needs Support(direction, vertex) that also gets the index of the point, and Vertex(index). shape has to outlive the mapping.<para/>
+		/// GJK caches the vertices of polytopes, so a warm started query starts from the same simplex the last query ended with.
+		/// </summary>
+		template<class TShape>
+		inline static SupportMapping OfPolytope(const TShape& shape, float radius = 0)
+		{
+			return SupportMapping{
+				[](const void* data, const Math::Vector3D& direction, int& vertex) { return static_cast<const TShape*>(data)->Support(direction, vertex); },
+				[](const void* data, int vertex) { return static_cast<const TShape*>(data)->Vertex(vertex); },
+				&shape, radius };
+		}
+
+		/// <summary>
+		/// Creates a support mapping of body, with the radius of its shape. body has to outlive the mapping.
+		/// </summary>
+		inline static SupportMapping OfBody(const RigidBody& body)
+		{
+			return OfPolytope(body, body.shape.radius);
+		}
+	};
+
+	/// <summary>
+	/// A 2D convex shape given by its support function. See SupportMapping.
+	/// </summary>
+	struct SUPERGOD_API_CLASS SupportMapping2D final
+	{
+		/// <summary>
+		/// Gets the point of the core that is the furthest along direction. When the core is a polytope, vertex gets the index of the point, and otherwise -1.
+		/// </summary>
+		typedef Math::Vector2D(*SupportFunction)(const void* shape, const Math::Vector2D& direction, int& vertex);
+
+		/// <summary>
+		/// Gets the point of a polytope core by the index SupportFunction gave.
+		/// </summary>
+		typedef Math::Vector2D(*VertexFunction)(const void* shape, int vertex);
+
+		SupportFunction supportFunction;
+		VertexFunction vertexFunction;
+		const void* shape;
+		float radius;
+
+		/// <summary>
+		/// Gets the point of the core that is the furthest along direction (which doesn't have to be normalized), and its index if the core is a polytope (or -1).
+		/// </summary>
+		inline Math::Vector2D Support(const Math::Vector2D& direction, int& vertex) const
+		{
+			return supportFunction(shape, direction, vertex);
+		}
+
+		/// <summary>
+		/// Gets the point of a polytope core with the index Support gave.
+		/// </summary>
+		inline Math::Vector2D Vertex(int vertex) const
+		{
+			return vertexFunction(shape, vertex);
+		}
+
+		/// <summary>
+		/// Creates a support mapping of shape, which needs a Support(direction) method for its core and has to outlive the mapping.
+		/// </summary>
+		template<class TShape>
+		inline static SupportMapping2D Of(const TShape& shape, float radius = 0)
+		{
+			return SupportMapping2D{
+				[](const void* data, const Math::Vector2D& direction, int& vertex) { vertex = -1; return static_cast<const TShape*>(data)->Support(direction); },
+				nullptr, &shape, radius };
+		}
+
+		/// <summary>
+		/// Creates a support mapping of shape with a polytope core, which needs Support(direction, vertex) that also gets the index of the point, and Vertex(index). shape has to outlive the mapping.<para/>
+		/// GJK caches the vertices of polytopes, so a warm started query starts from the same simplex the last query ended with.
+		/// </summary>
+		template<class TShape>
+		inline static SupportMapping2D OfPolytope(const TShape& shape, float radius = 0)
+		{
+			return SupportMapping2D{
+				[](const void* data, const Math::Vector2D& direction, int& vertex) { return static_cast<const TShape*>(data)->Support(direction, vertex); },
+				[](const void* data, int vertex) { return static_cast<const TShape*>(data)->Vertex(vertex); },
+				&shape, radius };
+		}
+	};
+
+	/// <summary>
+	/// The convex hull of points, which it doesn't own. Support goes over all the points, so keep hulls small. Use it with SupportMapping::OfPolytope.
+	/// </summary>
+	struct SUPERGOD_API_CLASS ConvexHull final
+	{
+		const Math::Vector3D* points;
+		size_t count;
+
+		/// <summary>
+		/// Gets the point that is the furthest along direction, and sets vertex to its index.
+		/// </summary>
+		Math::Vector3D Support(const Math::Vector3D& direction, int& vertex) const;
+
+		/// <summary>
+		/// Gets points[vertex].
+		/// </summary>
+		inline Math::Vector3D Vertex(int vertex) const
+		{
+			return points[vertex];
+		}
+	};
+
+	/// <summary>
+	/// The convex hull of 2D points, which it doesn't own. See ConvexHull.
+	/// </summary>
+	struct SUPERGOD_API_CLASS ConvexHull2D final
+	{
+		const Math::Vector2D* points;
+		size_t count;
+
+		/// <summary>
+		/// Gets the point that is the furthest along direction, and sets vertex to its index.
+		/// </summary>
+		Math::Vector2D Support(const Math::Vector2D& direction, int& vertex) const;
+
+		/// <summary>
+		/// Gets points[vertex].
+		/// </summary>
+		inline Math::Vector2D Vertex(int vertex) const
+		{
+			return points[vertex];
+		}
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,315 @@
+#include "Sweep.h"
+#include "Gjk.h"
+#include "Common/Parallel.h"
+#include <algorithm>
+#include <limits>
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Physics
+{
+	using namespace Math;
+
+	/// <summary>
+	/// Conservative advancement gives up after this many steps and reports a hit where it stopped, which is always before the real one.
+	/// </summary>
+	static constexpr int MAX_ADVANCEMENT_STEPS = 32;
+
+	/// <summary>
+	/// The number of spheres every thread sweeps at a time.
+	/// </summary>
+	static constexpr size_t PARALLEL_CHUNK_SIZE = 64;
+
+	#pragma region Rays against round shapes.
+	/// <summary>
+	/// Finds when the ray origin + motion * t (t from 0 to 1) first gets within radius of center. Returns a negative value if it doesn't.
+	/// </summary>
+	static float RaySphere(const Vector3D& origin, const Vector3D& motion, const Vector3D& center, float radius)
+	{
+		Vector3D offset = origin - center;
+		float c = offset.Dot(offset) - radius * radius;
+		if (c <= 0)
+			return 0;
+
+		float b = offset.Dot(motion);
+		float a = motion.Dot(motion);
+		float discriminant = b * b - a * c;
+		if (b >= 0 || discriminant < 0)
+			return -1;
+
+		float t = (-b - SMath::Sqrt(discriminant)) / a;
+		return t <= 1 ? t : -1;
+	}
+
+	/// <summary>
+	/// Finds when the ray origin + motion * t (t from 0 to 1) first gets within radius of the segment from p to q, not counting its ends. Returns a negative value if it doesn't.
+	/// </summary>
+	static float RayCylinder(const Vector3D& origin, const Vector3D& motion, const Vector3D& p, const Vector3D& q, float radius)
+	{
+		// Solve in the plane perpendicular to the segment, where the cylinder is a circle.
+		Vector3D axis = q - p;
+		float axisLength = axis.Dot(axis);
+		Vector3D offset = origin - p;
+		Vector3D flatOffset = offset - axis * (offset.Dot(axis) / axisLength);
+		Vector3D flatMotion = motion - axis * (motion.Dot(axis) / axisLength);
+
+		float t = 0;
+		float c = flatOffset.Dot(flatOffset) - radius * radius;
+		if (c > 0)
+		{
+			float a = flatMotion.Dot(flatMotion);
+			float b = flatOffset.Dot(flatMotion);
+			float discriminant = b * b - a * c;
+			if (a <= 0 || b >= 0 || discriminant < 0)
+				return -1;
+
+			t = (-b - SMath::Sqrt(discriminant)) / a;
+			if (t > 1)
+				return -1;
+		}
+
+		float along = (offset + motion * t).Dot(axis);
+		return along >= 0 && along <= axisLength ? t : -1;
+	}
+
+	/// <summary>
+	/// Gets the closest point of the segment from p to q to point.
+	/// </summary>
+	static inline Vector3D ClosestOnSegment(const Vector3D& point, const Vector3D& p, const Vector3D& q)
+	{
+		Vector3D axis = q - p;
+		float t = SMath::Clamp((point - p).Dot(axis) / axis.Dot(axis), 0.f, 1.f);
+		return p + axis * t;
+	}
+	#pragma endregion
+
+	#pragma region Sweeps.
+	SweepHit Sweep::SphereTriangle(const Vector3D& center, float radius, const Vector3D& motion, const Vector3D& a, const Vector3D& b, const Vector3D& c)
+	{
+		Vector3D normal = (b - a).Cross(c - a);
+		float normalLength = normal.Magnitude();
+		if (normalLength <= 0)
+			return SweepHit::Miss();
+
+		// The triangle is two sided, so the normal faces the side the sphere starts at.
+		Vector3D winding = normal / normalLength;
+		float distance = (center - a).Dot(winding);
+		normal = distance < 0 ? -winding : winding;
+		distance = SMath::Abs(distance);
+
+		// The sphere first touches the face when it's radius away from the plane, if that point is inside the triangle.
+		float approach = motion.Dot(normal);
+		float faceTime = distance <= radius ? 0 : approach < 0 ? (radius - distance) / approach : 2;
+		if (faceTime <= 1)
+		{
+			Vector3D point = center + motion * faceTime - normal * (distance <= radius ? distance : radius);
+			if ((b - a).Cross(point - a).Dot(winding) >= 0 && (c - b).Cross(point - b).Dot(winding) >= 0 && (a - c).Cross(point - c).Dot(winding) >= 0)
+				return SweepHit{ true, faceTime, normal, point, 0 };
+		}
+
+		// Otherwise it first touches an edge or a corner, which are a capsule of radius around every edge for the center.
+		float time = 2;
+		const Vector3D* corners[3] = { &a, &b, &c };
+		for (int i = 0; i < 3; i++)
+		{
+			float edgeTime = RayCylinder(center, motion, *corners[i], *corners[(i + 1) % 3], radius);
+			if (edgeTime >= 0 && edgeTime < time)
+				time = edgeTime;
+
+			float cornerTime = RaySphere(center, motion, *corners[i], radius);
+			if (cornerTime >= 0 && cornerTime < time)
+				time = cornerTime;
+		}
+		if (time > 1)
+			return SweepHit::Miss();
+
+		// The closest point of the triangle's edges to the center at the time of the hit is where they touch.
+		Vector3D moved = center + motion * time;
+		Vector3D point = ClosestOnSegment(moved, a, b);
+		for (int i = 1; i < 3; i++)
+		{
+			Vector3D edgePoint = ClosestOnSegment(moved, *corners[i], *corners[(i + 1) % 3]);
+			if ((edgePoint - moved).SqrMagnitude() < (point - moved).SqrMagnitude())
+				point = edgePoint;
+		}
+
+		Vector3D offset = moved - point;
+		float offsetLength = offset.Magnitude();
+		return SweepHit{ true, time, offsetLength > 0 ? offset / offsetLength : normal, point, 0 };
+	}
+
+	SweepHit Sweep::Boxes(const BoundingBox& moving, const Vector3D& motion, const BoundingBox& target)
+	{
+		// The slabs of every axis give a time range where the boxes overlap on it, and the boxes touch when all of the ranges overlap.
+		float enter = 0, exit = 1;
+		int enterAxis = -1;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float speed = motion[axis];
+			if (speed == 0)
+			{
+				if (moving.max[axis] < target.min[axis] || moving.min[axis] > target.max[axis])
+					return SweepHit::Miss();
+				continue;
+			}
+
+			float axisEnter = ((speed > 0 ? target.min[axis] - moving.max[axis] : target.max[axis] - moving.min[axis])) / speed;
+			float axisExit = ((speed > 0 ? target.max[axis] - moving.min[axis] : target.min[axis] - moving.max[axis])) / speed;
+			if (axisEnter > enter)
+			{
+				enter = axisEnter;
+				enterAxis = axis;
+			}
+			exit = std::min(exit, axisExit);
+			if (enter > exit)
+				return SweepHit::Miss();
+		}
+
+		Vector3D normal;
+		if (enterAxis >= 0)
+			normal[enterAxis] = motion[enterAxis] > 0 ? -1.f : 1.f;
+
+		// The point is the center of the part of the moved box's side that touches target.
+		Vector3D offset = motion * enter;
+		Vector3D low(std::max(moving.min.x + offset.x, target.min.x), std::max(moving.min.y + offset.y, target.min.y), std::max(moving.min.z + offset.z, target.min.z));
+		Vector3D high(std::min(moving.max.x + offset.x, target.max.x), std::min(moving.max.y + offset.y, target.max.y), std::min(moving.max.z + offset.z, target.max.z));
+		return SweepHit{ true, enter, normal, (low + high) * .5f, 0 };
+	}
+
+	/// <summary>
+	/// Gets the distance of the farthest point of shape from its center.
+	/// </summary>
+	static float BoundingRadius(const Shape& shape)
+	{
+		switch (shape.type)
+		{
+		case ShapeType::Sphere:
+			return shape.radius;
+
+		case ShapeType::Box:
+			return shape.halfExtents.Magnitude();
+
+		case ShapeType::Capsule:
+			return shape.halfHeight + shape.radius;
+		}
+		return shape.radius;
+	}
+
+	/// <summary>
+	/// Gets body moved by its velocities for time. The rotation is exact, unlike Quaternion::Integrate, because time can be a whole step.
+	/// </summary>
+	static RigidBody Advance(const RigidBody& body, float time)
+	{
+		RigidBody moved = body;
+		moved.position = body.position + body.linearVelocity * time;
+		float angularSpeed = body.angularVelocity.Magnitude();
+		if (angularSpeed > 0)
+			moved.orientation = Quaternion::FromAxisAngle(body.angularVelocity / angularSpeed, angularSpeed * time).Multiply(body.orientation).Normalized();
+		return moved;
+	}
+
+	SweepHit Sweep::ConservativeAdvancement(const RigidBody& a, const RigidBody& b, float deltaTime, float tolerance)
+	{
+		// No point of a body moves along a direction faster than its center does plus its angular speed times its farthest point.
+		float spinA = a.angularVelocity.Magnitude() * BoundingRadius(a.shape);
+		float spinB = b.angularVelocity.Magnitude() * BoundingRadius(b.shape);
+
+		GjkCache cache;
+		RigidBody movedA = a, movedB = b;
+		float time = 0;
+		for (int step = 0; step < MAX_ADVANCEMENT_STEPS; step++)
+		{
+			GjkResult result = Gjk::Distance(SupportMapping::OfBody(movedA), SupportMapping::OfBody(movedB), &cache);
+			if (result.intersecting || result.distance <= tolerance)
+			{
+				Vector3D normal = result.intersecting ? Vector3D() : -result.normal;
+				return SweepHit{ true, deltaTime > 0 ? time / deltaTime : 0, normal, (result.pointA + result.pointB) * .5f, 0 };
+			}
+
+			// The fastest the gap along the normal can close.
+			float closingSpeed = (a.linearVelocity - b.linearVelocity).Dot(result.normal) + spinA + spinB;
+			if (closingSpeed <= 0)
+				return SweepHit::Miss();
+
+			time += (result.distance - tolerance * .5f) / closingSpeed;
+			if (time > deltaTime)
+				return SweepHit::Miss();
+
+			movedA = Advance(a, time);
+			movedB = Advance(b, time);
+		}
+
+		GjkResult result = Gjk::Distance(SupportMapping::OfBody(movedA), SupportMapping::OfBody(movedB), &cache);
+		return SweepHit{ true, time / deltaTime, -result.normal, (result.pointA + result.pointB) * .5f, 0 };
+	}
+	#pragma endregion
+
+	#pragma region Sweep mesh.
+	SweepMesh::SweepMesh(const Vector3D* vertices, const uint* indices, size_t triangleCount)
+	{
+		corners.resize(triangleCount * 3);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			corners[i] = vertices[indices[i]];
+
+		// Padding bounds are inverted, so nothing overlaps them.
+		size_t padded = (triangleCount + 3) / 4 * 4;
+		std::vector<float>* streams[6] = { &minX, &minY, &minZ, &maxX, &maxY, &maxZ };
+		for (int stream = 0; stream < 6; stream++)
+			streams[stream]->assign(padded, stream < 3 ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest());
+
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			const Vector3D* triangle = &corners[i * 3];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				(*streams[axis])[i] = std::min({ triangle[0][axis], triangle[1][axis], triangle[2][axis] });
+				(*streams[axis + 3])[i] = std::max({ triangle[0][axis], triangle[1][axis], triangle[2][axis] });
+			}
+		}
+	}
+
+	SweepHit SweepMesh::SweepSphere(const Vector3D& center, float radius, const Vector3D& motion) const
+	{
+		// The box the sphere sweeps through, which is all the triangles it can touch.
+		Vector3D end = center + motion;
+		__m128 lowX = _mm_set1_ps(std::min(center.x, end.x) - radius), highX = _mm_set1_ps(std::max(center.x, end.x) + radius);
+		__m128 lowY = _mm_set1_ps(std::min(center.y, end.y) - radius), highY = _mm_set1_ps(std::max(center.y, end.y) + radius);
+		__m128 lowZ = _mm_set1_ps(std::min(center.z, end.z) - radius), highZ = _mm_set1_ps(std::max(center.z, end.z) + radius);
+
+		SweepHit closest = SweepHit::Miss();
+		for (size_t i = 0; i < minX.size(); i += 4)
+		{
+			__m128 overlap = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minX[i]), highX), _mm_cmpge_ps(_mm_loadu_ps(&maxX[i]), lowX));
+			overlap = _mm_and_ps(overlap, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minY[i]), highY), _mm_cmpge_ps(_mm_loadu_ps(&maxY[i]), lowY)));
+			overlap = _mm_and_ps(overlap, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minZ[i]), highZ), _mm_cmpge_ps(_mm_loadu_ps(&maxZ[i]), lowZ)));
+			int mask = _mm_movemask_ps(overlap);
+			if (mask == 0)
+				continue;
+
+			for (int lane = 0; lane < 4; lane++)
+			{
+				if ((mask & (1 << lane)) == 0)
+					continue;
+
+				size_t triangle = i + lane;
+				const Vector3D* triangleCorners = &corners[triangle * 3];
+				SweepHit hit = Sweep::SphereTriangle(center, radius, motion, triangleCorners[0], triangleCorners[1], triangleCorners[2]);
+				if (hit.hit && (!closest.hit || hit.time < closest.time))
+				{
+					closest = hit;
+					closest.index = (uint)triangle;
+				}
+			}
+		}
+		return closest;
+	}
+
+	void SweepMesh::SweepSpheres(const Vector3D* centers, const float* radii, const Vector3D* motions, size_t count, SweepHit* hits, bool multithreaded) const
+	{
+		Parallel::For(count, multithreaded ? PARALLEL_CHUNK_SIZE : count, [=](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+				hits[i] = SweepSphere(centers[i], radii[i], motions[i]);
+		});
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "Math/Vectors/Vector3D.h"
+#include "BoundingBox.h"
+#include "RigidBody.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// Where a moving shape first touches another shape along its motion.
+	/// </summary>
+	struct SUPERGOD_API_CLASS SweepHit final
+	{
+		/// <summary>
+		/// Did the moving shape touch the other shape during its motion?
+		/// </summary>
+		bool hit;
+
+		/// <summary>
+		/// The fraction of the motion before the hit, from 0 to 1. Shapes that overlap from the start hit at 0.
+		/// </summary>
+		float time;
+
+		/// <summary>
+		/// The normal of the surface that was hit, pointing towards the moving shape. Boxes that overlap from the start have no normal (it's zero).
+		/// </summary>
+		Math::Vector3D normal;
+
+		/// <summary>
+		/// The point where the shapes touch at time.
+		/// </summary>
+		Math::Vector3D point;
+
+		/// <summary>
+		/// The index of the triangle that was hit in batched sweeps.
+		/// </summary>
+		uint index;
+
+		/// <summary>
+		/// Gets a result that didn't hit anything.
+		/// </summary>
+		inline static constexpr SweepHit Miss()
+		{
+			return SweepHit{ false, 1, Math::Vector3D(), Math::Vector3D(), 0 };
+		}
+	};
+
+	/// <summary>
+	/// Continuous collision tests, which find the first time a moving shape touches another one instead of only checking where it ends up, so fast shapes can't pass through thin ones.
+	/// </summary>
+	namespace Sweep
+	{
+		/// <summary>
+		/// Moves a sphere by motion and finds where it first touches the triangle abc (from either side).
+		/// </summary>
+		SUPERGOD_API_FUNC SweepHit SphereTriangle(const Math::Vector3D& center, float radius, const Math::Vector3D& motion, const Math::Vector3D& a, const Math::Vector3D& b, const Math::Vector3D& c);
+
+		/// <summary>
+		/// Moves the box moving by motion and finds where it first touches target. To sweep two moving boxes, pass the motion of moving minus the motion of target.
+		/// </summary>
+		SUPERGOD_API_FUNC SweepHit Boxes(const BoundingBox& moving, const Math::Vector3D& motion, const BoundingBox& target);
+
+		/// <summary>
+		/// Moves a and b by their linear and angular velocities for deltaTime and finds when they first come within tolerance of each other, with conservative advancement:
+		/// every step measures their distance with GJK and advances by the time it surely takes them to close it, so they never pass through each other.<para/>
+		/// The normal points from b to a, and time is a fraction of deltaTime.
+		/// </summary>
+		SUPERGOD_API_FUNC SweepHit ConservativeAdvancement(const RigidBody& a, const RigidBody& b, float deltaTime, float tolerance = .001f);
+	}
+
+	/// <summary>
+	/// A triangle mesh that many spheres (like projectiles) can be swept against at once.<para/>
+	/// The bounds of the triangles are kept in streams, so every sphere rejects four triangles at a time with SSE before the exact test, and spheres are split between the threads of Parallel.
+	/// </summary>
+	class SweepMesh final
+	{
+	public:
+		/// <summary>
+		/// Creates a mesh from triangleCount triangles, where triangle i has the vertices indices[i * 3], indices[i * 3 + 1] and indices[i * 3 + 2]. The vertices are copied.
+		/// </summary>
+		SUPERGOD_API_FUNC SweepMesh(const Math::Vector3D* vertices, const uint* indices, size_t triangleCount);
+
+		/// <summary>
+		/// Gets the number of triangles.
+		/// </summary>
+		inline size_t TriangleCount() const { return corners.size() / 3; }
+
+		/// <summary>
+		/// Moves every sphere i (at centers[i] with radii[i]) by motions[i], and finds the first triangle it touches into hits[i].
+		/// </summary>
+		SUPERGOD_API_FUNC void SweepSpheres(const Math::Vector3D* centers, const float* radii, const Math::Vector3D* motions, size_t count, SweepHit* hits, bool multithreaded = true) const;
+
+	private:
+		/// <summary>
+		/// Finds the first triangle the sphere touches.
+		/// </summary>
+		SweepHit SweepSphere(const Math::Vector3D& center, float radius, const Math::Vector3D& motion) const;
+
+		std::vector<Math::Vector3D> corners;
+
+		/// <summary>
+		/// The bounds of the triangles, padded with empty bounds to a multiple of 4.
+		/// </summary>
+		std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+	};
+} }
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "SweepAndPrune.h"
+#include <algorithm>
+#include <immintrin.h>
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// The automatic axis only changes when another axis is this many times more spread, so it doesn't flip back and forth (every change sorts from scratch).
+	/// </summary>
+	static constexpr double AXIS_SWITCH_RATIO = 2;
+
+	/// <summary>
+	/// Insertion sort is quadratic on shuffled boxes (after objects teleport or many are added), so a full sort is used when more than 1 in this many boxes is out of order.
+	/// </summary>
+	static constexpr size_t INSERTION_SORT_MAX_DESCENTS = 8;
+
+	/// <summary>
+	/// Orders pairs by OverlapPair::Key.
+	/// </summary>
+	static inline bool ByKey(const OverlapPair& a, const OverlapPair& b)
+	{
+		return a.Key() < b.Key();
+	}
+
+	#pragma region Sweep and prune.
+	SweepAndPrune::SweepAndPrune(SweepAxis axis)
+		: axis(axis), sweepAxis(-1)
+	{
+	}
+
+	int SweepAndPrune::ChooseAxis(const BoundingBox* boxes, size_t count) const
+	{
+		if (axis != SweepAxis::Automatic)
+			return (int)axis - 1;
+
+		if (count == 0)
+			return sweepAxis < 0 ? 0 : sweepAxis;
+
+		// The variance of the centers (times count, and with the centers doubled) on every axis.
+		double sums[3] = {};
+		double squares[3] = {};
+		for (size_t i = 0; i < count; i++)
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				double center = (double)boxes[i].min[k] + boxes[i].max[k];
+				sums[k] += center;
+				squares[k] += center * center;
+			}
+		}
+
+		double variances[3];
+		for (int k = 0; k < 3; k++)
+			variances[k] = squares[k] - sums[k] * sums[k] / count;
+
+		int best = variances[1] > variances[0] ? 1 : 0;
+		if (variances[2] > variances[best])
+			best = 2;
+		return sweepAxis < 0 || variances[best] > variances[sweepAxis] * AXIS_SWITCH_RATIO ? best : sweepAxis;
+	}
+
+	void SweepAndPrune::Update(const BoundingBox* boxes, size_t count)
+	{
+		int newAxis = ChooseAxis(boxes, count);
+		bool axisChanged = newAxis != sweepAxis;
+		sweepAxis = newAxis;
+		int axis1 = (sweepAxis + 1) % 3;
+		int axis2 = (sweepAxis + 2) % 3;
+
+		// Objects removed from the end leave the order, and new objects join at the end and get sorted into place.
+		entries.erase(std::remove_if(entries.begin(), entries.end(), [count](const SweepEntry& entry) { return entry.index >= count; }), entries.end());
+		for (size_t i = entries.size(); i < count; i++)
+			entries.push_back(SweepEntry{ {}, 0, 0, (uint)i });
+
+		size_t descents = 0;
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			SweepEntry& entry = entries[i];
+			const BoundingBox& box = boxes[entry.index];
+			entry.min = box.min[sweepAxis];
+			entry.max = box.max[sweepAxis];
+			entry.secondary[0] = box.max[axis1];
+			entry.secondary[1] = box.max[axis2];
+			entry.secondary[2] = -box.min[axis1];
+			entry.secondary[3] = -box.min[axis2];
+			descents += i > 0 && entry.min < entries[i - 1].min;
+		}
+
+		if (axisChanged || descents * INSERTION_SORT_MAX_DESCENTS > entries.size())
+		{
+			std::sort(entries.begin(), entries.end(), [](const SweepEntry& a, const SweepEntry& b) { return a.min < b.min; });
+		}
+		else if (descents > 0)
+		{
+			for (size_t i = 1; i < entries.size(); i++)
+			{
+				SweepEntry entry = entries[i];
+				size_t j = i;
+				for (; j > 0 && entry.min < entries[j - 1].min; j--)
+					entries[j] = entries[j - 1];
+				entries[j] = entry;
+			}
+		}
+
+		pairs.clear();
+		const __m128 signs = _mm_set1_ps(-0.f);
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			const SweepEntry& entry = entries[i];
+
+			// The minimums of the other axes followed by their negated maximums, so entry overlaps other on both axes when every lane is at most other.secondary.
+			__m128 negated = _mm_xor_ps(_mm_loadu_ps(entry.secondary), signs);
+			__m128 query = _mm_shuffle_ps(negated, negated, _MM_SHUFFLE(1, 0, 3, 2));
+
+			for (size_t j = i + 1; j < entries.size() && entries[j].min <= entry.max; j++)
+			{
+				if (_mm_movemask_ps(_mm_cmple_ps(query, _mm_loadu_ps(entries[j].secondary))) == 0xf)
+				{
+					uint a = entry.index;
+					uint b = entries[j].index;
+					pairs.push_back(a < b ? OverlapPair{ a, b } : OverlapPair{ b, a });
+				}
+			}
+		}
+
+		// The sweep order depends on the order of previous updates, so the pairs are sorted to make the result depend only on the boxes.
+		std::sort(pairs.begin(), pairs.end(), ByKey);
+	}
+	#pragma endregion
+
+	#pragma region Multi box pruning.
+	MultiBoxPruning::MultiBoxPruning(const BoundingBox& worldBounds, uint regionsX, uint regionsZ)
+		: worldBounds(worldBounds), regionsX(regionsX > 0 ? regionsX : 1), regionsZ(regionsZ > 0 ? regionsZ : 1)
+	{
+		regions.resize((size_t)this->regionsX * this->regionsZ);
+	}
+
+	uint MultiBoxPruning::Cell(float value, int axis, uint cells) const
+	{
+		float relative = (value - worldBounds.min[axis]) / (worldBounds.max[axis] - worldBounds.min[axis]) * cells;
+		return relative <= 0 ? 0 : relative >= cells ? cells - 1 : (uint)relative;
+	}
+
+	void MultiBoxPruning::Update(const BoundingBox* boxes, size_t count)
+	{
+		for (Region& region : regions)
+		{
+			region.boxes.clear();
+			region.objects.clear();
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const BoundingBox& box = boxes[i];
+			uint maxX = Cell(box.max.x, 0, regionsX);
+			uint maxZ = Cell(box.max.z, 2, regionsZ);
+			for (uint z = Cell(box.min.z, 2, regionsZ); z <= maxZ; z++)
+			{
+				for (uint x = Cell(box.min.x, 0, regionsX); x <= maxX; x++)
+				{
+					Region& region = regions[(size_t)z * regionsX + x];
+					region.boxes.push_back(box);
+					region.objects.push_back((uint)i);
+				}
+			}
+		}
+
+		pairs.clear();
+		for (size_t r = 0; r < regions.size(); r++)
+		{
+			Region& region = regions[r];
+			region.sweep.Update(region.boxes.data(), region.boxes.size());
+			for (const OverlapPair& pair : region.sweep.GetPairs())
+			{
+				// Objects were added to the regions in order, so the objects of a pair stay in order.
+				uint a = region.objects[pair.a];
+				uint b = region.objects[pair.b];
+
+				// A pair that shares several regions is found in all of them, and is only kept by the region where the two boxes start overlapping.
+				float x = std::max(boxes[a].min.x, boxes[b].min.x);
+				float z = std::max(boxes[a].min.z, boxes[b].min.z);
+				if ((size_t)Cell(z, 2, regionsZ) * regionsX + Cell(x, 0, regionsX) == r)
+					pairs.push_back(OverlapPair{ a, b });
+			}
+		}
+
+		std::sort(pairs.begin(), pairs.end(), ByKey);
+	}
+	#pragma endregion
+} }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <vector>
+#include "Common/CommonDefines.h"
+#include "BoundingBox.h"
+#include "Broadphase.h"
+
+namespace SupergodCore { namespace Physics
+{
+	/// <summary>
+	/// The axis a sweep and prune sorts and sweeps the boxes along.
+	/// </summary>
+	enum class SweepAxis
+	{
+		X = 1,
+		Y,
+		Z,
+
+		/// <summary>
+		/// The axis the box centers are spread the most along, checked on every update.
+		/// </summary>
+		Automatic,
+	};
+
+	/// <summary>
+	/// A sweep and prune broadphase that keeps its boxes sorted between updates.<para/>
+	/// Objects barely move from one update to the next, so the boxes stay almost sorted and an insertion sort puts them back in order in about linear time.
+	/// The two axes that aren't swept are tested together with one SSE comparison, and the pairs go to a buffer that is reused, so updates don't allocate once the buffers are big enough.
+	/// </summary>
+	class SweepAndPrune final
+	{
+	public:
+		/// <summary>
+		/// The axis to sweep along. Changing it sorts everything from scratch on the next update.
+		/// </summary>
+		SweepAxis axis;
+
+		/// <summary>
+		/// Creates a sweep and prune without boxes.
+		/// </summary>
+		SUPERGOD_API_FUNC SweepAndPrune(SweepAxis axis = SweepAxis::Automatic);
+
+		/// <summary>
+		/// Updates the boxes and finds every pair that overlaps (touching counts).<para/>
+		/// boxes[i] is the box of object i. Objects should keep their index between updates to benefit from the previous order, and may be added or removed at the end.
+		/// </summary>
+		SUPERGOD_API_FUNC void Update(const BoundingBox* boxes, size_t count);
+
+		/// <summary>
+		/// Gets the overlapping pairs found by the last update, sorted by OverlapPair::Key.
+		/// </summary>
+		inline const std::vector<OverlapPair>& GetPairs() const { return pairs; }
+
+		/// <summary>
+		/// Gets the axis the last update swept along (0 for x, 1 for y and 2 for z), or -1 before the first update.
+		/// </summary>
+		inline int GetSweepAxis() const { return sweepAxis; }
+
+	private:
+		/// <summary>
+		/// A box in the sweep order. secondary holds the maximums of the other two axes followed by their negated minimums.
+		/// </summary>
+		struct SweepEntry
+		{
+			float secondary[4];
+			float min;
+			float max;
+			uint index;
+		};
+
+		/// <summary>
+		/// Picks the axis to sweep along in this update.
+		/// </summary>
+		int ChooseAxis(const BoundingBox* boxes, size_t count) const;
+
+		std::vector<SweepEntry> entries;
+		std::vector<OverlapPair> pairs;
+		int sweepAxis;
+	};
+
+	/// <summary>
+	/// A broadphase for big worlds that splits the world bounds into a grid of regions on the x and z axes, each with its own SweepAndPrune.<para/>
+	/// Boxes are only swept against the boxes of the regions they touch, so objects that are far apart never share a sweep. Boxes outside the world bounds go to the regions on its edges.
+	/// </summary>
+	class MultiBoxPruning final
+	{
+	public:
+		/// <summary>
+		/// Creates a broadphase that splits worldBounds into regionsX by regionsZ regions.
+		/// </summary>
+		SUPERGOD_API_FUNC MultiBoxPruning(const BoundingBox& worldBounds, uint regionsX, uint regionsZ);
+
+		/// <summary>
+		/// Updates the boxes and finds every pair that overlaps (touching counts). See SweepAndPrune::Update.
+		/// </summary>
+		SUPERGOD_API_FUNC void Update(const BoundingBox* boxes, size_t count);
+
+		/// <summary>
+		/// Gets the overlapping pairs found by the last update, sorted by OverlapPair::Key. Pairs that share several regions appear once.
+		/// </summary>
+		inline const std::vector<OverlapPair>& GetPairs() const { return pairs; }
+
+		/// <summary>
+		/// Gets the number of regions.
+		/// </summary>
+		inline size_t RegionCount() const { return regions.size(); }
+
+	private:
+		/// <summary>
+		/// The boxes that touch a region, and the objects they belong to.
+		/// </summary>
+		struct Region
+		{
+			SweepAndPrune sweep;
+			std::vector<BoundingBox> boxes;
+			std::vector<uint> objects;
+		};
+
+		/// <summary>
+		/// Gets the grid cell of value on axis, where the world bounds are split into cells.
+		/// </summary>
+		uint Cell(float value, int axis, uint cells) const;
+
+		BoundingBox worldBounds;
+		uint regionsX;
+		uint regionsZ;
+		std::vector<Region> regions;
+		std::vector<OverlapPair> pairs;
+	};
+} }
\ No newline at end of file
@@ -1,7 +1,14 @@
 #pragma once
 
 #include "Common/CommonDefines.h"
+#include "Common/CpuFeatures.h"
+#include "Common/Parallel.h"
+#include "Common/Checksum.h"
 #include "Math/Math.h"
+#include "Physics/Physics.h"
+#include "Geometry/Geometry.h"
+#include "Assets/Assets.h"
+#include "Network/Network.h"
 
 #undef DEFINE_STRUCT_VALUE_PRESET
 #undef TEMPLATED_INTERFACE_THIS_CUSTOM_NAME
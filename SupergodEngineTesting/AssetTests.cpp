@@ -0,0 +1,150 @@
+#include "TestUtils.h"
+#include <cstdio>
+#include <fstream>
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Assets;
+
+	TEST_CLASS(AssetTests)
+	{
+	private:
+		static constexpr const char* PATH = "AssetTests.sgaf";
+		static constexpr uint POSITIONS = ChunkId("POSI");
+		static constexpr uint TRANSFORMS = ChunkId("XFRM");
+		static constexpr uint NAME = ChunkId("NAME");
+
+		/// <summary>
+		/// Writes a file with random positions (streamed in parts), transforms and a name of an odd number of bytes between them, so the transforms need padding.
+		/// </summary>
+		static void WriteTestFile(std::vector<Vector3D>& positions, std::vector<Matrix3x3>& transforms)
+		{
+			positions.clear();
+			transforms.clear();
+			for (int i = 0; i < 1001; i++)
+				positions.push_back(Vector3D(RandFloat(-100, 100), RandFloat(-100, 100), RandFloat(-100, 100)));
+			for (int i = 0; i < 37; i++)
+				transforms.push_back(Matrix3x3(RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1)));
+
+			AssetWriter writer;
+			Assert::IsTrue(writer.Open(PATH));
+			Assert::IsTrue(writer.BeginChunk<Vector3D>(POSITIONS));
+			for (size_t i = 0; i < positions.size(); i += 100)
+				Assert::IsTrue(writer.Write(positions.data() + i, std::min<size_t>(100, positions.size() - i)));
+			Assert::IsTrue(writer.EndChunk());
+
+			const byte name[] = { 'r', 'o', 'c', 'k', '!' };
+			Assert::IsTrue(writer.WriteChunk(NAME, name, sizeof(name)));
+			Assert::IsTrue(writer.WriteChunk(TRANSFORMS, transforms.data(), transforms.size()));
+			Assert::IsTrue(writer.Close());
+		}
+
+		/// <summary>
+		/// Overwrites the byte at offset of the test file.
+		/// </summary>
+		static void Corrupt(long long offset, char value)
+		{
+			std::fstream file(PATH, std::ios::binary | std::ios::in | std::ios::out);
+			file.seekp(offset);
+			file.put(value);
+		}
+
+	public:
+		TEST_METHOD(Crc32CTest)
+		{
+			const char* check = "123456789";
+			Assert::AreEqual(Checksum::Crc32C(check, 9), 0xe3069283u);
+			Assert::AreEqual(Checksum::Crc32C(check + 4, 5, Checksum::Crc32C(check, 4)), 0xe3069283u);
+			Assert::AreEqual(Checksum::Crc32C(check, 0), 0u);
+		}
+
+		TEST_METHOD(RoundTripTest)
+		{
+			std::vector<Vector3D> positions;
+			std::vector<Matrix3x3> transforms;
+			WriteTestFile(positions, transforms);
+
+			AssetFile file;
+			Assert::IsTrue(file.Open(PATH));
+			Assert::AreEqual(file.ChunkCount(), 3u);
+			Assert::IsTrue(file.Verify());
+
+			ArrayView<Vector3D> positionsView = file.View<Vector3D>(POSITIONS);
+			ArrayView<Matrix3x3> transformsView = file.View<Matrix3x3>(TRANSFORMS);
+			Assert::AreEqual(positionsView.count, positions.size());
+			Assert::AreEqual(transformsView.count, transforms.size());
+			Assert::IsTrue(memcmp(positionsView.data, positions.data(), positions.size() * sizeof(Vector3D)) == 0);
+			Assert::IsTrue(memcmp(transformsView.data, transforms.data(), transforms.size() * sizeof(Matrix3x3)) == 0);
+			Assert::IsTrue((size_t)positionsView.data % AssetFormat::ALIGNMENT == 0 && (size_t)transformsView.data % AssetFormat::ALIGNMENT == 0);
+			ArrayView<byte> name = file.View<byte>(NAME);
+			Assert::IsTrue(std::string(name.begin(), name.end()) == "rock!");
+
+			// Views of the wrong type, or of chunks that aren't there, are empty.
+			Assert::IsTrue(file.View<Vector4D>(POSITIONS).IsEmpty());
+			Assert::IsTrue(file.View<Vector3D>(ChunkId("NONE")).IsEmpty());
+
+			file.Close();
+			Assert::IsFalse(file.IsOpen());
+			std::remove(PATH);
+		}
+
+		TEST_METHOD(CorruptionTest)
+		{
+			std::vector<Vector3D> positions;
+			std::vector<Matrix3x3> transforms;
+			WriteTestFile(positions, transforms);
+			AssetFile file;
+			Assert::IsTrue(file.Open(PATH));
+			const FileHeader header = file.Header();
+			const ChunkEntry transformsChunk = *file.FindChunk(TRANSFORMS);
+			file.Close();
+
+			// Broken data still opens, since opening doesn't read it, but doesn't verify.
+			Corrupt(transformsChunk.offset + 5, 42);
+			Assert::IsTrue(file.Open(PATH));
+			Assert::IsTrue(file.VerifyChunk(*file.FindChunk(POSITIONS)));
+			Assert::IsFalse(file.VerifyChunk(*file.FindChunk(TRANSFORMS)));
+			Assert::IsFalse(file.Verify());
+			file.Close();
+
+			// A broken table or header doesn't open at all.
+			Corrupt(header.tableOffset + 8, 42);
+			Assert::IsFalse(file.Open(PATH));
+			Assert::IsFalse(file.IsOpen());
+
+			WriteTestFile(positions, transforms);
+			Corrupt(4, 2);
+			Assert::IsFalse(file.Open(PATH));
+
+			// Neither do truncated files, or files that aren't there.
+			WriteTestFile(positions, transforms);
+			{
+				std::ofstream truncated(PATH, std::ios::binary | std::ios::trunc);
+				truncated.write("SGAF", 4);
+			}
+			Assert::IsFalse(file.Open(PATH));
+			std::remove(PATH);
+			Assert::IsFalse(file.Open(PATH));
+		}
+
+		TEST_METHOD(WriterMisuseTest)
+		{
+			Vector3D positions[] = { Vector3D(1, 2, 3) };
+			AssetWriter writer;
+			Assert::IsFalse(writer.BeginChunk<Vector3D>(POSITIONS));
+
+			// Writing outside of a chunk, or elements of another type, fails the whole file.
+			Assert::IsTrue(writer.Open(PATH));
+			Assert::IsFalse(writer.Write(positions, 1));
+			Assert::IsFalse(writer.WriteChunk(POSITIONS, positions, 1));
+			Assert::IsFalse(writer.Close());
+
+			Assert::IsTrue(writer.Open(PATH));
+			Assert::IsTrue(writer.BeginChunk<Vector4D>(POSITIONS));
+			Assert::IsFalse(writer.Write(positions, 1));
+			Assert::IsFalse(writer.Close());
+			std::remove(PATH);
+		}
+	};
+}
\ No newline at end of file
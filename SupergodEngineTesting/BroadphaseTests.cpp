@@ -0,0 +1,135 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Physics;
+
+	/// <summary>
+	/// Finds the overlapping pairs by testing every pair of boxes.
+	/// </summary>
+	static std::vector<OverlapPair> BruteForceOverlaps(const std::vector<BoundingBox>& boxes)
+	{
+		std::vector<OverlapPair> pairs;
+		for (uint a = 0; a < boxes.size(); a++)
+		{
+			for (uint b = a + 1; b < boxes.size(); b++)
+			{
+				if (boxes[a].Overlaps(boxes[b]))
+					pairs.push_back(OverlapPair{ a, b });
+			}
+		}
+		return pairs;
+	}
+
+	static void AssertSamePairs(const std::vector<OverlapPair>& expected, const std::vector<OverlapPair>& actual)
+	{
+		Assert::AreEqual(expected.size(), actual.size());
+		for (size_t i = 0; i < expected.size(); i++)
+			Assert::AreEqual(expected[i].Key(), actual[i].Key());
+	}
+
+	static BoundingBox RandomBox(float worldSize)
+	{
+		Vector3D center(RandFloat(-worldSize, worldSize), RandFloat(-worldSize / 4, worldSize / 4), RandFloat(-worldSize, worldSize));
+		return BoundingBox::FromCenter(center, Vector3D(RandFloat(.1f, 2), RandFloat(.1f, 2), RandFloat(.1f, 2)));
+	}
+
+	TEST_CLASS(BroadphaseTests)
+	{
+	public:
+		TEST_METHOD(FindOverlapsTest)
+		{
+			std::vector<BoundingBox> boxes;
+			for (int i = 0; i < 300; i++)
+				boxes.push_back(RandomBox(20));
+
+			std::vector<OverlapPair> pairs;
+			std::vector<uint> order;
+			Broadphase::FindOverlaps(boxes.data(), boxes.size(), pairs, order);
+			AssertSamePairs(BruteForceOverlaps(boxes), pairs);
+
+			// Touching boxes overlap.
+			BoundingBox touching[] = { BoundingBox(Vector3D(0, 0, 0), Vector3D(1, 1, 1)), BoundingBox(Vector3D(1, 0, 0), Vector3D(2, 1, 1)) };
+			Broadphase::FindOverlaps(touching, 2, pairs, order);
+			Assert::AreEqual((size_t)1, pairs.size());
+		}
+
+		TEST_METHOD(SweepAndPruneTest)
+		{
+			std::vector<BoundingBox> boxes;
+			for (int i = 0; i < 300; i++)
+				boxes.push_back(RandomBox(20));
+
+			SweepAndPrune sweep;
+			std::vector<Vector3D> velocities(boxes.size());
+			for (int frame = 0; frame < 30; frame++)
+			{
+				sweep.Update(boxes.data(), boxes.size());
+				AssertSamePairs(BruteForceOverlaps(boxes), sweep.GetPairs());
+
+				// Move the boxes a little, teleport one of them, and add and remove objects at the end.
+				for (size_t i = 0; i < boxes.size(); i++)
+				{
+					velocities[i] += Vector3D(RandFloat(-.1f, .1f), RandFloat(-.1f, .1f), RandFloat(-.1f, .1f));
+					boxes[i].min += velocities[i];
+					boxes[i].max += velocities[i];
+				}
+				boxes[frame * 7 % boxes.size()] = RandomBox(20);
+				if (frame % 3 == 0)
+				{
+					boxes.push_back(RandomBox(20));
+					velocities.push_back(Vector3D::Zero());
+				}
+				else if (frame % 5 == 0)
+				{
+					boxes.pop_back();
+					velocities.pop_back();
+				}
+			}
+
+			// Boxes spread along y only should make the automatic axis switch to y.
+			for (size_t i = 0; i < boxes.size(); i++)
+				boxes[i] = BoundingBox::FromCenter(Vector3D(RandFloat(-1, 1), i * 1.5f, RandFloat(-1, 1)), Vector3D(1, 1, 1));
+			sweep.Update(boxes.data(), boxes.size());
+			Assert::AreEqual(1, sweep.GetSweepAxis());
+			AssertSamePairs(BruteForceOverlaps(boxes), sweep.GetPairs());
+
+			SweepAndPrune fixedAxis(SweepAxis::Z);
+			fixedAxis.Update(boxes.data(), boxes.size());
+			Assert::AreEqual(2, fixedAxis.GetSweepAxis());
+			AssertSamePairs(sweep.GetPairs(), fixedAxis.GetPairs());
+
+			sweep.Update(boxes.data(), 0);
+			Assert::AreEqual((size_t)0, sweep.GetPairs().size());
+		}
+
+		TEST_METHOD(MultiBoxPruningTest)
+		{
+			std::vector<BoundingBox> boxes;
+			for (int i = 0; i < 400; i++)
+				boxes.push_back(RandomBox(25));
+
+			// The world bounds are smaller than the boxes' spread, so some boxes are outside of them.
+			MultiBoxPruning pruning(BoundingBox(Vector3D(-20, -20, -20), Vector3D(20, 20, 20)), 4, 3);
+			Assert::AreEqual((size_t)12, pruning.RegionCount());
+			for (int frame = 0; frame < 10; frame++)
+			{
+				pruning.Update(boxes.data(), boxes.size());
+				AssertSamePairs(BruteForceOverlaps(boxes), pruning.GetPairs());
+
+				for (BoundingBox& box : boxes)
+				{
+					Vector3D offset(RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1));
+					box.min += offset;
+					box.max += offset;
+				}
+			}
+
+			// A box covering every region shares all of them with a small box, and the pair is still found once.
+			BoundingBox spanning[] = { BoundingBox(Vector3D(-30, -1, -30), Vector3D(30, 1, 30)), BoundingBox(Vector3D(5, 0, 5), Vector3D(6, 1, 6)) };
+			pruning.Update(spanning, 2);
+			Assert::AreEqual((size_t)1, pruning.GetPairs().size());
+		}
+	};
+}
\ No newline at end of file
@@ -57,6 +57,252 @@ namespace SupergodEngineTesting
 			});
 		}
 
+		TEST_METHOD(ConversionTest)
+		{
+			AssertUtils::AreEqual((BColor)FColor::Gray(), BColor::Gray());
+			AssertUtils::AreEqual((BColor)FColor(2, -1, .5f, 1), BColor(255, 0, 128, 255));
+			AssertUtils::AreEqual((FColor)BColor::White(), FColor::White());
+
+			// Every byte survives a round trip.
+			for (int i = 0; i < 256; i++)
+			{
+				BColor color((byte)i, (byte)(255 - i), (byte)(i / 2), (byte)i);
+				AssertUtils::AreEqual((BColor)(FColor)color, color);
+			}
+
+			const size_t count = 37;
+			FColor floats[count];
+			for (size_t i = 0; i < count; i++)
+				floats[i] = FColor(RandFloat(-.5f, 1.5f), RandFloat(-.5f, 1.5f), RandFloat(-.5f, 1.5f), RandFloat(-.5f, 1.5f));
+
+			BColor bytes[count];
+			FColor unpacked[count];
+			ColorBuffers::ToBColors(floats, bytes, count);
+			ColorBuffers::ToFColors(bytes, unpacked, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(bytes[i], (BColor)floats[i]);
+				AssertUtils::AreEqual(unpacked[i], (FColor)bytes[i]);
+			}
+		}
+
+		TEST_METHOD(PremultiplyTest)
+		{
+			AssertUtils::AreEqual(BColor(255, 128, 0, 128).Premultiplied(), BColor(128, 64, 0, 128));
+			AssertUtils::AreEqual(BColor(128, 64, 0, 128).Unpremultiplied(), BColor(255, 128, 0, 128));
+			AssertUtils::AreEqual(BColor(10, 20, 30, 0).Unpremultiplied(), BColor::Clear());
+			AssertUtils::AreEqual(BColor(200, 100, 50, 255).Premultiplied(), BColor(200, 100, 50, 255));
+			AssertUtils::AreEqual(FColor(1, .5f, 0, .5f).Premultiplied(), FColor(.5f, .25f, 0, .5f));
+			AssertUtils::AreEqual(FColor(.5f, .25f, 0, .5f).Unpremultiplied(), FColor(1, .5f, 0, .5f));
+
+			// The premultiplied bytes are the exactly rounded products.
+			for (int color = 0; color < 256; color++)
+				for (int alpha = 0; alpha < 256; alpha++)
+					Assert::AreEqual(BColor::MultiplyNormalized((byte)color, (byte)alpha), NormalizedInt::PackUnorm8(color * alpha / (255.f * 255)));
+
+			const size_t count = 23;
+			BColor bytes[count], premultipliedBytes[count], unpremultipliedBytes[count];
+			FColor floats[count], premultipliedFloats[count], unpremultipliedFloats[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				bytes[i] = BColor((byte)std::rand(), (byte)std::rand(), (byte)std::rand(), i % 5 == 0 ? 0 : (byte)std::rand());
+				premultipliedBytes[i] = unpremultipliedBytes[i] = bytes[i];
+				floats[i] = FColor(RandFloat(), RandFloat(), RandFloat(), i % 5 == 0 ? 0 : RandFloat());
+				premultipliedFloats[i] = unpremultipliedFloats[i] = floats[i];
+			}
+
+			ColorBuffers::Premultiply(premultipliedBytes, count);
+			ColorBuffers::Unpremultiply(unpremultipliedBytes, count);
+			ColorBuffers::Premultiply(premultipliedFloats, count);
+			ColorBuffers::Unpremultiply(unpremultipliedFloats, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(premultipliedBytes[i], bytes[i].Premultiplied());
+				AssertUtils::AreEqual(unpremultipliedBytes[i], bytes[i].Unpremultiplied());
+				AssertUtils::AreEqual(premultipliedFloats[i], floats[i].Premultiplied());
+				AssertUtils::AreEqual(unpremultipliedFloats[i], floats[i].Unpremultiplied());
+			}
+		}
+
+		TEST_METHOD(SwapRedBlueTest)
+		{
+			AssertUtils::AreEqual(BColor(1, 2, 3, 4).SwappedRedBlue(), BColor(3, 2, 1, 4));
+
+			const size_t count = 11;
+			BColor colors[count], swapped[count];
+			for (size_t i = 0; i < count; i++)
+				colors[i] = BColor((byte)std::rand(), (byte)std::rand(), (byte)std::rand(), (byte)std::rand());
+
+			ColorBuffers::SwapRedBlue(colors, swapped, count);
+			for (size_t i = 0; i < count; i++)
+				AssertUtils::AreEqual(swapped[i], colors[i].SwappedRedBlue());
+
+			ColorBuffers::SwapRedBlue(swapped, count);
+			for (size_t i = 0; i < count; i++)
+				AssertUtils::AreEqual(swapped[i], colors[i]);
+		}
+
+		TEST_METHOD(ColorSpaceTest)
+		{
+			AssertUtils::CloseEnough(ColorSpace::SrgbToLinear(.5f), .21404f, .0001f);
+			AssertUtils::CloseEnough(ColorSpace::LinearToSrgb(.21404f), .5f, .0001f);
+			AssertUtils::CloseEnough(ColorSpace::SrgbToLinear(.02f), .02f / 12.92f, .000001f);
+			Assert::AreEqual(ColorSpace::EncodeSrgb(-1.f), (byte)0);
+			Assert::AreEqual(ColorSpace::EncodeSrgb(2.f), (byte)255);
+			Assert::AreEqual(ColorSpace::EncodeSrgb(std::numeric_limits<float>::quiet_NaN()), (byte)0);
+
+			// Every byte survives a round trip, and the table decoder is exact.
+			for (int i = 0; i < 256; i++)
+			{
+				Assert::AreEqual(ColorSpace::EncodeSrgb(ColorSpace::DecodeSrgb((byte)i)), (byte)i);
+				Assert::AreEqual(ColorSpace::DecodeSrgb((byte)i), ColorSpace::SrgbToLinear(i / 255.f));
+			}
+
+			// The encoder is never more than one step away from the exact value.
+			for (int i = 0; i <= 100000; i++)
+			{
+				float linear = i / 100000.f;
+				float exact = ColorSpace::LinearToSrgb(linear) * 255;
+				AssertUtils::CloseEnough((float)ColorSpace::EncodeSrgb(linear), exact, .6f);
+			}
+
+			const size_t count = 29;
+			BColor bytes[count];
+			FColor floats[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				bytes[i] = BColor((byte)std::rand(), (byte)std::rand(), (byte)std::rand(), (byte)std::rand());
+				floats[i] = FColor(RandFloat(-.1f, 1.1f), RandFloat(), RandFloat(), RandFloat(-.1f, 1.1f));
+			}
+
+			FColor decoded[count];
+			BColor encoded[count];
+			ColorSpace::DecodeSrgb(bytes, decoded, count);
+			ColorSpace::EncodeSrgb(floats, encoded, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(decoded[i], ColorSpace::DecodeSrgb(bytes[i]));
+				AssertUtils::AreEqual(encoded[i], ColorSpace::EncodeSrgb(floats[i]));
+				Assert::AreEqual(decoded[i].alpha, ((FColor)bytes[i]).alpha);
+			}
+		}
+
+		TEST_METHOD(BlendingTest)
+		{
+			using ColorBlending::BlendMode;
+
+			BColor source(200, 100, 0, 128), destination(0, 50, 255, 255);
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::Over, source, destination), BColor(100, 75, 127, 255));
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::Additive, source, destination), BColor(100, 100, 255, 255));
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::Multiply, source, destination), BColor(0, 35, 127, 255));
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::Screen, source, destination), BColor(100, 90, 255, 255));
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::PremultipliedOver, source.Premultiplied(), destination), BColor(100, 75, 127, 255));
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::PremultipliedAdditive, BColor(200, 10, 0, 100), BColor(100, 10, 0, 100)), BColor(255, 20, 0, 200));
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::Over, BColor::Clear(), destination), destination);
+			AssertUtils::AreEqual(ColorBlending::Blend(BlendMode::Over, BColor::Red(), destination), BColor::Red());
+
+			// Over is the exactly rounded lerp for every source, destination and alpha.
+			for (int sourceValue = 0; sourceValue < 256; sourceValue += 3)
+				for (int destinationValue = 0; destinationValue < 256; destinationValue += 5)
+					for (int alpha = 0; alpha < 256; alpha++)
+					{
+						BColor blended = ColorBlending::Blend(BlendMode::Over, BColor(sourceValue, 0, 0, alpha), BColor(destinationValue, 0, 0, 255));
+						Assert::AreEqual(blended.red, NormalizedInt::PackUnorm8((sourceValue * alpha + destinationValue * (255 - alpha)) / (255.f * 255)));
+					}
+
+			const BlendMode modes[] = { BlendMode::Over, BlendMode::PremultipliedOver, BlendMode::Additive, BlendMode::PremultipliedAdditive, BlendMode::Multiply, BlendMode::Screen };
+			// With AVX2 this goes through the AVX2, SSE2 and scalar versions.
+			const size_t count = 45;
+			BColor sources[count], destinations[count], blended[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				sources[i] = BColor((byte)std::rand(), (byte)std::rand(), (byte)std::rand(), (byte)std::rand());
+				destinations[i] = BColor((byte)std::rand(), (byte)std::rand(), (byte)std::rand(), (byte)std::rand());
+			}
+
+			for (BlendMode mode : modes)
+			{
+				for (size_t i = 0; i < count; i++)
+					blended[i] = destinations[i];
+
+				ColorBlending::Blend(mode, sources, blended, count);
+				for (size_t i = 0; i < count; i++)
+					AssertUtils::AreEqual(blended[i], ColorBlending::Blend(mode, sources[i], destinations[i]));
+			}
+		}
+
+		TEST_METHOD(ColorModelsTest)
+		{
+			AssertUtils::CloseEnough(HSVColor(FColor::Red()), HSVColor(0, 1, 1, 1));
+			AssertUtils::CloseEnough(HSVColor(FColor(0, .5f, 1, .5f)), HSVColor(3.5f / 6, 1, 1, .5f));
+			AssertUtils::CloseEnough(HSVColor(FColor::Black()), HSVColor(0, 0, 0, 1));
+			AssertUtils::CloseEnough((FColor)HSVColor(.5f, 1, 1, 1), FColor(0, 1, 1, 1));
+			AssertUtils::CloseEnough((FColor)HSVColor(-.5f, 1, 1, 1), FColor(0, 1, 1, 1));
+			AssertUtils::CloseEnough(HSLColor(FColor::Red()), HSLColor(0, 1, .5f, 1));
+			AssertUtils::CloseEnough(HSLColor(FColor::White()), HSLColor(0, 0, 1, 1));
+			AssertUtils::CloseEnough((FColor)HSLColor(1.f / 3, 1, .25f, 1), FColor(0, .5f, 0, 1));
+
+			AssertUtils::CloseEnough(OklabColor(FColor::White()), OklabColor(1, 0, 0, 1), .0001f);
+			AssertUtils::CloseEnough(OklabColor(FColor::Red()), OklabColor(.62796f, .22486f, .12585f, 1), .0001f);
+			AssertUtils::CloseEnough(OklabColor(FColor::Black()), OklabColor(0, 0, 0, 1));
+
+			const size_t count = 23;
+			FColor colors[count];
+			for (size_t i = 0; i < count; i++)
+				colors[i] = FColor(RandFloat(), RandFloat(), RandFloat(), RandFloat());
+
+			HSVColor hsv[count];
+			HSLColor hsl[count];
+			OklabColor oklab[count];
+			HSVColor::FromFColors(colors, hsv, count);
+			HSLColor::FromFColors(colors, hsl, count);
+			OklabColor::FromFColors(colors, oklab, count);
+
+			FColor fromHsv[count], fromHsl[count], fromOklab[count];
+			HSVColor::ToFColors(hsv, fromHsv, count);
+			HSLColor::ToFColors(hsl, fromHsl, count);
+			OklabColor::ToFColors(oklab, fromOklab, count);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::CloseEnough(hsv[i], HSVColor(colors[i]), .00001f);
+				AssertUtils::CloseEnough(hsl[i], HSLColor(colors[i]), .00001f);
+				AssertUtils::CloseEnough(oklab[i], OklabColor(colors[i]), .00001f);
+				AssertUtils::CloseEnough(fromHsv[i], (FColor)hsv[i], .00001f);
+				AssertUtils::CloseEnough(fromHsl[i], (FColor)hsl[i], .00001f);
+				AssertUtils::CloseEnough(fromOklab[i], (FColor)oklab[i], .00001f);
+
+				AssertUtils::CloseEnough(fromHsv[i], colors[i], .00001f);
+				AssertUtils::CloseEnough(fromHsl[i], colors[i], .00001f);
+				AssertUtils::CloseEnough(fromOklab[i], colors[i], .0001f);
+			}
+		}
+
+		TEST_METHOD(PerceptualLerpTest)
+		{
+			FColor source(1, 0, 0, 1), target(0, 0, 1, 0);
+			AssertUtils::CloseEnough(OklabColor::PerceptualLerp(source, target, 0), source, .0001f);
+			AssertUtils::CloseEnough(OklabColor::PerceptualLerp(source, target, 1), target, .0001f);
+			AssertUtils::CloseEnough(OklabColor::PerceptualLerp(source, target, 2), target, .0001f);
+
+			// Half way between black and white in Oklab has a lightness of 0.5, which is 0.125 in linear RGB.
+			AssertUtils::CloseEnough(OklabColor::PerceptualLerp(FColor::Black(), FColor::White(), .5f), FColor(.125f, .125f, .125f, 1), .0001f);
+
+			const size_t count = 19;
+			float alphas[count];
+			for (size_t i = 0; i < count; i++)
+				alphas[i] = RandFloat(-.2f, 1.2f);
+
+			FColor clamped[count], unclamped[count];
+			OklabColor::PerceptualLerp(source, target, alphas, clamped, count);
+			OklabColor::PerceptualLerp(source, target, alphas, unclamped, count, false);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::CloseEnough(clamped[i], OklabColor::PerceptualLerp(source, target, alphas[i]), .00001f);
+				AssertUtils::CloseEnough(unclamped[i], OklabColor::PerceptualLerp(source, target, alphas[i], false), .00001f);
+			}
+		}
+
 		TEST_METHOD(AdditionSubtractionTests)
 		{
 			Test50([&](int i)
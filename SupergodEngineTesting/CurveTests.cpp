@@ -0,0 +1,167 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(CurveTests)
+	{
+	private:
+		TEST_METHOD(GradientTest)
+		{
+			GradientStop stops[] = { GradientStop(1, FColor::Blue()), GradientStop(0, FColor::Red()), GradientStop(.5f, FColor::White()) };
+			Gradient gradient(stops, 3);
+			Assert::AreEqual(gradient.GetStop(0).time, 0.f);
+			Assert::AreEqual(gradient.GetStop(2).time, 1.f);
+
+			AssertUtils::AreEqual(gradient.Evaluate(-1), FColor::Red());
+			AssertUtils::AreEqual(gradient.Evaluate(.5f), FColor::White());
+			AssertUtils::AreEqual(gradient.Evaluate(2), FColor::Blue());
+			AssertUtils::CloseEnough(gradient.Evaluate(.25f), FColor(1, .5f, .5f, 1));
+			AssertUtils::CloseEnough(gradient.Evaluate(.75f), FColor(.5f, .5f, 1, 1));
+
+			gradient.AddStop(GradientStop(.75f, FColor::Black()));
+			AssertUtils::AreEqual(gradient.Evaluate(.75f), FColor::Black());
+			AssertUtils::AreEqual(Gradient().Evaluate(.5f), FColor::Clear());
+
+			const size_t count = 37;
+			float times[count];
+			for (size_t i = 0; i < count; i++)
+				times[i] = RandFloat(-.1f, 1.1f);
+
+			FColor exact[count];
+			gradient.Evaluate(times, exact, count);
+
+			gradient.Bake(1024);
+			Assert::IsTrue(gradient.IsBaked());
+			FColor baked[count];
+			gradient.Evaluate(times, baked, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(baked[i], gradient.Evaluate(times[i]));
+				AssertUtils::CloseEnough(baked[i], exact[i], .01f);
+			}
+
+			// Samples land exactly on the stops at the ends.
+			AssertUtils::AreEqual(gradient.Evaluate(0), FColor::Red());
+			AssertUtils::AreEqual(gradient.Evaluate(1), FColor::Blue());
+
+			gradient.RemoveStop(3);
+			Assert::IsTrue(gradient.IsBaked());
+			AssertUtils::AreEqual(gradient.Evaluate(1), FColor::Black());
+		}
+
+		TEST_METHOD(AnimationCurveTest)
+		{
+			AnimationCurve linear = AnimationCurve::Linear(0, 1, 2, 3);
+			Assert::AreEqual(linear.Evaluate(-1), 1.f);
+			AssertUtils::CloseEnough(linear.Evaluate(1), 2);
+			Assert::AreEqual(linear.Evaluate(5), 3.f);
+
+			CurveKey constantKey(0, 5);
+			constantKey.interpolation = CurveInterpolation::Constant;
+			CurveKey constantKeys[] = { constantKey, CurveKey(1, 7) };
+			Assert::AreEqual(AnimationCurve(constantKeys, 2).Evaluate(.99f), 5.f);
+
+			// A Hermite curve with tangents matching a line is the line, and one with flat tangents is a smoothstep.
+			CurveKey lineKeys[] = { CurveKey(0, 0, 2, 2), CurveKey(1, 2, 2, 2) };
+			AssertUtils::CloseEnough(AnimationCurve(lineKeys, 2).Evaluate(.3f), .6f);
+			CurveKey smoothKeys[] = { CurveKey(0, 0, 0, 0), CurveKey(1, 1, 0, 0) };
+			AssertUtils::CloseEnough(AnimationCurve(smoothKeys, 2).Evaluate(.25f), .15625f);
+
+			// Bezier keys with weights of 1/3 are the same as Hermite keys.
+			CurveKey hermiteKeys[] = { CurveKey(0, 1, 0, 3), CurveKey(2, -1, -2, 0) };
+			CurveKey bezierKeys[] = { CurveKey(0, 1, 0, 3, 1.f / 3, 1.f / 3), CurveKey(2, -1, -2, 0, 1.f / 3, 1.f / 3) };
+			AnimationCurve hermite(hermiteKeys, 2), bezier(bezierKeys, 2);
+			for (float time = 0; time <= 2; time += .125f)
+				AssertUtils::CloseEnough(bezier.Evaluate(time), hermite.Evaluate(time), .0001f);
+
+			// Heavier weights pull the curve towards the tangents.
+			bezierKeys[0].outWeight = .9f;
+			Assert::IsTrue(AnimationCurve(bezierKeys, 2).Evaluate(.5f) > bezier.Evaluate(.5f));
+
+			const size_t count = 41;
+			float times[count];
+			for (size_t i = 0; i < count; i++)
+				times[i] = RandFloat(-.5f, 2.5f);
+
+			float exact[count], baked[count];
+			hermite.Evaluate(times, exact, count);
+			hermite.Bake(512);
+			hermite.Evaluate(times, baked, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::CloseEnough(baked[i], hermite.Evaluate(times[i]), .00001f);
+				AssertUtils::CloseEnough(baked[i], exact[i], .001f);
+			}
+
+			hermite.AddKey(CurveKey(3, 10));
+			Assert::AreEqual(hermite.Evaluate(3), 10.f);
+			hermite.Unbake();
+			Assert::IsFalse(hermite.IsBaked());
+			AssertUtils::CloseEnough(hermite.Evaluate(2.5f), 4.5f);
+		}
+
+		TEST_METHOD(SplineTest)
+		{
+			Vector3D points[] = { Vector3D(0, 0, 0), Vector3D(1, 2, 0), Vector3D(3, 2, 1), Vector3D(4, 0, 1), Vector3D(6, -1, 0) };
+
+			// Catmull-Rom goes through every point, and Bezier goes through the ends of its segments.
+			Spline<Vector3D> catmullRom(SplineType::CatmullRom, points, 5);
+			Assert::AreEqual(catmullRom.SegmentCount(), (size_t)4);
+			for (int i = 0; i < 5; i++)
+				AssertUtils::CloseEnough(catmullRom.Evaluate(i / 4.f), points[i], .0001f);
+			AssertUtils::CloseEnough(catmullRom.Tangent(.25f), (points[2] - points[0]) * .5f * 4, .0001f);
+
+			Spline<Vector3D> bezier(SplineType::Bezier, points, 4);
+			AssertUtils::CloseEnough(bezier.Evaluate(0), points[0]);
+			AssertUtils::CloseEnough(bezier.Evaluate(1), points[3]);
+			AssertUtils::CloseEnough(bezier.Tangent(0), (points[1] - points[0]) * 3, .0001f);
+			AssertUtils::CloseEnough(bezier.Evaluate(.5f), (points[0] + points[1] * 3 + points[2] * 3 + points[3]) / 8, .0001f);
+
+			// A B-spline starts at (p0 + 4 p1 + p2) / 6.
+			Spline<Vector3D> bSpline(SplineType::BSpline, points, 5);
+			Assert::AreEqual(bSpline.SegmentCount(), (size_t)2);
+			AssertUtils::CloseEnough(bSpline.Evaluate(0), (points[0] + points[1] * 4 + points[2]) / 6, .0001f);
+
+			// Straight lines don't curve, and a Bezier quarter circle has a curvature of about 1 / its radius.
+			Vector2D line[] = { Vector2D(0, 0), Vector2D(1, 1), Vector2D(2, 2) };
+			AssertUtils::CloseEnough(Spline<Vector2D>(SplineType::CatmullRom, line, 3).Curvature(.3f), 0, .0001f);
+			const float handle = .5522847f * 2;
+			Vector2D arc[] = { Vector2D(2, 0), Vector2D(2, handle), Vector2D(handle, 2), Vector2D(0, 2) };
+			Spline<Vector2D> quarterCircle(SplineType::Bezier, arc, 4);
+			AssertUtils::CloseEnough(quarterCircle.Curvature(.5f), .5f, .01f);
+
+			// Arc length: a quarter circle of radius 2 is pi long, and distances are spread evenly along it.
+			quarterCircle.BuildArcLengthTable(64);
+			AssertUtils::CloseEnough(quarterCircle.Length(), Constants::PI, .001f);
+			AssertUtils::CloseEnough(quarterCircle.EvaluateAtDistance(Constants::PI / 2), Vector2D(SMath::Sqrt(2), SMath::Sqrt(2)), .01f);
+			for (int i = 0; i < 10; i++)
+				AssertUtils::CloseEnough(quarterCircle.EvaluateAtDistance(i * .3f).Distance(quarterCircle.EvaluateAtDistance((i + 1) * .3f)), .3f, .002f);
+
+			const size_t count = 23;
+			float parameters[count], distances[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				parameters[i] = RandFloat(-.1f, 1.1f);
+				distances[i] = RandFloat(0, Constants::PI);
+			}
+
+			Vector3D evaluated[count], tangents[count];
+			catmullRom.Evaluate(parameters, evaluated, count);
+			catmullRom.Tangent(parameters, tangents, count);
+			Vector2D atDistances[count];
+			quarterCircle.EvaluateAtDistance(distances, atDistances, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(evaluated[i], catmullRom.Evaluate(parameters[i]));
+				AssertUtils::AreEqual(tangents[i], catmullRom.Tangent(parameters[i]));
+				AssertUtils::AreEqual(atDistances[i], quarterCircle.EvaluateAtDistance(distances[i]));
+			}
+
+			// Splines work on colors too.
+			FColor colors[] = { FColor::Red(), FColor::Green(), FColor::Blue() };
+			AssertUtils::CloseEnough(Spline<FColor>(SplineType::CatmullRom, colors, 3).Evaluate(.5f), FColor::Green());
+		}
+	};
+}
\ No newline at end of file
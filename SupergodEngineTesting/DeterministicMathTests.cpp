@@ -0,0 +1,325 @@
+#include "TestUtils.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(DeterministicMathTests)
+	{
+	private:
+		struct GoldenValue
+		{
+			float input;
+			uint bits;
+		};
+
+		struct GoldenPair
+		{
+			float first, second;
+			uint bits;
+		};
+
+		static uint Bits(float value)
+		{
+			uint bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+
+		static float FromBits(uint bits)
+		{
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		/// <summary>
+		/// Gets the distance between a and the float closest to exact, in floats.
+		/// </summary>
+		static uint UlpDistance(float a, double exact)
+		{
+			// Maps the bits of floats to integers that are ordered like the floats.
+			auto ordered = [](float value)
+			{
+				uint bits = Bits(value);
+				return (bits & 0x80000000u) ? (long long)0x80000000u - (long long)bits : (long long)bits;
+			};
+
+			long long distance = ordered(a) - ordered((float)exact);
+			return (uint)(distance < 0 ? -distance : distance);
+		}
+
+	public:
+		// The expected bits were generated once and must never change: the same inputs have to give the same bits with every compiler and CPU.
+		TEST_METHOD(GoldenValuesTest)
+		{
+			const GoldenValue sinValues[] =
+			{
+				{ 0.f, 0x00000000u },
+				{ -0.f, 0x80000000u },
+				{ 9.99999997e-07f, 0x358637bdu },
+				{ 0.5f, 0x3ef57744u },
+				{ -0.785398185f, 0xbf3504f3u },
+				{ 1.f, 0x3f576aa4u },
+				{ 1.57079637f, 0x3f800000u },
+				{ 2.f, 0x3f68c7b7u },
+				{ -3.14159274f, 0x33bbbd2eu },
+				{ 10.f, 0xbf0b44f8u },
+				{ -123.456001f, 0x3f4dcee4u },
+				{ 1000.f, 0x3f53ae61u },
+				{ 65536.5f, 0x3e85c64eu },
+				{ -1000000.f, 0x3eb33259u }
+			};
+
+			for (const GoldenValue& value : sinValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Sin(value.input)));
+
+			const GoldenValue cosValues[] =
+			{
+				{ 0.f, 0x3f800000u },
+				{ -0.f, 0x3f800000u },
+				{ 9.99999997e-07f, 0x3f800000u },
+				{ 0.5f, 0x3f60a940u },
+				{ -0.785398185f, 0x3f3504f3u },
+				{ 1.f, 0x3f0a5140u },
+				{ 1.57079637f, 0xb33bbd2eu },
+				{ 2.f, 0xbed51133u },
+				{ -3.14159274f, 0xbf800000u },
+				{ 10.f, 0xbf56cd64u },
+				{ -123.456001f, 0xbf183f1bu },
+				{ 1000.f, 0x3f0ff813u },
+				{ 65536.5f, 0xbf771b81u },
+				{ -1000000.f, 0x3f6fcefdu }
+			};
+
+			for (const GoldenValue& value : cosValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Cos(value.input)));
+
+			const GoldenValue tanValues[] =
+			{
+				{ 0.f, 0x00000000u },
+				{ -0.f, 0x80000000u },
+				{ 9.99999997e-07f, 0x358637bdu },
+				{ 0.5f, 0x3f0bda7bu },
+				{ -0.785398185f, 0xbf800000u },
+				{ 1.f, 0x3fc75923u },
+				{ 1.57079637f, 0xcbae8a4au },
+				{ 2.f, 0xc00bd7b1u },
+				{ -3.14159274f, 0xb3bbbd2eu },
+				{ 10.f, 0x3f25fafau },
+				{ -123.456001f, 0xbfad0811u },
+				{ 1000.f, 0x3fbc3395u },
+				{ 65536.5f, 0xbe8a96b6u },
+				{ -1000000.f, 0x3ebf4bb4u }
+			};
+
+			for (const GoldenValue& value : tanValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Tan(value.input)));
+
+			const GoldenValue asinValues[] =
+			{
+				{ -1.f, 0xbfc90fdbu },
+				{ -0.999000013f, 0xbfc35650u },
+				{ -0.5f, 0xbf060a92u },
+				{ -9.99999975e-06f, 0xb727c5acu },
+				{ 0.f, 0x00000000u },
+				{ 0.100000001f, 0x3dcd2494u },
+				{ 0.333333313f, 0x3eadff1au },
+				{ 0.707106829f, 0x3f490fdcu },
+				{ 0.949999988f, 0x3fa06a08u },
+				{ 1.f, 0x3fc90fdbu }
+			};
+
+			for (const GoldenValue& value : asinValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Asin(value.input)));
+
+			const GoldenValue acosValues[] =
+			{
+				{ -1.f, 0x40490fdbu },
+				{ -0.999000013f, 0x40463315u },
+				{ -0.5f, 0x40060a92u },
+				{ -9.99999975e-06f, 0x3fc9102fu },
+				{ 0.f, 0x3fc90fdbu },
+				{ 0.100000001f, 0x3fbc3d91u },
+				{ 0.333333313f, 0x3f9d9014u },
+				{ 0.707106829f, 0x3f490fdau },
+				{ 0.949999988f, 0x3ea29749u },
+				{ 1.f, 0x00000000u }
+			};
+
+			for (const GoldenValue& value : acosValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Acos(value.input)));
+
+			const GoldenValue atanValues[] =
+			{
+				{ -1.00000002e+20f, 0xbfc90fdbu },
+				{ -100.f, 0xbfc7c82fu },
+				{ -2.5f, 0xbf985b6cu },
+				{ -1.f, 0xbf490fdbu },
+				{ -0.25f, 0xbe7adbb0u },
+				{ 0.f, 0x00000000u },
+				{ 1.00000001e-07f, 0x33d6bf95u },
+				{ 0.4375f, 0x3ed32776u },
+				{ 0.6875f, 0x3f1a2f81u },
+				{ 1.f, 0x3f490fdbu },
+				{ 1.1875f, 0x3f5ef387u },
+				{ 2.4375f, 0x3f973ab9u },
+				{ 3.f, 0x3f9fe0bbu },
+				{ 1e+10f, 0x3fc90fdbu }
+			};
+
+			for (const GoldenValue& value : atanValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Atan(value.input)));
+
+			const GoldenValue expValues[] =
+			{
+				{ -103.f, 0x00000001u },
+				{ -87.f, 0x00b33687u },
+				{ -10.f, 0x383e6bceu },
+				{ -1.f, 0x3ebc5ab2u },
+				{ -0.00100000005f, 0x3f7fbe7fu },
+				{ 0.f, 0x3f800000u },
+				{ 9.99999997e-07f, 0x3f800008u },
+				{ 0.346573591f, 0x3fb504f3u },
+				{ 1.f, 0x402df854u },
+				{ 2.30258489f, 0x411ffffeu },
+				{ 20.f, 0x4de75844u },
+				{ 88.f, 0x7ef882b7u }
+			};
+
+			for (const GoldenValue& value : expValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Exp(value.input)));
+
+			const GoldenValue logValues[] =
+			{
+				{ 9.9999461e-41f, 0xc2b834f2u },
+				{ 1e-30f, 0xc28a27b5u },
+				{ 0.00100000005f, 0xc0dd0c55u },
+				{ 0.5f, 0xbf317218u },
+				{ 0.999989986f, 0xb7280037u },
+				{ 1.f, 0x00000000u },
+				{ 1.00001001f, 0x3727ffc9u },
+				{ 2.f, 0x3f317218u },
+				{ 2.71828175f, 0x3f7fffffu },
+				{ 10.f, 0x40135d8eu },
+				{ 12345.6787f, 0x4116bcabu },
+				{ 3.00000001e+38f, 0x42b13196u }
+			};
+
+			for (const GoldenValue& value : logValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Log(value.input)));
+
+			const GoldenValue sqrtValues[] =
+			{
+				{ 9.9999461e-41f, 0x1e3ce4e7u },
+				{ 1e-30f, 0x26901d7du },
+				{ 0.00100000005f, 0x3d0186e3u },
+				{ 0.5f, 0x3f3504f3u },
+				{ 0.999989986f, 0x3f7fffacu },
+				{ 1.f, 0x3f800000u },
+				{ 1.00001001f, 0x3f80002au },
+				{ 2.f, 0x3fb504f3u },
+				{ 2.71828175f, 0x3fd3094cu },
+				{ 10.f, 0x404a62c2u },
+				{ 12345.6787f, 0x42de38e3u },
+				{ 3.00000001e+38f, 0x5f705eceu }
+			};
+
+			for (const GoldenValue& value : sqrtValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Sqrt(value.input)));
+
+			const GoldenPair atan2Values[] =
+			{
+				{ 1.f, 1.f, 0x3f490fdbu },
+				{ 1.f, -1.f, 0x4016cbe4u },
+				{ -1.f, -1.f, 0xc016cbe4u },
+				{ -1.f, 1.f, 0xbf490fdbu },
+				{ 0.f, -1.f, 0x40490fdbu },
+				{ -0.f, -1.f, 0xc0490fdbu },
+				{ 3.f, 0.f, 0x3fc90fdbu },
+				{ -2.f, 0.f, 0xbfc90fdbu },
+				{ 9.99999968e-21f, 1.00000002e+20f, 0x000116c2u },
+				{ 5.f, 12.f, 0x3eca2210u }
+			};
+
+			for (const GoldenPair& value : atan2Values)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Atan2(value.first, value.second)));
+
+			const GoldenPair powValues[] =
+			{
+				{ 2.f, 10.f, 0x44800000u },
+				{ 2.f, -1.f, 0x3f000000u },
+				{ 10.f, 0.5f, 0x404a62c2u },
+				{ 0.5f, 3.29999995f, 0x3dcfefc6u },
+				{ -2.f, 3.f, 0xc1000000u },
+				{ -2.f, 4.f, 0x41800000u },
+				{ 1.00010002f, 10000.f, 0x402dfd7eu },
+				{ 7.5f, -2.25f, 0x3c300204u },
+				{ 123.f, 1.5f, 0x44aa845au },
+				{ 0.f, -2.f, 0x7f800000u }
+			};
+
+			for (const GoldenPair& value : powValues)
+				Assert::AreEqual(value.bits, Bits(SMath::Deterministic::Pow(value.first, value.second)));
+		}
+
+		TEST_METHOD(SpecialValuesTest)
+		{
+			float infinity = std::numeric_limits<float>::infinity();
+			Assert::IsTrue(SMath::IsNaN(SMath::Deterministic::Sin(infinity)));
+			Assert::IsTrue(SMath::IsNaN(SMath::Deterministic::Asin(1.5f)));
+			Assert::IsTrue(SMath::IsNaN(SMath::Deterministic::Log(-1)));
+			Assert::IsTrue(SMath::IsNaN(SMath::Deterministic::Pow(-2, .5f)));
+			Assert::AreEqual(SMath::Deterministic::Log(0), -infinity);
+			Assert::AreEqual(SMath::Deterministic::Exp(100), infinity);
+			Assert::AreEqual(SMath::Deterministic::Exp(-infinity), 0.f);
+			Assert::AreEqual(SMath::Deterministic::Atan(-infinity), -Constants::PI / 2);
+			Assert::AreEqual(SMath::Deterministic::Pow(-3, 3), -27.f);
+			Assert::AreEqual(SMath::Deterministic::Pow(-1, infinity), 1.f);
+			Assert::AreEqual(SMath::Deterministic::Pow(.5f, infinity), 0.f);
+			Assert::AreEqual(Bits(SMath::Deterministic::Sin(-0.f)), 0x80000000u);
+		}
+
+		TEST_METHOD(AccuracyTest)
+		{
+			for (int i = 0; i < 10000; i++)
+			{
+				float x = RandFloat(-1000, 1000);
+				float unit = RandFloat(-1, 1);
+				float positive = RandFloat(0, 1000);
+
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Sin(x), std::sin((double)x)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Cos(x), std::cos((double)x)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Tan(x), std::tan((double)x)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Asin(unit), std::asin((double)unit)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Acos(unit), std::acos((double)unit)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Atan(x), std::atan((double)x)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Atan2(x, unit), std::atan2((double)x, (double)unit)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Exp(x / 12), std::exp((double)(x / 12))) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Log(positive), std::log((double)positive)) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Pow(positive, unit * 5), std::pow((double)positive, (double)(unit * 5))) <= 1);
+				Assert::IsTrue(UlpDistance(SMath::Deterministic::Sqrt(positive), std::sqrt((double)positive)) == 0);
+			}
+		}
+
+		TEST_METHOD(DeterministicVectorsTest)
+		{
+			// Normalized only uses basic operations and a square root, and the rotation builders use SMath::Constexpr, so they are deterministic as well.
+			Vector3D normalized = Vector3D(3, -4, 12).Normalized();
+			Assert::AreEqual(Bits(normalized.x), 0x3e6c4ec5u);
+			Assert::AreEqual(Bits(normalized.y), 0xbe9d89d9u);
+			Assert::AreEqual(Bits(normalized.z), 0x3f6c4ec5u);
+
+			Matrix2x2 rotation = Matrix2x2::Rotate(Angle(1));
+			Assert::AreEqual(Bits(rotation(0, 0)), 0x3f0a5140u);
+			Assert::AreEqual(Bits(rotation(1, 0)), 0x3f576aa4u);
+
+			// SmallestAngle goes through SMath::Acos, which is only bit exact when the core is built with SUPERGOD_DETERMINISTIC_MATH.
+			Assert::IsTrue(UlpDistance(Vector3D(3, -4, 12).SmallestAngle(Vector3D(1, 2, .5f)).GetRadians(), FromBits(0x3fc4c390u)) <= 1);
+			Assert::IsTrue(UlpDistance(Vector2D(2, 5).SmallestAngle(Vector2D(-3, 1)).GetRadians(), FromBits(0x3fd0952au)) <= 1);
+		}
+	};
+}
\ No newline at end of file
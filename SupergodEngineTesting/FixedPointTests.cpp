@@ -0,0 +1,177 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(FixedPointTests)
+	{
+	private:
+		TEST_METHOD(Fixed32Test)
+		{
+			Assert::AreEqual(Fixed32(1).raw, 65536);
+			Assert::AreEqual(Fixed32(-2.5f).raw, -163840);
+			Assert::AreEqual(Fixed32(1e10f).raw, Fixed32::Max().raw);
+			Assert::AreEqual((float)Fixed32(.75f), .75f);
+			Assert::AreEqual((int)Fixed32(-1.5f), -2);
+
+			AssertUtils::AreEqual(Fixed32(3) + Fixed32(.5f), Fixed32(3.5f));
+			AssertUtils::AreEqual(Fixed32(3) - Fixed32(.5f), Fixed32(2.5f));
+			AssertUtils::AreEqual(Fixed32(3) * Fixed32(-.5f), Fixed32(-1.5f));
+			AssertUtils::AreEqual(Fixed32(3) / Fixed32(4), Fixed32(.75f));
+			AssertUtils::AreEqual(Fixed32(1) / Fixed32(), Fixed32::Max());
+			AssertUtils::AreEqual(-Fixed32(2), Fixed32(-2));
+			Assert::IsTrue(Fixed32(1) < Fixed32(2) && Fixed32(2) > Fixed32(-3));
+
+			AssertUtils::AreEqual(Fixed32(-1.25f).Floor(), Fixed32(-2));
+			AssertUtils::AreEqual(Fixed32(1.25f).Ceil(), Fixed32(2));
+			AssertUtils::AreEqual(Fixed32(2).Lerp(Fixed32(4), Fixed32(.25f)), Fixed32(2.5f));
+			AssertUtils::AreEqual(Lerper::Lerp(Fixed32(2), Fixed32(4), 2.f), Fixed32(4));
+			AssertUtils::AreEqual(SMath::Clamp(Fixed32(5), Fixed32(0), Fixed32(1)), Fixed32(1));
+
+			// The square root is exact (rounded down).
+			Assert::AreEqual(Fixed32::Sqrt(Fixed32(4)).raw, 2 * 65536);
+			Assert::AreEqual(Fixed32::Sqrt(Fixed32(2)).raw, 92681);
+			Assert::AreEqual(Fixed32::Sqrt(Fixed32::Epsilon()).raw, 256);
+			Assert::AreEqual(Fixed32::Sqrt(Fixed32(-1)).raw, 0);
+
+			for (int i = 0; i < 100; i++)
+			{
+				float a = RandFloat(-100, 100), b = RandFloat(-100, 100);
+				AssertUtils::CloseEnough((float)(Fixed32(a) * Fixed32(b)), a * b, .01f);
+				AssertUtils::CloseEnough((float)(Fixed32(a) / Fixed32(b + 200)), a / (b + 200), .0001f);
+				AssertUtils::CloseEnough((float)Fixed32::Sqrt(Fixed32(a + 100)), SMath::Sqrt(a + 100), .0001f);
+			}
+		}
+
+		TEST_METHOD(Fixed64Test)
+		{
+			Assert::AreEqual(Fixed64(1).raw, 1LL << 32);
+			Assert::AreEqual(Fixed64(Fixed32(-1.5f)).raw, -3LL << 31);
+			AssertUtils::AreEqual((Fixed32)Fixed64(2.25), Fixed32(2.25f));
+			Assert::AreEqual((double)Fixed64(-1000000.5), -1000000.5);
+
+			AssertUtils::AreEqual(Fixed64(-3) * Fixed64(.5), Fixed64(-1.5));
+			AssertUtils::AreEqual(Fixed64(100000) * Fixed64(10000), Fixed64(1000000000));
+			AssertUtils::AreEqual(Fixed64(-7) / Fixed64(2), Fixed64(-3.5));
+			AssertUtils::AreEqual(Fixed64(100000) / Fixed64(-.25), Fixed64(-400000));
+			AssertUtils::AreEqual(Fixed64(-1) / Fixed64(), Fixed64::Min());
+			Assert::AreEqual(Fixed64::Sqrt(Fixed64(2)).raw, 6074000999LL);
+			Assert::AreEqual(Fixed64::Sqrt(Fixed64(1000000000)).raw, 135818791312945LL);
+
+			for (int i = 0; i < 100; i++)
+			{
+				double a = RandFloat(-10000, 10000), b = RandFloat(-10000, 10000);
+				Assert::AreEqual((double)(Fixed64(a) * Fixed64(b)), a * b, 1e-6);
+				Assert::AreEqual((double)(Fixed64(a) / Fixed64(b + 20000)), a / (b + 20000), 1e-9);
+				Assert::AreEqual((double)Fixed64::Sqrt(Fixed64(a + 10000)), std::sqrt(a + 10000), 1e-9);
+			}
+		}
+
+		TEST_METHOD(FixedAngleTest)
+		{
+			AssertUtils::AreEqual(FixedAngle::FromDegrees(Fixed32(90)), FixedAngle::Right());
+			AssertUtils::AreEqual(FixedAngle::FromDegrees(Fixed32(-90)), FixedAngle::StraightAndHalf());
+			AssertUtils::AreEqual(FixedAngle::FromRevolutions(Fixed32(2.5f)), FixedAngle::Straight());
+			AssertUtils::AreEqual(FixedAngle::Right().GetDegrees(), Fixed32(90));
+			AssertUtils::CloseEnough(FixedAngle::FromRadians(Fixed32::Pi()), FixedAngle::Straight(), .0001f);
+			AssertUtils::AreEqual(FixedAngle::StraightAndHalf() + FixedAngle::Straight(), FixedAngle::Right());
+
+			AssertUtils::AreEqual(FixedAngle::Zero().Sin(), Fixed32(0));
+			AssertUtils::AreEqual(FixedAngle::Right().Sin(), Fixed32(1));
+			AssertUtils::AreEqual(FixedAngle::Straight().Cos(), Fixed32(-1));
+			AssertUtils::AreEqual(FixedAngle::StraightAndHalf().Sin(), Fixed32(-1));
+			AssertUtils::AreEqual(FixedAngle::HalfRight().Tan(), Fixed32(1));
+			AssertUtils::AreEqual(FixedAngle::Atan2(Fixed32(1), Fixed32(1)), FixedAngle::HalfRight());
+			AssertUtils::AreEqual(FixedAngle::Atan2(Fixed32(0), Fixed32(-3)), FixedAngle::Straight());
+			AssertUtils::AreEqual(FixedAngle::Atan2(Fixed32(-2), Fixed32(0)), FixedAngle::StraightAndHalf());
+
+			FixedAngle from = FixedAngle::FromDegrees(Fixed32(350));
+			FixedAngle to = FixedAngle::FromDegrees(Fixed32(10));
+			AssertUtils::CloseEnough((float)from.DeltaTo(to), 20 * Angle::DEG_TO_RAD, .0001f);
+			AssertUtils::AreEqual(from.LerpShortest(to, Fixed32(.5f)), FixedAngle::Zero());
+
+			for (int i = 0; i < 200; i++)
+			{
+				float radians = RandFloat(-20, 20);
+				FixedAngle angle = FixedAngle::FromRadians(Fixed32(radians));
+				AssertUtils::CloseEnough((float)angle.Sin(), std::sin(radians), .0001f);
+				AssertUtils::CloseEnough((float)angle.Cos(), std::cos(radians), .0001f);
+
+				float y = RandFloat(-100, 100), x = RandFloat(-100, 100);
+				FixedAngle atan = FixedAngle::Atan2(Fixed32(y), Fixed32(x));
+				AssertUtils::CloseEnough(atan, FixedAngle(Angle(std::atan2(y, x))), .0001f);
+			}
+		}
+
+		TEST_METHOD(FixedVectorTest)
+		{
+			FixedVector3D a(Fixed32(1), Fixed32(2), Fixed32(3)), b(Fixed32(-2), Fixed32(0), Fixed32(.5f));
+			AssertUtils::AreEqual(a + b, FixedVector3D(Fixed32(-1), Fixed32(2), Fixed32(3.5f)));
+			AssertUtils::AreEqual(a * Fixed32(2), FixedVector3D(Fixed32(2), Fixed32(4), Fixed32(6)));
+			AssertUtils::AreEqual(a.Dot(b), Fixed32(-.5f));
+			AssertUtils::AreEqual(FixedVector3D::UnitX().Cross(FixedVector3D::UnitY()), FixedVector3D::UnitZ());
+			AssertUtils::AreEqual(FixedVector3D(Fixed32(2), Fixed32(3), Fixed32(6)).Magnitude(), Fixed32(7));
+			AssertUtils::AreEqual(FixedVector3D(Fixed32(10000), Fixed32(0), Fixed32(0)).Magnitude(), Fixed32(10000));
+			AssertUtils::AreEqual(FixedVector3D().Normalized(), FixedVector3D());
+			AssertUtils::CloseEnough((Vector3D)a.Normalized(), Vector3D(1, 2, 3).Normalized(), .0001f);
+
+			FixedVector2D v(Fixed32(3), Fixed32(4));
+			AssertUtils::AreEqual(v.Magnitude(), Fixed32(5));
+			AssertUtils::AreEqual(v.Rotated(FixedAngle::Right()), FixedVector2D(Fixed32(-4), Fixed32(3)));
+			AssertUtils::AreEqual(FixedVector2D::FromAngle(FixedAngle::Straight()), FixedVector2D(Fixed32(-1), Fixed32(0)));
+			AssertUtils::CloseEnough((float)v.Direction().GetRadians(), std::atan2(4.f, 3.f), .0001f);
+			AssertUtils::CloseEnough((Vector2D)v.Normalized(), Vector2D(.6f, .8f), .0001f);
+		}
+
+		TEST_METHOD(DeterminismTest)
+		{
+			// Runs a small lockstep-like simulation and hashes every raw value it produces.
+			// Everything is integer math, so the hash must be the same with every compiler, CPU and optimization level.
+			unsigned long long hash = 14695981039346656037ULL;
+			auto mix = [&hash](long long value)
+			{
+				for (int i = 0; i < 8; i++)
+				{
+					hash ^= (unsigned long long)(value >> (i * 8)) & 0xff;
+					hash *= 1099511628211ULL;
+				}
+			};
+
+			FixedVector2D positions[16], velocities[16];
+			FixedAngle headings[16];
+			for (int i = 0; i < 16; i++)
+			{
+				positions[i] = FixedVector2D(Fixed32(i * 3 - 20), Fixed32(7 - i));
+				headings[i] = FixedAngle::FromDegrees(Fixed32(i * 23));
+			}
+
+			Fixed32 deltaTime = Fixed32(1) / Fixed32(60);
+			Fixed64 time;
+			for (int step = 0; step < 600; step++)
+			{
+				time = time + Fixed64(deltaTime);
+				for (int i = 0; i < 16; i++)
+				{
+					FixedVector2D target = positions[(i + 1) % 16] - positions[i];
+					FixedAngle desired = target.Direction();
+					headings[i] = headings[i].LerpShortest(desired, Fixed32(.1f));
+					velocities[i] = FixedVector2D::FromAngle(headings[i]) * (Fixed32(2) + headings[i].Sin() * Fixed32(.5f));
+					positions[i] = positions[i] + velocities[i] * deltaTime + target.Normalized() * (deltaTime * Fixed32(.25f));
+
+					mix(positions[i].x.raw);
+					mix(positions[i].y.raw);
+					mix(headings[i].raw);
+					mix(target.Magnitude().raw);
+				}
+
+				mix((time * time).raw);
+				mix(Fixed64::Sqrt(time).raw);
+				mix((Fixed64(1) / time).raw);
+				mix(FixedAngle::FromRadians((Fixed32)time).Tan().raw);
+			}
+
+			Assert::AreEqual(hash, 11080622709613395728ULL);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Physics;
+
+	TEST_CLASS(GjkTests)
+	{
+	private:
+		static RigidBody Body(const Shape& shape, const Vector3D& position, const Quaternion& orientation = Quaternion::Identity())
+		{
+			return RigidBody(shape, position, orientation, 1);
+		}
+
+	public:
+		TEST_METHOD(DistanceTest)
+		{
+			RigidBody boxA = Body(Shape::Box(Vector3D(1, 1, 1)), Vector3D::Zero());
+			RigidBody boxB = Body(Shape::Box(Vector3D(1, 1, 1)), Vector3D(5, .5f, 0));
+			GjkResult result = Gjk::Distance(SupportMapping::OfBody(boxA), SupportMapping::OfBody(boxB));
+			Assert::IsFalse(result.intersecting);
+			AssertUtils::CloseEnough(result.distance, 3, .0001f);
+			AssertUtils::CloseEnough(result.normal, Vector3D::UnitX(), .0001f);
+			AssertUtils::CloseEnough(result.pointA.x, 1, .0001f);
+			AssertUtils::CloseEnough(result.pointB.x, 4, .0001f);
+
+			// A box turned by 45 degrees points its edge at the other box.
+			boxB.orientation = Quaternion::FromAxisAngle(Vector3D::UnitZ(), Constants::PI / 4);
+			boxB.position = Vector3D(5, 0, 0);
+			result = Gjk::Distance(SupportMapping::OfBody(boxA), SupportMapping::OfBody(boxB));
+			AssertUtils::CloseEnough(result.distance, 4 - SMath::Sqrt(2), .0001f);
+
+			// Spheres are points with a radius, so GJK is done in a step or two.
+			RigidBody sphereA = Body(Shape::Sphere(1), Vector3D::Zero());
+			RigidBody sphereB = Body(Shape::Sphere(1.5f), Vector3D(3, 4, 0));
+			result = Gjk::Distance(SupportMapping::OfBody(sphereA), SupportMapping::OfBody(sphereB));
+			AssertUtils::CloseEnough(result.distance, 2.5f, .0001f);
+			AssertUtils::CloseEnough(result.pointA, Vector3D(.6f, .8f, 0), .0001f);
+			Assert::IsTrue(result.iterations <= 3);
+
+			RigidBody capsule = Body(Shape::Capsule(.5f, 2), Vector3D(0, 0, 4), Quaternion::FromAxisAngle(Vector3D::UnitX(), Constants::PI / 2));
+			result = Gjk::Distance(SupportMapping::OfBody(boxA), SupportMapping::OfBody(capsule));
+			AssertUtils::CloseEnough(result.distance, .5f, .0001f);
+			capsule.position.z = 3;
+			Assert::IsTrue(Gjk::Distance(SupportMapping::OfBody(boxA), SupportMapping::OfBody(capsule)).intersecting);
+
+			Vector3D points[] = { Vector3D(0, 0, 0), Vector3D(1, 0, 0), Vector3D(0, 1, 0), Vector3D(0, 0, 1) };
+			ConvexHull tetrahedron = { points, 4 };
+			RigidBody point = Body(Shape::Sphere(0), Vector3D(1, 1, 1));
+			result = Gjk::Distance(SupportMapping::OfPolytope(tetrahedron), SupportMapping::OfBody(point));
+			AssertUtils::CloseEnough(result.distance, 2 / SMath::Sqrt(3), .0001f);
+			AssertUtils::CloseEnough(result.pointA, Vector3D(1, 1, 1) / 3.f, .0001f);
+		}
+
+		TEST_METHOD(PenetrationTest)
+		{
+			RigidBody boxA = Body(Shape::Box(Vector3D(1, 1, 1)), Vector3D::Zero());
+			RigidBody boxB = Body(Shape::Box(Vector3D(1, 1, 1)), Vector3D(1.5f, .2f, 0));
+			GjkResult result = Gjk::Penetration(SupportMapping::OfBody(boxA), SupportMapping::OfBody(boxB));
+			Assert::IsTrue(result.intersecting);
+			AssertUtils::CloseEnough(result.depth, .5f, .0001f);
+			AssertUtils::CloseEnough(result.normal, Vector3D::UnitX(), .0001f);
+
+			// Moving B by the normal times the depth leaves the boxes touching.
+			boxB.position += result.normal * (result.depth + .001f);
+			Assert::IsFalse(Gjk::Distance(SupportMapping::OfBody(boxA), SupportMapping::OfBody(boxB)).intersecting);
+
+			// Only the radii overlap, so GJK finds the depth without EPA.
+			RigidBody sphereA = Body(Shape::Sphere(1), Vector3D::Zero());
+			RigidBody sphereB = Body(Shape::Sphere(1), Vector3D(0, 1.5f, 0));
+			result = Gjk::Penetration(SupportMapping::OfBody(sphereA), SupportMapping::OfBody(sphereB));
+			AssertUtils::CloseEnough(result.depth, .5f, .0001f);
+			AssertUtils::CloseEnough(result.normal, Vector3D::UnitY(), .0001f);
+			AssertUtils::CloseEnough(result.pointA, Vector3D(0, 1, 0), .0001f);
+
+			// A sphere whose center is inside a box needs EPA on the box.
+			RigidBody sphere = Body(Shape::Sphere(.5f), Vector3D(.7f, .1f, -.2f));
+			result = Gjk::Penetration(SupportMapping::OfBody(boxA), SupportMapping::OfBody(sphere));
+			AssertUtils::CloseEnough(result.depth, .8f, .001f);
+			AssertUtils::CloseEnough(result.normal, Vector3D::UnitX(), .001f);
+
+			// The cores of crossing capsules (and of spheres at the same place) have no inside, so only the radii are deep.
+			RigidBody capsuleA = Body(Shape::Capsule(.5f, 2), Vector3D::Zero());
+			RigidBody capsuleB = Body(Shape::Capsule(.25f, 2), Vector3D::Zero(), Quaternion::FromAxisAngle(Vector3D::UnitX(), Constants::PI / 2));
+			result = Gjk::Penetration(SupportMapping::OfBody(capsuleA), SupportMapping::OfBody(capsuleB));
+			AssertUtils::CloseEnough(result.depth, .75f, .0001f);
+			AssertUtils::CloseEnough(SMath::Abs(result.normal.x), 1, .0001f);
+			sphereB.position = Vector3D::Zero();
+			AssertUtils::CloseEnough(Gjk::Penetration(SupportMapping::OfBody(sphereA), SupportMapping::OfBody(sphereB)).depth, 2, .0001f);
+
+			// Turned boxes agree with the separating axis test of Collision.
+			for (int i = 0; i < 50; i++)
+			{
+				RigidBody a = Body(Shape::Box(Vector3D(RandFloat(.5f, 2), RandFloat(.5f, 2), RandFloat(.5f, 2))), Vector3D::Zero(),
+					Quaternion::FromAxisAngle(Vector3D(RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1)).Normalized(), RandFloat(0, 3)));
+				RigidBody b = Body(Shape::Box(Vector3D(RandFloat(.5f, 2), RandFloat(.5f, 2), RandFloat(.5f, 2))), Vector3D(RandFloat(-2, 2), RandFloat(-2, 2), RandFloat(-2, 2)),
+					Quaternion::FromAxisAngle(Vector3D(RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1)).Normalized(), RandFloat(0, 3)));
+				result = Gjk::Penetration(SupportMapping::OfBody(a), SupportMapping::OfBody(b));
+				ContactManifold manifold;
+				Assert::AreEqual(result.intersecting, Collision::Collide(a, b, manifold) > 0);
+				if (!result.intersecting)
+					continue;
+
+				b.position += result.normal * (result.depth + .001f);
+				Assert::IsFalse(Gjk::Distance(SupportMapping::OfBody(a), SupportMapping::OfBody(b)).intersecting);
+				b.position -= result.normal * .01f;
+				Assert::IsTrue(Gjk::Distance(SupportMapping::OfBody(a), SupportMapping::OfBody(b)).intersecting);
+			}
+		}
+
+		TEST_METHOD(WarmStartTest)
+		{
+			RigidBody a = Body(Shape::Box(Vector3D(1, .5f, 2)), Vector3D::Zero());
+			RigidBody b = Body(Shape::Box(Vector3D(.5f, 1, .5f)), Vector3D(3, 1, 0));
+			GjkCache cache;
+			int coldIterations = 0, warmIterations = 0;
+			for (int frame = 0; frame < 100; frame++)
+			{
+				a.orientation = Quaternion::FromAxisAngle(Vector3D::UnitY(), frame * .01f);
+				b.orientation = Quaternion::FromAxisAngle(Vector3D(1, 1, 0).Normalized(), frame * .02f);
+				b.position.z = frame * .01f;
+
+				GjkResult cold = Gjk::Distance(SupportMapping::OfBody(a), SupportMapping::OfBody(b));
+				GjkResult warm = Gjk::Distance(SupportMapping::OfBody(a), SupportMapping::OfBody(b), &cache);
+				AssertUtils::CloseEnough(cold.distance, warm.distance, .0001f);
+				coldIterations += cold.iterations;
+				warmIterations += warm.iterations;
+			}
+			Assert::IsTrue(warmIterations < coldIterations);
+		}
+
+		TEST_METHOD(Gjk2DTest)
+		{
+			Vector2D square[] = { Vector2D(-1, -1), Vector2D(1, -1), Vector2D(1, 1), Vector2D(-1, 1) };
+			Vector2D triangle[] = { Vector2D(3, 0), Vector2D(5, 2), Vector2D(5, -2) };
+			ConvexHull2D a = { square, 4 };
+			ConvexHull2D b = { triangle, 3 };
+			GjkResult2D result = Gjk::Distance(SupportMapping2D::OfPolytope(a), SupportMapping2D::OfPolytope(b));
+			Assert::IsFalse(result.intersecting);
+			AssertUtils::CloseEnough(result.distance, 2, .0001f);
+			AssertUtils::CloseEnough(result.normal, Vector2D::UnitX(), .0001f);
+
+			// A point with a radius is a circle.
+			Vector2D center[] = { Vector2D(1.5f, .5f) };
+			ConvexHull2D circle = { center, 1 };
+			result = Gjk::Penetration(SupportMapping2D::OfPolytope(a), SupportMapping2D::OfPolytope(circle, 1));
+			AssertUtils::CloseEnough(result.depth, .5f, .0001f);
+			AssertUtils::CloseEnough(result.normal, Vector2D::UnitX(), .0001f);
+
+			center[0] = Vector2D(.2f, .7f);
+			result = Gjk::Penetration(SupportMapping2D::OfPolytope(a), SupportMapping2D::OfPolytope(circle, .5f));
+			AssertUtils::CloseEnough(result.depth, .8f, .001f);
+			AssertUtils::CloseEnough(result.normal, Vector2D::UnitY(), .001f);
+
+			GjkCache2D cache;
+			for (int frame = 0; frame < 20; frame++)
+			{
+				center[0] = Vector2D(3, frame * .1f);
+				GjkResult2D cold = Gjk::Distance(SupportMapping2D::OfPolytope(a), SupportMapping2D::OfPolytope(circle));
+				GjkResult2D warm = Gjk::Distance(SupportMapping2D::OfPolytope(a), SupportMapping2D::OfPolytope(circle), &cache);
+				AssertUtils::CloseEnough(cold.distance, warm.distance, .0001f);
+				AssertUtils::CloseEnough(cold.pointA, warm.pointA, .0001f);
+			}
+		}
+	};
+}
\ No newline at end of file
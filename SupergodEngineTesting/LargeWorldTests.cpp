@@ -0,0 +1,113 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(LargeWorldTests)
+	{
+	private:
+		TEST_METHOD(Vector3DDoubleTest)
+		{
+			Vector3DDouble vector(1, 2, 3);
+			AssertUtils::AreEqual(vector + Vector3DDouble(1, 1, 1), Vector3DDouble(2, 3, 4));
+			AssertUtils::AreEqual(vector - Vector3DDouble(1, 1, 1), Vector3DDouble(0, 1, 2));
+			AssertUtils::AreEqual(-vector, Vector3DDouble(-1, -2, -3));
+			AssertUtils::AreEqual(vector * 2, Vector3DDouble(2, 4, 6));
+			AssertUtils::AreEqual(vector / 2, Vector3DDouble(.5, 1, 1.5));
+			Assert::AreEqual(vector.Dot(Vector3DDouble(1, 1, 1)), 6.0);
+			AssertUtils::AreEqual(Vector3DDouble(1, 0, 0).Cross(Vector3DDouble(0, 1, 0)), Vector3DDouble(0, 0, 1));
+			Assert::AreEqual(Vector3DDouble(3, 4, 0).Magnitude(), 5.0);
+			AssertUtils::AreEqual(vector.Lerp(Vector3DDouble(3, 4, 5), .5), Vector3DDouble(2, 3, 4));
+			AssertUtils::AreEqual((Vector3D)vector, Vector3D(1, 2, 3));
+		}
+
+		TEST_METHOD(PrecisionTest)
+		{
+			// 10,000 km away a float can't represent a millimeter offset, but the double path must keep it.
+			Vector3DDouble far(1e7, -1e7, 1e7);
+			Vector3DDouble offset(.001, .002, -.003);
+
+			FloatingOrigin floatingOrigin(far);
+			Vector3D local = floatingOrigin.ToLocal(far + offset);
+			AssertUtils::CloseEnough(local, Vector3D(.001f, .002f, -.003f), 1e-7f);
+			Assert::IsTrue(floatingOrigin.ToWorld(local).CloseEnough(far + offset, 1e-9));
+
+			Vector3D naive = (Vector3D)(far + offset) - (Vector3D)far;
+			AssertUtils::TooFar(naive, local, 1e-4f);
+		}
+
+		TEST_METHOD(Matrix3x3DoubleTest)
+		{
+			Test50([&](int i)
+			{
+				Matrix3x3 a(
+					RandFloat100(), RandFloat100(), RandFloat100(),
+					RandFloat100(), RandFloat100(), RandFloat100(),
+					RandFloat100(), RandFloat100(), RandFloat100());
+				Matrix3x3 b(
+					RandFloat100(), RandFloat100(), RandFloat100(),
+					RandFloat100(), RandFloat100(), RandFloat100(),
+					RandFloat100(), RandFloat100(), RandFloat100());
+				Vector3D vector(RandFloat100(), RandFloat100(), RandFloat100());
+
+				Matrix3x3Double aDouble(a);
+				Matrix3x3Double bDouble(b);
+
+				AssertUtils::CloseEnough((Matrix3x3)(aDouble * bDouble), a * b, .01f);
+				AssertUtils::CloseEnough((Vector3D)(aDouble * Vector3DDouble(vector)), a * vector, .01f);
+				AssertUtils::AreEqual((Matrix3x3)aDouble.Transposed(), a.Transposed());
+				AssertUtils::CloseEnough((float)aDouble.Determinant(), a.Determinant(), 1);
+				Assert::IsTrue((aDouble * aDouble.Inverted()).CloseEnough(Matrix3x3Double::Identity(), 1e-9));
+			});
+		}
+
+		TEST_METHOD(BatchConversionTest)
+		{
+			FloatingOrigin floatingOrigin(Vector3DDouble(123456789.5, -98765.25, 5e6));
+
+			// An odd count makes sure the remainder is converted as well as the batched part.
+			const size_t count = 13;
+			Vector3DDouble world[count];
+			Vector3D local[count];
+			Vector3DDouble back[count];
+			for (size_t i = 0; i < count; i++)
+				world[i] = floatingOrigin.origin + Vector3DDouble(RandFloat100(), RandFloat100(), RandFloat100());
+
+			floatingOrigin.ToLocal(world, local, count);
+			floatingOrigin.ToWorld(local, back, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(local[i], floatingOrigin.ToLocal(world[i]));
+				AssertUtils::AreEqual(back[i], floatingOrigin.ToWorld(local[i]));
+			}
+		}
+
+		TEST_METHOD(RebaseTest)
+		{
+			for (size_t count = 0; count < 20; count++)
+			{
+				FloatingOrigin floatingOrigin(Vector3DDouble(5e6, 5e6, -5e6));
+				Vector3DDouble newOrigin(5e6 + 1000.5, 5e6 - 250.25, -5e6 + 3);
+
+				std::vector<Vector3D> positions(count);
+				std::vector<Vector3DDouble> world(count);
+				for (size_t i = 0; i < count; i++)
+				{
+					positions[i] = Vector3D(RandFloat100(), RandFloat100(), RandFloat100());
+					world[i] = floatingOrigin.ToWorld(positions[i]);
+				}
+
+				floatingOrigin.Rebase(newOrigin, positions.data(), count);
+				AssertUtils::AreEqual(floatingOrigin.origin, newOrigin);
+
+				for (size_t i = 0; i < count; i++)
+					AssertUtils::AreEqual(positions[i], floatingOrigin.ToLocal(world[i]));
+			}
+
+			FloatingOrigin floatingOrigin;
+			Assert::IsFalse(floatingOrigin.ShouldRebase(Vector3DDouble(100, -100, 100), 1000));
+			Assert::IsTrue(floatingOrigin.ShouldRebase(Vector3DDouble(100, -1001, 100), 1000));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(LerpTests)
+	{
+	private:
+		TEST_METHOD(BatchedLerpTest)
+		{
+			// 11 values: two groups of 4 and a tail.
+			const size_t count = 11;
+			float alphas[count];
+			Vector2D sources2[count], targets2[count], vectors2[count];
+			Vector3D sources3[count], targets3[count], vectors3[count];
+			FColor sourceColors[count], targetColors[count], colors[count];
+			Angle sourceAngles[count], targetAngles[count], angles[count];
+			Matrix3x3 sourceMatrices[count], targetMatrices[count], matrices[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				alphas[i] = RandFloat(-.5f, 1.5f);
+				sources2[i] = Vector2D(RandFloat100(), RandFloat100());
+				targets2[i] = Vector2D(RandFloat100(), RandFloat100());
+				sources3[i] = Vector3D(RandFloat100(), RandFloat100(), RandFloat100());
+				targets3[i] = Vector3D(RandFloat100(), RandFloat100(), RandFloat100());
+				sourceColors[i] = FColor(RandFloat(), RandFloat(), RandFloat(), RandFloat());
+				targetColors[i] = FColor(RandFloat(), RandFloat(), RandFloat(), RandFloat());
+				sourceAngles[i] = Angle(RandFloat(0, Constants::TAU));
+				targetAngles[i] = Angle(RandFloat(0, Constants::TAU));
+				sourceMatrices[i] = Matrix3x3(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+				targetMatrices[i] = Matrix3x3(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+			}
+
+			Lerper::LerpN(sources2, targets2, alphas, vectors2, count);
+			Lerper::LerpN(sources3, targets3, alphas, vectors3, count);
+			Lerper::LerpN(sourceColors, targetColors, alphas, colors, count);
+			Lerper::LerpN(sourceAngles, targetAngles, alphas, angles, count);
+			Lerper::LerpN(sourceMatrices, targetMatrices, alphas, matrices, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::CloseEnough(vectors2[i], sources2[i].Lerp(targets2[i], alphas[i]), .0001f);
+				AssertUtils::CloseEnough(vectors3[i], sources3[i].Lerp(targets3[i], alphas[i]), .0001f);
+				AssertUtils::CloseEnough(colors[i], sourceColors[i].Lerp(targetColors[i], alphas[i]), .000001f);
+				AssertUtils::CloseEnough(angles[i], sourceAngles[i].Lerp(targetAngles[i], alphas[i]), .000001f);
+				AssertUtils::CloseEnough(matrices[i], sourceMatrices[i].Lerp(targetMatrices[i], alphas[i]), .0001f);
+			}
+
+			// Without clamping, the angles that go out of range are wrapped.
+			Lerper::LerpN(sourceAngles, targetAngles, alphas, angles, count, false);
+			for (size_t i = 0; i < count; i++)
+			{
+				Assert::IsTrue(angles[i].GetRadians() >= 0 && angles[i].GetRadians() <= Constants::TAU);
+				AssertUtils::CloseEnough(angles[i], sourceAngles[i].Lerp(targetAngles[i], alphas[i], false), .0001f);
+			}
+
+			// Alphas of 0 and 1 give exactly the sources and the targets, in place too.
+			Lerper::LerpN(sources3, targets3, 0.f, vectors3, count);
+			Lerper::LerpN(sourceColors, targetColors, 1.f, sourceColors, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::AreEqual(vectors3[i], sources3[i]);
+				AssertUtils::AreEqual(sourceColors[i], targetColors[i]);
+			}
+
+			// Clamping keeps a NaN alpha NaN, like Lerp does.
+			float nan = std::numeric_limits<float>::quiet_NaN();
+			Lerper::LerpN(sources3, targets3, nan, vectors3, count);
+			Assert::IsTrue(std::isnan(sources3[0].Lerp(targets3[0], nan).x));
+			for (size_t i = 0; i < count; i++)
+				Assert::IsTrue(std::isnan(vectors3[i].x) && std::isnan(vectors3[i].y) && std::isnan(vectors3[i].z));
+		}
+
+		TEST_METHOD(ShortestAngleLerpTest)
+		{
+			Angle from(350, Angle::Measurement::Degrees);
+			Angle to(10, Angle::Measurement::Degrees);
+			AssertUtils::CloseEnough(from.DeltaTo(to), 20 * Angle::DEG_TO_RAD, .00001f);
+			AssertUtils::CloseEnough(to.DeltaTo(from), -20 * Angle::DEG_TO_RAD, .00001f);
+			AssertUtils::CloseEnough(from.LerpShortest(to, .75f).GetDegrees(), 5, .001f);
+			AssertUtils::CloseEnough(from.LerpShortest(to, .25f).GetDegrees(), 355, .001f);
+			AssertUtils::CloseEnough(to.LerpShortest(from, .75f).GetDegrees(), 355, .001f);
+			AssertUtils::CloseEnough(from.LerpShortest(to, 2).GetDegrees(), 10, .001f);
+			AssertUtils::CloseEnough(from.LerpShortest(to, 2, false).GetDegrees(), 30, .001f);
+			Assert::AreEqual(Angle::Right().DeltaTo(Angle::Right()), 0.f);
+		}
+
+		TEST_METHOD(BatchedAngleTest)
+		{
+			const size_t count = 14;
+			Angle sources[count], targets[count], results[count];
+			float radians[count], alphas[count], sines[count], cosines[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				sources[i] = Angle(RandFloat(0, Constants::TAU));
+				targets[i] = Angle(RandFloat(0, Constants::TAU));
+				radians[i] = RandFloat(-20, 20);
+				alphas[i] = RandFloat(-.5f, 1.5f);
+			}
+
+			// Both ends of the range, and values more than a turn away from it.
+			radians[0] = 0;
+			radians[1] = Constants::TAU;
+			radians[2] = -1e-9f;
+			radians[3] = 3 * Constants::TAU + 1;
+
+			Angle::Wrap(radians, results, count);
+			for (size_t i = 0; i < count; i++)
+				AssertUtils::CloseEnough(results[i], Angle(radians[i]), .00001f);
+
+			Angle::Add(sources, radians, results, count);
+			for (size_t i = 0; i < count; i++)
+				AssertUtils::CloseEnough(results[i], Angle(sources[i].GetRadians() + radians[i]), .00001f);
+
+			Angle::LerpShortest(sources, targets, alphas, results, count);
+			for (size_t i = 0; i < count; i++)
+				AssertUtils::CloseEnough(results[i], sources[i].LerpShortest(targets[i], alphas[i]), .00001f);
+
+			Angle::LerpShortest(sources, targets, alphas, results, count, false);
+			for (size_t i = 0; i < count; i++)
+				AssertUtils::CloseEnough(results[i], sources[i].LerpShortest(targets[i], alphas[i], false), .00001f);
+
+			sources[0] = Angle::Zero();
+			sources[1] = Angle::Right();
+			sources[2] = Angle::Straight();
+			sources[3] = Angle::StraightAndHalf();
+			sources[4] = Angle(Constants::TAU);
+			Angle::SinCos(sources, sines, cosines, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				AssertUtils::CloseEnough(sines[i], SMath::Sin(sources[i]), .000001f);
+				AssertUtils::CloseEnough(cosines[i], SMath::Cos(sources[i]), .000001f);
+			}
+
+			Angle::SinCos(sources, nullptr, cosines, 3);
+			AssertUtils::CloseEnough(cosines[2], -1, .000001f);
+		}
+	};
+}
\ No newline at end of file
@@ -185,6 +185,22 @@ namespace SupergodEngineTesting
 			AssertUtils::AreEqual(matrix * vector, Vector2D(.5f, -.5f));
 		}
 
+		TEST_METHOD(RowAndColumnViewTest)
+		{
+			Matrix2x2 matrix = Matrix2x2(6, 8, 7, 9);
+			AssertUtils::AreEqual((Vector2D)matrix.GetRowView(1), Vector2D(7, 9));
+			AssertUtils::AreEqual((Vector2D)matrix.GetColumnView(1), Vector2D(8, 9));
+			Assert::AreEqual(matrix.GetColumnView(0).Dot(Vector2D(1, 2)), 20.f);
+
+			for (int i = 0; i < 100; i++)
+			{
+				Matrix2x2 random(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+				Vector2D vector(RandFloat100(), RandFloat100());
+				AssertUtils::AreEqual(vector * random, random.Transposed().Multiply(vector));
+				AssertUtils::AreEqual(random.LeftMultiply(vector), Vector2D(random.GetColumnView(0).Dot(vector), random.GetColumnView(1).Dot(vector)));
+			}
+		}
+
 		TEST_METHOD(AdditionSubtractionTests)
 		{
 			Matrix2x2 a = Matrix2x2(2, 3, 4, 10);
@@ -218,6 +218,32 @@ namespace SupergodEngineTesting
 			AssertUtils::AreEqual(second * second, Matrix3x3(77, 29, 37, 67, 24, 17, 53, 26, 68));
 			AssertUtils::AreEqual(first * second, Matrix3x3(37, 15, 17, 85, 36, 50, 133, 57, 83));
 		}
+
+		TEST_METHOD(RowAndColumnViewTest)
+		{
+			Matrix3x3 matrix = Matrix3x3(1, 2, 3, 4, 5, 6, 7, 8, 9);
+			AssertUtils::AreEqual((Vector3D)matrix.GetRowView(1), Vector3D(4, 5, 6));
+			AssertUtils::AreEqual((Vector3D)matrix.GetColumnView(2), Vector3D(3, 6, 9));
+			Assert::AreEqual(matrix.GetColumnView(0)[2], 7.f);
+			Assert::AreEqual(matrix.GetColumnView(1).Dot(Vector3D(1, 0, -1)), -6.f);
+
+			// Reading in place gives exactly what going through copies and transposes did.
+			for (int i = 0; i < 100; i++)
+			{
+				Matrix3x3 first(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+				Matrix3x3 second(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+				Vector3D vector(RandFloat100(), RandFloat100(), RandFloat100());
+				AssertUtils::AreEqual(vector * first, first.Transposed().Multiply(vector));
+
+				Matrix3x3 product = first * second;
+				for (int row = 0; row < 3; row++)
+				{
+					AssertUtils::AreEqual(second.GetColumn(row), second.Transposed().GetRow(row));
+					for (int column = 0; column < 3; column++)
+						Assert::AreEqual(product(row, column), first.GetRow(row).Dot(second.GetColumn(column)));
+				}
+			}
+		}
 		#pragma endregion
 
 		#pragma region Transformation tests.
@@ -266,6 +292,20 @@ namespace SupergodEngineTesting
 				));
 			});
 		}
+
+		TEST_METHOD(ConstexprTransformTest)
+		{
+			constexpr Matrix3x3 transform = Matrix3x3::Translate(Vector2D(3, 4)) * Matrix3x3::Rotate(Angle(90, Angle::Measurement::Degrees));
+			constexpr Vector3D point = transform * Vector3D(1, 0, 1);
+			static_assert(point.z == 1, "Baked transforms must be usable at compile time.");
+
+			AssertUtils::CloseEnough(point, Vector3D(3, 5, 1));
+			AssertUtils::CloseEnough(transform, Matrix3x3(
+				0, -1, 3,
+				1, 0, 4,
+				0, 0, 1
+			));
+		}
 		#pragma endregion
 
 		#pragma region Inverse, transpose, cofactor, adjugate, inverse, negated, trace and abs tests.
@@ -0,0 +1,160 @@
+#include "TestUtils.h"
+#include <algorithm>
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Geometry;
+
+	TEST_CLASS(MeshSimplifierTests)
+	{
+	private:
+		/// <summary>
+		/// Asserts that every triangle of indices faces away from the origin, and that every edge has exactly two triangles.
+		/// </summary>
+		static void AssertClosedAndFacingOut(const Mesh& mesh, const std::vector<uint>& indices)
+		{
+			std::vector<std::pair<uint, uint>> edges;
+			for (size_t triangle = 0; triangle < indices.size() / 3; triangle++)
+			{
+				const uint* corners = &indices[triangle * 3];
+				const Vector3D& a = mesh.positions[corners[0]];
+				const Vector3D& b = mesh.positions[corners[1]];
+				const Vector3D& c = mesh.positions[corners[2]];
+				Assert::IsTrue((b - a).Cross(c - a).Dot(a + b + c) > 0);
+				for (int corner = 0; corner < 3; corner++)
+					edges.push_back(std::make_pair(corners[corner], corners[(corner + 1) % 3]));
+			}
+
+			// Every directed edge must be there once, along with its opposite.
+			std::sort(edges.begin(), edges.end());
+			Assert::IsTrue(std::adjacent_find(edges.begin(), edges.end()) == edges.end());
+			for (const std::pair<uint, uint>& edge : edges)
+				Assert::IsTrue(std::binary_search(edges.begin(), edges.end(), std::make_pair(edge.second, edge.first)));
+		}
+
+	public:
+		TEST_METHOD(QuadricTest)
+		{
+			// The planes y = 1 and x = -2, one of them weighted twice.
+			Quadric quadric = Quadric::FromPlane(Vector3D::UnitY(), -1, 1).Add(Quadric::FromPlane(Vector3D::UnitX(), 2, 2));
+			AssertUtils::CloseEnough(quadric.Evaluate(Vector3D(0, 1, 0)), 8);
+			AssertUtils::CloseEnough(quadric.Evaluate(Vector3D(-2, 4, 7)), 9);
+			AssertUtils::CloseEnough(quadric.Evaluate(Vector3D(1, 3, 0)), 22);
+			AssertUtils::CloseEnough(quadric.Error(Vector3D(-2, 4, 7)), SMath::Sqrt(3));
+			AssertUtils::CloseEnough(Quadric().Error(Vector3D(1, 2, 3)), 0);
+		}
+
+		TEST_METHOD(FlatGridTest)
+		{
+			// Every vertex inside a flat grid can go without moving the surface, while the border stays as it is.
+			const int size = 16;
+			Mesh grid = MeshPrimitives::Grid(size);
+			MeshLod lod = MeshSimplifier::Simplify(grid, 0);
+			Assert::IsTrue(lod.indices.size() / 3 < grid.TriangleCount() / 8);
+			AssertUtils::CloseEnough(lod.error, 0);
+
+			float area = 0;
+			for (size_t triangle = 0; triangle < lod.indices.size() / 3; triangle++)
+			{
+				const uint* corners = &lod.indices[triangle * 3];
+				Vector3D normal = (grid.positions[corners[1]] - grid.positions[corners[0]]).Cross(grid.positions[corners[2]] - grid.positions[corners[0]]);
+				Assert::IsTrue(normal.y > 0);
+				area += normal.Magnitude() / 2;
+			}
+			AssertUtils::CloseEnough(area, size * size, .001f);
+
+			std::vector<bool> used(grid.VertexCount(), false);
+			for (uint vertex : lod.indices)
+				used[vertex] = true;
+			for (size_t vertex = 0; vertex < grid.VertexCount(); vertex++)
+			{
+				const Vector3D& position = grid.positions[vertex];
+				if (position.x == 0 || position.z == 0 || position.x == size || position.z == size)
+					Assert::IsTrue(used[vertex]);
+			}
+
+			// With no error allowed, a bump in the middle stays where it is while the flat parts go.
+			uint bump = (size + 1) * (size / 2) + size / 2;
+			grid.positions[bump].y = 1;
+			lod = MeshSimplifier::Simplify(grid, 0, 0);
+			Assert::IsTrue(std::find(lod.indices.begin(), lod.indices.end(), bump) != lod.indices.end());
+			Assert::IsTrue(lod.indices.size() / 3 < grid.TriangleCount() / 4);
+			AssertUtils::CloseEnough(lod.error, 0);
+		}
+
+		TEST_METHOD(SphereTest)
+		{
+			Mesh sphere = MeshPrimitives::Sphere(32, 64);
+			size_t target = sphere.TriangleCount() / 10;
+			MeshLod lod = MeshSimplifier::Simplify(sphere, target);
+			Assert::IsTrue(lod.indices.size() / 3 <= target && lod.indices.size() / 3 > target - 2);
+			Assert::IsTrue(lod.error > 0 && lod.error < .05f);
+			AssertClosedAndFacingOut(sphere, lod.indices);
+
+			// Every vertex that is left is still on the sphere, so the surface can't be further from it than the error allows for.
+			MeshLod limited = MeshSimplifier::Simplify(sphere, 0, .01f);
+			Assert::IsTrue(limited.indices.size() / 3 > target && limited.error <= .01f);
+			AssertClosedAndFacingOut(sphere, limited.indices);
+		}
+
+		TEST_METHOD(SeamTest)
+		{
+			// Split the vertices of the sphere at a seam along a meridian, like a seam of the texture coordinates.
+			const int rings = 16, segments = 32;
+			Mesh sphere = MeshPrimitives::Sphere(rings, segments);
+			std::vector<uint> seam;
+			for (int ring = 1; ring < rings; ring++)
+			{
+				uint vertex = (uint)(1 + (ring - 1) * segments);
+				seam.push_back(vertex);
+				sphere.AddVertex(sphere.positions[vertex]);
+			}
+			for (size_t triangle = 0; triangle < sphere.TriangleCount(); triangle++)
+			{
+				uint* corners = &sphere.indices[triangle * 3];
+				bool pastSeam = false;
+				for (int corner = 0; corner < 3; corner++)
+					pastSeam |= sphere.positions[corners[corner]].z < -.0001f;
+				for (int corner = 0; corner < 3 && pastSeam; corner++)
+				{
+					auto split = std::find(seam.begin(), seam.end(), corners[corner]);
+					if (split != seam.end())
+						corners[corner] = (uint)(sphere.VertexCount() - seam.size() + (split - seam.begin()));
+				}
+			}
+
+			MeshLod lod = MeshSimplifier::Simplify(sphere, sphere.TriangleCount() / 10);
+			std::vector<bool> used(sphere.VertexCount(), false);
+			for (uint vertex : lod.indices)
+				used[vertex] = true;
+			for (size_t i = 0; i < seam.size(); i++)
+			{
+				Assert::IsTrue(used[seam[i]]);
+				Assert::IsTrue(used[sphere.VertexCount() - seam.size() + i]);
+			}
+		}
+
+		TEST_METHOD(GenerateLodsTest)
+		{
+			float ratios[] = { .5f, .25f, .1f };
+			Mesh meshes[] = { MeshPrimitives::Sphere(24, 48), MeshPrimitives::Grid(20), MeshPrimitives::Sphere(16, 24) };
+			std::vector<MeshLod> single[3], multithreaded[3];
+			MeshSimplifier::GenerateLods(meshes, 3, ratios, 3, single, false);
+			MeshSimplifier::GenerateLods(meshes, 3, ratios, 3, multithreaded, true);
+
+			for (int mesh = 0; mesh < 3; mesh++)
+			{
+				Assert::AreEqual(single[mesh].size(), (size_t)3);
+				for (int lod = 0; lod < 3; lod++)
+				{
+					Assert::IsTrue(single[mesh][lod].indices == multithreaded[mesh][lod].indices);
+					Assert::IsTrue(single[mesh][lod].indices.size() / 3 <= (size_t)(meshes[mesh].TriangleCount() * ratios[lod]) || mesh == 1);
+					if (lod > 0)
+						Assert::IsTrue(single[mesh][lod].error >= single[mesh][lod - 1].error);
+				}
+			}
+			AssertClosedAndFacingOut(meshes[0], single[0][2].indices);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "TestUtils.h"
+#include <algorithm>
+#include <array>
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Geometry;
+
+	TEST_CLASS(MeshTests)
+	{
+	private:
+		typedef std::array<float, 9> TrianglePositions;
+
+		/// <summary>
+		/// Creates a flat grid of size by size quads with three unshared vertices for every triangle, with the triangles shuffled.
+		/// </summary>
+		static Mesh ShuffledGrid(int size)
+		{
+			Mesh mesh;
+			for (int z = 0; z < size; z++)
+			{
+				for (int x = 0; x < size; x++)
+				{
+					Vector3D corners[] = { Vector3D((float)x, 0, (float)z), Vector3D(x + 1.f, 0, (float)z), Vector3D((float)x, 0, z + 1.f), Vector3D(x + 1.f, 0, z + 1.f) };
+					int triangles[] = { 0, 2, 1, 1, 2, 3 };
+					for (int corner : triangles)
+						mesh.AddVertex(corners[corner], Vector3D::UnitY(), Vector2D(corners[corner].x / size, corners[corner].z / size));
+				}
+			}
+
+			std::vector<uint> order(mesh.VertexCount() / 3);
+			for (size_t i = 0; i < order.size(); i++)
+				order[i] = (uint)i;
+			std::shuffle(order.begin(), order.end(), std::mt19937(5));
+			for (uint triangle : order)
+				mesh.AddTriangle(triangle * 3, triangle * 3 + 1, triangle * 3 + 2);
+			return mesh;
+		}
+
+		/// <summary>
+		/// Gets the positions of all the triangles of mesh, every triangle starting at its smallest corner so the winding stays, sorted.
+		/// </summary>
+		static std::vector<TrianglePositions> SortedTriangles(const Mesh& mesh)
+		{
+			std::vector<TrianglePositions> triangles;
+			for (size_t triangle = 0; triangle < mesh.TriangleCount(); triangle++)
+			{
+				std::array<std::array<float, 3>, 3> corners;
+				for (int corner = 0; corner < 3; corner++)
+				{
+					const Vector3D& position = mesh.positions[mesh.indices[triangle * 3 + corner]];
+					corners[corner] = { position.x, position.y, position.z };
+				}
+				std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+
+				TrianglePositions positions;
+				for (int i = 0; i < 9; i++)
+					positions[i] = corners[i / 3][i % 3];
+				triangles.push_back(positions);
+			}
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+
+	public:
+		TEST_METHOD(AverageCacheMissRatioTest)
+		{
+			uint triangle[] = { 0, 1, 2 };
+			AssertUtils::CloseEnough(MeshOptimizer::AverageCacheMissRatio(triangle, 3), 3);
+
+			uint quad[] = { 0, 1, 2, 2, 1, 3 };
+			AssertUtils::CloseEnough(MeshOptimizer::AverageCacheMissRatio(quad, 6), 2);
+
+			// With a cache of 3, vertex 0 is pushed out by the time the last triangle uses it again.
+			uint fan[] = { 0, 1, 2, 3, 4, 5, 0, 4, 5 };
+			AssertUtils::CloseEnough(MeshOptimizer::AverageCacheMissRatio(fan, 9, 3), 7 / 3.f);
+			AssertUtils::CloseEnough(MeshOptimizer::AverageCacheMissRatio(fan, 9, 6), 2);
+		}
+
+		TEST_METHOD(DeduplicateTest)
+		{
+			Mesh mesh = ShuffledGrid(10);
+			std::vector<TrianglePositions> triangles = SortedTriangles(mesh);
+			Assert::AreEqual((size_t)600, mesh.VertexCount());
+
+			Assert::AreEqual((size_t)121, MeshOptimizer::Deduplicate(mesh));
+			Assert::AreEqual((size_t)121, mesh.VertexCount());
+			Assert::AreEqual((size_t)121, mesh.normals.size());
+			Assert::AreEqual((size_t)121, mesh.uvs.size());
+			Assert::IsTrue(triangles == SortedTriangles(mesh));
+
+			// Vertices with the same position and different texture coordinates stay apart.
+			mesh.uvs[0] = Vector2D(5, 5);
+			mesh.AddVertex(mesh.positions[0], mesh.normals[0], Vector2D(6, 6));
+			mesh.AddVertex(mesh.positions[0], mesh.normals[0], Vector2D(5, 5));
+			Assert::AreEqual((size_t)122, MeshOptimizer::Deduplicate(mesh));
+		}
+
+		TEST_METHOD(OptimizeVertexCacheTest)
+		{
+			Mesh mesh = ShuffledGrid(32);
+			MeshOptimizer::Deduplicate(mesh);
+			std::vector<TrianglePositions> triangles = SortedTriangles(mesh);
+			float before = MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size());
+
+			MeshOptimizer::OptimizeVertexCache(mesh);
+			float after = MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size());
+			Assert::IsTrue(triangles == SortedTriangles(mesh));
+			Assert::IsTrue(before > 2);
+			Assert::IsTrue(after < .8f);
+
+			// Degenerate triangles are kept as well.
+			mesh.AddTriangle(0, 0, 1);
+			MeshOptimizer::OptimizeVertexCache(mesh);
+			Assert::AreEqual(triangles.size() + 1, mesh.TriangleCount());
+		}
+
+		TEST_METHOD(OptimizeOverdrawTest)
+		{
+			// A closed box: every side should end up as its own cluster, in any order.
+			Mesh mesh;
+			for (int side = 0; side < 6; side++)
+			{
+				int axis = side / 2;
+				float sign = side % 2 ? 1.f : -1.f;
+				for (int v = 0; v <= 8; v++)
+				{
+					for (int u = 0; u <= 8; u++)
+					{
+						Vector3D position;
+						position[axis] = sign;
+						position[(axis + 1) % 3] = u / 4.f - 1;
+						position[(axis + 2) % 3] = v / 4.f - 1;
+						mesh.AddVertex(position);
+					}
+				}
+				uint first = side * 81;
+				for (uint v = 0; v < 8; v++)
+				{
+					for (uint u = 0; u < 8; u++)
+					{
+						uint corner = first + v * 9 + u;
+						mesh.AddTriangle(corner, corner + 1, corner + 9);
+						mesh.AddTriangle(corner + 1, corner + 10, corner + 9);
+					}
+				}
+			}
+
+			MeshOptimizer::OptimizeVertexCache(mesh);
+			std::vector<TrianglePositions> triangles = SortedTriangles(mesh);
+			float before = MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size());
+
+			MeshOptimizer::OptimizeOverdraw(mesh);
+			Assert::IsTrue(triangles == SortedTriangles(mesh));
+			Assert::IsTrue(MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size()) <= before * 1.1f);
+
+			// A degenerate first triangle misses only 2 vertices, and the triangles before the first full miss must still be kept.
+			Mesh degenerate;
+			degenerate.positions = mesh.positions;
+			degenerate.AddTriangle(0, 0, 1);
+			degenerate.indices.insert(degenerate.indices.end(), mesh.indices.begin(), mesh.indices.end());
+			triangles = SortedTriangles(degenerate);
+			MeshOptimizer::OptimizeOverdraw(degenerate);
+			Assert::AreEqual(degenerate.TriangleCount(), mesh.TriangleCount() + 1);
+			Assert::IsTrue(triangles == SortedTriangles(degenerate));
+		}
+
+		TEST_METHOD(OptimizeVertexFetchTest)
+		{
+			Mesh mesh = ShuffledGrid(8);
+			MeshOptimizer::Deduplicate(mesh);
+			MeshOptimizer::OptimizeVertexCache(mesh);
+			std::vector<TrianglePositions> triangles = SortedTriangles(mesh);
+
+			// A vertex no triangle uses is removed.
+			mesh.AddVertex(Vector3D(100, 100, 100), Vector3D::UnitY(), Vector2D());
+			Assert::AreEqual((size_t)81, MeshOptimizer::OptimizeVertexFetch(mesh));
+			Assert::AreEqual((size_t)81, mesh.VertexCount());
+			Assert::IsTrue(triangles == SortedTriangles(mesh));
+
+			// Every index is at most one more than the biggest one before it.
+			uint next = 0;
+			for (uint index : mesh.indices)
+			{
+				Assert::IsTrue(index <= next);
+				if (index == next)
+					next++;
+			}
+		}
+
+		TEST_METHOD(OptimizeTest)
+		{
+			Mesh mesh = ShuffledGrid(16);
+			std::vector<TrianglePositions> triangles = SortedTriangles(mesh);
+			MeshOptimizer::Optimize(mesh);
+			Assert::AreEqual((size_t)289, mesh.VertexCount());
+			Assert::IsTrue(triangles == SortedTriangles(mesh));
+			Assert::IsTrue(MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size()) < .9f);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "TestUtils.h"
+#include <algorithm>
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Network;
+
+	TEST_CLASS(NetworkTests)
+	{
+	private:
+		static Quaternion RandRotation()
+		{
+			return Quaternion::FromAxisAngle(Vector3D(RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(-1, 1) + 2).Normalized(), RandFloat(-3, 3));
+		}
+
+		static void AssertSameSnapshots(const QuantizedSnapshot& a, const QuantizedSnapshot& b)
+		{
+			Assert::IsTrue(a.positions == b.positions);
+			Assert::IsTrue(a.rotations == b.rotations);
+		}
+
+	public:
+		TEST_METHOD(BitStreamTest)
+		{
+			std::mt19937 random(7);
+			std::vector<uint> values, bits;
+			BitWriter writer;
+			for (int i = 0; i < 1000; i++)
+			{
+				bits.push_back(random() % 33);
+				values.push_back(bits.back() == 32 ? (uint)random() : (uint)random() & ((1u << bits.back()) - 1));
+				writer.Write(values.back(), bits.back());
+			}
+			size_t bitCount = writer.GetBitCount();
+			writer.Flush();
+			Assert::AreEqual(writer.GetBytes().size(), (bitCount + 7) / 8);
+
+			BitReader reader(writer.GetBytes().data(), writer.GetBytes().size());
+			for (int i = 0; i < 1000; i++)
+				Assert::AreEqual(reader.Read(bits[i]), values[i]);
+			Assert::IsFalse(reader.HasOverflowed());
+
+			// Only the padding is left, so anything bigger than it overflows.
+			reader.Read((uint)reader.GetBitsLeft());
+			Assert::IsFalse(reader.HasOverflowed());
+			Assert::AreEqual(reader.Read(1), 0u);
+			Assert::IsTrue(reader.HasOverflowed());
+		}
+
+		TEST_METHOD(DeltaTest)
+		{
+			std::mt19937 random(11);
+			BitWriter writer;
+			std::vector<uint> values, baselines, bits;
+			for (int i = 0; i < 2000; i++)
+			{
+				bits.push_back(1 + random() % 32);
+				uint mask = bits.back() == 32 ? 0xffffffff : (1u << bits.back()) - 1;
+				baselines.push_back(random() & mask);
+
+				// Half of the values are close to their baselines.
+				values.push_back(i % 2 == 0 ? random() & mask : (baselines.back() + random() % 600 - 300) & mask);
+				writer.WriteDelta(values.back(), baselines.back(), bits.back());
+			}
+			writer.Flush();
+
+			BitReader reader(writer.GetBytes().data(), writer.GetBytes().size());
+			for (int i = 0; i < 2000; i++)
+				Assert::AreEqual(reader.ReadDelta(baselines[i], bits[i]), values[i]);
+			Assert::IsFalse(reader.HasOverflowed());
+
+			BitWriter sizes;
+			sizes.WriteDelta(1234, 1234, 20);
+			Assert::AreEqual(sizes.GetBitCount(), (size_t)1);
+			sizes.WriteDelta(1230, 1234, 20);
+			Assert::AreEqual(sizes.GetBitCount(), (size_t)(1 + 6));
+
+			// Across the wrap, 0 is right after the biggest value.
+			sizes.Clear();
+			sizes.WriteDelta(0, 65535, 16);
+			Assert::AreEqual(sizes.GetBitCount(), (size_t)6);
+		}
+
+		TEST_METHOD(QuantizationTest)
+		{
+			Quantization quantization(-500, 1500, 16);
+			std::vector<float> values;
+			for (int i = 0; i < 1003; i++)
+				values.push_back(RandFloat(-600, 1600));
+
+			std::vector<uint> quantized(values.size());
+			std::vector<float> dequantized(values.size());
+			quantization.Quantize(values.data(), quantized.data(), values.size());
+			quantization.Dequantize(quantized.data(), dequantized.data(), values.size());
+			for (size_t i = 0; i < values.size(); i++)
+			{
+				Assert::AreEqual(quantized[i], quantization.Quantize(values[i]));
+				Assert::AreEqual(dequantized[i], quantization.Dequantize(quantized[i]));
+				Assert::IsTrue(quantized[i] <= 65535);
+				float clamped = SMath::Clamp(values[i], -500, 1500);
+				Assert::IsTrue(std::abs(dequantized[i] - clamped) <= quantization.GetPrecision() * .5f + .001f);
+			}
+			Assert::AreEqual(quantization.Dequantize(0), -500.f);
+			AssertUtils::CloseEnough(quantization.Dequantize(65535), 1500.f, .01f);
+
+			// With 23 and 24 bits, max times the scale rounds up past the biggest value, which must not wrap around to 0.
+			for (uint bits : { 23u, 24u })
+			{
+				Quantization precise(-740, 34.98f, bits);
+				uint biggest = (1u << bits) - 1;
+				float maxes[] = { 34.98f, 34.98f, 34.98f, 34.98f, 34.98f };
+				uint bulk[5];
+				precise.Quantize(maxes, bulk, 5);
+				Assert::AreEqual(precise.Quantize(34.98f), biggest);
+				for (uint value : bulk)
+					Assert::AreEqual(value, biggest);
+				AssertUtils::CloseEnough(precise.Dequantize(biggest), 34.98f, .001f);
+			}
+		}
+
+		TEST_METHOD(AngleQuantizationTest)
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				Angle angle(RandFloat(0, Constants::TAU));
+				Angle dequantized = AngleQuantization::Dequantize(AngleQuantization::Quantize(angle, 12), 12);
+				float difference = std::abs(dequantized.GetRadians() - angle.GetRadians());
+				Assert::IsTrue(SMath::Min(difference, Constants::TAU - difference) <= Constants::TAU / 4096 * .51f);
+			}
+			Assert::AreEqual(AngleQuantization::Quantize(Angle(Constants::TAU - .0001f), 12), 0u);
+			Assert::AreEqual(AngleQuantization::Quantize(Angle(Constants::PI), 12), 2048u);
+		}
+
+		TEST_METHOD(SmallestThreeTest)
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				Quaternion rotation = RandRotation();
+				uint packed = SmallestThree::Pack(rotation);
+				Assert::IsTrue(packed >> SmallestThree::GetPackedBits(SmallestThree::DEFAULT_COMPONENT_BITS) == 0);
+
+				// q and -q are the same rotation.
+				Quaternion unpacked = SmallestThree::Unpack(packed);
+				Assert::IsTrue(std::abs(unpacked.Dot(rotation)) > .99999f);
+				AssertUtils::CloseEnough(unpacked.Rotate(Vector3D(1, 2, 3)), rotation.Rotate(Vector3D(1, 2, 3)), .01f);
+				Assert::AreEqual(SmallestThree::Pack(Quaternion(-rotation.x, -rotation.y, -rotation.z, -rotation.w)), packed);
+
+				// Packing it again gives the same bits, unless the two biggest components are too close to tell which one is left out.
+				float magnitudes[] = { std::abs(rotation.x), std::abs(rotation.y), std::abs(rotation.z), std::abs(rotation.w) };
+				std::sort(magnitudes, magnitudes + 4);
+				if (magnitudes[3] - magnitudes[2] > .01f)
+					Assert::AreEqual(SmallestThree::Pack(unpacked), packed);
+			}
+		}
+
+		TEST_METHOD(SnapshotTest)
+		{
+			SnapshotCodec codec(SnapshotSettings(Vector3D(-1000, -100, -1000), Vector3D(1000, 100, 1000)));
+			std::vector<Vector3D> positions;
+			std::vector<Quaternion> rotations;
+			for (int i = 0; i < 101; i++)
+			{
+				positions.push_back(Vector3D(RandFloat(-1000, 1000), RandFloat(-100, 100), RandFloat(-1000, 1000)));
+				rotations.push_back(RandRotation());
+			}
+
+			QuantizedSnapshot baseline;
+			codec.Quantize(positions.data(), rotations.data(), positions.size(), baseline);
+			std::vector<Vector3D> dequantizedPositions(positions.size());
+			std::vector<Quaternion> dequantizedRotations(positions.size());
+			codec.Dequantize(baseline, dequantizedPositions.data(), dequantizedRotations.data());
+			for (size_t i = 0; i < positions.size(); i++)
+			{
+				AssertUtils::CloseEnough(dequantizedPositions[i], positions[i], .01f);
+				Assert::IsTrue(std::abs(dequantizedRotations[i].Dot(rotations[i])) > .99999f);
+			}
+
+			// Every third entity moves a little, and 2 new ones show up.
+			for (size_t i = 0; i < positions.size(); i += 3)
+			{
+				positions[i] += Vector3D(.1f, 0, -.05f);
+				rotations[i] = (rotations[i] * Quaternion::FromAxisAngle(Vector3D::UnitY(), .01f)).Normalized();
+			}
+			positions.push_back(Vector3D(1, 2, 3));
+			positions.push_back(Vector3D(-4, 5, -6));
+			rotations.push_back(Quaternion::Identity());
+			rotations.push_back(RandRotation());
+			QuantizedSnapshot snapshot;
+			codec.Quantize(positions.data(), rotations.data(), positions.size(), snapshot);
+
+			BitWriter full, delta;
+			codec.Encode(snapshot, nullptr, full);
+			codec.Encode(snapshot, &baseline, delta);
+			full.Flush();
+			delta.Flush();
+			Assert::AreEqual(full.GetBitCount(), (size_t)(32 + 103 * (3 * 18 + 32)));
+			Assert::IsTrue(delta.GetBitCount() * 4 < full.GetBitCount());
+
+			QuantizedSnapshot decoded;
+			BitReader fullReader(full.GetBytes().data(), full.GetBytes().size());
+			Assert::IsTrue(codec.Decode(fullReader, nullptr, decoded));
+			AssertSameSnapshots(decoded, snapshot);
+
+			BitReader deltaReader(delta.GetBytes().data(), delta.GetBytes().size());
+			Assert::IsTrue(codec.Decode(deltaReader, &baseline, decoded));
+			AssertSameSnapshots(decoded, snapshot);
+
+			BitReader cutReader(delta.GetBytes().data(), delta.GetBytes().size() / 2);
+			Assert::IsFalse(codec.Decode(cutReader, &baseline, decoded));
+
+			// With 23 bits, the top of this box scales to exactly halfway past the biggest value. It still gets the biggest value, in the SSE2 loop and after it.
+			SnapshotCodec precise(SnapshotSettings(Vector3D(-740, -740, -740), Vector3D(34.98f, 34.98f, 34.98f), 23));
+			std::vector<Vector3D> corners(5, Vector3D(34.98f, 34.98f, 34.98f));
+			std::vector<Quaternion> identities(5, Quaternion::Identity());
+			precise.Quantize(corners.data(), identities.data(), corners.size(), snapshot);
+			for (uint value : snapshot.positions)
+				Assert::AreEqual(value, (1u << 23) - 1);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(PackingTests)
+	{
+	private:
+		TEST_METHOD(HalfConversionTest)
+		{
+			Assert::AreEqual(Half(1).bits, (ushort)0x3c00);
+			Assert::AreEqual(Half(-2).bits, (ushort)0xc000);
+			Assert::AreEqual(Half(.1f).bits, (ushort)0x2e66);
+			Assert::AreEqual(Half(65504).bits, (ushort)0x7bff);
+			Assert::AreEqual(Half(65520).bits, (ushort)0x7c00);
+			Assert::AreEqual(Half(5.9604645e-8f).bits, (ushort)0x0001);
+			Assert::AreEqual(Half(1e-8f).bits, (ushort)0);
+			Assert::IsTrue(Half(std::numeric_limits<float>::quiet_NaN()).IsNaN());
+
+			// Ties round to even.
+			Assert::AreEqual(Half(1 + 1 / 2048.f).bits, (ushort)0x3c00);
+			Assert::AreEqual(Half(1 + 3 / 2048.f).bits, (ushort)0x3c02);
+
+			// Every half converts to a float and back without changing.
+			for (uint bits = 0; bits <= 0xffff; bits++)
+			{
+				Half half = Half::FromBits((ushort)bits);
+				if (!half.IsNaN())
+					Assert::AreEqual(Half((float)half).bits, half.bits);
+			}
+
+			Assert::AreEqual((float)Half::One(), 1.f);
+			Assert::AreEqual((float)Half::Max(), 65504.f);
+		}
+
+		TEST_METHOD(HalfBulkTest)
+		{
+			const size_t count = 37;
+			float source[count];
+			Half packed[count];
+			float unpacked[count];
+			for (size_t i = 0; i < count; i++)
+				source[i] = RandFloat(-70000, 70000) * SMath::Pow(10, RandFloat(-10, 0));
+
+			Half::Pack(source, packed, count);
+			Half::Unpack(packed, unpacked, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				Assert::AreEqual(packed[i].bits, Half::FloatToBits(source[i]));
+				Assert::AreEqual(unpacked[i], Half::BitsToFloat(packed[i].bits));
+			}
+		}
+
+		TEST_METHOD(HalfVectorsTest)
+		{
+			Vector3D vectors[5];
+			FColor colors[5];
+			for (int i = 0; i < 5; i++)
+			{
+				vectors[i] = Vector3D(RandFloat100(), RandFloat100(), RandFloat100());
+				colors[i] = FColor(RandFloat(), RandFloat(), RandFloat(), RandFloat());
+			}
+
+			Vector3DHalf packedVectors[5];
+			Vector4DHalf packedColors[5];
+			Vector3DHalf::Pack(vectors, packedVectors, 5);
+			Vector4DHalf::Pack(colors, packedColors, 5);
+
+			Vector3D unpackedVectors[5];
+			FColor unpackedColors[5];
+			Vector3DHalf::Unpack(packedVectors, unpackedVectors, 5);
+			Vector4DHalf::Unpack(packedColors, unpackedColors, 5);
+
+			for (int i = 0; i < 5; i++)
+			{
+				AssertUtils::AreEqual(packedVectors[i], Vector3DHalf(vectors[i]));
+				AssertUtils::AreEqual(packedColors[i], Vector4DHalf(colors[i]));
+				AssertUtils::CloseEnough(unpackedVectors[i], vectors[i], .05f);
+				AssertUtils::CloseEnough(unpackedColors[i], colors[i], .001f);
+			}
+		}
+
+		TEST_METHOD(NormalizedIntTest)
+		{
+			Assert::AreEqual(NormalizedInt::PackUnorm8(1), (byte)255);
+			Assert::AreEqual(NormalizedInt::PackUnorm8(2), (byte)255);
+			Assert::AreEqual(NormalizedInt::PackUnorm8(-1), (byte)0);
+			Assert::AreEqual(NormalizedInt::PackUnorm8(.5f), (byte)128);
+			Assert::AreEqual(NormalizedInt::PackUnorm16(1), (ushort)65535);
+			Assert::AreEqual(NormalizedInt::PackSnorm8(-1), (sbyte)-127);
+			Assert::AreEqual(NormalizedInt::PackSnorm16(-2), (short)-32767);
+			Assert::AreEqual(NormalizedInt::UnpackSnorm8(-128), -1.f);
+			Assert::AreEqual(NormalizedInt::UnpackUnorm16(65535), 1.f);
+
+			const size_t count = 45;
+			float source[count];
+			for (size_t i = 0; i < count; i++)
+				source[i] = RandFloat(-1.5f, 1.5f);
+
+			byte unorm8[count];
+			ushort unorm16[count];
+			sbyte snorm8[count];
+			short snorm16[count];
+			NormalizedInt::PackUnorm8(source, unorm8, count);
+			NormalizedInt::PackUnorm16(source, unorm16, count);
+			NormalizedInt::PackSnorm8(source, snorm8, count);
+			NormalizedInt::PackSnorm16(source, snorm16, count);
+
+			float unpackedUnorm8[count], unpackedUnorm16[count], unpackedSnorm8[count], unpackedSnorm16[count];
+			NormalizedInt::UnpackUnorm8(unorm8, unpackedUnorm8, count);
+			NormalizedInt::UnpackUnorm16(unorm16, unpackedUnorm16, count);
+			NormalizedInt::UnpackSnorm8(snorm8, unpackedSnorm8, count);
+			NormalizedInt::UnpackSnorm16(snorm16, unpackedSnorm16, count);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				Assert::AreEqual(unorm8[i], NormalizedInt::PackUnorm8(source[i]));
+				Assert::AreEqual(unorm16[i], NormalizedInt::PackUnorm16(source[i]));
+				Assert::AreEqual(snorm8[i], NormalizedInt::PackSnorm8(source[i]));
+				Assert::AreEqual(snorm16[i], NormalizedInt::PackSnorm16(source[i]));
+
+				Assert::AreEqual(unpackedUnorm8[i], NormalizedInt::UnpackUnorm8(unorm8[i]));
+				Assert::AreEqual(unpackedUnorm16[i], NormalizedInt::UnpackUnorm16(unorm16[i]));
+				Assert::AreEqual(unpackedSnorm8[i], NormalizedInt::UnpackSnorm8(snorm8[i]));
+				Assert::AreEqual(unpackedSnorm16[i], NormalizedInt::UnpackSnorm16(snorm16[i]));
+
+				AssertUtils::CloseEnough(unpackedUnorm8[i], SMath::Clamp(source[i], 0, 1), .5f / 255);
+				AssertUtils::CloseEnough(unpackedSnorm16[i], SMath::Clamp(source[i], -1, 1), .5f / 32767);
+			}
+		}
+
+		TEST_METHOD(OctahedralNormalTest)
+		{
+			Vector3D axes[] = { Vector3D::UnitX(), Vector3D::UnitY(), Vector3D::UnitZ(), -Vector3D::UnitX(), -Vector3D::UnitY(), -Vector3D::UnitZ() };
+			for (const Vector3D& axis : axes)
+				AssertUtils::CloseEnough((Vector3D)OctahedralNormal(axis), axis, .0001f);
+
+			const size_t count = 23;
+			Vector3D normals[count];
+			for (size_t i = 0; i < count; i++)
+				normals[i] = Vector3D(RandFloat100(), RandFloat100(), RandFloat100()).Normalized();
+
+			OctahedralNormal packed[count];
+			Vector3D unpacked[count];
+			OctahedralNormal::Pack(normals, packed, count);
+			OctahedralNormal::Unpack(packed, unpacked, count);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				// The scalar functions may be contracted into fused multiply-adds, so they can be a rounding away from the bulk functions.
+				AssertUtils::CloseEnough((Vector3D)packed[i], (Vector3D)OctahedralNormal(normals[i]), .0001f);
+				AssertUtils::CloseEnough(unpacked[i], (Vector3D)packed[i], .000001f);
+				AssertUtils::CloseEnough(unpacked[i].Magnitude(), 1, .0001f);
+				AssertUtils::CloseEnough(unpacked[i], normals[i], .0001f);
+			}
+		}
+	};
+}
\ No newline at end of file
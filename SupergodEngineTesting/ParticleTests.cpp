@@ -0,0 +1,187 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Physics;
+
+	TEST_CLASS(ParticleTests)
+	{
+	private:
+		/// <summary>
+		/// Fills buffer with count random particles, every 5th one with an infinite mass.
+		/// </summary>
+		static void AddRandomParticles(ParticleBuffer& buffer, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				Vector3D position(RandFloat100(), RandFloat100(), RandFloat100());
+				Vector3D velocity(RandFloat(-10, 10), RandFloat(-10, 10), RandFloat(-10, 10));
+				buffer.Add(position, velocity, i % 5 == 0 ? 0 : RandFloat(.1f, 4), 1 / 60.f);
+			}
+		}
+
+		TEST_METHOD(SemiImplicitEulerTest)
+		{
+			// 11 particles: two groups of 4 and a tail.
+			const size_t count = 11;
+			const Vector3D gravity(0, -9.81f, 0);
+			const float linear = .1f, quadratic = .05f, deltaTime = 1 / 60.f;
+
+			ParticleBuffer buffer;
+			AddRandomParticles(buffer, count);
+			ParticleStreams particles = buffer.GetStreams();
+
+			Vector3D positions[count], velocities[count];
+			for (size_t i = 0; i < count; i++)
+			{
+				positions[i] = particles.GetPosition(i);
+				velocities[i] = particles.GetVelocity(i);
+			}
+
+			Particles::ClearForces(particles);
+			Particles::AddGravity(particles, gravity);
+			Particles::AddDrag(particles, linear, quadratic);
+			Particles::SemiImplicitEuler(particles, deltaTime);
+
+			// The same operations one particle at a time.
+			for (size_t i = 0; i < count; i++)
+			{
+				float inverseMass = particles.inverseMass[i];
+				float mass = inverseMass > 0 ? 1 / inverseMass : 0;
+				Vector3D& v = velocities[i];
+				float drag = linear + quadratic * std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+				Vector3D force(gravity.x * mass - drag * v.x, gravity.y * mass - drag * v.y, gravity.z * mass - drag * v.z);
+
+				float impulseScale = inverseMass * deltaTime;
+				v = Vector3D(v.x + force.x * impulseScale, v.y + force.y * impulseScale, v.z + force.z * impulseScale);
+				positions[i] = Vector3D(positions[i].x + v.x * deltaTime, positions[i].y + v.y * deltaTime, positions[i].z + v.z * deltaTime);
+
+				AssertUtils::CloseEnough(particles.GetVelocity(i), v, .0001f);
+				AssertUtils::CloseEnough(particles.GetPosition(i), positions[i], .0001f);
+			}
+		}
+
+		TEST_METHOD(MultithreadedTest)
+		{
+			// Several chunks and a tail.
+			const size_t count = Particles::PARALLEL_CHUNK_SIZE * 5 + 3;
+			ParticleBuffer serial, parallel;
+			AddRandomParticles(serial, count);
+			parallel = serial;
+
+			for (int step = 0; step < 3; step++)
+			{
+				for (bool multithreaded : { false, true })
+				{
+					ParticleStreams particles = (multithreaded ? parallel : serial).GetStreams();
+					Particles::ClearForces(particles, multithreaded);
+					Particles::AddGravity(particles, Vector3D(0, -9.81f, 0), multithreaded);
+					Particles::AddDrag(particles, .1f, .05f, multithreaded);
+					Particles::Verlet(particles, 1 / 60.f, multithreaded);
+					Particles::RungeKutta4(particles, Vector3D(1, -9.81f, 0), .1f, .05f, 1 / 60.f, multithreaded);
+					Particles::CollidePlane(particles, Vector3D::UnitY(), -50, .5f, .2f, 1 / 60.f, multithreaded);
+				}
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				if (!(serial.GetPosition(i) == parallel.GetPosition(i)) || !(serial.GetVelocity(i) == parallel.GetVelocity(i)))
+					Assert::Fail(L"The multithreaded kernels gave different results.");
+			}
+		}
+
+		TEST_METHOD(VerletTest)
+		{
+			const Vector3D gravity(0, -10, 0);
+			const Vector3D start(1, 2, -2), startVelocity(3, 5, 0);
+			const float deltaTime = 1 / 100.f;
+			const int steps = 100;
+
+			ParticleBuffer buffer;
+			buffer.Add(start, startVelocity, .5f, deltaTime);
+			ParticleStreams particles = buffer.GetStreams();
+			for (int step = 0; step < steps; step++)
+			{
+				Particles::ClearForces(particles);
+				Particles::AddGravity(particles, gravity);
+				Particles::Verlet(particles, deltaTime);
+			}
+
+			// Starting from position - velocity * deltaTime, step n adds velocity * deltaTime + n * gravity * deltaTime^2.
+			float time = steps * deltaTime;
+			Vector3D expected = start + startVelocity * time + gravity * (deltaTime * deltaTime * steps * (steps + 1) / 2);
+			AssertUtils::CloseEnough(buffer.GetPosition(0), expected, .001f);
+			AssertUtils::CloseEnough(buffer.GetVelocity(0), startVelocity + gravity * time, .01f);
+		}
+
+		TEST_METHOD(RungeKutta4Test)
+		{
+			// Without drag, a constant acceleration is integrated exactly.
+			const Vector3D gravity(0, -9.81f, 0);
+			ParticleBuffer buffer;
+			buffer.Add(Vector3D(0, 10, 0), Vector3D(2, 0, 0), 1);
+			buffer.Add(Vector3D(5, 5, 5), Vector3D(1, 1, 1), 0);
+			ParticleStreams particles = buffer.GetStreams();
+			Particles::ClearForces(particles);
+			for (int step = 0; step < 60; step++)
+				Particles::RungeKutta4(particles, gravity, 0, 0, 1 / 60.f);
+
+			AssertUtils::CloseEnough(buffer.GetPosition(0), Vector3D(2, 10 - 9.81f / 2, 0), .0001f);
+			AssertUtils::CloseEnough(buffer.GetVelocity(0), Vector3D(2, -9.81f, 0), .0001f);
+			AssertUtils::CloseEnough(buffer.GetPosition(1), Vector3D(6, 6, 6), .0001f);
+
+			// A falling particle with quadratic drag reaches the terminal velocity, where the drag cancels its weight: k * v^2 = m * g.
+			const float mass = 2, drag = .3f;
+			buffer.Clear();
+			buffer.Add(Vector3D::Zero(), Vector3D::Zero(), 1 / mass);
+			particles = buffer.GetStreams();
+			Particles::ClearForces(particles);
+			for (int step = 0; step < 1000; step++)
+				Particles::RungeKutta4(particles, gravity, 0, drag, 1 / 60.f);
+
+			AssertUtils::CloseEnough(buffer.GetVelocity(0).y, -std::sqrt(mass * 9.81f / drag), .001f);
+		}
+
+		TEST_METHOD(CollidePlaneTest)
+		{
+			ParticleBuffer buffer;
+			buffer.Add(Vector3D(1, -.5f, 2), Vector3D(4, -10, 0));
+			buffer.Add(Vector3D(1, -.5f, 2), Vector3D(4, 3, 0));
+			buffer.Add(Vector3D(1, .5f, 2), Vector3D(4, -10, 0));
+			ParticleStreams particles = buffer.GetStreams();
+			Particles::CollidePlane(particles, Vector3D::UnitY(), 0, .5f, .25f, 1 / 60.f);
+
+			// Bounces with half the speed and loses a quarter of the sliding speed.
+			AssertUtils::AreEqual(buffer.GetPosition(0), Vector3D(1, 0, 2));
+			AssertUtils::AreEqual(buffer.GetVelocity(0), Vector3D(3, 5, 0));
+			AssertUtils::CloseEnough(Vector3D(particles.previousPositionX[0], particles.previousPositionY[0], particles.previousPositionZ[0]), Vector3D(.95f, -5 / 60.f, 2));
+
+			// Already leaving the plane, so only pushed out of it.
+			AssertUtils::AreEqual(buffer.GetPosition(1), Vector3D(1, 0, 2));
+			AssertUtils::AreEqual(buffer.GetVelocity(1), Vector3D(4, 3, 0));
+
+			// In front of the plane.
+			AssertUtils::AreEqual(buffer.GetPosition(2), Vector3D(1, .5f, 2));
+			AssertUtils::AreEqual(buffer.GetVelocity(2), Vector3D(4, -10, 0));
+		}
+
+		TEST_METHOD(ParticleBufferTest)
+		{
+			ParticleBuffer buffer;
+			Assert::AreEqual(buffer.Add(Vector3D(1, 2, 3), Vector3D(4, 5, 6)), (size_t)0);
+			Assert::AreEqual(buffer.Add(Vector3D(7, 8, 9), Vector3D::Zero(), 0), (size_t)1);
+			Assert::AreEqual(buffer.Add(Vector3D(-1, -2, -3), Vector3D::One()), (size_t)2);
+
+			buffer.RemoveSwapBack(0);
+			Assert::AreEqual(buffer.Count(), (size_t)2);
+			AssertUtils::AreEqual(buffer.GetPosition(0), Vector3D(-1, -2, -3));
+			AssertUtils::AreEqual(buffer.GetVelocity(0), Vector3D::One());
+
+			ParticleStreams slice = buffer.GetStreams().Slice(1, 1);
+			Assert::AreEqual(slice.count, (size_t)1);
+			AssertUtils::AreEqual(slice.GetPosition(0), Vector3D(7, 8, 9));
+			Assert::AreEqual(slice.inverseMass[0], 0.f);
+		}
+	};
+}
\ No newline at end of file
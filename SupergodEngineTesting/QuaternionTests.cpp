@@ -0,0 +1,59 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(QuaternionTests)
+	{
+	public:
+		TEST_METHOD(RotationTest)
+		{
+			Quaternion quarterTurn = Quaternion::FromAxisAngle(Vector3D::UnitZ(), Angle(90, Angle::Measurement::Degrees));
+			AssertUtils::CloseEnough(quarterTurn.Rotate(Vector3D::UnitX()), Vector3D::UnitY(), .00001f);
+			AssertUtils::CloseEnough(quarterTurn.InverseRotate(Vector3D::UnitY()), Vector3D::UnitX(), .00001f);
+			AssertUtils::AreEqual(Quaternion::Identity().Rotate(Vector3D(1, 2, 3)), Vector3D(1, 2, 3));
+
+			for (int i = 0; i < 20; i++)
+			{
+				Vector3D axisA = Vector3D(RandFloat(-1, 1), RandFloat(-1, 1), RandFloat(1, 2)).Normalized();
+				Vector3D axisB = Vector3D(RandFloat(1, 2), RandFloat(-1, 1), RandFloat(-1, 1)).Normalized();
+				Quaternion a = Quaternion::FromAxisAngle(axisA, RandFloat(-3, 3));
+				Quaternion b = Quaternion::FromAxisAngle(axisB, RandFloat(-3, 3));
+				Vector3D vector(RandFloat(-10, 10), RandFloat(-10, 10), RandFloat(-10, 10));
+
+				// a * b rotates by b first, like matrices.
+				AssertUtils::CloseEnough((a * b).Rotate(vector), a.Rotate(b.Rotate(vector)), .0001f);
+				AssertUtils::CloseEnough(a.ToMatrix().Multiply(vector), a.Rotate(vector), .0001f);
+				AssertUtils::CloseEnough((a * b).ToMatrix(), a.ToMatrix() * b.ToMatrix(), .00001f);
+				AssertUtils::CloseEnough((a * a.Conjugate()), Quaternion::Identity(), .00001f);
+				AssertUtils::CloseEnough(a.Rotate(vector).Magnitude(), vector.Magnitude(), .0001f);
+				Assert::IsTrue(a.IsSameRotation(a.Scaled(-1)));
+			}
+		}
+
+		TEST_METHOD(IntegrateTest)
+		{
+			// A quarter turn per second around y, for a second.
+			Quaternion orientation;
+			Vector3D angularVelocity(0, Constants::PI / 2, 0);
+			for (int i = 0; i < 1000; i++)
+				orientation = orientation.Integrate(angularVelocity, .001f);
+
+			AssertUtils::CloseEnough(orientation.Magnitude(), 1, .00001f);
+			Assert::IsTrue(orientation.IsSameRotation(Quaternion::FromAxisAngle(Vector3D::UnitY(), Constants::PI / 2), .001f));
+		}
+
+		TEST_METHOD(SlerpTest)
+		{
+			Quaternion from = Quaternion::FromAxisAngle(Vector3D::UnitX(), .5f);
+			Quaternion to = Quaternion::FromAxisAngle(Vector3D::UnitX(), 2.5f);
+			AssertUtils::CloseEnough(from.Slerp(to, 0), from, .00001f);
+			AssertUtils::CloseEnough(from.Slerp(to, 1), to, .00001f);
+			Assert::IsTrue(from.Slerp(to, .25f).IsSameRotation(Quaternion::FromAxisAngle(Vector3D::UnitX(), 1), .00001f));
+
+			// -to is the same rotation, and slerp still takes the short way.
+			Assert::IsTrue(from.Slerp(to.Scaled(-1), .25f).IsSameRotation(Quaternion::FromAxisAngle(Vector3D::UnitX(), 1), .00001f));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Physics;
+
+	TEST_CLASS(RigidBodyTests)
+	{
+	private:
+		/// <summary>
+		/// Adds a static ground box with its top at y = 0.
+		/// </summary>
+		static void AddGround(PhysicsWorld& world)
+		{
+			world.AddBody(RigidBody(Shape::Box(Vector3D(100, 1, 100)), Vector3D(0, -1, 0), Quaternion::Identity(), 0));
+		}
+
+		/// <summary>
+		/// Adds stacks of unit boxes on the ground, one per x in xs, with count boxes each.
+		/// </summary>
+		static void AddStacks(PhysicsWorld& world, int stacks, int count)
+		{
+			for (int stack = 0; stack < stacks; stack++)
+			{
+				for (int i = 0; i < count; i++)
+					world.AddBody(RigidBody(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D(stack * 3.f, .5f + i, 0), Quaternion::Identity(), 1));
+			}
+		}
+
+		/// <summary>
+		/// Adds a pyramid of unit boxes on the ground with base boxes in its bottom row, where every box rests on two boxes. All of it is a single island.
+		/// </summary>
+		static void AddPyramid(PhysicsWorld& world, int base)
+		{
+			for (int row = 0; row < base; row++)
+			{
+				for (int i = 0; i < base - row; i++)
+					world.AddBody(RigidBody(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D(i * 1.05f + row * .525f, .5f + row, 0), Quaternion::Identity(), 1));
+			}
+		}
+
+	public:
+		TEST_METHOD(ShapeTest)
+		{
+			Matrix3x3 inertia = Shape::Box(Vector3D(1, 2, 3)).Inertia(6);
+			AssertUtils::CloseEnough(inertia, Matrix3x3(26, 0, 0, 0, 20, 0, 0, 0, 10));
+			AssertUtils::CloseEnough(Shape::Sphere(2).Inertia(5), Matrix3x3(8));
+
+			// Without a cylinder the capsule is a sphere.
+			AssertUtils::CloseEnough(Shape::Capsule(2, 0).Inertia(5), Matrix3x3(8));
+			AssertUtils::CloseEnough(Shape::Capsule(1, 1).Volume(), Constants::PI * (4 / 3.f + 2), .0001f);
+
+			BoundingBox bounds = Shape::Box(Vector3D(1, 2, 3)).Bounds(Vector3D(10, 0, 0), Quaternion::FromAxisAngle(Vector3D::UnitZ(), Constants::PI / 2));
+			AssertUtils::CloseEnough(bounds.min, Vector3D(8, -1, -3), .0001f);
+			AssertUtils::CloseEnough(bounds.max, Vector3D(12, 1, 3), .0001f);
+
+			bounds = Shape::Capsule(.5f, 2).Bounds(Vector3D::Zero(), Quaternion::FromAxisAngle(Vector3D::UnitX(), Constants::PI / 2));
+			AssertUtils::CloseEnough(bounds.max, Vector3D(.5f, .5f, 2.5f), .0001f);
+		}
+
+		TEST_METHOD(CollisionTest)
+		{
+			ContactManifold manifold;
+			RigidBody sphereA(Shape::Sphere(1), Vector3D::Zero(), Quaternion::Identity(), 1);
+			RigidBody sphereB(Shape::Sphere(1), Vector3D(1.5f, 0, 0), Quaternion::Identity(), 1);
+			Assert::AreEqual(Collision::Collide(sphereA, sphereB, manifold), 1);
+			AssertUtils::CloseEnough(manifold.normal, Vector3D::UnitX());
+			AssertUtils::CloseEnough(manifold.points[0].depth, .5f);
+			AssertUtils::CloseEnough(manifold.points[0].position, Vector3D(.75f, 0, 0));
+
+			sphereB.position = Vector3D(2.5f, 0, 0);
+			Assert::AreEqual(Collision::Collide(sphereA, sphereB, manifold), 0);
+
+			// A box resting on a bigger box touches it at its 4 bottom corners.
+			RigidBody ground(Shape::Box(Vector3D(10, 1, 10)), Vector3D(0, -1, 0), Quaternion::Identity(), 0);
+			RigidBody box(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D(0, .49f, 0), Quaternion::FromAxisAngle(Vector3D::UnitY(), .3f), 1);
+			Assert::AreEqual(Collision::Collide(ground, box, manifold), 4);
+			AssertUtils::CloseEnough(manifold.normal, Vector3D::UnitY());
+			for (int i = 0; i < 4; i++)
+			{
+				AssertUtils::CloseEnough(manifold.points[i].depth, .01f, .0001f);
+				AssertUtils::CloseEnough(manifold.points[i].position.y, -.005f, .0001f);
+			}
+
+			// The same with the bodies switched flips the normal.
+			Assert::AreEqual(Collision::Collide(box, ground, manifold), 4);
+			AssertUtils::CloseEnough(manifold.normal, -Vector3D::UnitY());
+
+			// Two boxes crossing edge to edge.
+			RigidBody edgeA(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D::Zero(), Quaternion::FromAxisAngle(Vector3D::UnitZ(), Constants::PI / 4), 1);
+			RigidBody edgeB(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D(0, 1.4f, 0), Quaternion::FromAxisAngle(Vector3D::UnitX(), Constants::PI / 4), 1);
+			Assert::AreEqual(Collision::Collide(edgeA, edgeB, manifold), 1);
+			AssertUtils::CloseEnough(manifold.normal, Vector3D::UnitY(), .0001f);
+			AssertUtils::CloseEnough(manifold.points[0].depth, Constants::SQRT2 - 1.4f, .0001f);
+
+			// A sphere on a box, and a capsule lying on it (touching at both ends).
+			RigidBody ball(Shape::Sphere(.5f), Vector3D(3, .4f, 2), Quaternion::Identity(), 1);
+			Assert::AreEqual(Collision::Collide(ground, ball, manifold), 1);
+			AssertUtils::CloseEnough(manifold.points[0].depth, .1f, .0001f);
+
+			RigidBody capsule(Shape::Capsule(.5f, 1), Vector3D(0, .45f, 0), Quaternion::FromAxisAngle(Vector3D::UnitZ(), Constants::PI / 2), 1);
+			Assert::AreEqual(Collision::Collide(ground, capsule, manifold), 2);
+			AssertUtils::CloseEnough(manifold.points[0].depth, .05f, .0001f);
+			AssertUtils::CloseEnough(SMath::Abs(manifold.points[0].position.x - manifold.points[1].position.x), 2, .0001f);
+
+			// Parallel capsules also touch at both ends of the line between them, and a standing capsule touches with its bottom.
+			RigidBody otherCapsule(Shape::Capsule(.5f, 1), Vector3D(.5f, 1.4f, 0), capsule.orientation, 1);
+			Assert::AreEqual(Collision::Collide(capsule, otherCapsule, manifold), 2);
+			AssertUtils::CloseEnough(manifold.normal, Vector3D::UnitY(), .0001f);
+
+			RigidBody standing(Shape::Capsule(.5f, 1), Vector3D(2, 1.4f, 0), Quaternion::Identity(), 1);
+			Assert::AreEqual(Collision::Collide(standing, ground, manifold), 1);
+			AssertUtils::CloseEnough(manifold.normal, -Vector3D::UnitY(), .0001f);
+			AssertUtils::CloseEnough(manifold.points[0].depth, .1f, .0001f);
+		}
+
+		TEST_METHOD(StackTest)
+		{
+			PhysicsWorld world;
+			AddGround(world);
+			AddStacks(world, 1, 6);
+
+			for (int step = 0; step < 180; step++)
+				world.Step(1 / 60.f);
+
+			// The stack stands still and falls asleep.
+			for (uint i = 1; i < world.BodyCount(); i++)
+			{
+				const RigidBody& box = world.GetBody(i);
+				AssertUtils::CloseEnough(box.position, Vector3D(0, .5f + (i - 1), 0), .05f);
+				Assert::IsFalse(box.awake);
+			}
+			Assert::AreEqual(world.AwakeBodyCount(), (size_t)0);
+
+			// A ball dropped on the top box wakes the whole stack.
+			uint ball = world.AddBody(RigidBody(Shape::Sphere(.25f), Vector3D(0, 7, 0), Quaternion::Identity(), 1));
+			for (int step = 0; step < 40; step++)
+				world.Step(1 / 60.f);
+
+			Assert::AreEqual(world.AwakeBodyCount(), world.BodyCount() - 1);
+			Assert::AreEqual(world.AwakeIslandCount(), (size_t)1);
+			AssertUtils::CloseEnough(world.GetBody(ball).position.y, 6.25f, .05f);
+		}
+
+		TEST_METHOD(BounceTest)
+		{
+			PhysicsWorld world;
+			AddGround(world);
+			RigidBody ball(Shape::Sphere(.5f), Vector3D(0, 3, 0), Quaternion::Identity(), 1);
+			ball.restitution = .8f;
+			uint index = world.AddBody(ball);
+
+			// The ball falls, bounces with most of its speed and flies up again.
+			float maxSpeed = 0, bounceSpeed = 0;
+			for (int step = 0; step < 120; step++)
+			{
+				world.Step(1 / 60.f);
+				float speed = world.GetBody(index).linearVelocity.y;
+				maxSpeed = SMath::Min(maxSpeed, speed);
+				bounceSpeed = SMath::Max(bounceSpeed, speed);
+			}
+
+			AssertUtils::CloseEnough(bounceSpeed / -maxSpeed, .8f, .1f);
+			Assert::IsTrue(world.GetBody(index).position.y > .4f);
+		}
+
+		TEST_METHOD(FrictionTest)
+		{
+			// A box sliding on the ground stops, and a sphere rolls instead of sliding.
+			PhysicsWorld world;
+			AddGround(world);
+			RigidBody box(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D(0, .5f, 0), Quaternion::Identity(), 1);
+			box.linearVelocity = Vector3D(2, 0, 0);
+			uint boxIndex = world.AddBody(box);
+
+			RigidBody ball(Shape::Sphere(.5f), Vector3D(0, .5f, 5), Quaternion::Identity(), 1);
+			ball.linearVelocity = Vector3D(2, 0, 0);
+			uint ballIndex = world.AddBody(ball);
+
+			for (int step = 0; step < 120; step++)
+				world.Step(1 / 60.f);
+
+			// Friction of .5 stops it after v^2 / (2 * .5 * g) meters.
+			AssertUtils::CloseEnough(world.GetBody(boxIndex).position.x, 4 / 9.81f, .05f);
+			AssertUtils::CloseEnough(world.GetBody(boxIndex).linearVelocity.x, 0, .001f);
+
+			const RigidBody& rolling = world.GetBody(ballIndex);
+			Assert::IsTrue(rolling.linearVelocity.x > 1);
+			AssertUtils::CloseEnough(rolling.angularVelocity.z * .5f, -rolling.linearVelocity.x, .01f);
+		}
+
+		TEST_METHOD(MultithreadedTest)
+		{
+			PhysicsWorld serial, parallel;
+			serial.multithreaded = false;
+			for (PhysicsWorld* world : { &serial, &parallel })
+			{
+				AddGround(*world);
+				AddStacks(*world, 12, 5);
+				for (int i = 0; i < 8; i++)
+					world->AddBody(RigidBody(Shape::Capsule(.3f, .5f), Vector3D(i * 3.f, 8, .2f), Quaternion::FromAxisAngle(Vector3D::UnitZ(), 1), 2));
+			}
+
+			for (int step = 0; step < 60; step++)
+			{
+				serial.Step(1 / 60.f);
+				parallel.Step(1 / 60.f);
+			}
+
+			for (uint i = 0; i < serial.BodyCount(); i++)
+			{
+				AssertUtils::AreEqual(serial.GetBody(i).position, parallel.GetBody(i).position);
+				AssertUtils::AreEqual(serial.GetBody(i).angularVelocity, parallel.GetBody(i).angularVelocity);
+			}
+		}
+
+		TEST_METHOD(LargeIslandTest)
+		{
+			// The pyramid has enough manifolds to be solved by color, which splits it between the threads when multithreaded is set.
+			PhysicsWorld serial, parallel;
+			serial.multithreaded = false;
+			for (PhysicsWorld* world : { &serial, &parallel })
+			{
+				AddGround(*world);
+				AddPyramid(*world, 16);
+			}
+
+			for (int step = 0; step < 60; step++)
+			{
+				serial.Step(1 / 60.f);
+				parallel.Step(1 / 60.f);
+			}
+
+			Assert::AreEqual(serial.AwakeIslandCount(), (size_t)1);
+			Assert::IsTrue(serial.GetContacts().size() >= 128);
+			for (uint i = 0; i < serial.BodyCount(); i++)
+			{
+				AssertUtils::AreEqual(serial.GetBody(i).position, parallel.GetBody(i).position);
+				AssertUtils::AreEqual(serial.GetBody(i).angularVelocity, parallel.GetBody(i).angularVelocity);
+			}
+
+			// The pyramid stands.
+			const RigidBody& top = serial.GetBody((uint)serial.BodyCount() - 1);
+			AssertUtils::CloseEnough(top.position, Vector3D(7.5f * 1.05f, 15.5f, 0), .1f);
+		}
+	};
+}
\ No newline at end of file
@@ -103,11 +103,11 @@ namespace SupergodEngineTesting
 				Assert::AreEqual(test, 1.f);
 
 				test = SMath::Exp(i);
-				Assert::AreEqual(test, SMath::Pow(Constants::E, i));
+				AssertUtils::CloseEnough(test / SMath::Pow(Constants::E, i), 1, .00001f);
 
 				test = SMath::Squared(i);
 				Assert::AreEqual(test, i * i);
-				Assert::AreEqual(test, SMath::Pow(i, 2));
+				AssertUtils::CloseEnough(test / SMath::Pow(i, 2), 1, .00001f);
 
 				test = SMath::Cubed(i);
 				AssertUtils::CloseEnough(test, i * i * i, .00785f);
@@ -253,6 +253,19 @@ namespace SupergodEngineTesting
 			Assert::IsTrue(SMath::CloseEnough(test, 1));
 		}
 
+		TEST_METHOD(ConstexprTrigTest)
+		{
+			static_assert(SMath::Constexpr::Sin(0) == 0, "Constexpr sin must be usable at compile time.");
+			static_assert(SMath::Constexpr::Cos(0) == 1, "Constexpr cos must be usable at compile time.");
+
+			TestMultiple(1000, [&](int i)
+			{
+				float theta = RandFloat100();
+				Assert::IsTrue(SMath::CloseEnough(SMath::Constexpr::Sin(theta), SMath::Sin(theta), 0.0001f));
+				Assert::IsTrue(SMath::CloseEnough(SMath::Constexpr::Cos(theta), SMath::Cos(theta), 0.0001f));
+			});
+		}
+
 		TEST_METHOD(AsinTest)
 		{
 			float test = SMath::Asin(-1);
@@ -0,0 +1,185 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Physics;
+
+	TEST_CLASS(SweepTests)
+	{
+	public:
+		TEST_METHOD(SphereTriangleTest)
+		{
+			Vector3D a(-1, 0, -1), b(1, 0, -1), c(0, 0, 2);
+
+			// Falling straight onto the face.
+			SweepHit hit = Sweep::SphereTriangle(Vector3D(0, 3, 0), .5f, Vector3D(0, -5, 0), a, b, c);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, .5f, .0001f);
+			AssertUtils::CloseEnough(hit.normal, Vector3D::UnitY(), .0001f);
+			AssertUtils::CloseEnough(hit.point, Vector3D(0, 0, 0), .0001f);
+
+			// The triangle is two sided.
+			hit = Sweep::SphereTriangle(Vector3D(0, -3, 0), .5f, Vector3D(0, 5, 0), a, b, c);
+			AssertUtils::CloseEnough(hit.time, .5f, .0001f);
+			AssertUtils::CloseEnough(hit.normal, -Vector3D::UnitY(), .0001f);
+
+			// Moving along z into the edge from a to b.
+			hit = Sweep::SphereTriangle(Vector3D(0, 0, -4), 1, Vector3D(0, 0, 4), a, b, c);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, .5f, .0001f);
+			AssertUtils::CloseEnough(hit.normal, -Vector3D::UnitZ(), .0001f);
+			AssertUtils::CloseEnough(hit.point, Vector3D(0, 0, -1), .0001f);
+
+			// Moving along z into the corner c.
+			hit = Sweep::SphereTriangle(Vector3D(0, 0, 5), 1, Vector3D(0, 0, -4), a, b, c);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, .5f, .0001f);
+			AssertUtils::CloseEnough(hit.point, c, .0001f);
+			AssertUtils::CloseEnough(hit.normal, Vector3D::UnitZ(), .0001f);
+
+			// Passing beside the triangle or stopping short of it.
+			Assert::IsFalse(Sweep::SphereTriangle(Vector3D(5, 3, 0), .5f, Vector3D(0, -5, 0), a, b, c).hit);
+			Assert::IsFalse(Sweep::SphereTriangle(Vector3D(0, 3, 0), .5f, Vector3D(0, -2, 0), a, b, c).hit);
+
+			// Overlapping from the start.
+			hit = Sweep::SphereTriangle(Vector3D(0, .25f, 0), .5f, Vector3D(1, 0, 0), a, b, c);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, 0, .0001f);
+		}
+
+		TEST_METHOD(TunnelingTest)
+		{
+			// A tiny fast sphere ends up far behind a wall, which a test of where it ends up misses.
+			Vector3D a(0, -1, -1), b(0, 1, -1), c(0, 0, 2);
+			Vector3D center(-10, 0, 0), motion(100, 0, 0);
+			Assert::IsFalse((center + motion).Magnitude() <= .01f);
+
+			SweepHit hit = Sweep::SphereTriangle(center, .01f, motion, a, b, c);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, 9.99f / 100, .0001f);
+			AssertUtils::CloseEnough(hit.normal, -Vector3D::UnitX(), .0001f);
+		}
+
+		TEST_METHOD(BoxesTest)
+		{
+			BoundingBox target(Vector3D(4, -1, -1), Vector3D(6, 1, 1));
+			BoundingBox moving = BoundingBox::FromCenter(Vector3D::Zero(), Vector3D(1, 1, 1));
+
+			SweepHit hit = Sweep::Boxes(moving, Vector3D(6, 0, 0), target);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, .5f, .0001f);
+			AssertUtils::CloseEnough(hit.normal, -Vector3D::UnitX(), .0001f);
+			AssertUtils::CloseEnough(hit.point, Vector3D(4, 0, 0), .0001f);
+
+			// The axis that enters last is the one that is hit.
+			hit = Sweep::Boxes(moving, Vector3D(6, 6, 0), BoundingBox(Vector3D(4, 5, -1), Vector3D(6, 7, 1)));
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time, 4 / 6.f, .0001f);
+			AssertUtils::CloseEnough(hit.normal, -Vector3D::UnitY(), .0001f);
+
+			Assert::IsFalse(Sweep::Boxes(moving, Vector3D(2, 0, 0), target).hit);
+			Assert::IsFalse(Sweep::Boxes(moving, Vector3D(6, 6, 0), target).hit);
+			Assert::IsFalse(Sweep::Boxes(moving, Vector3D(-6, 0, 0), target).hit);
+
+			hit = Sweep::Boxes(BoundingBox::FromCenter(Vector3D(4.5f, 0, 0), Vector3D(1, 1, 1)), Vector3D(1, 0, 0), target);
+			Assert::IsTrue(hit.hit);
+			Assert::AreEqual(0.f, hit.time);
+			Assert::IsTrue(hit.normal == Vector3D::Zero());
+		}
+
+		TEST_METHOD(ConservativeAdvancementTest)
+		{
+			// A small fast sphere that would pass through a thin box in one step.
+			RigidBody bullet(Shape::Sphere(.1f), Vector3D(-5, 0, 0), Quaternion::Identity(), 1);
+			bullet.linearVelocity = Vector3D(600, 0, 0);
+			RigidBody wall(Shape::Box(Vector3D(.05f, 2, 2)), Vector3D::Zero(), Quaternion::Identity(), 0);
+
+			SweepHit hit = Sweep::ConservativeAdvancement(bullet, wall, 1 / 60.f);
+			Assert::IsTrue(hit.hit);
+			AssertUtils::CloseEnough(hit.time * (1 / 60.f) * 600, 4.85f, .01f);
+			AssertUtils::CloseEnough(hit.normal, -Vector3D::UnitX(), .001f);
+
+			bullet.linearVelocity = Vector3D(-600, 0, 0);
+			Assert::IsFalse(Sweep::ConservativeAdvancement(bullet, wall, 1 / 60.f).hit);
+			bullet.linearVelocity = Vector3D(200, 0, 0);
+			Assert::IsFalse(Sweep::ConservativeAdvancement(bullet, wall, 1 / 60.f).hit);
+
+			// A long box that turns a quarter turn around its center, which hits a sphere beside it only by turning.
+			RigidBody bar(Shape::Box(Vector3D(2, .1f, .1f)), Vector3D::Zero(), Quaternion::Identity(), 1);
+			bar.angularVelocity = Vector3D(0, 0, Constants::PI / 2);
+			RigidBody ball(Shape::Sphere(.2f), Vector3D(0, 1.5f, 0), Quaternion::Identity(), 0);
+			hit = Sweep::ConservativeAdvancement(bar, ball, 1);
+			Assert::IsTrue(hit.hit);
+			Assert::IsTrue(hit.time > .5f && hit.time < 1);
+
+			// The bar is touching the ball at the reported time.
+			bar.orientation = Quaternion::FromAxisAngle(Vector3D::UnitZ(), hit.time * Constants::PI / 2);
+			GjkResult distance = Gjk::Distance(SupportMapping::OfBody(bar), SupportMapping::OfBody(ball));
+			Assert::IsTrue(distance.intersecting || distance.distance <= .001f);
+
+			ball.position = Vector3D(0, 3, 0);
+			Assert::IsFalse(Sweep::ConservativeAdvancement(bar, ball, 1).hit);
+		}
+
+		TEST_METHOD(SweepMeshTest)
+		{
+			// A bumpy grid of triangles with spheres shot at it from random places.
+			const int size = 8;
+			std::vector<Vector3D> vertices;
+			for (int z = 0; z <= size; z++)
+			{
+				for (int x = 0; x <= size; x++)
+					vertices.push_back(Vector3D((float)x, RandFloat(-.3f, .3f), (float)z));
+			}
+
+			std::vector<uint> indices;
+			for (int z = 0; z < size; z++)
+			{
+				for (int x = 0; x < size; x++)
+				{
+					uint corner = z * (size + 1) + x;
+					uint triangles[] = { corner, corner + 1, corner + size + 1, corner + 1, corner + size + 2, corner + size + 1 };
+					indices.insert(indices.end(), triangles, triangles + 6);
+				}
+			}
+
+			SweepMesh mesh(vertices.data(), indices.data(), indices.size() / 3);
+			Assert::AreEqual(indices.size() / 3, mesh.TriangleCount());
+
+			const size_t count = 300;
+			std::vector<Vector3D> centers, motions;
+			std::vector<float> radii;
+			for (size_t i = 0; i < count; i++)
+			{
+				centers.push_back(Vector3D(RandFloat(-1, size + 1), RandFloat(1, 3), RandFloat(-1, size + 1)));
+				motions.push_back(Vector3D(RandFloat(-3, 3), RandFloat(-5, 1), RandFloat(-3, 3)));
+				radii.push_back(RandFloat(.01f, .5f));
+			}
+
+			for (bool multithreaded : { false, true })
+			{
+				std::vector<SweepHit> hits(count);
+				mesh.SweepSpheres(centers.data(), radii.data(), motions.data(), count, hits.data(), multithreaded);
+				for (size_t i = 0; i < count; i++)
+				{
+					SweepHit expected = SweepHit::Miss();
+					for (size_t triangle = 0; triangle < indices.size() / 3; triangle++)
+					{
+						SweepHit hit = Sweep::SphereTriangle(centers[i], radii[i], motions[i],
+							vertices[indices[triangle * 3]], vertices[indices[triangle * 3 + 1]], vertices[indices[triangle * 3 + 2]]);
+						if (hit.hit && (!expected.hit || hit.time < expected.time))
+						{
+							expected = hit;
+							expected.index = (uint)triangle;
+						}
+					}
+
+					Assert::AreEqual(expected.hit, hits[i].hit);
+					Assert::AreEqual(expected.time, hits[i].time);
+					Assert::AreEqual(expected.index, hits[i].index);
+				}
+			}
+		}
+	};
+}
\ No newline at end of file
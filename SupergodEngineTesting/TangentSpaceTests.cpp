@@ -0,0 +1,103 @@
+#include "TestUtils.h"
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+	using namespace Geometry;
+
+	TEST_CLASS(TangentSpaceTests)
+	{
+	public:
+		TEST_METHOD(ComputeNormalsTest)
+		{
+			for (NormalWeighting weighting : { NormalWeighting::Uniform, NormalWeighting::Area, NormalWeighting::Angle })
+			{
+				Mesh grid = MeshPrimitives::Grid(4);
+				TangentSpace::ComputeNormals(grid, weighting);
+				for (const Vector3D& normal : grid.normals)
+					AssertUtils::CloseEnough(normal, Vector3D::UnitY(), .0001f);
+			}
+
+			// A cube with one vertex at every corner: weighting by angle makes the normals point straight out of the corners, however the sides are split.
+			Mesh cube;
+			for (int corner = 0; corner < 8; corner++)
+				cube.AddVertex(Vector3D(corner & 1 ? 1.f : -1.f, corner & 2 ? 1.f : -1.f, corner & 4 ? 1.f : -1.f));
+			uint sides[] = { 0, 2, 3, 1, 4, 5, 7, 6, 0, 1, 5, 4, 2, 6, 7, 3, 0, 4, 6, 2, 1, 3, 7, 5 };
+			for (int side = 0; side < 6; side++)
+			{
+				const uint* quad = &sides[side * 4];
+				cube.AddTriangle(quad[0], quad[1], quad[2]);
+				cube.AddTriangle(quad[0], quad[2], quad[3]);
+			}
+			TangentSpace::ComputeNormals(cube, NormalWeighting::Angle);
+			for (int corner = 0; corner < 8; corner++)
+				AssertUtils::CloseEnough(cube.normals[corner], cube.positions[corner].Normalized(), .0001f);
+
+			// The vertices at the seam only see the triangles on one side of them, so they lean more. Those at the poles are split for every segment, so they see a single thin triangle at most.
+			Mesh sphere = MeshPrimitives::Sphere(32, 64, true);
+			TangentSpace::ComputeNormals(sphere);
+			for (size_t vertex = 65; vertex < sphere.VertexCount() - 65; vertex++)
+			{
+				bool seam = vertex % 65 == 0 || vertex % 65 == 64;
+				AssertUtils::CloseEnough(sphere.normals[vertex], sphere.positions[vertex], seam ? .06f : .02f);
+			}
+
+			// Vertices that no triangle uses point up.
+			cube.AddVertex(Vector3D(5, 5, 5));
+			TangentSpace::ComputeNormals(cube);
+			Assert::IsTrue(cube.normals.back() == Vector3D::UnitY());
+		}
+
+		TEST_METHOD(ComputeTangentsTest)
+		{
+			Mesh grid = MeshPrimitives::Grid(4);
+			Assert::IsFalse(TangentSpace::ComputeTangents(grid));
+			Assert::IsFalse(grid.HasTangents());
+
+			// u grows along x, and v grows along z which is -normal.Cross(tangent).
+			TangentSpace::ComputeNormals(grid);
+			Assert::IsTrue(TangentSpace::ComputeTangents(grid));
+			for (const Vector4D& tangent : grid.tangents)
+				AssertUtils::CloseEnough(tangent, Vector4D(1, 0, 0, -1), .0001f);
+
+			// Mirroring the texture flips both the tangent and the handedness.
+			Mesh mirrored = MeshPrimitives::Grid(4, -1);
+			TangentSpace::ComputeNormals(mirrored);
+			TangentSpace::ComputeTangents(mirrored);
+			for (const Vector4D& tangent : mirrored.tangents)
+				AssertUtils::CloseEnough(tangent, Vector4D(-1, 0, 0, 1), .0001f);
+
+			// On a sphere, u grows around the y axis.
+			Mesh sphere = MeshPrimitives::Sphere(32, 64, true);
+			TangentSpace::ComputeNormals(sphere);
+			TangentSpace::ComputeTangents(sphere);
+			for (size_t vertex = 0; vertex < sphere.VertexCount(); vertex++)
+			{
+				Vector3D tangent(sphere.tangents[vertex].x, sphere.tangents[vertex].y, sphere.tangents[vertex].z);
+				AssertUtils::CloseEnough(tangent.Magnitude(), 1, .0001f);
+				AssertUtils::CloseEnough(tangent.Dot(sphere.normals[vertex]), 0, .0001f);
+
+				const Vector3D& position = sphere.positions[vertex];
+				bool seam = vertex % 65 == 0 || vertex % 65 == 64;
+				if (SMath::Abs(position.y) < .9f)
+					AssertUtils::CloseEnough(tangent, Vector3D(-position.z, 0, position.x).Normalized(), seam ? .06f : .005f);
+			}
+		}
+
+		TEST_METHOD(MultithreadedTest)
+		{
+			// Every vertex sums its corners in the same order on any number of threads, so the results are the same to the bit.
+			Mesh single = MeshPrimitives::Sphere(128, 256, true);
+			Mesh multithreaded = single;
+			for (NormalWeighting weighting : { NormalWeighting::Area, NormalWeighting::Angle })
+			{
+				TangentSpace::ComputeNormals(single, weighting, false);
+				TangentSpace::ComputeNormals(multithreaded, weighting, true);
+				TangentSpace::ComputeTangents(single, false);
+				TangentSpace::ComputeTangents(multithreaded, true);
+				Assert::IsTrue(memcmp(single.normals.data(), multithreaded.normals.data(), single.normals.size() * sizeof(Vector3D)) == 0);
+				Assert::IsTrue(memcmp(single.tangents.data(), multithreaded.tangents.data(), single.tangents.size() * sizeof(Vector4D)) == 0);
+			}
+		}
+	};
+}
\ No newline at end of file
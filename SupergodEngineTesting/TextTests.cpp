@@ -0,0 +1,234 @@
+#include "TestUtils.h"
+#include <cmath>
+#include <string>
+
+namespace SupergodEngineTesting
+{
+	using namespace Math;
+
+	TEST_CLASS(TextTests)
+	{
+	private:
+		/// <summary>
+		/// Formats value with ToChars.
+		/// </summary>
+		template<class T>
+		static std::string Format(const T& value)
+		{
+			char buffer[256];
+			char* end = Text::ToChars(buffer, buffer + sizeof(buffer), value);
+			Assert::IsTrue(end != nullptr);
+			return std::string(buffer, end);
+		}
+
+		/// <summary>
+		/// Parses all of text with FromChars, failing if any of it is left.
+		/// </summary>
+		template<class T>
+		static T Parse(const std::string& text)
+		{
+			T value;
+			const char* end = Text::FromChars(text.data(), text.data() + text.size(), value);
+			Assert::IsTrue(end == text.data() + text.size());
+			return value;
+		}
+
+		static uint Bits(float value)
+		{
+			uint bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+
+		static float FromBits(uint bits)
+		{
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		template<class T>
+		static void AssertSameFloats(const T& a, const T& b, int count)
+		{
+			const float* aFloats = reinterpret_cast<const float*>(&a);
+			const float* bFloats = reinterpret_cast<const float*>(&b);
+			for (int i = 0; i < count; i++)
+				Assert::AreEqual(Bits(aFloats[i]), Bits(bFloats[i]));
+		}
+
+	public:
+		TEST_METHOD(FloatRoundTripTest)
+		{
+			std::mt19937 random(1234);
+			for (int i = 0; i < 200000; i++)
+			{
+				// Every few values is a subnormal, to cover the smallest exponents too.
+				uint bits = random();
+				if (i % 8 == 0)
+					bits &= 0x807fffff;
+				float value = FromBits(bits);
+				if (std::isnan(value))
+					continue;
+
+				std::string text = Format(value);
+				Assert::IsTrue(text.size() <= (size_t)Text::MAX_FLOAT_CHARS);
+				Assert::AreEqual(Bits(value), Bits(Parse<float>(text)));
+			}
+		}
+
+		TEST_METHOD(FloatShortestTest)
+		{
+			Assert::IsTrue(Format(.1f) == "0.1");
+			Assert::IsTrue(Format(1e10f) == "1e+10");
+			Assert::IsTrue(Format(1.5e-7f) == "1.5e-07");
+			Assert::IsTrue(Format(123456.f) == "123456");
+			Assert::IsTrue(Format(.001f) == "0.001");
+			Assert::IsTrue(Format(0.f) == "0");
+			Assert::IsTrue(Format(-0.f) == "-0");
+			Assert::IsTrue(Format(3.4028235e38f) == "3.4028235e+38");
+			Assert::IsTrue(Format(FromBits(1)) == "1e-45");
+			Assert::IsTrue(Format(INFINITY) == "inf");
+			Assert::IsTrue(Format(-INFINITY) == "-inf");
+			Assert::IsTrue(Format(NAN) == "nan");
+
+			// Like std::to_chars, integers in fixed notation get all of their digits, and the digits closest to the float win exact ties by being even.
+			Assert::IsTrue(Format(240823472.f) == "240823472");
+			Assert::IsTrue(Format(2846088.75f) == "2846088.8");
+			Assert::IsTrue(Format(-22176.4375f) == "-22176.438");
+			Assert::IsTrue(Format(178616.125f) == "178616.12");
+		}
+
+		TEST_METHOD(FloatParseTest)
+		{
+			Assert::AreEqual(Parse<float>("1.5e3"), 1500.f);
+			Assert::AreEqual(Parse<float>("-.25"), -.25f);
+			Assert::AreEqual(Parse<float>("7."), 7.f);
+			Assert::AreEqual(Parse<float>("1E-2"), .01f);
+			Assert::IsTrue(std::isinf(Parse<float>("Infinity")));
+			Assert::IsTrue(std::isnan(Parse<float>("nan")));
+			Assert::IsTrue(std::isinf(Parse<float>("1e39")));
+			Assert::AreEqual(Bits(Parse<float>("-1e-50")), Bits(-0.f));
+
+			// Halfway between the smallest subnormal and 0 rounds to even (0), and anything above it rounds up.
+			Assert::AreEqual(Bits(Parse<float>("7.006492321624085354618e-46")), 0u);
+			Assert::AreEqual(Bits(Parse<float>("7.006492321624085354619e-46")), 1u);
+
+			// Halfway between 1 and the next float, then a hair above it, with more digits than fit in a double.
+			Assert::AreEqual(Bits(Parse<float>("1.000000059604644775390625")), Bits(1.f));
+			Assert::AreEqual(Bits(Parse<float>("1.00000005960464477539062500000000000001")), Bits(1.f) + 1);
+			Assert::AreEqual(Bits(Parse<float>("16777217")), Bits(16777216.f));
+			Assert::AreEqual(Bits(Parse<float>("16777219")), Bits(16777220.f));
+
+			// Failures leave the value as it was.
+			float value = 3;
+			for (const char* text : { "", "-", ".", "e5", "+1", " 1", "in" })
+			{
+				Assert::IsTrue(Text::FromChars(text, text + std::strlen(text), value) == nullptr);
+				Assert::AreEqual(value, 3.f);
+			}
+
+			// Parsing stops at the end of the number.
+			const char* text = "2.5e1x";
+			Assert::IsTrue(Text::FromChars(text, text + 6, value) == text + 5);
+			Assert::AreEqual(value, 25.f);
+		}
+
+		TEST_METHOD(IntTest)
+		{
+			Assert::IsTrue(Format(0) == "0");
+			Assert::IsTrue(Format(-2147483647 - 1) == "-2147483648");
+			Assert::AreEqual(Parse<int>("2147483647"), 2147483647);
+			Assert::AreEqual(Parse<int>("-2147483648"), -2147483647 - 1);
+
+			int value = 5;
+			const char* text = "2147483648";
+			Assert::IsTrue(Text::FromChars(text, text + 10, value) == nullptr);
+			Assert::AreEqual(value, 5);
+		}
+
+		TEST_METHOD(VectorAndMatrixTest)
+		{
+			Vector3D vector(RandFloat100(), RandFloat100(), RandFloat100());
+			AssertSameFloats(vector, Parse<Vector3D>(Format(vector)), 3);
+			Assert::IsTrue(Format(Vector2D(1, -.5f)) == "1 -0.5");
+			AssertSameFloats(Parse<Vector4D>(" 1,2,\t3 , 4"), Vector4D(1, 2, 3, 4), 4);
+
+			Matrix2x2 matrix2x2(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+			AssertSameFloats(matrix2x2, Parse<Matrix2x2>(Format(matrix2x2)), 4);
+			Matrix3x3 matrix3x3(RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100(), RandFloat100());
+			AssertSameFloats(matrix3x3, Parse<Matrix3x3>(Format(matrix3x3)), 9);
+			Assert::AreEqual(Parse<Matrix3x3>("1 2 3 4 5 6 7 8 9").r1c2, 6.f);
+
+			// A missing float fails without touching the vector.
+			Vector3D unchanged(1, 2, 3);
+			const char* text = "4 5";
+			Assert::IsTrue(Text::FromChars(text, text + 3, unchanged) == nullptr);
+			AssertSameFloats(unchanged, Vector3D(1, 2, 3), 3);
+		}
+
+		TEST_METHOD(AngleTest)
+		{
+			AssertUtils::CloseEnough(Parse<Angle>("90deg").GetRadians(), Constants::PI / 2);
+			AssertUtils::CloseEnough(Parse<Angle>("0.25rev").GetRadians(), Constants::PI / 2);
+			AssertUtils::CloseEnough(Parse<Angle>("1.5").GetRadians(), 1.5f);
+			AssertUtils::CloseEnough(Parse<Angle>(Format(Angle(2.f))).GetRadians(), 2.f);
+
+			Angle angle;
+			const char* text = "90degrees";
+			Assert::IsTrue(Text::FromChars(text, text + 9, angle) == nullptr);
+		}
+
+		TEST_METHOD(ColorTest)
+		{
+			Assert::IsTrue(Format(BColor(255, 128, 0, 255)) == "#ff8000ff");
+			Assert::IsTrue(Parse<BColor>("#ff8000ff") == BColor(255, 128, 0, 255));
+			Assert::IsTrue(Parse<BColor>("#F80") == BColor(255, 136, 0, 255));
+			Assert::IsTrue(Parse<BColor>("#12345678") == BColor(0x12, 0x34, 0x56, 0x78));
+			Assert::IsTrue(Parse<BColor>("10, 20, 30, 40") == BColor(10, 20, 30, 40));
+
+			FColor color = Parse<FColor>("#ff000080");
+			Assert::AreEqual(color.red, 1.f);
+			AssertUtils::CloseEnough(color.alpha, 128 / 255.f);
+			AssertSameFloats(Parse<FColor>(Format(FColor(.1f, .2f, .3f, 1))), FColor(.1f, .2f, .3f, 1), 4);
+
+			char buffer[16];
+			Assert::IsTrue(std::string(buffer, Text::ToHexChars(buffer, buffer + sizeof(buffer), FColor(1, 0, 0, 1))) == "#ff0000ff");
+
+			BColor unchanged(1, 2, 3, 4);
+			for (const char* text : { "#12345", "#123456789", "1 2 3 256", "#" })
+			{
+				Assert::IsTrue(Text::FromChars(text, text + std::strlen(text), unchanged) == nullptr);
+				Assert::IsTrue(unchanged == BColor(1, 2, 3, 4));
+			}
+		}
+
+		TEST_METHOD(BulkTest)
+		{
+			std::vector<Vector3D> vectors;
+			for (int i = 0; i < 100; i++)
+				vectors.push_back(Vector3D(RandFloat100(), RandFloat100(), RandFloat100()));
+
+			std::vector<char> buffer(vectors.size() * (Text::MAX_FLOAT_CHARS + 1) * 3);
+			char* end = Text::ToChars(buffer.data(), buffer.data() + buffer.size(), vectors.data(), vectors.size());
+			Assert::IsTrue(end != nullptr);
+
+			std::vector<Vector3D> parsed;
+			parsed.reserve(vectors.size());
+			Assert::IsTrue(Text::FromChars(buffer.data(), end, parsed) == end);
+			Assert::AreEqual(parsed.size(), vectors.size());
+			for (size_t i = 0; i < vectors.size(); i++)
+				AssertSameFloats(parsed[i], vectors[i], 3);
+
+			Vector2D fixed[2];
+			const char* text = "1 2\n3 4\n";
+			Assert::IsTrue(Text::FromChars(text, text + 8, fixed, 2) == text + 7);
+			Assert::AreEqual(fixed[1].y, 4.f);
+
+			// Garbage stops parsing, keeping what came before it.
+			parsed.clear();
+			text = "1 2 3, 4 5 6; 7 8 9";
+			Assert::IsTrue(Text::FromChars(text, text + std::strlen(text), parsed) == nullptr);
+			Assert::AreEqual(parsed.size(), (size_t)2);
+		}
+	};
+}
\ No newline at end of file
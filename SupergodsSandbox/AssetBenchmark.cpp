@@ -0,0 +1,109 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Assets;
+
+/// <summary>
+/// Uses all the loaded data, the same way for both formats.
+/// </summary>
+static float Sum(const Vector3D* positions, size_t positionCount, const Matrix3x3* transforms, size_t transformCount)
+{
+	float sum = 0;
+	for (size_t i = 0; i < positionCount; i++)
+		sum += positions[i].x;
+	for (size_t i = 0; i < transformCount; i++)
+		sum += transforms[i].Determinant();
+	return sum;
+}
+
+void RunAssetBenchmark()
+{
+	const size_t positionCount = 1000000, transformCount = 100000;
+	const char* binaryPath = "AssetBenchmark.sgaf";
+	const char* textPath = "AssetBenchmark.txt";
+	const uint positionsId = ChunkId("POSI"), transformsId = ChunkId("XFRM");
+	std::cout << "--- Assets (" << positionCount << " positions and " << transformCount << " transforms, per float) ---" << std::endl;
+
+	std::vector<Vector3D> positions(positionCount);
+	std::vector<Matrix3x3> transforms(transformCount);
+	for (size_t i = 0; i < positionCount; i++)
+		positions[i] = Vector3D(std::rand() * .01f, std::rand() * -.001f, std::rand() * .1f);
+	for (size_t i = 0; i < transformCount; i++)
+		transforms[i] = Matrix3x3::Identity().Multiply(std::rand() / (float)RAND_MAX);
+
+	const size_t floatCount = positionCount * 3 + transformCount * 9;
+	const float* positionFloats = &positions[0].x;
+	const float* transformFloats = reinterpret_cast<const float*>(transforms.data());
+
+	Benchmark::Run("Writing the asset file", 1, floatCount, [&]()
+	{
+		AssetWriter writer;
+		writer.Open(binaryPath);
+		writer.WriteChunk(positionsId, positions.data(), positions.size());
+		writer.WriteChunk(transformsId, transforms.data(), transforms.size());
+		writer.Close();
+	});
+
+	// The same floats as text, one position or transform on every line.
+	{
+		std::ofstream text(textPath);
+		char line[256];
+		for (size_t i = 0; i < positionCount; i++)
+		{
+			std::snprintf(line, sizeof(line), "%.9g %.9g %.9g\n", positionFloats[i * 3], positionFloats[i * 3 + 1], positionFloats[i * 3 + 2]);
+			text << line;
+		}
+		for (size_t i = 0; i < transformCount * 9; i++)
+		{
+			std::snprintf(line, sizeof(line), i % 9 == 8 ? "%.9g\n" : "%.9g ", transformFloats[i]);
+			text << line;
+		}
+	}
+
+	// Loading is done once the floats can be used, so both ways use all of them.
+	std::vector<Vector3D> loadedPositions(positionCount);
+	std::vector<Matrix3x3> loadedTransforms(transformCount);
+	Benchmark::Run("Parsing text (strtof)", 3, floatCount, [&]()
+	{
+		std::ifstream text(textPath);
+		std::stringstream contents;
+		contents << text.rdbuf();
+		std::string string = contents.str();
+
+		const char* parse = string.c_str();
+		char* parsed;
+		float* destination = &loadedPositions[0].x;
+		for (size_t i = 0; i < positionCount * 3; i++, parse = parsed)
+			destination[i] = std::strtof(parse, &parsed);
+		destination = reinterpret_cast<float*>(loadedTransforms.data());
+		for (size_t i = 0; i < transformCount * 9; i++, parse = parsed)
+			destination[i] = std::strtof(parse, &parsed);
+
+		Benchmark::DoNotOptimize(Sum(loadedPositions.data(), positionCount, loadedTransforms.data(), transformCount));
+	});
+
+	for (bool verify : { false, true })
+	{
+		Benchmark::Run(verify ? "Mapping the asset file, verifying checksums" : "Mapping the asset file", 3, floatCount, [&]()
+		{
+			AssetFile file;
+			if (!file.Open(binaryPath) || (verify && !file.Verify()))
+				std::cout << "Failed to open the asset file!" << std::endl;
+
+			ArrayView<Vector3D> mappedPositions = file.View<Vector3D>(positionsId);
+			ArrayView<Matrix3x3> mappedTransforms = file.View<Matrix3x3>(transformsId);
+			Benchmark::DoNotOptimize(Sum(mappedPositions.data, mappedPositions.count, mappedTransforms.data, mappedTransforms.count));
+		});
+	}
+
+	std::remove(binaryPath);
+	std::remove(textPath);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/// <summary>
+/// A tiny timing helper for the sandbox benchmarks. Build the sandbox in release to get meaningful numbers.
+/// </summary>
+namespace Benchmark
+{
+	/// <summary>
+	/// Keeps the compiler from optimizing away the computation of value.
+	/// </summary>
+	template<class T>
+	inline void DoNotOptimize(const T& value)
+	{
+		static volatile char sink;
+		sink = *reinterpret_cast<const volatile char*>(&value);
+	}
+
+	/// <summary>
+	/// Runs test iterations times (after one warm up run) and prints the average time it took for a single item, where every run processes itemsPerRun items.
+	/// </summary>
+	/// <returns>The average time for a single item in nanoseconds.</returns>
+	template<class TTest>
+	inline double Run(const std::string& name, int iterations, size_t itemsPerRun, const TTest& test)
+	{
+		test();
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+			test();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / ((double)iterations * itemsPerRun);
+		std::cout << name << ": " << nanoseconds << " ns per item" << std::endl;
+		return nanoseconds;
+	}
+}
\ No newline at end of file
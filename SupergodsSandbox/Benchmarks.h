@@ -0,0 +1,96 @@
+#pragma once
+
+/// <summary>
+/// Compares the double precision (large world) path with the float path.
+/// </summary>
+void RunLargeWorldBenchmark();
+
+/// <summary>
+/// Compares the table based sRGB conversions with the exact pow based ones.
+/// </summary>
+void RunColorSpaceBenchmark();
+
+/// <summary>
+/// Measures the throughput of the blend modes, single colors versus the bulk kernels.
+/// </summary>
+void RunBlendingBenchmark();
+
+/// <summary>
+/// Compares evaluating gradients and animation curves from their keys with evaluating baked tables, and measures path following on splines.
+/// </summary>
+void RunCurveBenchmark();
+
+/// <summary>
+/// Compares blending animation poses with Lerp on every value with the batched Lerper::LerpN, and the single and batched angle functions on unit headings.
+/// </summary>
+void RunLerpBenchmark();
+
+/// <summary>
+/// Compares normalizing, sin/cos and atan2 on float vectors and angles with the deterministic fixed-point types.
+/// </summary>
+void RunFixedPointBenchmark();
+
+/// <summary>
+/// Compares the standard library math functions with the deterministic SMath::Deterministic versions.
+/// </summary>
+void RunDeterministicMathBenchmark();
+
+/// <summary>
+/// Compares a particle step on an array of structures with the particle stream kernels, single threaded and multithreaded, and measures the integrators.
+/// </summary>
+void RunParticleBenchmark();
+
+/// <summary>
+/// Measures the rigid body world step on resting stacks of boxes with 1k and 10k bodies, single threaded and multithreaded.
+/// </summary>
+void RunRigidBodyBenchmark();
+
+/// <summary>
+/// Compares sorting and sweeping moving boxes from scratch with the incremental SweepAndPrune and with MultiBoxPruning.
+/// </summary>
+void RunBroadphaseBenchmark();
+
+/// <summary>
+/// Compares cold and warm started GJK distance and penetration queries on turning boxes, and in 2D.
+/// </summary>
+void RunGjkBenchmark();
+
+/// <summary>
+/// Compares sweeping projectiles against every triangle of a mesh with the batched SweepMesh, and times conservative advancement of fast turning boxes.
+/// </summary>
+void RunSweepBenchmark();
+
+/// <summary>
+/// Times every step of MeshOptimizer on a shuffled sphere, and prints the average cache miss ratio after each of them.
+/// </summary>
+void RunMeshBenchmark();
+
+/// <summary>
+/// Times computing the normals and tangents of a million triangle sphere, single threaded and multithreaded, against adding every triangle's normal to its vertices.
+/// </summary>
+void RunTangentSpaceBenchmark();
+
+/// <summary>
+/// Times generating a chain of levels of detail for a bumpy sphere and prints their triangles and errors, and times simplifying a batch of meshes single threaded and multithreaded.
+/// </summary>
+void RunMeshSimplifierBenchmark();
+
+/// <summary>
+/// Compares loading a million positions and their transforms by mapping an asset file, with and without verifying its checksums, against parsing them from text.
+/// </summary>
+void RunAssetBenchmark();
+
+/// <summary>
+/// Compares formatting and parsing floats with Text::ToChars and Text::FromChars against snprintf and strtof, and times parsing a text of Vector3Ds.
+/// </summary>
+void RunTextBenchmark();
+
+/// <summary>
+/// Times quantizing, encoding and decoding a snapshot of entities whole and as a delta from the previous one, and prints how many bytes every entity takes.
+/// </summary>
+void RunNetworkBenchmark();
+
+/// <summary>
+/// Compares multiplying row vectors by matrices, reading columns and multiplying matrices in place against going through transposes and copied columns.
+/// </summary>
+void RunMatrixBenchmark();
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+using ColorBlending::BlendMode;
+
+void RunBlendingBenchmark()
+{
+	const size_t count = 1920 * 1080;
+	const int iterations = 20;
+
+	std::vector<BColor> source(count), destination(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		source[i] = BColor((byte)i, (byte)(i >> 3), (byte)(i >> 6), (byte)(i >> 9));
+		destination[i] = BColor((byte)(i >> 2), (byte)(i >> 4), (byte)i, 255);
+	}
+
+	std::cout << "--- Blending (" << count << " pixels) ---" << std::endl;
+
+	const std::pair<const char*, BlendMode> modes[] =
+	{
+		{ "Over", BlendMode::Over },
+		{ "PremultipliedOver", BlendMode::PremultipliedOver },
+		{ "Additive", BlendMode::Additive },
+		{ "PremultipliedAdditive", BlendMode::PremultipliedAdditive },
+		{ "Multiply", BlendMode::Multiply },
+		{ "Screen", BlendMode::Screen },
+	};
+
+	for (const auto& mode : modes)
+	{
+		double scalar = Benchmark::Run(std::string(mode.first) + " (single colors)", iterations, count, [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+				destination[i] = ColorBlending::Blend(mode.second, source[i], destination[i]);
+			Benchmark::DoNotOptimize(destination[count - 1]);
+		});
+
+		double bulk = Benchmark::Run(std::string(mode.first) + " (bulk)", iterations, count, [&]()
+		{
+			ColorBlending::Blend(mode.second, source.data(), destination.data(), count);
+			Benchmark::DoNotOptimize(destination[count - 1]);
+		});
+
+		std::cout << "    " << 1000 / scalar << " vs " << 1000 / bulk << " megapixels per second" << std::endl;
+	}
+}
\ No newline at end of file
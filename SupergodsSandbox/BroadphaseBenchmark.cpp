@@ -0,0 +1,68 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Physics;
+
+void RunBroadphaseBenchmark()
+{
+	const float worldSize = 500;
+	const int iterations = 20;
+	std::cout << "--- Broadphase (moving boxes) ---" << std::endl;
+
+	for (size_t count : { 10000u, 100000u })
+	{
+		// Boxes on a loose grid, each moving slowly in its own direction like objects between two frames.
+		std::vector<BoundingBox> boxes(count);
+		std::vector<Vector3D> velocities(count);
+		uint side = (uint)SMath::Sqrt((float)count);
+		float spacing = worldSize * 2 / side;
+		for (size_t i = 0; i < count; i++)
+		{
+			Vector3D center(-worldSize + (i % side) * spacing, (float)(i % 3), -worldSize + (i / side) * spacing);
+			boxes[i] = BoundingBox::FromCenter(center, Vector3D(1, 1, 1) * (spacing * .4f + (i % 5) * .2f));
+			velocities[i] = Vector3D((float)(i % 7) - 3, 0, (float)(i % 11) - 5) * .01f;
+		}
+
+		auto move = [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				boxes[i].min += velocities[i];
+				boxes[i].max += velocities[i];
+			}
+		};
+
+		std::string suffix = " (" + std::to_string(count) + " boxes)";
+		std::vector<OverlapPair> pairs;
+		std::vector<uint> order;
+		Benchmark::Run("Sort and sweep from scratch" + suffix, iterations, count, [&]()
+		{
+			move();
+			Broadphase::FindOverlaps(boxes.data(), count, pairs, order);
+			Benchmark::DoNotOptimize(pairs.size());
+		});
+
+		SweepAndPrune sweep;
+		sweep.Update(boxes.data(), count);
+		Benchmark::Run("Incremental sweep and prune" + suffix, iterations, count, [&]()
+		{
+			move();
+			sweep.Update(boxes.data(), count);
+			Benchmark::DoNotOptimize(sweep.GetPairs().size());
+		});
+
+		MultiBoxPruning pruning(BoundingBox(Vector3D(-worldSize, -10, -worldSize), Vector3D(worldSize, 10, worldSize)), 8, 8);
+		pruning.Update(boxes.data(), count);
+		Benchmark::Run("Multi box pruning, 8x8 regions" + suffix, iterations, count, [&]()
+		{
+			move();
+			pruning.Update(boxes.data(), count);
+			Benchmark::DoNotOptimize(pruning.GetPairs().size());
+		});
+		std::cout << "    " << sweep.GetPairs().size() << " pairs" << std::endl;
+	}
+}
\ No newline at end of file
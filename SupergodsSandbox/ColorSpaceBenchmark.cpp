@@ -0,0 +1,59 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+
+void RunColorSpaceBenchmark()
+{
+	const size_t count = 1024 * 1024;
+	const int iterations = 20;
+
+	std::vector<BColor> srgb(count);
+	std::vector<FColor> linear(count);
+	for (size_t i = 0; i < count; i++)
+		srgb[i] = BColor((byte)i, (byte)(i >> 8), (byte)(i >> 16), (byte)(i * 7));
+
+	std::cout << "--- sRGB conversion (" << count << " pixels) ---" << std::endl;
+
+	Benchmark::Run("Decode with pow", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			linear[i] = ColorSpace::SrgbToLinear((FColor)srgb[i]);
+		Benchmark::DoNotOptimize(linear[count - 1]);
+	});
+
+	Benchmark::Run("Decode with table", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			linear[i] = ColorSpace::DecodeSrgb(srgb[i]);
+		Benchmark::DoNotOptimize(linear[count - 1]);
+	});
+
+	Benchmark::Run("Decode with table (bulk)", iterations, count, [&]()
+	{
+		ColorSpace::DecodeSrgb(srgb.data(), linear.data(), count);
+		Benchmark::DoNotOptimize(linear[count - 1]);
+	});
+
+	Benchmark::Run("Encode with pow", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			srgb[i] = (BColor)ColorSpace::LinearToSrgb(linear[i]);
+		Benchmark::DoNotOptimize(srgb[count - 1]);
+	});
+
+	Benchmark::Run("Encode with table", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			srgb[i] = ColorSpace::EncodeSrgb(linear[i]);
+		Benchmark::DoNotOptimize(srgb[count - 1]);
+	});
+
+	Benchmark::Run("Encode with table (bulk)", iterations, count, [&]()
+	{
+		ColorSpace::EncodeSrgb(linear.data(), srgb.data(), count);
+		Benchmark::DoNotOptimize(srgb[count - 1]);
+	});
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+
+void RunCurveBenchmark()
+{
+	const size_t count = 500000;
+	const int iterations = 20;
+
+	std::vector<float> ages(count), sizes(count);
+	std::vector<FColor> colors(count);
+	for (size_t i = 0; i < count; i++)
+		ages[i] = (float)((i * 7919) % count) / count;
+
+	GradientStop stops[] = { GradientStop(0, FColor::Yellow()), GradientStop(.3f, FColor::Orange()), GradientStop(.6f, FColor::Red()), GradientStop(1, FColor::Clear()) };
+	Gradient gradient(stops, 4);
+	CurveKey keys[] = { CurveKey(0, 0, 0, 4), CurveKey(.2f, 1, 0, 0), CurveKey(.7f, .8f, -1, -1), CurveKey(1, 0, -3, 0) };
+	AnimationCurve curve(keys, 4);
+
+	std::cout << "--- Particle curves (" << count << " particles) ---" << std::endl;
+
+	Benchmark::Run("Gradient (key search)", iterations, count, [&]()
+	{
+		gradient.Evaluate(ages.data(), colors.data(), count);
+		Benchmark::DoNotOptimize(colors[count - 1]);
+	});
+
+	Benchmark::Run("AnimationCurve (key search)", iterations, count, [&]()
+	{
+		curve.Evaluate(ages.data(), sizes.data(), count);
+		Benchmark::DoNotOptimize(sizes[count - 1]);
+	});
+
+	gradient.Bake();
+	curve.Bake();
+
+	Benchmark::Run("Gradient (baked, batched)", iterations, count, [&]()
+	{
+		gradient.Evaluate(ages.data(), colors.data(), count);
+		Benchmark::DoNotOptimize(colors[count - 1]);
+	});
+
+	Benchmark::Run("AnimationCurve (baked, batched)", iterations, count, [&]()
+	{
+		curve.Evaluate(ages.data(), sizes.data(), count);
+		Benchmark::DoNotOptimize(sizes[count - 1]);
+	});
+
+	const size_t agents = 10000;
+	std::vector<Vector3D> path(64);
+	for (size_t i = 0; i < path.size(); i++)
+		path[i] = Vector3D((float)i * 4, (float)(i % 5), (float)((i * 13) % 7));
+
+	Spline<Vector3D> rail(SplineType::CatmullRom, path.data(), path.size());
+	rail.BuildArcLengthTable();
+
+	std::vector<float> distances(agents);
+	std::vector<Vector3D> positions(agents);
+	for (size_t i = 0; i < agents; i++)
+		distances[i] = rail.Length() * i / agents;
+
+	std::cout << "--- Spline path following (" << agents << " agents) ---" << std::endl;
+
+	Benchmark::Run("Spline::EvaluateAtDistance (single)", iterations, agents, [&]()
+	{
+		for (size_t i = 0; i < agents; i++)
+			positions[i] = rail.EvaluateAtDistance(distances[i]);
+		Benchmark::DoNotOptimize(positions[agents - 1]);
+	});
+
+	Benchmark::Run("Spline::EvaluateAtDistance (batched)", iterations, agents, [&]()
+	{
+		rail.EvaluateAtDistance(distances.data(), positions.data(), agents);
+		Benchmark::DoNotOptimize(positions[agents - 1]);
+	});
+}
\ No newline at end of file
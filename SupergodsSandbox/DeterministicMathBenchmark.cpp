@@ -0,0 +1,62 @@
+#include <vector>
+#include <cmath>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+
+void RunDeterministicMathBenchmark()
+{
+	const size_t count = 1000000;
+	const int iterations = 20;
+
+	std::vector<float> angles(count), units(count), positives(count), results(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		angles[i] = (i % 20000) * .01f - 100;
+		units[i] = (i % 2001) / 1000.f - 1;
+		positives[i] = (i % 10000) * .01f + .001f;
+	}
+
+	std::cout << "--- Deterministic math (" << count << " values) ---" << std::endl;
+
+	// Compares a standard library function with its deterministic version on the same inputs.
+	auto compare = [&](const char* name, const std::vector<float>& inputs, float(*standard)(float), float(*deterministic)(float))
+	{
+		Benchmark::Run(std::string(name) + " (standard library)", iterations, count, [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+				results[i] = standard(inputs[i]);
+			Benchmark::DoNotOptimize(results[count - 1]);
+		});
+
+		Benchmark::Run(std::string(name) + " (deterministic)", iterations, count, [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+				results[i] = deterministic(inputs[i]);
+			Benchmark::DoNotOptimize(results[count - 1]);
+		});
+	};
+
+	compare("sin", angles, [](float x) { return std::sin(x); }, SMath::Deterministic::Sin);
+	compare("cos", angles, [](float x) { return std::cos(x); }, SMath::Deterministic::Cos);
+	compare("tan", angles, [](float x) { return std::tan(x); }, SMath::Deterministic::Tan);
+	compare("acos", units, [](float x) { return std::acos(x); }, SMath::Deterministic::Acos);
+	compare("atan", angles, [](float x) { return std::atan(x); }, SMath::Deterministic::Atan);
+	compare("exp", units, [](float x) { return std::exp(x * 50); }, [](float x) { return SMath::Deterministic::Exp(x * 50); });
+	compare("log", positives, [](float x) { return std::log(x); }, SMath::Deterministic::Log);
+	compare("pow", positives, [](float x) { return std::pow(x, 2.4f); }, [](float x) { return SMath::Deterministic::Pow(x, 2.4f); });
+	compare("sqrt", positives, [](float x) { return std::sqrt(x); }, SMath::Deterministic::Sqrt);
+
+	std::vector<Vector3D> vectors(count), normalized(count);
+	for (size_t i = 0; i < count; i++)
+		vectors[i] = Vector3D(angles[i], units[i], positives[i]);
+
+	Benchmark::Run("Vector3D::Normalized", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			normalized[i] = vectors[i].Normalized();
+		Benchmark::DoNotOptimize(normalized[count - 1]);
+	});
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+
+void RunFixedPointBenchmark()
+{
+	// A lockstep steering step: normalize the direction to the target, then turn it into a heading and back.
+	const size_t units = 100000;
+	const int iterations = 50;
+
+	std::vector<Vector2D> offsets(units), directions(units);
+	std::vector<FixedVector2D> fixedOffsets(units), fixedDirections(units);
+	std::vector<Angle> headings(units);
+	std::vector<FixedAngle> fixedHeadings(units);
+	for (size_t i = 0; i < units; i++)
+	{
+		offsets[i] = Vector2D((float)(i % 101) - 50, (float)(i % 37) - 18.5f);
+		fixedOffsets[i] = FixedVector2D(offsets[i]);
+		headings[i] = Angle(i * .01f);
+		fixedHeadings[i] = FixedAngle(headings[i]);
+	}
+
+	std::cout << "--- Deterministic steering (" << units << " units) ---" << std::endl;
+
+	Benchmark::Run("Vector2D::Normalized", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			directions[i] = offsets[i].Normalized();
+		Benchmark::DoNotOptimize(directions[units - 1]);
+	});
+
+	Benchmark::Run("FixedVector2D::Normalized", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			fixedDirections[i] = fixedOffsets[i].Normalized();
+		Benchmark::DoNotOptimize(fixedDirections[units - 1]);
+	});
+
+	Benchmark::Run("sin/cos (float)", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			directions[i] = Vector2D(SMath::Cos(headings[i].GetRadians()), SMath::Sin(headings[i].GetRadians()));
+		Benchmark::DoNotOptimize(directions[units - 1]);
+	});
+
+	Benchmark::Run("FixedVector2D::FromAngle", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			fixedDirections[i] = FixedVector2D::FromAngle(fixedHeadings[i]);
+		Benchmark::DoNotOptimize(fixedDirections[units - 1]);
+	});
+
+	Benchmark::Run("atan2 (float)", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			headings[i] = Angle(SMath::Atan2(offsets[i].y, offsets[i].x));
+		Benchmark::DoNotOptimize(headings[units - 1]);
+	});
+
+	Benchmark::Run("FixedAngle::Atan2", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			fixedHeadings[i] = fixedOffsets[i].Direction();
+		Benchmark::DoNotOptimize(fixedHeadings[units - 1]);
+	});
+}
\ No newline at end of file
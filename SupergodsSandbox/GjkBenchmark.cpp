@@ -0,0 +1,94 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Physics;
+
+void RunGjkBenchmark()
+{
+	const size_t count = 1000;
+	const int frames = 100;
+	std::cout << "--- GJK (" << count << " pairs of turning boxes over " << frames << " frames) ---" << std::endl;
+
+	// Pairs of boxes close to each other that turn a little every frame, like bodies in a world.
+	std::vector<RigidBody> bodies;
+	for (size_t i = 0; i < count; i++)
+	{
+		Vector3D size(.5f + i % 3 * .25f, .5f + i % 5 * .2f, .5f + i % 7 * .1f);
+		bodies.push_back(RigidBody(Shape::Box(size), Vector3D::Zero(), Quaternion::Identity(), 1));
+		bodies.push_back(RigidBody(Shape::Box(size.Abs()), Vector3D(2.5f + i % 4 * .5f, i % 3 * .3f, 0), Quaternion::Identity(), 1));
+	}
+
+	auto turn = [&](int frame)
+	{
+		for (size_t i = 0; i < bodies.size(); i++)
+			bodies[i].orientation = Quaternion::FromAxisAngle(Vector3D((float)(i % 3), 1, (float)(i % 2)).Normalized(), frame * .01f * (1 + i % 4));
+	};
+
+	for (bool penetration : { false, true })
+	{
+		// Pushing the second body in makes most pairs overlap, which runs EPA.
+		for (size_t i = 0; i < count; i++)
+			bodies[i * 2 + 1].position.x = penetration ? 1.2f + i % 4 * .2f : 2.5f + i % 4 * .5f;
+
+		const char* query = penetration ? "Penetration" : "Distance";
+		for (bool warm : { false, true })
+		{
+			std::vector<GjkCache> caches(count);
+			long long iterations = 0;
+			float checksum = 0;
+			Benchmark::Run(std::string(query) + (warm ? ", warm started" : ", cold"), 1, count * frames, [&]()
+			{
+				for (int frame = 0; frame < frames; frame++)
+				{
+					turn(frame);
+					for (size_t i = 0; i < count; i++)
+					{
+						SupportMapping a = SupportMapping::OfBody(bodies[i * 2]);
+						SupportMapping b = SupportMapping::OfBody(bodies[i * 2 + 1]);
+						GjkCache* cache = warm ? &caches[i] : nullptr;
+						GjkResult result = penetration ? Gjk::Penetration(a, b, cache) : Gjk::Distance(a, b, cache);
+						iterations += result.iterations;
+						checksum += result.distance + result.depth;
+					}
+				}
+				Benchmark::DoNotOptimize(checksum);
+			});
+			std::cout << "    " << (double)iterations / (count * frames) << " support points per query" << std::endl;
+		}
+	}
+
+	// The same in 2D, with squares sliding past triangles.
+	Vector2D square[] = { Vector2D(-1, -1), Vector2D(1, -1), Vector2D(1, 1), Vector2D(-1, 1) };
+	std::vector<Vector2D> triangles(count * 3);
+	for (bool warm : { false, true })
+	{
+		std::vector<GjkCache2D> caches(count);
+		long long iterations = 0;
+		float checksum = 0;
+		Benchmark::Run(std::string("2D distance") + (warm ? ", warm started" : ", cold"), 1, count * frames, [&]()
+		{
+			for (int frame = 0; frame < frames; frame++)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					float y = frame * .02f - 1 + i % 5 * .1f;
+					triangles[i * 3] = Vector2D(3, y);
+					triangles[i * 3 + 1] = Vector2D(5, y + 2);
+					triangles[i * 3 + 2] = Vector2D(5 + i % 3, y - 2);
+
+					ConvexHull2D a = { square, 4 };
+					ConvexHull2D b = { &triangles[i * 3], 3 };
+					GjkResult2D result = Gjk::Distance(SupportMapping2D::OfPolytope(a), SupportMapping2D::OfPolytope(b), warm ? &caches[i] : nullptr);
+					iterations += result.iterations;
+					checksum += result.distance;
+				}
+			}
+			Benchmark::DoNotOptimize(checksum);
+		});
+		std::cout << "    " << (double)iterations / (count * frames) << " support points per query" << std::endl;
+	}
+}
\ No newline at end of file
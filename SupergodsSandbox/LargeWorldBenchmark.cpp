@@ -0,0 +1,70 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+
+void RunLargeWorldBenchmark()
+{
+	const size_t count = 100000;
+	const int iterations = 200;
+
+	std::vector<Vector3D> floatPositions(count);
+	std::vector<Vector3DDouble> doublePositions(count);
+	std::vector<Vector3D> local(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		floatPositions[i] = Vector3D((float)i, (float)(i % 100), -(float)i);
+		doublePositions[i] = Vector3DDouble(1e7 + i, 1e7 + i % 100, -1e7 - i);
+	}
+
+	Matrix3x3 floatRotation = Matrix3x3::Rotate(Angle(30, Angle::Measurement::Degrees));
+	Matrix3x3Double doubleRotation(floatRotation);
+
+	std::cout << "--- Large world (" << count << " positions) ---" << std::endl;
+
+	Benchmark::Run("Matrix3x3 * Vector3D", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			floatPositions[i] = floatRotation * floatPositions[i];
+		Benchmark::DoNotOptimize(floatPositions[count - 1]);
+	});
+
+	Benchmark::Run("Matrix3x3Double * Vector3DDouble", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			doublePositions[i] = doubleRotation * doublePositions[i];
+		Benchmark::DoNotOptimize(doublePositions[count - 1]);
+	});
+
+	FloatingOrigin floatingOrigin(doublePositions[0]);
+	Benchmark::Run("FloatingOrigin::ToLocal (scalar)", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			local[i] = floatingOrigin.ToLocal(doublePositions[i]);
+		Benchmark::DoNotOptimize(local[count - 1]);
+	});
+
+	Benchmark::Run("FloatingOrigin::ToLocal (batch)", iterations, count, [&]()
+	{
+		floatingOrigin.ToLocal(doublePositions.data(), local.data(), count);
+		Benchmark::DoNotOptimize(local[count - 1]);
+	});
+
+	Vector3D floatShift(1.5f, -2.25f, 3);
+	Benchmark::Run("Float rebase (Vector3D + Vector3D)", iterations, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			floatPositions[i] += floatShift;
+		Benchmark::DoNotOptimize(floatPositions[count - 1]);
+	});
+
+	Vector3DDouble newOrigin = floatingOrigin.origin;
+	Benchmark::Run("FloatingOrigin::Rebase (batch, double precision)", iterations, count, [&]()
+	{
+		newOrigin = newOrigin + Vector3DDouble(1.5, -2.25, 3);
+		floatingOrigin.Rebase(newOrigin, floatPositions.data(), count);
+		Benchmark::DoNotOptimize(floatPositions[count - 1]);
+	});
+}
\ No newline at end of file
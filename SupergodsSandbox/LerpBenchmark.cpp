@@ -0,0 +1,107 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore::Math;
+
+void RunLerpBenchmark()
+{
+	// Blending two animation poses: a position and a scale per bone, for many skeletons.
+	const size_t bones = 256 * 1024;
+	const int iterations = 50;
+
+	std::vector<Vector3D> posePositions(bones), targetPositions(bones), positions(bones);
+	std::vector<Vector4D> poseScales(bones), targetScales(bones), scales(bones);
+	std::vector<float> weights(bones);
+	for (size_t i = 0; i < bones; i++)
+	{
+		posePositions[i] = Vector3D((float)i, (float)(i % 7), (float)(i % 13));
+		targetPositions[i] = Vector3D((float)(i % 5), (float)i, (float)(i % 3));
+		poseScales[i] = Vector4D(1, (float)(i % 3), 2, 1);
+		targetScales[i] = Vector4D((float)(i % 11), 1, 1, 0);
+		weights[i] = (i % 100) / 100.f;
+	}
+
+	std::cout << "--- Pose blending (" << bones << " bones) ---" << std::endl;
+
+	Benchmark::Run("Vector3D::Lerp", iterations, bones, [&]()
+	{
+		for (size_t i = 0; i < bones; i++)
+			positions[i] = posePositions[i].Lerp(targetPositions[i], weights[i]);
+		Benchmark::DoNotOptimize(positions[bones - 1]);
+	});
+
+	Benchmark::Run("Lerper::LerpN (Vector3D)", iterations, bones, [&]()
+	{
+		Lerper::LerpN(posePositions.data(), targetPositions.data(), weights.data(), positions.data(), bones);
+		Benchmark::DoNotOptimize(positions[bones - 1]);
+	});
+
+	Benchmark::Run("Vector4D::Lerp", iterations, bones, [&]()
+	{
+		for (size_t i = 0; i < bones; i++)
+			scales[i] = poseScales[i].Lerp(targetScales[i], weights[i]);
+		Benchmark::DoNotOptimize(scales[bones - 1]);
+	});
+
+	Benchmark::Run("Lerper::LerpN (Vector4D)", iterations, bones, [&]()
+	{
+		Lerper::LerpN(poseScales.data(), targetScales.data(), weights.data(), scales.data(), bones);
+		Benchmark::DoNotOptimize(scales[bones - 1]);
+	});
+
+	Benchmark::Run("Lerper::LerpN (Vector4D, one alpha)", iterations, bones, [&]()
+	{
+		Lerper::LerpN(poseScales.data(), targetScales.data(), .3f, scales.data(), bones);
+		Benchmark::DoNotOptimize(scales[bones - 1]);
+	});
+
+	// Steering units: turn the headings, then get their directions.
+	const size_t units = 100000;
+	std::vector<Angle> headings(units), targetHeadings(units);
+	std::vector<float> turns(units), sines(units), cosines(units);
+	for (size_t i = 0; i < units; i++)
+	{
+		headings[i] = Angle((float)i);
+		targetHeadings[i] = Angle(i * .37f);
+		turns[i] = (i % 17) * .01f - .08f;
+	}
+
+	std::cout << "--- Unit headings (" << units << " units) ---" << std::endl;
+
+	Benchmark::Run("Angle::LerpShortest (single)", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+			headings[i] = headings[i].LerpShortest(targetHeadings[i], .1f);
+		Benchmark::DoNotOptimize(headings[units - 1]);
+	});
+
+	Benchmark::Run("Angle::LerpShortest (batched)", iterations, units, [&]()
+	{
+		Angle::LerpShortest(headings.data(), targetHeadings.data(), weights.data(), headings.data(), units);
+		Benchmark::DoNotOptimize(headings[units - 1]);
+	});
+
+	Benchmark::Run("Angle::Add (batched)", iterations, units, [&]()
+	{
+		Angle::Add(headings.data(), turns.data(), headings.data(), units);
+		Benchmark::DoNotOptimize(headings[units - 1]);
+	});
+
+	Benchmark::Run("SMath::Sin and SMath::Cos", iterations, units, [&]()
+	{
+		for (size_t i = 0; i < units; i++)
+		{
+			sines[i] = SMath::Sin(headings[i]);
+			cosines[i] = SMath::Cos(headings[i]);
+		}
+		Benchmark::DoNotOptimize(cosines[units - 1]);
+	});
+
+	Benchmark::Run("Angle::SinCos (batched)", iterations, units, [&]()
+	{
+		Angle::SinCos(headings.data(), sines.data(), cosines.data(), units);
+		Benchmark::DoNotOptimize(cosines[units - 1]);
+	});
+}
\ No newline at end of file
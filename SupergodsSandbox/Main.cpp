@@ -1,5 +1,6 @@
 #include <iostream>
 #include <SupergodCore.h>
+#include "Benchmarks.h"
 
 #define PRINT(thing) cout << thing << endl
 
@@ -11,5 +12,25 @@ using namespace SupergodCore;
 void main()
 {
 	Math::Vector3D test = Math::Vector3D::UnitX();
+
+	RunLargeWorldBenchmark();
+	RunColorSpaceBenchmark();
+	RunBlendingBenchmark();
+	RunCurveBenchmark();
+	RunLerpBenchmark();
+	RunFixedPointBenchmark();
+	RunDeterministicMathBenchmark();
+	RunParticleBenchmark();
+	RunRigidBodyBenchmark();
+	RunBroadphaseBenchmark();
+	RunGjkBenchmark();
+	RunSweepBenchmark();
+	RunMeshBenchmark();
+	RunTangentSpaceBenchmark();
+	RunMeshSimplifierBenchmark();
+	RunAssetBenchmark();
+	RunTextBenchmark();
+	RunNetworkBenchmark();
+	RunMatrixBenchmark();
 	cin.get();
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <cstdlib>
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+
+static float RandomElement()
+{
+	return std::rand() * 2.f / RAND_MAX - 1;
+}
+
+void RunMatrixBenchmark()
+{
+	const size_t count = 1000000;
+	std::cout << "--- Matrices (" << count << " 3x3 matrices, per matrix) ---" << std::endl;
+
+	std::vector<Matrix3x3> matrices(count);
+	std::vector<Vector3D> vectors(count), results(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		matrices[i] = Matrix3x3(RandomElement(), RandomElement(), RandomElement(), RandomElement(), RandomElement(), RandomElement(), RandomElement(), RandomElement(), RandomElement());
+		vectors[i] = Vector3D(RandomElement(), RandomElement(), RandomElement());
+	}
+
+	Benchmark::Run("Row vector times matrix, through a transpose", 10, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			results[i] = matrices[i].Transposed().Multiply(vectors[i]);
+		Benchmark::DoNotOptimize(results.data());
+	});
+
+	Benchmark::Run("Row vector times matrix, in place", 10, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			results[i] = vectors[i] * matrices[i];
+		Benchmark::DoNotOptimize(results.data());
+	});
+
+	Benchmark::Run("Column dot products, copying columns", 10, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			results[i] = Vector3D(matrices[i].GetColumn(0).Dot(vectors[i]), matrices[i].GetColumn(1).Dot(vectors[i]), matrices[i].GetColumn(2).Dot(vectors[i]));
+		Benchmark::DoNotOptimize(results.data());
+	});
+
+	Benchmark::Run("Column dot products, through column views", 10, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			results[i] = Vector3D(matrices[i].GetColumnView(0).Dot(vectors[i]), matrices[i].GetColumnView(1).Dot(vectors[i]), matrices[i].GetColumnView(2).Dot(vectors[i]));
+		Benchmark::DoNotOptimize(results.data());
+	});
+
+	std::vector<Matrix3x3> products(count);
+	Benchmark::Run("Products from copied rows and columns", 10, count - 1, [&]()
+	{
+		for (size_t i = 0; i + 1 < count; i++)
+		{
+			Matrix3x3& product = products[i];
+			for (int row = 0; row < 3; row++)
+			{
+				for (int column = 0; column < 3; column++)
+					product(row, column) = matrices[i].GetRow(row).Dot(matrices[i + 1].GetColumn(column));
+			}
+		}
+		Benchmark::DoNotOptimize(products.data());
+	});
+
+	Benchmark::Run("Products (Matrix3x3::Multiply)", 10, count - 1, [&]()
+	{
+		for (size_t i = 0; i + 1 < count; i++)
+			products[i] = matrices[i].Multiply(matrices[i + 1]);
+		Benchmark::DoNotOptimize(products.data());
+	});
+}
\ No newline at end of file
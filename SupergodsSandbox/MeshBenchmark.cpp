@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Geometry;
+
+/// <summary>
+/// Creates a sphere with unshared vertices for every triangle, in a random order, like meshes from some exporters.
+/// </summary>
+static Mesh ShuffledSphere(int rings, int segments)
+{
+	Mesh sphere = MeshPrimitives::Sphere(rings, segments, true);
+	Mesh mesh;
+	for (uint vertex : sphere.indices)
+		mesh.AddVertex(sphere.positions[vertex], sphere.positions[vertex], sphere.uvs[vertex]);
+
+	std::vector<uint> order(sphere.TriangleCount());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = (uint)i;
+	std::shuffle(order.begin(), order.end(), std::mt19937(1));
+	for (uint triangle : order)
+		mesh.AddTriangle(triangle * 3, triangle * 3 + 1, triangle * 3 + 2);
+	return mesh;
+}
+
+void RunMeshBenchmark()
+{
+	const int rings = 256, segments = 512;
+	std::cout << "--- Mesh optimization (sphere of " << rings * segments * 2 << " triangles) ---" << std::endl;
+
+	Mesh source = ShuffledSphere(rings, segments);
+	auto printCacheMisses = [](const char* name, const Mesh& mesh)
+	{
+		std::cout << "    " << name << ": ACMR " << MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size(), 16) << " (16 vertices), "
+			<< MeshOptimizer::AverageCacheMissRatio(mesh.indices.data(), mesh.indices.size(), 32) << " (32 vertices), " << mesh.VertexCount() << " vertices" << std::endl;
+	};
+	printCacheMisses("Shuffled", source);
+
+	Mesh mesh;
+	Benchmark::Run("Deduplicate", 1, source.VertexCount(), [&]()
+	{
+		mesh = source;
+		MeshOptimizer::Deduplicate(mesh);
+	});
+	printCacheMisses("Deduplicated", mesh);
+
+	Mesh deduplicated = mesh;
+	Benchmark::Run("OptimizeVertexCache", 1, mesh.TriangleCount(), [&]()
+	{
+		mesh.indices = deduplicated.indices;
+		MeshOptimizer::OptimizeVertexCache(mesh);
+	});
+	printCacheMisses("Vertex cache optimized", mesh);
+
+	Mesh cacheOptimized = mesh;
+	Benchmark::Run("OptimizeOverdraw", 1, mesh.TriangleCount(), [&]()
+	{
+		mesh.indices = cacheOptimized.indices;
+		MeshOptimizer::OptimizeOverdraw(mesh);
+	});
+	printCacheMisses("Overdraw optimized", mesh);
+
+	Benchmark::Run("OptimizeVertexFetch", 1, mesh.VertexCount(), [&]()
+	{
+		MeshOptimizer::OptimizeVertexFetch(mesh);
+	});
+	printCacheMisses("Vertex fetch optimized", mesh);
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Geometry;
+
+/// <summary>
+/// Creates a closed sphere of radius 1, bumped a little so collapses have different errors.
+/// </summary>
+static Mesh BumpySphere(int rings, int segments)
+{
+	Mesh mesh = MeshPrimitives::Sphere(rings, segments);
+	for (Vector3D& position : mesh.positions)
+		position = position * (1 + .05f * SMath::Sin(position.y * 11) * SMath::Cos(position.x * 8));
+	return mesh;
+}
+
+void RunMeshSimplifierBenchmark()
+{
+	float ratios[] = { .5f, .25f, .125f, .0625f };
+	const size_t lodCount = sizeof(ratios) / sizeof(float);
+
+	Mesh sphere = BumpySphere(256, 512);
+	std::cout << "--- Mesh simplification (sphere of " << sphere.TriangleCount() << " triangles, " << Parallel::ThreadCount() << " threads) ---" << std::endl;
+
+	std::vector<MeshLod> lods;
+	Benchmark::Run("GenerateLods, 4 levels", 1, sphere.TriangleCount(), [&]()
+	{
+		lods = MeshSimplifier::GenerateLods(sphere, ratios, lodCount);
+		Benchmark::DoNotOptimize(lods.data());
+	});
+	for (size_t lod = 0; lod < lodCount; lod++)
+		std::cout << "Level " << lod + 1 << ": " << lods[lod].indices.size() / 3 << " triangles, error " << lods[lod].error << std::endl;
+
+	// Importing a level of many small meshes, one mesh on every thread.
+	std::vector<Mesh> meshes(32, BumpySphere(48, 96));
+	std::vector<std::vector<MeshLod>> meshLods(meshes.size());
+	for (bool multithreaded : { false, true })
+	{
+		Benchmark::Run(multithreaded ? "GenerateLods of 32 meshes, multithreaded" : "GenerateLods of 32 meshes, single threaded", 1, meshes.size() * meshes[0].TriangleCount(), [&]()
+		{
+			MeshSimplifier::GenerateLods(meshes.data(), meshes.size(), ratios, lodCount, meshLods.data(), multithreaded);
+			Benchmark::DoNotOptimize(meshLods.data());
+		});
+	}
+}
\ No newline at end of file
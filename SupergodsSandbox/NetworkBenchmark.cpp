@@ -0,0 +1,91 @@
+#include <cstdlib>
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Network;
+
+static float RandomFloat(float min, float max)
+{
+	return min + std::rand() * (max - min) / RAND_MAX;
+}
+
+void RunNetworkBenchmark()
+{
+	const size_t count = 10000;
+	std::cout << "--- Network snapshots (" << count << " entities, per entity) ---" << std::endl;
+
+	SnapshotCodec codec(SnapshotSettings(Vector3D(-2000, -200, -2000), Vector3D(2000, 200, 2000)));
+	std::vector<Vector3D> positions(count);
+	std::vector<Quaternion> rotations(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		positions[i] = Vector3D(RandomFloat(-2000, 2000), RandomFloat(-200, 200), RandomFloat(-2000, 2000));
+		rotations[i] = Quaternion::FromAxisAngle(Vector3D::UnitY(), RandomFloat(-3, 3));
+	}
+
+	QuantizedSnapshot baseline, snapshot;
+	codec.Quantize(positions.data(), rotations.data(), count, baseline);
+
+	// A tick later, a quarter of the entities walked and turned a little.
+	for (size_t i = 0; i < count; i += 4)
+	{
+		positions[i] += Vector3D(RandomFloat(-.2f, .2f), 0, RandomFloat(-.2f, .2f));
+		rotations[i] = (rotations[i] * Quaternion::FromAxisAngle(Vector3D::UnitY(), RandomFloat(-.05f, .05f))).Normalized();
+	}
+
+	Benchmark::Run("Quantizing positions one float at a time, and rotations", 100, count, [&]()
+	{
+		snapshot.positions.resize(count * 3);
+		snapshot.rotations.resize(count);
+		const float* source = &positions[0].x;
+		Quantization axes[] =
+		{
+			Quantization(-2000, 2000, codec.GetSettings().positionBits),
+			Quantization(-200, 200, codec.GetSettings().positionBits),
+			Quantization(-2000, 2000, codec.GetSettings().positionBits)
+		};
+		for (size_t i = 0; i < count * 3; i++)
+			snapshot.positions[i] = axes[i % 3].Quantize(source[i]);
+		for (size_t i = 0; i < count; i++)
+			snapshot.rotations[i] = SmallestThree::Pack(rotations[i], codec.GetSettings().rotationBits);
+		Benchmark::DoNotOptimize(snapshot.rotations.data());
+	});
+
+	Benchmark::Run("Quantizing positions and rotations (SSE2 positions)", 100, count, [&]()
+	{
+		codec.Quantize(positions.data(), rotations.data(), count, snapshot);
+		Benchmark::DoNotOptimize(snapshot.rotations.data());
+	});
+
+	for (bool useBaseline : { false, true })
+	{
+		BitWriter writer;
+		Benchmark::Run(useBaseline ? "Encoding as a delta" : "Encoding whole", 100, count, [&]()
+		{
+			writer.Clear();
+			codec.Encode(snapshot, useBaseline ? &baseline : nullptr, writer);
+			writer.Flush();
+		});
+		std::cout << (useBaseline ? "Delta: " : "Whole: ") << writer.GetBytes().size() / (double)count << " bytes per entity (raw floats are " << sizeof(Vector3D) + sizeof(Quaternion) << ")" << std::endl;
+
+		QuantizedSnapshot decoded;
+		Benchmark::Run(useBaseline ? "Decoding a delta" : "Decoding whole", 100, count, [&]()
+		{
+			BitReader reader(writer.GetBytes().data(), writer.GetBytes().size());
+			if (!codec.Decode(reader, useBaseline ? &baseline : nullptr, decoded) || decoded.rotations != snapshot.rotations)
+				std::cout << "Decoding failed!" << std::endl;
+		});
+	}
+
+	std::vector<Vector3D> dequantizedPositions(count);
+	std::vector<Quaternion> dequantizedRotations(count);
+	Benchmark::Run("Dequantizing positions and rotations (SSE2 positions)", 100, count, [&]()
+	{
+		codec.Dequantize(snapshot, dequantizedPositions.data(), dequantizedRotations.data());
+		Benchmark::DoNotOptimize(dequantizedRotations.data());
+	});
+}
\ No newline at end of file
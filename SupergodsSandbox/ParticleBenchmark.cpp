@@ -0,0 +1,90 @@
+#include <vector>
+#include <cmath>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Physics;
+
+/// <summary>
+/// A particle stored the usual way, as an array of structures.
+/// </summary>
+struct BenchmarkParticle
+{
+	Vector3D position;
+	Vector3D velocity;
+	Vector3D force;
+	float inverseMass;
+};
+
+void RunParticleBenchmark()
+{
+	const size_t count = 1000000;
+	const int iterations = 20;
+	const Vector3D gravity(0, -9.81f, 0);
+	const float linearDrag = .1f, quadraticDrag = .05f, deltaTime = 1 / 60.f;
+
+	std::vector<BenchmarkParticle> structures(count);
+	ParticleBuffer buffer;
+	buffer.Reserve(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		Vector3D position((float)(i % 1000), (float)(i / 1000 % 1000), (float)(i % 7));
+		Vector3D velocity((i % 13) - 6.f, (float)(i % 5), (i % 11) - 5.f);
+		float inverseMass = 1.f / (1 + i % 4);
+		structures[i] = { position, velocity, Vector3D::Zero(), inverseMass };
+		buffer.Add(position, velocity, inverseMass, deltaTime);
+	}
+
+	ParticleStreams particles = buffer.GetStreams();
+	std::cout << "--- Particles (" << count << " particles, " << Parallel::ThreadCount() << " threads) ---" << std::endl;
+
+	// Forces, semi-implicit Euler and a ground plane, which is a whole step of a simple particle system.
+	double structureTime = Benchmark::Run("Step, array of structures", iterations, count, [&]()
+	{
+		for (BenchmarkParticle& particle : structures)
+		{
+			float mass = particle.inverseMass > 0 ? 1 / particle.inverseMass : 0;
+			float drag = linearDrag + quadraticDrag * particle.velocity.Magnitude();
+			particle.force = gravity * mass - particle.velocity * drag;
+			particle.velocity += particle.force * (particle.inverseMass * deltaTime);
+			particle.position += particle.velocity * deltaTime;
+			if (particle.position.y < 0)
+			{
+				particle.position.y = 0;
+				if (particle.velocity.y < 0)
+					particle.velocity = Vector3D(particle.velocity.x * .8f, particle.velocity.y * -.5f, particle.velocity.z * .8f);
+			}
+		}
+		Benchmark::DoNotOptimize(structures[count - 1]);
+	});
+
+	for (bool multithreaded : { false, true })
+	{
+		std::string suffix = multithreaded ? " (multithreaded)" : " (single thread)";
+		double time = Benchmark::Run("Step, particle streams" + suffix, iterations, count, [&]()
+		{
+			Particles::ClearForces(particles, multithreaded);
+			Particles::AddGravity(particles, gravity, multithreaded);
+			Particles::AddDrag(particles, linearDrag, quadraticDrag, multithreaded);
+			Particles::SemiImplicitEuler(particles, deltaTime, multithreaded);
+			Particles::CollidePlane(particles, Vector3D::UnitY(), 0, .5f, .2f, deltaTime, multithreaded);
+			Benchmark::DoNotOptimize(particles.positionY[count - 1]);
+		});
+		std::cout << "    " << 1000 / time << " million particles per second, " << structureTime / time << "x the array of structures" << std::endl;
+
+		Benchmark::Run("Verlet" + suffix, iterations, count, [&]()
+		{
+			Particles::Verlet(particles, deltaTime, multithreaded);
+			Benchmark::DoNotOptimize(particles.positionY[count - 1]);
+		});
+
+		Benchmark::Run("Runge-Kutta 4" + suffix, iterations, count, [&]()
+		{
+			Particles::RungeKutta4(particles, gravity, linearDrag, quadraticDrag, deltaTime, multithreaded);
+			Benchmark::DoNotOptimize(particles.positionY[count - 1]);
+		});
+	}
+}
\ No newline at end of file
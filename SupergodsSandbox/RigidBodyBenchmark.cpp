@@ -0,0 +1,84 @@
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Physics;
+
+/// <summary>
+/// Builds a world with a ground box and stacks of 10 unit boxes on a grid, which never fall asleep so every step does the full work.
+/// </summary>
+static void BuildStacks(PhysicsWorld& world, uint stacks, bool multithreaded)
+{
+	const uint height = 10;
+	const uint rows = (uint)SMath::Sqrt((float)stacks);
+	world.sleepDelay = 1e30f;
+	world.multithreaded = multithreaded;
+	world.AddBody(RigidBody(Shape::Box(Vector3D(rows * 2.f + 10, 1, rows * 2.f + 10)), Vector3D(rows * 1.5f, -1, rows * 1.5f), Quaternion::Identity(), 0));
+	for (uint stack = 0; stack < stacks; stack++)
+	{
+		for (uint level = 0; level < height; level++)
+		{
+			Vector3D position((stack % rows) * 3.f, level + .5f, (stack / rows) * 3.f);
+			world.AddBody(RigidBody(Shape::Box(Vector3D(.5f, .5f, .5f)), position, Quaternion::Identity(), 1));
+		}
+	}
+}
+
+/// <summary>
+/// Builds a world with a ground box and a pyramid of unit boxes with base boxes in its bottom row, which is a single island that never falls asleep.
+/// </summary>
+static void BuildPyramid(PhysicsWorld& world, uint base, bool multithreaded)
+{
+	world.sleepDelay = 1e30f;
+	world.multithreaded = multithreaded;
+	world.AddBody(RigidBody(Shape::Box(Vector3D(base * 2.f, 1, 10)), Vector3D(base * .5f, -1, 0), Quaternion::Identity(), 0));
+	for (uint row = 0; row < base; row++)
+	{
+		for (uint i = 0; i < base - row; i++)
+			world.AddBody(RigidBody(Shape::Box(Vector3D(.5f, .5f, .5f)), Vector3D(i * 1.05f + row * .525f, row + .5f, 0), Quaternion::Identity(), 1));
+	}
+}
+
+/// <summary>
+/// Lets the world settle, so the benchmark measures resting contact rather than the initial impacts, and then times its steps.
+/// </summary>
+static void RunSteps(PhysicsWorld& world, const std::string& scene, int iterations)
+{
+	const float deltaTime = 1 / 60.f;
+	for (int step = 0; step < 30; step++)
+		world.Step(deltaTime);
+
+	size_t bodies = world.BodyCount() - 1;
+	std::string name = "Step, " + std::to_string(bodies) + " " + scene + (world.multithreaded ? " (multithreaded)" : " (single thread)");
+	double time = Benchmark::Run(name, iterations, bodies, [&]()
+	{
+		world.Step(deltaTime);
+		Benchmark::DoNotOptimize(world.GetBody(1).position);
+	});
+	std::cout << "    " << time * bodies / 1000000 << " ms per step, " << world.GetContacts().size() << " manifolds, " << world.AwakeIslandCount() << " islands" << std::endl;
+}
+
+void RunRigidBodyBenchmark()
+{
+	std::cout << "--- Rigid bodies (" << Parallel::ThreadCount() << " threads) ---" << std::endl;
+
+	for (uint stacks : { 100u, 1000u })
+	{
+		for (bool multithreaded : { false, true })
+		{
+			PhysicsWorld world;
+			BuildStacks(world, stacks, multithreaded);
+			RunSteps(world, "boxes in stacks of 10", stacks >= 1000 ? 10 : 60);
+		}
+	}
+
+	// A single island, which the threads can only share by splitting its contacts into colors.
+	for (bool multithreaded : { false, true })
+	{
+		PhysicsWorld world;
+		BuildPyramid(world, 40, multithreaded);
+		RunSteps(world, "boxes in a pyramid", 30);
+	}
+}
\ No newline at end of file
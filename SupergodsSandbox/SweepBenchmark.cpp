@@ -0,0 +1,103 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Physics;
+
+void RunSweepBenchmark()
+{
+	const int size = 32;
+	const size_t count = 10000;
+	std::cout << "--- Sweeps (" << count << " projectiles against " << size * size * 2 << " triangles) ---" << std::endl;
+
+	// Bumpy ground made of a grid of triangles.
+	std::vector<Vector3D> vertices;
+	for (int z = 0; z <= size; z++)
+	{
+		for (int x = 0; x <= size; x++)
+			vertices.push_back(Vector3D((float)x, (x * 7 + z * 13) % 5 * .1f, (float)z));
+	}
+
+	std::vector<uint> indices;
+	for (int z = 0; z < size; z++)
+	{
+		for (int x = 0; x < size; x++)
+		{
+			uint corner = z * (size + 1) + x;
+			uint triangles[] = { corner, corner + 1, corner + size + 1, corner + 1, corner + size + 2, corner + size + 1 };
+			indices.insert(indices.end(), triangles, triangles + 6);
+		}
+	}
+	SweepMesh mesh(vertices.data(), indices.data(), indices.size() / 3);
+
+	// Fast projectiles that move about a tile in a step, most of them falling onto the ground.
+	std::vector<Vector3D> centers, motions;
+	std::vector<float> radii;
+	for (size_t i = 0; i < count; i++)
+	{
+		centers.push_back(Vector3D(i % 997 * size / 997.f, .5f + i % 13 * .1f, i % 991 * size / 991.f));
+		motions.push_back(Vector3D(i % 3 * .5f - .5f, -1.5f, i % 5 * .25f - .5f));
+		radii.push_back(.05f + i % 4 * .05f);
+	}
+
+	std::vector<SweepHit> hits(count);
+	auto countHits = [&]()
+	{
+		size_t hitCount = 0;
+		for (const SweepHit& hit : hits)
+			hitCount += hit.hit;
+		std::cout << "    " << hitCount << " hits" << std::endl;
+	};
+
+	// Every projectile against every triangle.
+	Benchmark::Run("Sphere against every triangle", 1, count, [&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			SweepHit closest = SweepHit::Miss();
+			for (size_t triangle = 0; triangle < indices.size() / 3; triangle++)
+			{
+				SweepHit hit = Sweep::SphereTriangle(centers[i], radii[i], motions[i],
+					vertices[indices[triangle * 3]], vertices[indices[triangle * 3 + 1]], vertices[indices[triangle * 3 + 2]]);
+				if (hit.hit && hit.time < closest.time)
+					closest = hit;
+			}
+			hits[i] = closest;
+		}
+		Benchmark::DoNotOptimize(hits.data());
+	});
+	countHits();
+
+	for (bool multithreaded : { false, true })
+	{
+		Benchmark::Run(multithreaded ? "SweepMesh, multithreaded" : "SweepMesh, single threaded", 5, count, [&]()
+		{
+			mesh.SweepSpheres(centers.data(), radii.data(), motions.data(), count, hits.data(), multithreaded);
+			Benchmark::DoNotOptimize(hits.data());
+		});
+	}
+	countHits();
+
+	// Conservative advancement of fast turning boxes against a wall, which is how bodies that aren't spheres are swept.
+	RigidBody wall(Shape::Box(Vector3D(.05f, 4, 4)), Vector3D::Zero(), Quaternion::Identity(), 0);
+	std::vector<RigidBody> bodies;
+	for (size_t i = 0; i < 1000; i++)
+	{
+		bodies.push_back(RigidBody(Shape::Box(Vector3D(.2f, .1f, .3f)), Vector3D(-3 - i % 7 * .2f, i % 5 * .5f - 1, 0), Quaternion::Identity(), 1));
+		bodies.back().linearVelocity = Vector3D(150 + i % 11 * 20.f, 0, 0);
+		bodies.back().angularVelocity = Vector3D(i % 3 * 5.f, 10, 0);
+	}
+
+	size_t hitCount = 0;
+	Benchmark::Run("Conservative advancement", 5, bodies.size(), [&]()
+	{
+		hitCount = 0;
+		for (const RigidBody& body : bodies)
+			hitCount += Sweep::ConservativeAdvancement(body, wall, 1 / 60.f).hit;
+		Benchmark::DoNotOptimize(hitCount);
+	});
+	std::cout << "    " << hitCount << " hits" << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+using namespace SupergodCore::Geometry;
+
+void RunTangentSpaceBenchmark()
+{
+	const int rings = 512, segments = 1024;
+	std::cout << "--- Normals and tangents (sphere of " << rings * segments * 2 << " triangles, " << Parallel::ThreadCount() << " threads) ---" << std::endl;
+
+	Mesh mesh = MeshPrimitives::Sphere(rings, segments, true);
+
+	// The usual loop that adds every triangle's normal to its vertices and normalizes them after.
+	Benchmark::Run("Normals, adding to vertices", 3, mesh.TriangleCount(), [&]()
+	{
+		mesh.normals.assign(mesh.VertexCount(), Vector3D());
+		for (size_t triangle = 0; triangle < mesh.TriangleCount(); triangle++)
+		{
+			const uint* corners = &mesh.indices[triangle * 3];
+			Vector3D normal = (mesh.positions[corners[1]] - mesh.positions[corners[0]]).Cross(mesh.positions[corners[2]] - mesh.positions[corners[0]]);
+			for (int corner = 0; corner < 3; corner++)
+				mesh.normals[corners[corner]] = mesh.normals[corners[corner]] + normal;
+		}
+		for (Vector3D& normal : mesh.normals)
+			normal = normal.SqrMagnitude() > 0 ? normal.Normalized() : Vector3D::UnitY();
+		Benchmark::DoNotOptimize(mesh.normals.data());
+	});
+
+	for (NormalWeighting weighting : { NormalWeighting::Area, NormalWeighting::Angle })
+	{
+		for (bool multithreaded : { false, true })
+		{
+			std::string name = std::string("ComputeNormals, ") + (weighting == NormalWeighting::Area ? "area" : "angle") + (multithreaded ? ", multithreaded" : ", single threaded");
+			Benchmark::Run(name, 3, mesh.TriangleCount(), [&]()
+			{
+				TangentSpace::ComputeNormals(mesh, weighting, multithreaded);
+				Benchmark::DoNotOptimize(mesh.normals.data());
+			});
+		}
+	}
+
+	for (bool multithreaded : { false, true })
+	{
+		Benchmark::Run(multithreaded ? "ComputeTangents, multithreaded" : "ComputeTangents, single threaded", 3, mesh.TriangleCount(), [&]()
+		{
+			TangentSpace::ComputeTangents(mesh, multithreaded);
+			Benchmark::DoNotOptimize(mesh.tangents.data());
+		});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <SupergodCore.h>
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+using namespace SupergodCore;
+using namespace SupergodCore::Math;
+
+void RunTextBenchmark()
+{
+	// A multiple of 3, so the floats are whole Vector3Ds too.
+	const size_t count = 1200000;
+	std::cout << "--- Text (" << count << " floats, per float) ---" << std::endl;
+
+	std::vector<float> values(count);
+	for (size_t i = 0; i < count; i++)
+		values[i] = (std::rand() - RAND_MAX / 2) * .0137f * std::rand() / RAND_MAX;
+
+	// Room for every float and a separator after it.
+	std::vector<char> text(count * (Text::MAX_FLOAT_CHARS + 1));
+	char* textEnd = nullptr;
+
+	Benchmark::Run("Formatting (snprintf %.9g)", 3, count, [&]()
+	{
+		char* position = text.data();
+		for (size_t i = 0; i < count; i++)
+			position += std::snprintf(position, Text::MAX_FLOAT_CHARS + 2, "%.9g ", values[i]);
+		Benchmark::DoNotOptimize(position);
+	});
+
+	Benchmark::Run("Formatting (Text::ToChars, shortest)", 3, count, [&]()
+	{
+		textEnd = Text::ToChars(text.data(), text.data() + text.size(), values.data(), count);
+		Benchmark::DoNotOptimize(textEnd);
+	});
+	std::cout << "Shortest text: " << (textEnd - text.data()) / (double)count << " characters per float" << std::endl;
+
+	// strtof needs the text null terminated.
+	*textEnd = 0;
+	std::vector<float> parsed(count);
+	Benchmark::Run("Parsing (strtof)", 3, count, [&]()
+	{
+		const char* position = text.data();
+		char* end;
+		for (size_t i = 0; i < count; i++, position = end)
+			parsed[i] = std::strtof(position, &end);
+		Benchmark::DoNotOptimize(parsed[count - 1]);
+	});
+
+	Benchmark::Run("Parsing (Text::FromChars)", 3, count, [&]()
+	{
+		Text::FromChars(text.data(), textEnd, parsed.data(), count);
+		Benchmark::DoNotOptimize(parsed[count - 1]);
+	});
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < count; i++)
+		mismatches += parsed[i] != values[i];
+	std::cout << "Floats that didn't round trip: " << mismatches << std::endl;
+
+	std::vector<Vector3D> vectors;
+	vectors.reserve(count / 3);
+	Benchmark::Run("Parsing into a reserved vector of Vector3Ds", 3, count, [&]()
+	{
+		vectors.clear();
+		if (Text::FromChars(text.data(), textEnd, vectors) == nullptr)
+			std::cout << "Failed to parse the Vector3Ds!" << std::endl;
+		Benchmark::DoNotOptimize(vectors.data());
+	});
+}
\ No newline at end of file